@@ -77,6 +77,7 @@
 
 /* BSP Common Includes (Other than bsp_common.h) */
  #include "../../src/bsp/mcu/all/bsp_delay.h"
+ #include "../../src/bsp/mcu/all/bsp_perf.h"
  #include "../../src/bsp/mcu/all/bsp_mcu_api.h"
 
 #endif
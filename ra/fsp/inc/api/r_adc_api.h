@@ -118,6 +118,7 @@ typedef enum e_adc_event
     ADC_EVENT_WINDOW_COMPARE_A,        ///< Window A comparison condition met
     ADC_EVENT_WINDOW_COMPARE_B,        ///< Window B comparison condition met
     ADC_EVENT_ZERO_CROSS_DETECTION,    ///< Zero-cross detection interrupt
+    ADC_EVENT_STREAM_BLOCK_COMPLETE,   ///< Streaming block filled and ready to be read
 } adc_event_t;
 
 #endif
@@ -77,6 +77,7 @@ typedef enum e_can_event
     CAN_EVENT_ERR_GLOBAL           = 0x1000, ///< Global error has occurred.
     CAN_EVENT_TX_FIFO_EMPTY        = 0x2000, ///< Transmit FIFO is empty.
     CAN_EVENT_FIFO_MESSAGE_LOST    = 0x4000, ///< Receive FIFO overrun.
+    CAN_EVENT_RX_BATCH_READY       = 0x8000, ///< One or more frames were queued to the driver receive ring.
 } can_event_t;
 
 /** CAN Operation modes */
@@ -132,6 +132,13 @@ typedef struct st_ether_callback_args
  */
 typedef void ether_ctrl_t;
 
+/** One buffer of a frame passed to @ref ether_api_t::writeFragments. */
+typedef struct st_ether_tx_fragment
+{
+    void   * p_buffer;                 ///< Start of the fragment data
+    uint32_t length;                   ///< Length of the fragment data in bytes
+} ether_tx_fragment_t;
+
 /** Configuration parameters. */
 typedef struct st_ether_cfg
 {
@@ -239,6 +246,16 @@ typedef struct st_ether_api
      */
     fsp_err_t (* callbackSet)(ether_ctrl_t * const p_ctrl, void (* p_callback)(ether_callback_args_t *),
                               void const * const p_context, ether_callback_args_t * const p_callback_memory);
+
+    /** Write a frame stored in several buffers, using one transmit descriptor per buffer (zero copy only).
+     *
+     * @param[in]  p_ctrl         Pointer to control structure.
+     * @param[in]  p_fragments    Buffers of the frame in transmit order. The first buffer starts with the
+     *                            Ethernet header.
+     * @param[in]  num_fragments  Number of buffers.
+     */
+    fsp_err_t (* writeFragments)(ether_ctrl_t * const p_ctrl, ether_tx_fragment_t const * const p_fragments,
+                                 uint32_t const num_fragments);
 } ether_api_t;
 
 /** This structure encompasses everything that is needed to use an instance of this interface. */
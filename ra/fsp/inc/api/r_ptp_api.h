@@ -267,6 +267,7 @@ typedef enum e_ptp_event
     PTP_EVENT_MESSAGE_TRANSMIT_COMPLETE    = 0x13, ///< A PTP message has been transmitted.
     PTP_EVENT_PULSE_TIMER_MINT_RISING_EDGE = 0x14, ///< A rising edge occurred on a pulse timer channel.
     PTP_EVENT_PULSE_TIMER_IPLS_COMMON      = 0x15, ///< A rising or falling edge occurred on any pulse timer channel.
+    PTP_EVENT_SERVO_UPDATED                = 0x16, ///< The software clock servo processed a new offsetFromMaster sample.
 } ptp_event_t;
 
 /** The Ethernet PHY interface type. */
@@ -441,15 +442,77 @@ typedef struct PTP_PACKED st_ptp_message
     };
 } ptp_message_t;
 
+/** State of the software clock servo. */
+typedef enum e_ptp_servo_state
+{
+    PTP_SERVO_STATE_UNLOCKED,          ///< No sample has been processed since the servo was reset.
+    PTP_SERVO_STATE_LOCKING,           ///< The servo is slewing the local clock towards the master clock.
+    PTP_SERVO_STATE_LOCKED,            ///< The offset has been within the lock threshold for the configured number of samples.
+} ptp_servo_state_t;
+
+/** Correction requested by the software clock servo. */
+typedef enum e_ptp_servo_action
+{
+    PTP_SERVO_ACTION_NONE,             ///< The sample was rejected by the filter and no correction is required.
+    PTP_SERVO_ACTION_STEP,             ///< Subtract @ref ptp_servo_output_t::step from the local clock.
+    PTP_SERVO_ACTION_ADJUST,           ///< Apply @ref ptp_servo_output_t::frequency to the local clock source.
+} ptp_servo_action_t;
+
+/** Configuration settings for the software clock servo. */
+typedef struct st_ptp_servo_cfg
+{
+    int32_t  kp;                       ///< Proportional gain in 1/65536 ppb per nanosecond of offset.
+    int32_t  ki;                       ///< Integral gain in 1/65536 ppb per nanosecond of offset.
+    int32_t  max_frequency;            ///< Limit of the frequency adjustment in ppb.
+
+    /** Offsets larger than this value (in nanoseconds) step the local clock instead of slewing it (0 disables stepping after the first sample). */
+    uint32_t step_threshold;
+    uint32_t lock_threshold;           ///< Maximum filtered offset (in nanoseconds) for the servo to be considered locked.
+    uint8_t  lock_count;               ///< Number of consecutive samples within lock_threshold required to lock.
+    uint8_t  offset_filter_shift;      ///< The offset filter weights new samples by 1 / 2^n (0 disables the filter).
+    uint8_t  delay_filter_shift;       ///< The meanPathDelay filter weights new samples by 1 / 2^n (0 disables the filter).
+
+    /** Reject samples whose meanPathDelay differs from the filtered value by more than this (in nanoseconds, 0 disables rejection). */
+    uint32_t delay_outlier_threshold;
+} ptp_servo_cfg_t;
+
+/** Offset and delay statistics collected by the software clock servo. */
+typedef struct st_ptp_servo_stats
+{
+    ptp_servo_state_t state;           ///< Current servo state.
+    uint32_t          samples;         ///< Number of samples processed.
+    uint32_t          rejected;        ///< Number of samples rejected by the meanPathDelay outlier filter.
+    uint32_t          steps;           ///< Number of times the local clock was stepped.
+    int32_t           frequency;       ///< Current frequency adjustment in ppb.
+    int64_t           offset;          ///< Last offsetFromMaster sample in nanoseconds.
+    int64_t           offset_filtered; ///< Filtered offsetFromMaster in nanoseconds.
+    int64_t           offset_min;      ///< Minimum offsetFromMaster sample since the servo was reset.
+    int64_t           offset_max;      ///< Maximum offsetFromMaster sample since the servo was reset.
+    int64_t           delay;           ///< Last meanPathDelay sample in nanoseconds.
+    int64_t           delay_filtered;  ///< Filtered meanPathDelay in nanoseconds.
+    int64_t           delay_min;       ///< Minimum meanPathDelay sample since the servo was reset.
+    int64_t           delay_max;       ///< Maximum meanPathDelay sample since the servo was reset.
+} ptp_servo_stats_t;
+
+/** Result of processing one sample in the software clock servo. */
+typedef struct st_ptp_servo_output
+{
+    ptp_servo_action_t        action;    ///< Correction to apply.
+    int64_t                   step;      ///< Offset in nanoseconds to subtract from the local clock (Valid for PTP_SERVO_ACTION_STEP).
+    int32_t                   frequency; ///< Frequency adjustment in ppb; positive values speed up the local clock.
+    ptp_servo_stats_t const * p_stats;   ///< Servo statistics after processing the sample.
+} ptp_servo_output_t;
+
 /** Arguments passed to p_ptp_callback. */
 typedef struct st_ptp_callback_args
 {
-    ptp_event_t           event;               ///< Event that caused the callback.
-    ptp_message_t const * p_message;           ///< The message received (PTP message fields will be little endian).
-    uint8_t const       * p_tlv_data;          ///< Start of TLV data (TLV data will be big endian).
-    uint16_t              tlv_data_size;       ///< Total bytes of TLV data.
-    uint32_t              pulse_timer_channel; ///< Channel of the pulse timer that caused @ref ptp_event_t::PTP_EVENT_PULSE_TIMER_MINT_RISING_EDGE
-    void const          * p_context;           ///< Context value set in the configuration.
+    ptp_event_t                event;               ///< Event that caused the callback.
+    ptp_message_t const      * p_message;           ///< The message received (PTP message fields will be little endian).
+    uint8_t const            * p_tlv_data;          ///< Start of TLV data (TLV data will be big endian).
+    uint16_t                   tlv_data_size;       ///< Total bytes of TLV data.
+    uint32_t                   pulse_timer_channel; ///< Channel of the pulse timer that caused @ref ptp_event_t::PTP_EVENT_PULSE_TIMER_MINT_RISING_EDGE
+    ptp_servo_output_t const * p_servo_output;      ///< Servo result that caused @ref ptp_event_t::PTP_EVENT_SERVO_UPDATED
+    void const               * p_context;           ///< Context value set in the configuration.
 } ptp_callback_args_t;
 
 /** Structure for configuring the IPLS IRQ settings that are common to all pulse timer channels. */
@@ -64,6 +64,23 @@ typedef struct st_rm_filex_block_media_callback_args
     void const           * p_context;  ///< Placeholder for user data.
 } rm_filex_block_media_callback_args_t;
 
+/** Number of buckets in the request size histograms. Bucket n counts requests of 2^n to 2^(n+1) - 1 sectors, the
+ * last bucket also counts all larger requests. */
+ #define RM_FILEX_BLOCK_MEDIA_STATS_BUCKETS    (8U)
+
+/** Request statistics */
+typedef struct st_rm_filex_block_media_stats
+{
+    uint32_t read_requests;                                       ///< FileX read requests
+    uint32_t write_requests;                                      ///< FileX write requests
+    uint32_t read_hits;                                           ///< Read requests served from the read buffer
+    uint32_t merged_writes;                                       ///< Write requests merged into a previous write
+    uint32_t media_reads;                                         ///< Read requests issued to the block media
+    uint32_t media_writes;                                        ///< Write requests issued to the block media
+    uint32_t request_sectors[RM_FILEX_BLOCK_MEDIA_STATS_BUCKETS]; ///< Histogram of FileX read and write request sizes
+    uint32_t media_sectors[RM_FILEX_BLOCK_MEDIA_STATS_BUCKETS];   ///< Histogram of block media request sizes
+} rm_filex_block_media_stats_t;
+
 /** Block media configuration structure */
 typedef struct st_rm_filex_block_media_cfg
 {
@@ -91,6 +108,15 @@ typedef struct st_rm_filex_block_media_api
      * @param[in]  p_ctrl       Pointer to control structure.
      */
     fsp_err_t (* close)(rm_filex_block_media_ctrl_t * const p_ctrl);
+
+    /** Get request statistics and optionally reset them.
+     *
+     * @param[in]  p_ctrl       Pointer to control structure.
+     * @param[out] p_stats      Pointer to store the statistics.
+     * @param[in]  reset        Clear the statistics after reading them.
+     */
+    fsp_err_t (* statsGet)(rm_filex_block_media_ctrl_t * const p_ctrl, rm_filex_block_media_stats_t * const p_stats,
+                           bool reset);
 } rm_filex_block_media_api_t;
 
 /** This structure encompasses everything that is needed to use an instance of this interface. */
@@ -170,6 +170,13 @@ typedef struct st_rm_freertos_plus_fat_api
      * @param[in]  p_ctrl       Pointer to control structure.
      */
     fsp_err_t (* close)(rm_freertos_plus_fat_ctrl_t * const p_ctrl);
+
+    /** Write all sectors held in the port layer write-back cache to the media device. Call after FF_FlushCache to
+     * make sure data written through FreeRTOS+FAT has reached the media.
+     *
+     * @param[in]  p_ctrl       Pointer to control structure.
+     */
+    fsp_err_t (* cacheFlush)(rm_freertos_plus_fat_ctrl_t * const p_ctrl);
 } rm_freertos_plus_fat_api_t;
 
 /** This structure encompasses everything that is needed to use an instance of this interface. */
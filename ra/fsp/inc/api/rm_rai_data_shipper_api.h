@@ -54,6 +54,13 @@ FSP_HEADER
  * Typedef definitions
  **********************************************************************************************************************/
 
+/** Channel encoding used in transmit buffer mode */
+typedef enum e_rai_data_shipper_compression
+{
+    RAI_DATA_SHIPPER_COMPRESSION_NONE  = 0, ///< Channels are sent as raw samples
+    RAI_DATA_SHIPPER_COMPRESSION_DELTA = 1, ///< Integer channels are delta encoded and bit-packed
+} rai_data_shipper_compression_t;
+
 /** Callback function parameter structure */
 typedef struct st_rai_data_shipper_callback_args
 {
@@ -81,6 +88,13 @@ typedef struct st_rai_data_shipper_cfg
 
     void const * p_context;                                         ///< Pointer to the user-provided context
     void (* p_callback)(rai_data_shipper_callback_args_t * p_args); ///< Pointer to the callback function on data sent or error
+
+    /** Optional transmit buffer. When set, the header, channels and diagnostic data of a frame are gathered into this
+     * buffer and sent with a single write. Frames that do not fit, or that are written while the buffer still holds a
+     * frame waiting to be sent, are sent segment by segment. */
+    uint8_t * p_tx_buffer;
+    uint32_t  tx_buffer_size;                                       ///< Size of p_tx_buffer in bytes
+    rai_data_shipper_compression_t compression;                     ///< Channel encoding. Requires p_tx_buffer.
 } rai_data_shipper_cfg_t;
 
 /** Data Shipper control block.  Allocate an instance specific control block to pass into the Data Shipper API calls.
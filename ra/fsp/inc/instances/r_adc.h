@@ -296,6 +296,21 @@ typedef struct st_adc_channel_cfg
     uint8_t            sample_hold_states; ///< Number of states to be used for sample and hold. Affects channels 0-2.
 } adc_channel_cfg_t;
 
+/** Streaming configuration for R_ADC_StreamStart. Each completed scan is copied by the transfer instance into a
+ * frame of the current block. A frame holds every data register from the lowest to the highest scanned channel in
+ * register order, the same window reported by R_ADC_InfoGet. */
+typedef struct st_adc_stream_cfg
+{
+    /** Transfer instance (DTC or DMAC) activated by the scan end event of this unit. The transfer info is configured
+     * by R_ADC_StreamStart. */
+    transfer_instance_t const * p_transfer;
+    uint16_t * p_buffer;               ///< Ring storage of num_blocks * frames_per_block * (frame length) samples
+    uint16_t   num_blocks;             ///< Number of blocks in the ring, at least 2
+    uint16_t   frames_per_block;       ///< Scans copied into each block before it is handed out
+    uint16_t   decimation;             ///< Frames combined into one output frame; 1 disables decimation
+    uint32_t   decimation_mask;        ///< Frame positions that are averaged; other positions keep the newest sample
+} adc_stream_cfg_t;
+
 /* Sample and hold Channel mask. Sample and hold is only available for channel 0,1,2*/
 #define ADC_SAMPLE_HOLD_CHANNELS    (0x07U)
 
@@ -318,6 +333,15 @@ typedef struct
 
     /* Pointer to context to be passed into callback function */
     void const * p_context;
+
+    /* Streaming state, used by R_ADC_StreamStart. */
+    adc_stream_cfg_t const * p_stream_cfg;      // Active streaming configuration, NULL when not streaming
+    transfer_info_t          stream_info;       // Transfer descriptor, must stay valid while the DTC is in use
+    uint32_t                 stream_frame_size; // Samples per frame
+    uint16_t                 stream_write;      // Block being filled by the transfer
+    uint16_t                 stream_read;       // Oldest completed block
+    volatile uint16_t        stream_count;      // Completed blocks not yet released
+    bool                     stream_dmac;       // Completion reported by the transfer callback instead of the ADC ISR
 } adc_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -350,6 +374,10 @@ fsp_err_t R_ADC_CallbackSet(adc_ctrl_t * const          p_api_ctrl,
                             void (                    * p_callback)(adc_callback_args_t *),
                             void const * const          p_context,
                             adc_callback_args_t * const p_callback_memory);
+fsp_err_t R_ADC_StreamStart(adc_ctrl_t * const p_ctrl, adc_stream_cfg_t const * const p_stream_cfg);
+fsp_err_t R_ADC_StreamBlockGet(adc_ctrl_t * const p_ctrl, uint16_t ** const pp_block, uint32_t * const p_frames);
+fsp_err_t R_ADC_StreamBlockRelease(adc_ctrl_t * const p_ctrl);
+fsp_err_t R_ADC_StreamStop(adc_ctrl_t * const p_ctrl);
 
 /*******************************************************************************************************************//**
  * @} (end defgroup ADC)
@@ -46,6 +46,15 @@ FSP_HEADER
  #define R_CANFD_NUM_COMMON_FIFOS    (6U)
 #endif
 
+/** Build the RFIGCV field of a CFDRFCCn setting (canfd_global_cfg_t::rx_fifo_config) from a canfd_fifo_watermark_t. */
+#define CANFD_RX_FIFO_WATERMARK(watermark)        (((uint32_t) (watermark) << R_CANFD_CFDRFCC_RFIGCV_Pos) & \
+                                                   R_CANFD_CFDRFCC_RFIGCV_Msk)
+
+/** Build the CFIGCV field of a CFDCFCCn setting (canfd_global_cfg_t::common_fifo_config) from a
+ * canfd_fifo_watermark_t. */
+#define CANFD_COMMON_FIFO_WATERMARK(watermark)    (((uint32_t) (watermark) << R_CANFD_CFDCFCC_CFIGCV_Pos) & \
+                                                   R_CANFD_CFDCFCC_CFIGCV_Msk)
+
 /**********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -287,6 +296,54 @@ typedef enum e_canfd_frame_option
     // CANFD_FRAME_OPTION_ONESHOT = 0x80, ///< One-shot mode (no retries).
 } canfd_frame_options_t;
 
+/** CANFD FIFO interrupt watermark (CFDRFCCn.RFIGCV and CFDCFCCn.CFIGCV). Only used when the FIFO interrupt mode is
+ * set to interrupt at a fill level (RFIM/CFIM = 0). */
+typedef enum e_canfd_fifo_watermark
+{
+    CANFD_FIFO_WATERMARK_1_8 = 0,      ///< Interrupt when the FIFO is 1/8 full
+    CANFD_FIFO_WATERMARK_2_8 = 1,      ///< Interrupt when the FIFO is 2/8 full
+    CANFD_FIFO_WATERMARK_3_8 = 2,      ///< Interrupt when the FIFO is 3/8 full
+    CANFD_FIFO_WATERMARK_4_8 = 3,      ///< Interrupt when the FIFO is 4/8 full
+    CANFD_FIFO_WATERMARK_5_8 = 4,      ///< Interrupt when the FIFO is 5/8 full
+    CANFD_FIFO_WATERMARK_6_8 = 5,      ///< Interrupt when the FIFO is 6/8 full
+    CANFD_FIFO_WATERMARK_7_8 = 6,      ///< Interrupt when the FIFO is 7/8 full
+    CANFD_FIFO_WATERMARK_8_8 = 7,      ///< Interrupt when the FIFO is full
+} canfd_fifo_watermark_t;
+
+/* Software receive ring. Written only by the RX FIFO ISRs and read only by R_CANFD_RxRingRead. */
+typedef struct st_canfd_rx_ring
+{
+    can_frame_t     * p_frames;        // Frame storage, NULL when the ring is not used
+    uint32_t          mask;            // Number of frames in the ring minus one
+    volatile uint32_t head;            // Free-running write index (ISR)
+    volatile uint32_t tail;            // Free-running read index (application)
+    volatile uint32_t overflow_count;  // Number of frames dropped because the ring was full
+} canfd_rx_ring_t;
+
+/** Entry in the software transmit queue. Storage for these is provided through canfd_extended_cfg_t. */
+typedef struct st_canfd_tx_queue_entry
+{
+    uint32_t    key;                   ///< Arbitration priority key (lower value wins arbitration)
+    uint32_t    sequence;              ///< Submission order, used to keep frames with equal keys in order
+    can_frame_t frame;                 ///< Frame to transmit
+} canfd_tx_queue_entry_t;
+
+/* Software transmit queue state. The queue is a binary min-heap ordered by CAN arbitration priority; the TX message
+ * buffers selected in canfd_extended_cfg_t::tx_queue_mb_mask are kept loaded from the top of the heap. */
+typedef struct st_canfd_tx_queue
+{
+    canfd_tx_queue_entry_t * p_heap;   // Heap storage, NULL when the queue is not used
+    uint32_t                 length;   // Number of entries in p_heap
+    uint32_t                 count;    // Number of frames waiting in the heap
+    uint32_t                 sequence; // Next submission sequence number
+    uint64_t                 mb_mask;  // TX message buffers owned by the queue (bit n = TX MB n)
+    uint64_t                 mb_busy;  // Owned TX message buffers with a transmission request pending
+    uint64_t                 mb_abort; // Owned TX message buffers with an abort request pending
+    uint32_t                 mb_key[16];      // Key of the frame loaded in each owned TX message buffer
+    uint32_t                 mb_sequence[16]; // Sequence number of the frame loaded in each owned TX message buffer
+    volatile uint32_t        lost_count;      // Preempted frames dropped because the queue was full when they were returned
+} canfd_tx_queue_t;
+
 /* CAN Instance Control Block   */
 typedef struct st_canfd_instance_ctrl
 {
@@ -303,6 +360,11 @@ typedef struct st_canfd_instance_ctrl
     void (* p_callback)(can_callback_args_t *); // Pointer to callback
     can_callback_args_t * p_callback_memory;    // Pointer to optional callback argument memory
     void const          * p_context;            // Pointer to context to be passed into callback function
+    canfd_rx_ring_t       rx_ring;              // Software receive ring state
+    canfd_tx_queue_t      tx_queue;             // Software transmit queue state
+#if BSP_CFG_PERF_COUNTERS_ENABLE
+    bsp_perf_entry_t perf;                      // Performance counters, see bsp_perf.h
+#endif
 } canfd_instance_ctrl_t;
 
 /** AFL Entry (based on R_CANFD_CFDGAFL_Type in renesas.h) */
@@ -374,6 +436,18 @@ typedef struct st_canfd_extended_cfg
     can_bit_timing_cfg_t * p_data_timing;      ///< FD Data Rate (when bitrate switching is used)
     uint8_t                delay_compensation; ///< FD Transceiver Delay Compensation (enable or disable)
     canfd_global_cfg_t   * p_global_cfg;       ///< Global configuration (global error callback channel only)
+
+    /** Software receive ring storage. When set, frames received through RX FIFOs and Common FIFOs routed to this
+     * channel are copied into this ring from the ISR and CAN_EVENT_RX_BATCH_READY is raised once per interrupt
+     * instead of calling the callback for each frame. Set to NULL to disable. */
+    can_frame_t * p_rx_ring_buffer;
+    uint32_t      rx_ring_length;              ///< Number of frames in p_rx_ring_buffer (must be a power of 2)
+
+    /** Software transmit queue storage. When set, frames written with R_CANFD_TxQueueWrite are held in priority order
+     * and the TX message buffers in tx_queue_mb_mask are refilled from the transmit ISR. Set to NULL to disable. */
+    canfd_tx_queue_entry_t * p_tx_queue_buffer;
+    uint32_t                 tx_queue_length;  ///< Number of entries in p_tx_queue_buffer
+    uint64_t                 tx_queue_mb_mask; ///< TX message buffers reserved for the queue (same layout as txmb_txi_enable)
 } canfd_extended_cfg_t;
 
 /**********************************************************************************************************************
@@ -401,6 +475,11 @@ fsp_err_t R_CANFD_CallbackSet(can_ctrl_t * const          p_api_ctrl,
                               void (                    * p_callback)(can_callback_args_t *),
                               void const * const          p_context,
                               can_callback_args_t * const p_callback_memory);
+fsp_err_t R_CANFD_TxQueueWrite(can_ctrl_t * const p_api_ctrl, can_frame_t * const p_frame);
+fsp_err_t R_CANFD_RxRingRead(can_ctrl_t * const  p_api_ctrl,
+                             can_frame_t * const p_frames,
+                             uint32_t const      max_frames,
+                             uint32_t * const    p_count);
 
 /*******************************************************************************************************************//**
  * @} (end defgroup CAN)
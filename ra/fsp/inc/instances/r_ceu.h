@@ -83,6 +83,8 @@ typedef enum e_ceu_event
     CEU_EVENT_FRAME_END     = 0x00000001, ///< Frame end event (CPE)
     CEU_EVENT_HD            = 0x00000100, ///< (Not Used) HD received (HD)
     CEU_EVENT_VD            = 0x00000200, ///< VD received (VD)
+    CEU_EVENT_BUNDLE_A_END  = 0x00001000, ///< Bundle written to the CDAYR area in bundle write mode (CPBE1)
+    CEU_EVENT_BUNDLE_B_END  = 0x00002000, ///< Bundle written to the CDAYR2 area in bundle write mode (CPBE2)
     CEU_EVENT_CRAM_OVERFLOW = 0x00010000, ///< Data overflowed in the CRAM buffer (CDTOF)
     CEU_EVENT_HD_MISMATCH   = 0x00020000, ///< HD mismatch (IGHS)
     CEU_EVENT_VD_MISMATCH   = 0x00040000, ///< VD mismatch (IGVS)
@@ -129,6 +131,7 @@ typedef struct st_ceu_extended_cfg
     uint32_t                  interrupts_enabled; ///< Enabled interrupt events bit mask
     uint8_t   ceu_ipl;                            ///< PDC interrupt priority
     IRQn_Type ceu_irq;                            ///< PDC IRQ number
+    uint16_t  bundle_lines;                       ///< Lines per bundle in bundle write mode (0 = bundle write disabled)
 } ceu_extended_cfg_t;
 
 /** CEU instance control block. DO NOT INITIALIZE. */
@@ -138,6 +141,7 @@ typedef struct st_ceu_instance_ctrl
     uint32_t              open;                     // Indicates whether or not the driver is open called.
     uint8_t             * p_buffer;                 // Pointer to buffer currently in use
     uint32_t              image_area_size;          // Size of capture area for image (Used for Data Enable Fetch)
+    uint32_t              bundle_size;              // Size of one bundle in bytes (0 if bundle write mode is disabled)
     uint32_t              interrupts_enabled;       // Interrupts enabled bitmask
     void (* p_callback)(capture_callback_args_t *); // Pointer to callback that is called when an ceu_event_t occurs.
     capture_callback_args_t * p_callback_memory;    // Pointer to non-secure memory that can be used to pass arguments to a callback in non-secure memory.
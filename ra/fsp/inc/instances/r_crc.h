@@ -32,6 +32,7 @@
 #include "bsp_api.h"
 #include "r_crc_cfg.h"
 #include "r_crc_api.h"
+#include "r_transfer_api.h"
 
 /* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
 FSP_HEADER
@@ -44,13 +45,45 @@ FSP_HEADER
  * Typedef definitions
  **********************************************************************************************************************/
 
+/** Callback function parameter data for R_CRC_CalculateAsync(). */
+typedef struct st_crc_callback_args
+{
+    uint32_t     crc_result;           ///< Calculated CRC value
+    void const * p_context;            ///< Placeholder for user data. Set in @ref crc_extended_cfg_t.
+} crc_callback_args_t;
+
+/** CRC extended configuration. Optional; only required for R_CRC_CalculateAsync(). */
+typedef struct st_crc_extended_cfg
+{
+    /** DMAC instance used to stream input data into CRCDIR. The transfer must support software start; the DTC
+     * cannot be used because it is only activated by interrupt events. */
+    transfer_instance_t const * p_transfer;
+
+    void (* p_callback)(crc_callback_args_t * p_args); ///< Called when an asynchronous calculation completes
+    void const * p_context;                           ///< Placeholder for user data. Passed to the callback.
+} crc_extended_cfg_t;
+
 /** Driver instance control structure. */
 typedef struct st_crc_instance_ctrl
 {
     uint32_t          open;
-    const crc_cfg_t * p_cfg;           // Pointer to initial configurations
+    const crc_cfg_t * p_cfg;             // Pointer to initial configurations
+    transfer_info_t   transfer_info;     // Transfer settings for the current asynchronous chunk
+    uint8_t const   * p_next;            // Next input data for an asynchronous calculation
+    uint32_t          remaining;         // Input bytes left to stream after the current chunk
+    volatile bool     async_in_progress; // Set while an asynchronous calculation is running
 } crc_instance_ctrl_t;
 
+/** Result of R_CRC_Benchmark(). */
+typedef struct st_crc_benchmark
+{
+    uint32_t num_bytes;                ///< Bytes in the input buffer
+    uint32_t cpu_cycles;               ///< Core clock cycles taken by R_CRC_Calculate
+    uint32_t dmac_cycles;              ///< Core clock cycles from R_CRC_CalculateAsync until the calculation completed (0 if no transfer instance is configured)
+    uint32_t software_cycles;          ///< Core clock cycles taken by the software instance (0 if none was given)
+    bool     results_match;            ///< All measured implementations calculated the same value
+} crc_benchmark_t;
+
 /**********************************************************************************************************************
  * Exported global variables
  **********************************************************************************************************************/
@@ -70,6 +103,11 @@ fsp_err_t R_CRC_Calculate(crc_ctrl_t * const p_ctrl, crc_input_t * const p_crc_i
 fsp_err_t R_CRC_CalculatedValueGet(crc_ctrl_t * const p_ctrl, uint32_t * calculatedValue);
 fsp_err_t R_CRC_SnoopEnable(crc_ctrl_t * const p_ctrl, uint32_t crc_seed);
 fsp_err_t R_CRC_SnoopDisable(crc_ctrl_t * const p_ctrl);
+fsp_err_t R_CRC_CalculateAsync(crc_ctrl_t * const p_ctrl, crc_input_t * const p_crc_input);
+fsp_err_t R_CRC_Benchmark(crc_ctrl_t * const           p_ctrl,
+                          crc_instance_t const * const p_software,
+                          crc_input_t * const          p_crc_input,
+                          crc_benchmark_t * const      p_result);
 
 /*******************************************************************************************************************//**
  * @} (end defgroup CRC)
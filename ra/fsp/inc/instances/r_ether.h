@@ -126,6 +126,12 @@ typedef struct st_ether_instance_ctrl
 
     /* Pointer to context to be passed into callback function */
     void const * p_context;
+
+#if BSP_CFG_PERF_COUNTERS_ENABLE
+
+    /* Performance counters, see bsp_perf.h */
+    bsp_perf_entry_t perf;
+#endif
 } ether_instance_ctrl_t;
 
 /*
@@ -216,6 +222,10 @@ fsp_err_t R_ETHER_CallbackSet(ether_ctrl_t * const          p_api_ctrl,
                               void const * const            p_context,
                               ether_callback_args_t * const p_callback_memory);
 
+fsp_err_t R_ETHER_WriteFragments(ether_ctrl_t * const              p_ctrl,
+                                 ether_tx_fragment_t const * const p_fragments,
+                                 uint32_t const                    num_fragments);
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup ETHER)
  **********************************************************************************************************************/
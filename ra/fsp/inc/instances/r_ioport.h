@@ -57,6 +57,16 @@ typedef struct st_ioport_instance_ctrl
     void const * p_context;
 } ioport_instance_ctrl_t;
 
+/** Result of R_IOPORT_FastPinBenchmark(). Each value is the number of core clock cycles taken to drive the pin high
+ * and then low again. */
+typedef struct st_ioport_fast_pin_benchmark
+{
+    uint32_t pin_write_cycles;          ///< Two calls to R_IOPORT_PinWrite
+    uint32_t port_write_cycles;         ///< Two calls to R_IOPORT_PortWrite
+    uint32_t fast_pin_write_cycles;     ///< Two calls to R_BSP_FastPinWrite
+    uint32_t fast_pin_set_clear_cycles; ///< R_BSP_FastPinSet followed by R_BSP_FastPinClear
+} ioport_fast_pin_benchmark_t;
+
 /* This typedef is here temporarily. See SWFLEX-144 for details. */
 /** Superset list of all possible IO port pins. */
 typedef enum e_ioport_port_pin_t
@@ -522,6 +532,9 @@ fsp_err_t R_IOPORT_PortEventOutputWrite(ioport_ctrl_t * const p_ctrl,
                                         ioport_size_t         mask_value);
 fsp_err_t R_IOPORT_PortRead(ioport_ctrl_t * const p_ctrl, bsp_io_port_t port, ioport_size_t * p_port_value);
 fsp_err_t R_IOPORT_PortWrite(ioport_ctrl_t * const p_ctrl, bsp_io_port_t port, ioport_size_t value, ioport_size_t mask);
+fsp_err_t R_IOPORT_FastPinBenchmark(ioport_ctrl_t * const               p_ctrl,
+                                    bsp_io_port_pin_t                   pin,
+                                    ioport_fast_pin_benchmark_t * const p_result);
 
 /*******************************************************************************************************************//**
  * @} (end defgroup IOPORT)
@@ -38,6 +38,24 @@ FSP_HEADER
  * Type defines for the SPI interface API
  *************************************************************************************************/
 
+/** Software clock servo state. Initialize with @ref R_PTP_ServoInit. */
+typedef struct st_ptp_servo
+{
+    ptp_servo_cfg_t const * p_cfg;          ///< Pointer to the servo configuration.
+    ptp_servo_stats_t       stats;          ///< Offset and delay statistics.
+    int64_t                 integral;       ///< Accumulated integral term in 1/65536 ppb.
+    uint8_t                 lock_counter;   ///< Consecutive samples within the lock threshold.
+    uint8_t                 reject_counter; ///< Consecutive samples rejected by the outlier filter.
+} ptp_servo_t;
+
+/** PTP extended configuration. */
+typedef struct st_ptp_extended_cfg
+{
+    /** Filter samples and step the local clock with the software clock servo in the MINT ISR (NULL to disable). The rate
+     * is adjusted by the STCA, which must use @ref PTP_CLOCK_CORRECTION_MODE2. */
+    ptp_servo_cfg_t const * p_servo_cfg;
+} ptp_extended_cfg_t;
+
 /** PTP instance control block. */
 typedef struct
 {
@@ -47,6 +65,7 @@ typedef struct
     uint32_t          rx_buffer_index;          ///< Index into the descriptor of the last received packet.
     uint32_t          tslatr;                   ///< Keep track of whether tslatr was set.
     ptp_cfg_t const * p_cfg;                    ///< Pointer to the configuration structure.
+    ptp_servo_t       servo;                    ///< Software clock servo (Used if ptp_extended_cfg_t::p_servo_cfg is set).
 } ptp_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -86,6 +105,18 @@ fsp_err_t R_PTP_Close(ptp_ctrl_t * const p_ctrl);
 fsp_err_t R_PTP_BestMasterClock(ptp_message_t const * const p_announce1,
                                 ptp_message_t const * const p_announce2,
                                 int8_t * const              p_comparison);
+fsp_err_t R_PTP_OffsetCalculate(ptp_time_t const * const p_t1,
+                                ptp_time_t const * const p_t2,
+                                ptp_time_t const * const p_t3,
+                                ptp_time_t const * const p_t4,
+                                int64_t * const          p_offset,
+                                int64_t * const          p_delay);
+fsp_err_t R_PTP_ServoInit(ptp_servo_t * const p_servo, ptp_servo_cfg_t const * const p_cfg);
+fsp_err_t R_PTP_ServoUpdate(ptp_servo_t * const        p_servo,
+                            int64_t                    offset,
+                            int64_t                    delay,
+                            ptp_servo_output_t * const p_output);
+fsp_err_t R_PTP_ServoStatsGet(ptp_ctrl_t * const p_ctrl, ptp_servo_stats_t * const p_stats);
 
 /*******************************************************************************************************************//**
  * @} (end ingroup PTP)
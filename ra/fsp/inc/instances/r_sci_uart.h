@@ -97,6 +97,12 @@ typedef struct st_sci_uart_instance_ctrl
 
     /* Pointer to context to be passed into callback function */
     void const * p_context;
+
+#if BSP_CFG_PERF_COUNTERS_ENABLE
+
+    /* Performance counters, see bsp_perf.h */
+    bsp_perf_entry_t perf;
+#endif
 } sci_uart_instance_ctrl_t;
 
 /** Receive FIFO trigger configuration. */
@@ -105,6 +105,9 @@ typedef struct st_sdmmc_instance_ctrl
     void (* p_callback)(sdmmc_callback_args_t *); // Pointer to callback
     sdmmc_callback_args_t * p_callback_memory;    // Pointer to optional callback argument memory
     void const            * p_context;            // Pointer to context to be passed into callback function
+#if BSP_CFG_PERF_COUNTERS_ENABLE
+    bsp_perf_entry_t perf;                        // Performance counters, see bsp_perf.h
+#endif
 } sdhi_instance_ctrl_t;
 
 /**********************************************************************************************************************
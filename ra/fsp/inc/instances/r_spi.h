@@ -131,6 +131,58 @@ typedef struct st_spi_extended_cfg
     spi_delay_count_t            next_access_delay;  ///< SPI Next-Access Delay Register Setting
 } spi_extended_cfg_t;
 
+/** Chip select control for a device driven through the transaction queue */
+typedef enum e_spi_queue_cs_mode
+{
+    SPI_QUEUE_CS_MODE_SSL,             ///< Chip select is the SSLn signal selected by ssl_select, driven by the peripheral. Requires SPI_SSL_MODE_SPI.
+    SPI_QUEUE_CS_MODE_PIN,             ///< Chip select is a GPIO pin driven by the driver between segments. Requires SPI_SSL_MODE_CLK_SYN.
+} spi_queue_cs_mode_t;
+
+/** Device on the bus. The settings are applied by the queue whenever a segment addresses a different device. */
+typedef struct st_spi_queue_device
+{
+    spi_clk_phase_t     clk_phase;     ///< Clock phase of the device
+    spi_clk_polarity_t  clk_polarity;  ///< Clock polarity of the device
+    spi_bit_order_t     bit_order;     ///< Bit order of the device
+    rspck_div_setting_t spck_div;      ///< Bitrate of the device, see R_SPI_CalculateBitrate
+    spi_queue_cs_mode_t cs_mode;       ///< How the chip select is driven
+    spi_ssl_select_t    ssl_select;    ///< SSLn signal used when cs_mode is SPI_QUEUE_CS_MODE_SSL
+    spi_ssl_polarity_t  cs_polarity;   ///< Active level of the chip select
+    bsp_io_port_pin_t   cs_pin;        ///< Pin used when cs_mode is SPI_QUEUE_CS_MODE_PIN, configured as GPIO output
+} spi_queue_device_t;
+
+/** One transfer of a queued transaction */
+typedef struct st_spi_queue_segment
+{
+    spi_queue_device_t const * p_device;  ///< Device addressed by this segment
+    void const               * p_src;     ///< Data to transmit, NULL to transmit zeros
+    void                     * p_dest;    ///< Buffer for received data, NULL to discard it
+    uint32_t                   length;    ///< Number of data frames
+    spi_bit_width_t            bit_width; ///< Data frame size
+
+    /** Keep a pin chip select asserted after this segment. The next segment must address the same device. Ignored
+     * for SSL chip selects, which the peripheral negates at the end of every segment. */
+    bool cs_hold;
+} spi_queue_segment_t;
+
+/** Transaction submitted with R_SPI_QueueSubmit. The transaction and its segments must remain valid until it
+ * completes. Fields after result are private to the FSP. */
+typedef struct st_spi_queue_transaction
+{
+    spi_queue_segment_t const * p_segments;   ///< Segments transferred back to back, in order
+    uint32_t                    num_segments; ///< Number of entries in p_segments
+
+    /** Called from the transfer end or error interrupt when the transaction completes (optional). */
+    void (* p_callback)(struct st_spi_queue_transaction * p_transaction);
+    void const * p_context;                   ///< Placeholder for user data
+
+    volatile bool busy;                       ///< True from submission until the transaction completes
+    spi_event_t   result;                     ///< SPI_EVENT_TRANSFER_COMPLETE or the event that ended the transaction
+
+    struct st_spi_queue_transaction * p_next; // Next transaction in the queue
+    uint32_t segment;                         // Index of the segment in progress
+} spi_queue_transaction_t;
+
 /** Channel control block. DO NOT INITIALIZE.  Initialization occurs when @ref spi_api_t::open is called. */
 typedef struct st_spi_instance_ctrl
 {
@@ -150,6 +202,15 @@ typedef struct st_spi_instance_ctrl
 
     /* Pointer to context to be passed into callback function */
     void const * p_context;
+
+    /* Transaction queue state, used by R_SPI_QueueSubmit. */
+    spi_queue_transaction_t  * p_queue_head;      ///< Transaction in progress, NULL when the queue is idle
+    spi_queue_transaction_t  * p_queue_tail;      ///< Last queued transaction
+    spi_queue_device_t const * p_queue_device;    ///< Device the registers are currently configured for
+    uint16_t                   queue_saved_spcmd; ///< SPCMD0 setting restored when the queue drains
+    uint8_t                    queue_saved_spbr;  ///< SPBR setting restored when the queue drains
+    uint8_t                    queue_saved_sslp;  ///< SSLP setting restored when the queue drains
+    bool                       queue_dispatching; ///< Set while the transfer end interrupt completes a transaction
 } spi_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -186,6 +247,7 @@ fsp_err_t R_SPI_WriteRead(spi_ctrl_t * const    p_api_ctrl,
 fsp_err_t R_SPI_Close(spi_ctrl_t * const p_api_ctrl);
 
 fsp_err_t R_SPI_CalculateBitrate(uint32_t bitrate, rspck_div_setting_t * spck_div);
+fsp_err_t R_SPI_QueueSubmit(spi_ctrl_t * const p_api_ctrl, spi_queue_transaction_t * const p_transaction);
 fsp_err_t R_SPI_CallbackSet(spi_ctrl_t * const          p_api_ctrl,
                             void (                    * p_callback)(spi_callback_args_t *),
                             void const * const          p_context,
@@ -67,6 +67,43 @@ typedef enum e_ssi_clock_div
     SSI_CLOCK_DIV_128 = 7,             ///< Clock divisor 128
 } ssi_clock_div_t;
 
+/** Sample format used by the application buffers passed to R_SSI_StreamWrite and R_SSI_StreamRead. */
+typedef enum e_ssi_stream_sample
+{
+    SSI_STREAM_SAMPLE_NATIVE = 0,      ///< Same size and alignment as the FIFO access size (no conversion)
+    SSI_STREAM_SAMPLE_16_BIT = 1,      ///< 16-bit signed samples, scaled to and from the configured PCM width
+} ssi_stream_sample_t;
+
+/** Channel layout used by the application buffers passed to R_SSI_StreamWrite and R_SSI_StreamRead. */
+typedef enum e_ssi_stream_channels
+{
+    SSI_STREAM_CHANNELS_STEREO = 0,    ///< Left and right samples interleaved (no conversion)
+    SSI_STREAM_CHANNELS_MONO   = 1,    ///< One sample per frame, sent on both channels and received from the left
+} ssi_stream_channels_t;
+
+/** Circular streaming configuration used by R_SSI_StreamStart. The rings are always stored in the FIFO format
+ * (two samples per frame, one FIFO access size per sample). */
+typedef struct st_ssi_stream_cfg
+{
+    void   * p_tx_buffer;              ///< Transmit ring of num_periods * period_bytes bytes, NULL to not transmit
+    void   * p_rx_buffer;              ///< Receive ring of num_periods * period_bytes bytes, NULL to not receive
+    uint32_t period_bytes;             ///< Bytes per period, a multiple of one frame and at most 65535 frames
+    uint8_t  num_periods;              ///< Number of periods in each ring, at least 2 (2 gives half/full notification)
+    ssi_stream_sample_t   sample;      ///< Application sample format
+    ssi_stream_channels_t channels;    ///< Application channel layout
+} ssi_stream_cfg_t;
+
+/** Circular streaming status returned by R_SSI_StreamStatusGet. Frame counts use the application format. */
+typedef struct st_ssi_stream_status
+{
+    uint32_t tx_frames_free;           ///< Frames that can be written without blocking the transmit ring
+    uint32_t tx_write_offset;          ///< Byte offset in the transmit ring where the next frame is written
+    uint32_t tx_underruns;             ///< Periods started before they were completely written, or FIFO underflows
+    uint32_t rx_frames_available;      ///< Frames received and not yet read
+    uint32_t rx_read_offset;           ///< Byte offset in the receive ring of the oldest unread frame
+    uint32_t rx_overruns;              ///< Periods dropped because they were not read in time, or FIFO overflows
+} ssi_stream_status_t;
+
 /** Channel instance control block. DO NOT INITIALIZE.  Initialization occurs when @ref i2s_api_t::open is called. */
 typedef struct st_ssi_instance_ctrl
 {
@@ -91,6 +128,18 @@ typedef struct st_ssi_instance_ctrl
     void (* p_callback)(i2s_callback_args_t *);
     i2s_callback_args_t * p_callback_memory;
     void const          * p_context;   // < User defined context passed into callback function
+
+    /* Circular streaming state, p_stream_cfg is NULL when not streaming. The levels count ring bytes: the transmit
+     * level includes the period being sent and the receive level excludes the period being received. */
+    ssi_stream_cfg_t const * p_stream_cfg;
+    uint32_t                 stream_ring_bytes;
+    uint8_t                  stream_pcm_shift; // Left shift from a 16-bit sample to the PCM width
+    volatile uint8_t         stream_tx_period; // Period currently read by the transmit transfer
+    volatile uint8_t         stream_rx_period; // Period currently written by the receive transfer
+    volatile uint32_t        stream_tx_level;
+    volatile uint32_t        stream_rx_level;
+    volatile uint32_t        stream_tx_underruns;
+    volatile uint32_t        stream_rx_overruns;
 } ssi_instance_ctrl_t;
 
 /** SSI configuration extension. This extension is optional. */
@@ -126,6 +175,12 @@ fsp_err_t R_SSI_CallbackSet(i2s_ctrl_t * const          p_api_ctrl,
                             void (                    * p_callback)(i2s_callback_args_t *),
                             void const * const          p_context,
                             i2s_callback_args_t * const p_callback_memory);
+fsp_err_t R_SSI_StreamStart(i2s_ctrl_t * const p_ctrl, ssi_stream_cfg_t const * const p_stream_cfg);
+fsp_err_t R_SSI_StreamWrite(i2s_ctrl_t * const p_ctrl, void const * const p_src, uint32_t const frames,
+                            uint32_t * const p_frames_written);
+fsp_err_t R_SSI_StreamRead(i2s_ctrl_t * const p_ctrl, void * const p_dest, uint32_t const frames,
+                           uint32_t * const p_frames_read);
+fsp_err_t R_SSI_StreamStatusGet(i2s_ctrl_t * const p_ctrl, ssi_stream_status_t * const p_status);
 
 /* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
 FSP_FOOTER
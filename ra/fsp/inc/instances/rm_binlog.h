@@ -0,0 +1,183 @@
+/***********************************************************************************************************************
+ * Copyright [2020-2024] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef RM_BINLOG_H
+#define RM_BINLOG_H
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_BINLOG
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "rm_binlog_cfg.h"
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/** Marker at the start of every frame written to the sink ("BLOG" in little endian). */
+#define RM_BINLOG_FRAME_MAGIC      (0x474F4C42U)
+
+/** Version of the frame format. */
+#define RM_BINLOG_FRAME_VERSION    (1U)
+
+/** Maximum number of arguments stored with one message. */
+#define RM_BINLOG_MAX_ARGS         (4U)
+
+/* Format strings can be collected in their own section, for example one marked (INFO) in the linker script so the
+ * strings stay in the ELF file for the decoder but use no flash. Messages can then only be formatted on the host. */
+#ifdef RM_BINLOG_CFG_FORMAT_SECTION
+ #define RM_BINLOG_PRV_FORMAT_ATTRIBUTE    BSP_PLACE_IN_SECTION(RM_BINLOG_CFG_FORMAT_SECTION)
+#else
+ #define RM_BINLOG_PRV_FORMAT_ATTRIBUTE
+#endif
+
+#define RM_BINLOG_PRV_FORMAT_DEFINE(fmt)    static const char rm_binlog_format[] RM_BINLOG_PRV_FORMAT_ATTRIBUTE = fmt
+
+/** Records a message without arguments. fmt must be a string literal. Can be called from tasks and ISRs. */
+#define RM_BINLOG_0(fmt)                                \
+    do {                                                \
+        RM_BINLOG_PRV_FORMAT_DEFINE(fmt);               \
+        rm_binlog_write(rm_binlog_format, 0U, NULL);    \
+    } while (0)
+
+/** Records a message with one argument. Arguments are stored as 32-bit words and formatted later. */
+#define RM_BINLOG_1(fmt, a0)                                     \
+    do {                                                         \
+        RM_BINLOG_PRV_FORMAT_DEFINE(fmt);                        \
+        uint32_t const rm_binlog_args[] = {(uint32_t) (a0)};     \
+        rm_binlog_write(rm_binlog_format, 1U, rm_binlog_args);   \
+    } while (0)
+
+/** Records a message with two arguments. */
+#define RM_BINLOG_2(fmt, a0, a1)                                                 \
+    do {                                                                         \
+        RM_BINLOG_PRV_FORMAT_DEFINE(fmt);                                        \
+        uint32_t const rm_binlog_args[] = {(uint32_t) (a0), (uint32_t) (a1)};    \
+        rm_binlog_write(rm_binlog_format, 2U, rm_binlog_args);                   \
+    } while (0)
+
+/** Records a message with three arguments. */
+#define RM_BINLOG_3(fmt, a0, a1, a2)                                                             \
+    do {                                                                                         \
+        RM_BINLOG_PRV_FORMAT_DEFINE(fmt);                                                        \
+        uint32_t const rm_binlog_args[] = {(uint32_t) (a0), (uint32_t) (a1), (uint32_t) (a2)};   \
+        rm_binlog_write(rm_binlog_format, 3U, rm_binlog_args);                                   \
+    } while (0)
+
+/** Records a message with four arguments. */
+#define RM_BINLOG_4(fmt, a0, a1, a2, a3)                                                                         \
+    do {                                                                                                         \
+        RM_BINLOG_PRV_FORMAT_DEFINE(fmt);                                                                        \
+        uint32_t const rm_binlog_args[] = {(uint32_t) (a0), (uint32_t) (a1), (uint32_t) (a2), (uint32_t) (a3)};  \
+        rm_binlog_write(rm_binlog_format, 4U, rm_binlog_args);                                                   \
+    } while (0)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Frame types written to the sink. */
+typedef enum e_rm_binlog_frame_type
+{
+    RM_BINLOG_FRAME_TYPE_INFO     = 1, ///< Payload is rm_binlog_frame_info_t
+    RM_BINLOG_FRAME_TYPE_MESSAGES = 2, ///< Payload is a sequence of messages, see rm_binlog_frame_message_t
+} rm_binlog_frame_type_t;
+
+/** Header that starts every frame written to the sink. All fields are little endian. */
+typedef struct st_rm_binlog_frame_header
+{
+    uint32_t magic;                    ///< RM_BINLOG_FRAME_MAGIC
+    uint8_t  type;                     ///< Frame type, see rm_binlog_frame_type_t
+    uint8_t  version;                  ///< RM_BINLOG_FRAME_VERSION
+    uint16_t length;                   ///< Payload length in bytes
+} rm_binlog_frame_header_t;
+
+/** Payload of an info frame. */
+typedef struct st_rm_binlog_frame_info
+{
+    uint32_t timestamp_hz;             ///< Timestamp counter frequency
+    uint32_t timestamp;                ///< Timestamp when the frame was written
+    uint32_t dropped;                  ///< Messages dropped because the ring was full since the last info frame
+    uint32_t reserved;
+} rm_binlog_frame_info_t;
+
+/** Start of one message in a messages frame. The message is followed by argument_count 32-bit arguments. */
+typedef struct st_rm_binlog_frame_message
+{
+    uint32_t header;                   ///< Number of arguments in bits 0-7. Other bits are reserved.
+    uint32_t timestamp;                ///< Timestamp counter (DWT CYCCNT by default)
+    uint32_t format;                   ///< Address of the format string. The decoder looks it up in the ELF file.
+} rm_binlog_frame_message_t;
+
+/** One message read back on the target with RM_BINLOG_MessageGet. */
+typedef struct st_rm_binlog_message
+{
+    char const * p_format;                  ///< Format string
+    uint32_t     timestamp;                 ///< Timestamp counter when the message was recorded
+    uint32_t     argument_count;            ///< Number of valid entries in arguments
+    uint32_t     arguments[RM_BINLOG_MAX_ARGS]; ///< Raw arguments
+} rm_binlog_message_t;
+
+/** Log status. */
+typedef struct st_rm_binlog_status
+{
+    uint32_t dropped;                  ///< Messages dropped because the ring was full since RM_BINLOG_Open
+    uint32_t used;                     ///< Ring words holding messages that were not read yet
+    uint32_t peak;                     ///< Highest value of used since RM_BINLOG_Open
+} rm_binlog_status_t;
+
+/** Context for the memory sink. */
+typedef struct st_rm_binlog_memory_sink
+{
+    uint8_t * p_buffer;                ///< Destination buffer
+    uint32_t  size;                    ///< Size of p_buffer in bytes
+    uint32_t  used;                    ///< Bytes written so far. Set to 0 to restart the dump.
+} rm_binlog_memory_sink_t;
+
+/***********************************************************************************************************************
+ * Public APIs
+ **********************************************************************************************************************/
+fsp_err_t RM_BINLOG_Open(bsp_sink_t const * const p_sink);
+fsp_err_t RM_BINLOG_Flush(void);
+fsp_err_t RM_BINLOG_MessageGet(rm_binlog_message_t * const p_message);
+fsp_err_t RM_BINLOG_MessageFormat(rm_binlog_message_t const * const p_message, char * const p_buffer, uint32_t size);
+fsp_err_t RM_BINLOG_StatusGet(rm_binlog_status_t * const p_status);
+fsp_err_t RM_BINLOG_Close(void);
+fsp_err_t RM_BINLOG_MemorySinkWrite(void * p_context, uint8_t const * p_data, uint32_t bytes);
+
+/* Called by the RM_BINLOG_n macros. */
+void rm_binlog_write(char const * p_format, uint32_t count, uint32_t const * p_args);
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_BINLOG)
+ **********************************************************************************************************************/
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif
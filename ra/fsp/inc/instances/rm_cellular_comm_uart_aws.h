@@ -56,12 +56,12 @@ FSP_HEADER
 typedef struct st_rm_cellular_comm_uart_aws_instance_ctrl
 {
     uart_instance_t * p_lower_level_instance;                              ///< Lower level UART instance
-    uint8_t         * p_recv_buffer;                                       ///< Receieve buffer to zero copy to
-    uint32_t          remaining_recv_read_length;                          ///< Length left overall to read to receive buffer
-    uint32_t          current_recv_read_length;                            ///< Length to read to receive buffer for current cluster of bytes
-    bool              transfer_in_progress;                                ///< Indicates if transfer is in progress for recv
-    uint8_t           rx_buffer[RM_CELLULAR_COMM_UART_AWS_RX_BUFFER_SIZE]; ///< Receive Buffer
-    uint32_t          read_count;                                          ///< Number of bytes read into rx_buffer so far
+    uint8_t           rx_buffer[RM_CELLULAR_COMM_UART_AWS_RX_BUFFER_SIZE]; ///< Receive ring buffer
+    volatile uint32_t rx_head;                                             ///< Ring offset the next received byte is written to
+    uint32_t          rx_tail;                                             ///< Ring offset the next byte is read from
+    volatile uint32_t rx_count;                                            ///< Number of received bytes waiting in the ring
+    uint32_t          rx_armed_length;                                     ///< Length of the read currently armed at rx_head
+    volatile bool     transfer_in_progress;                                ///< Indicates if a lower level read into the ring is armed
     StaticSemaphore_t tx_semaphore_buffer;                                 ///< Transmit semaphore buffer
     SemaphoreHandle_t tx_semaphore_handle;                                 ///< Transmit semaphore handle
     StaticSemaphore_t rx_semaphore_buffer;                                 ///< Receive semaphore buffer
@@ -107,6 +107,7 @@ typedef struct st_rm_comms_i2c_bus_extended_cfg
 #endif
     uint32_t          bus_timeout;                          ///< Possible in ticks.
     rm_comms_ctrl_t * p_current_ctrl;                       ///< Current device using the bus (by switching the address)
+    void            * p_scheduler;                          ///< Scheduler that owns the bus, set while RM_COMMS_I2C_SchedulerOpen() is in effect
     void const      * p_driver_instance;                    ///< Pointer to I2C HAL interface to be used in the framework
 } rm_comms_i2c_bus_extended_cfg_t;
 
@@ -126,6 +127,71 @@ typedef struct st_rm_comms_i2c_instance_ctrl
     void const * p_context;            ///< Pointer to the user-provided context
 } rm_comms_i2c_instance_ctrl_t;
 
+/** Transaction types handled by the bus scheduler. */
+typedef enum e_rm_comms_i2c_transaction_type
+{
+    RM_COMMS_I2C_TRANSACTION_TYPE_WRITE      = 0, ///< Write p_src to the device
+    RM_COMMS_I2C_TRANSACTION_TYPE_READ       = 1, ///< Read from the device into p_dest
+    RM_COMMS_I2C_TRANSACTION_TYPE_WRITE_READ = 2, ///< Write p_src, then read into p_dest with restart
+} rm_comms_i2c_transaction_type_t;
+
+/** Transaction states. Managed by the scheduler. */
+typedef enum e_rm_comms_i2c_transaction_state
+{
+    RM_COMMS_I2C_TRANSACTION_STATE_IDLE    = 0, ///< Not queued
+    RM_COMMS_I2C_TRANSACTION_STATE_QUEUED  = 1, ///< Waiting in the ready queue
+    RM_COMMS_I2C_TRANSACTION_STATE_WAITING = 2, ///< Periodic transaction waiting for its next period
+    RM_COMMS_I2C_TRANSACTION_STATE_ACTIVE  = 3, ///< On the bus
+} rm_comms_i2c_transaction_state_t;
+
+struct st_rm_comms_i2c_transaction;
+
+/** Arguments passed to the transaction callback. */
+typedef struct st_rm_comms_i2c_transaction_callback_args
+{
+    rm_comms_event_t                     event;         ///< RM_COMMS_EVENT_OPERATION_COMPLETE or RM_COMMS_EVENT_ERROR
+    struct st_rm_comms_i2c_transaction * p_transaction; ///< Transaction that finished
+    void const * p_context;                             ///< Context provided in the transaction
+} rm_comms_i2c_transaction_callback_args_t;
+
+/** Transaction descriptor. The descriptor is owned by the scheduler from submit until it completes (one-shot) or is
+ * cancelled (periodic), so it must not be placed on the stack of a function that returns in the meantime. */
+typedef struct st_rm_comms_i2c_transaction
+{
+    rm_comms_ctrl_t               * p_device;   ///< Opened RM_COMMS_I2C device on the scheduler's bus
+    rm_comms_i2c_transaction_type_t type;       ///< Transaction type
+    uint8_t  * p_src;                           ///< Write data (WRITE and WRITE_READ)
+    uint32_t   src_bytes;                       ///< Number of bytes to write
+    uint8_t  * p_dest;                          ///< Read buffer (READ and WRITE_READ)
+    uint32_t   dest_bytes;                      ///< Number of bytes to read
+    uint8_t    priority;                        ///< 0 is the highest priority. Typically assigned per device.
+    uint32_t   period;                          ///< Repeat every period scheduler ticks. 0 runs the transaction once.
+
+    /* Pointer to callback and optional working memory */
+    void (* p_callback)(rm_comms_i2c_transaction_callback_args_t * p_args);
+    void const * p_context;            ///< Pointer to the user-provided context
+
+    /* Managed by the scheduler. */
+    volatile rm_comms_i2c_transaction_state_t state;  ///< Current state
+    struct st_rm_comms_i2c_transaction      * p_next; ///< Next transaction in the ready or waiting list
+    uint32_t next_tick;                               ///< Scheduler tick at which a periodic transaction is due
+} rm_comms_i2c_transaction_t;
+
+/** Bus transaction scheduler control structure. */
+typedef struct st_rm_comms_i2c_scheduler_instance_ctrl
+{
+    uint32_t open;                                  ///< Open flag
+    rm_comms_i2c_bus_extended_cfg_t * p_bus;        ///< Bus driven by the scheduler
+    rm_comms_i2c_transaction_t      * p_ready;      ///< Ready queue, sorted by priority
+    rm_comms_i2c_transaction_t      * p_waiting;    ///< Periodic transactions waiting for their next period
+    rm_comms_i2c_transaction_t * volatile p_active; ///< Transaction on the bus
+    rm_comms_ctrl_t * p_current_device;             ///< Device whose address is programmed in the driver
+    rm_comms_ctrl_t * p_restore_device;             ///< Device whose callback is restored by RM_COMMS_I2C_SchedulerClose
+    volatile uint32_t tick;                         ///< Scheduler tick counter
+    bool              read_pending;                 ///< Restart read of a WRITE_READ transaction is outstanding
+    bool              cancel_active;                ///< Active transaction was cancelled and must not be requeued
+} rm_comms_i2c_scheduler_instance_ctrl_t;
+
 /**********************************************************************************************************************
  * Exported global variables
  **********************************************************************************************************************/
@@ -145,6 +211,14 @@ fsp_err_t RM_COMMS_I2C_Read(rm_comms_ctrl_t * const p_api_ctrl, uint8_t * const
 fsp_err_t RM_COMMS_I2C_Write(rm_comms_ctrl_t * const p_api_ctrl, uint8_t * const p_src, uint32_t const bytes);
 fsp_err_t RM_COMMS_I2C_WriteRead(rm_comms_ctrl_t * const            p_api_ctrl,
                                  rm_comms_write_read_params_t const write_read_params);
+fsp_err_t RM_COMMS_I2C_SchedulerOpen(rm_comms_i2c_scheduler_instance_ctrl_t * const p_ctrl,
+                                     rm_comms_i2c_bus_extended_cfg_t * const        p_bus);
+fsp_err_t RM_COMMS_I2C_TransactionSubmit(rm_comms_i2c_scheduler_instance_ctrl_t * const p_ctrl,
+                                         rm_comms_i2c_transaction_t * const             p_transaction);
+fsp_err_t RM_COMMS_I2C_TransactionCancel(rm_comms_i2c_scheduler_instance_ctrl_t * const p_ctrl,
+                                         rm_comms_i2c_transaction_t * const             p_transaction);
+fsp_err_t RM_COMMS_I2C_SchedulerTick(rm_comms_i2c_scheduler_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_COMMS_I2C_SchedulerClose(rm_comms_i2c_scheduler_instance_ctrl_t * const p_ctrl);
 
 #if defined(__CCRX__) || defined(__ICCRX__) || defined(__RX__)
 void rm_comms_i2c_callback(rm_comms_ctrl_t const * p_api_ctrl);
@@ -154,6 +228,7 @@ void rm_comms_i2c_callback(rm_comms_ctrl_t const * p_api_ctrl, bool aborted);
 
 #else
 void rm_comms_i2c_callback(i2c_master_callback_args_t * p_args);
+void rm_comms_i2c_scheduler_callback(i2c_master_callback_args_t * p_args);
 
 /* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
 FSP_FOOTER
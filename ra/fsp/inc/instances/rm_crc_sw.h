@@ -0,0 +1,95 @@
+/***********************************************************************************************************************
+ * Copyright [2020-2024] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef RM_CRC_SW_H
+#define RM_CRC_SW_H
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_CRC_SW
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "rm_crc_sw_cfg.h"
+#include "r_crc_api.h"
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* Number of lookup tables used by the slicing-by-N algorithm. 1 selects the classic byte-wise table algorithm. Each
+ * table takes 1 KB in the control block. */
+#ifndef RM_CRC_SW_CFG_SLICES
+ #define RM_CRC_SW_CFG_SLICES    (4)
+#endif
+
+#if (RM_CRC_SW_CFG_SLICES != 1) && (RM_CRC_SW_CFG_SLICES != 4) && (RM_CRC_SW_CFG_SLICES != 8)
+ #error "RM_CRC_SW_CFG_SLICES must be 1, 4 or 8."
+#endif
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Software CRC instance control structure. */
+typedef struct st_rm_crc_sw_instance_ctrl
+{
+    uint32_t          open;
+    const crc_cfg_t * p_cfg;                          // Pointer to initial configurations
+    uint32_t          result;                         // Result of the last calculation
+    uint32_t          width;                          // Width of the polynomial in bits
+    bool              reflected;                      // True for LSB first calculation
+    uint32_t          table[RM_CRC_SW_CFG_SLICES][256]; // Slicing-by-N lookup tables, generated in open
+} rm_crc_sw_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/** @cond INC_HEADER_DEFS_SEC */
+/** Filled in Interface API structure for this Instance. */
+extern const crc_api_t g_crc_on_crc_sw;
+
+/** @endcond */
+
+/***********************************************************************************************************************
+ * Public APIs
+ **********************************************************************************************************************/
+fsp_err_t RM_CRC_SW_Open(crc_ctrl_t * const p_ctrl, crc_cfg_t const * const p_cfg);
+fsp_err_t RM_CRC_SW_Close(crc_ctrl_t * const p_ctrl);
+fsp_err_t RM_CRC_SW_Calculate(crc_ctrl_t * const p_ctrl, crc_input_t * const p_crc_input, uint32_t * calculatedValue);
+fsp_err_t RM_CRC_SW_CalculatedValueGet(crc_ctrl_t * const p_ctrl, uint32_t * calculatedValue);
+fsp_err_t RM_CRC_SW_SnoopEnable(crc_ctrl_t * const p_ctrl, uint32_t crc_seed);
+fsp_err_t RM_CRC_SW_SnoopDisable(crc_ctrl_t * const p_ctrl);
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup RM_CRC_SW)
+ **********************************************************************************************************************/
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif
@@ -0,0 +1,204 @@
+/***********************************************************************************************************************
+ * Copyright [2020-2024] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_DMAC_COPY
+ * @{
+ **********************************************************************************************************************/
+
+#ifndef RM_DMAC_COPY_H
+#define RM_DMAC_COPY_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "r_transfer_api.h"
+#include "rm_dmac_copy_cfg.h"
+#if BSP_CFG_RTOS == 1                  // ThreadX
+ #include "tx_api.h"
+#elif BSP_CFG_RTOS == 2                // FreeRTOS
+ #include "FreeRTOS.h"
+ #include "semphr.h"
+#endif
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Copy job types */
+typedef enum e_rm_dmac_copy_job_type
+{
+    RM_DMAC_COPY_JOB_TYPE_COPY,        ///< Copy length bytes from p_src to p_dest (memcpy)
+    RM_DMAC_COPY_JOB_TYPE_FILL,        ///< Set length bytes at p_dest to value (memset)
+    RM_DMAC_COPY_JOB_TYPE_COPY_2D,     ///< Copy rows of length bytes from p_src to p_dest using separate strides
+} rm_dmac_copy_job_type_t;
+
+/** Copy job states */
+typedef enum e_rm_dmac_copy_job_state
+{
+    RM_DMAC_COPY_JOB_STATE_IDLE,       ///< The job has not been submitted or has been aborted
+    RM_DMAC_COPY_JOB_STATE_QUEUED,     ///< The job is waiting for a free DMAC channel
+    RM_DMAC_COPY_JOB_STATE_ACTIVE,     ///< The job is being transferred
+    RM_DMAC_COPY_JOB_STATE_COMPLETE,   ///< All data in the job has been transferred
+} rm_dmac_copy_job_state_t;
+
+/** Copy engine events */
+typedef enum e_rm_dmac_copy_event
+{
+    RM_DMAC_COPY_EVENT_JOB_COMPLETE,   ///< A job has completed
+    RM_DMAC_COPY_EVENT_JOB_ABORTED,    ///< A job was removed from the queue by RM_DMAC_COPY_Close
+} rm_dmac_copy_event_t;
+
+struct st_rm_dmac_copy_job;
+
+/** Callback function parameter data */
+typedef struct st_rm_dmac_copy_callback_args
+{
+    rm_dmac_copy_event_t         event;     ///< Event that caused the callback
+    struct st_rm_dmac_copy_job * p_job;     ///< Job that caused the callback
+    void const                 * p_context; ///< Placeholder for user data
+} rm_dmac_copy_callback_args_t;
+
+#if BSP_CFG_RTOS
+
+/** Semaphore released when a job completes */
+typedef struct st_rm_dmac_copy_semaphore
+{
+ #if BSP_CFG_RTOS == 1                 // ThreadX
+    TX_SEMAPHORE * p_semaphore_handle;
+ #elif BSP_CFG_RTOS == 2               // FreeRTOS
+    SemaphoreHandle_t * p_semaphore_handle;
+ #else
+ #endif
+} rm_dmac_copy_semaphore_t;
+#endif
+
+/** Copy job. The job must remain valid until it completes. Fields after state are private to the FSP. */
+typedef struct st_rm_dmac_copy_job
+{
+    rm_dmac_copy_job_type_t type;        ///< Job type
+    void const            * p_src;       ///< Source address (COPY and COPY_2D)
+    void                  * p_dest;      ///< Destination address
+    uint32_t                length;      ///< Number of bytes to copy or fill (bytes per row for COPY_2D)
+    uint32_t                rows;        ///< Number of rows (COPY_2D)
+    uint32_t                src_stride;  ///< Bytes between the start of consecutive source rows (COPY_2D)
+    uint32_t                dest_stride; ///< Bytes between the start of consecutive destination rows (COPY_2D)
+    uint8_t                 value;       ///< Fill value (FILL)
+
+    /** Callback when this job completes. If NULL, rm_dmac_copy_cfg_t::p_callback is used. */
+    void (* p_callback)(rm_dmac_copy_callback_args_t * p_args);
+    void const * p_context;            ///< Placeholder for user data passed to p_callback
+#if BSP_CFG_RTOS
+    rm_dmac_copy_semaphore_t const * p_semaphore; ///< Semaphore released when this job completes (optional)
+#endif
+
+    volatile rm_dmac_copy_job_state_t state; ///< Current state of the job
+    struct st_rm_dmac_copy_job      * p_next;       // Next job in the queue
+    uint32_t                          row;          // Index of the row being transferred
+    uint32_t                          offset;       // Bytes of the current row already transferred
+    uint32_t                          fill_pattern; // Fill value replicated to a word, used as the DMAC source
+} rm_dmac_copy_job_t;
+
+/** User configuration structure, used in open function */
+typedef struct st_rm_dmac_copy_cfg
+{
+    /** DMAC instances owned by the copy engine. Each must use software activation (ELC_EVENT_NONE) and have its
+     * interrupt enabled. The transfer callback is overwritten in RM_DMAC_COPY_Open. */
+    transfer_instance_t const * const * p_transfer_instances;
+    uint8_t                             num_channels; ///< Number of entries in p_transfer_instances
+
+    /** Jobs shorter than this many bytes are copied by the CPU in RM_DMAC_COPY_Submit because the DMAC setup and
+     * interrupt cost more than the copy itself. Set to 0 to always use the DMAC. */
+    uint32_t cpu_copy_threshold;
+
+    void (* p_callback)(rm_dmac_copy_callback_args_t * p_args); ///< Default job callback (optional)
+    void const * p_context;                                       ///< Placeholder for user data
+} rm_dmac_copy_cfg_t;
+
+/** Result of RM_DMAC_COPY_Benchmark */
+typedef struct st_rm_dmac_copy_benchmark
+{
+    uint32_t length;                   ///< Bytes copied
+    uint32_t cpu_cycles;               ///< Core clock cycles taken by memcpy
+    uint32_t dmac_cycles;              ///< Core clock cycles from submission until the DMAC job completed
+} rm_dmac_copy_benchmark_t;
+
+struct st_rm_dmac_copy_instance_ctrl;
+
+/** DMAC channel state. This is private to the FSP and should not be used or modified by the application. */
+typedef struct st_rm_dmac_copy_channel
+{
+    struct st_rm_dmac_copy_instance_ctrl * p_ctrl;
+    transfer_instance_t const            * p_transfer;
+    rm_dmac_copy_job_t * volatile          p_job;   // Job being transferred, NULL if the channel is idle
+    uint32_t                               chunk;   // Bytes in the transfer in progress
+    transfer_info_t                        info;    // Transfer settings of the transfer in progress
+} rm_dmac_copy_channel_t;
+
+/** Instance control block. This is private to the FSP and should not be used or modified by the application. */
+typedef struct st_rm_dmac_copy_instance_ctrl
+{
+    uint32_t                   open;
+    rm_dmac_copy_cfg_t const * p_cfg;
+    rm_dmac_copy_job_t       * p_head;                                // First queued job
+    rm_dmac_copy_job_t       * p_tail;                                // Last queued job
+    rm_dmac_copy_channel_t     channels[BSP_FEATURE_DMAC_MAX_CHANNEL]; // Channel state, indexed like p_transfer_instances
+} rm_dmac_copy_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Public APIs
+ **********************************************************************************************************************/
+fsp_err_t RM_DMAC_COPY_Open(rm_dmac_copy_instance_ctrl_t * const p_ctrl, rm_dmac_copy_cfg_t const * const p_cfg);
+fsp_err_t RM_DMAC_COPY_Submit(rm_dmac_copy_instance_ctrl_t * const p_ctrl, rm_dmac_copy_job_t * const p_job);
+fsp_err_t RM_DMAC_COPY_Benchmark(rm_dmac_copy_instance_ctrl_t * const p_ctrl,
+                                 void * const                         p_dest,
+                                 void const * const                   p_src,
+                                 uint32_t const                       length,
+                                 rm_dmac_copy_benchmark_t * const     p_result);
+
+#if BSP_CFG_RTOS
+fsp_err_t RM_DMAC_COPY_JobWait(rm_dmac_copy_instance_ctrl_t * const p_ctrl,
+                               rm_dmac_copy_job_t * const           p_job,
+                               uint32_t const                       timeout);
+#endif
+fsp_err_t RM_DMAC_COPY_Close(rm_dmac_copy_instance_ctrl_t * const p_ctrl);
+
+void rm_dmac_copy_transfer_callback(transfer_callback_args_t * p_args);
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 // RM_DMAC_COPY_H
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_DMAC_COPY)
+ **********************************************************************************************************************/
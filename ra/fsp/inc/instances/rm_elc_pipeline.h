@@ -0,0 +1,123 @@
+/***********************************************************************************************************************
+ * Copyright [2020-2024] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_ELC_PIPELINE
+ * @{
+ **********************************************************************************************************************/
+
+#ifndef RM_ELC_PIPELINE_H
+#define RM_ELC_PIPELINE_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "r_elc_api.h"
+#include "r_timer_api.h"
+#include "r_adc_api.h"
+#include "r_transfer_api.h"
+#include "r_dac_api.h"
+#include "r_spi_api.h"
+#include "rm_elc_pipeline_cfg.h"
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Stage types */
+typedef enum e_rm_elc_pipeline_stage_type
+{
+    RM_ELC_PIPELINE_STAGE_TYPE_TIMER,    ///< Timer (timer_instance_t), started and stopped with the pipeline
+    RM_ELC_PIPELINE_STAGE_TYPE_ADC,      ///< ADC (adc_instance_t), scan enabled and disabled with the pipeline
+    RM_ELC_PIPELINE_STAGE_TYPE_TRANSFER, ///< DTC or DMAC (transfer_instance_t), enabled and disabled with the pipeline
+    RM_ELC_PIPELINE_STAGE_TYPE_DAC,      ///< DAC (dac_instance_t), started and stopped with the pipeline
+    RM_ELC_PIPELINE_STAGE_TYPE_SPI,      ///< SPI (spi_instance_t), only produces events for transfer stages
+} rm_elc_pipeline_stage_type_t;
+
+/** One producer/consumer stage. Stages are listed in data flow order, from the first producer to the last consumer. */
+typedef struct st_rm_elc_pipeline_stage
+{
+    rm_elc_pipeline_stage_type_t type; ///< Stage type
+    void const * p_instance;           ///< Opened instance of the type selected by type
+
+    /** Event that triggers this stage. For timer, ADC and DAC stages this event is linked to elc_input through the
+     * ELC. For transfer stages it must be the activation source the transfer instance was opened with. ELC_EVENT_NONE
+     * uses the event produced by the previous stage; the first stage is then started by software only. */
+    elc_event_t trigger;
+
+    /** Event this stage produces for the next stage. ELC_EVENT_NONE for an ADC stage resolves to the scan end event
+     * of the unit. */
+    elc_event_t event;
+
+    /** ELC input of timer and DAC stages. ADC stages use the input of their unit. Ignored by other stages. */
+    elc_peripheral_t elc_input;
+
+    /** Transfer stages only: descriptor loaded with transfer_api_t::reconfigure when the pipeline starts, or NULL to
+     * enable the transfer with its current descriptor. If the previous stage is an ADC and p_src is NULL, the
+     * source, length and size are resolved from the ADC data registers when the pipeline is opened. */
+    transfer_info_t * p_info;
+} rm_elc_pipeline_stage_t;
+
+/** User configuration structure, used in open function */
+typedef struct st_rm_elc_pipeline_cfg
+{
+    elc_instance_t const          * p_elc;      ///< Opened ELC instance used to create the links
+    rm_elc_pipeline_stage_t const * p_stages;   ///< Stages in data flow order
+    uint8_t                         num_stages; ///< Number of entries in p_stages
+} rm_elc_pipeline_cfg_t;
+
+/** Instance control block. This is private to the FSP and should not be used or modified by the application. */
+typedef struct st_rm_elc_pipeline_instance_ctrl
+{
+    uint32_t                      open;
+    rm_elc_pipeline_cfg_t const * p_cfg;
+    uint32_t                      elc_inputs; // ELC inputs linked by this pipeline, bit n is elc_peripheral_t n
+    bool                          running;
+} rm_elc_pipeline_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Public APIs
+ **********************************************************************************************************************/
+fsp_err_t RM_ELC_PIPELINE_Open(rm_elc_pipeline_instance_ctrl_t * const p_ctrl,
+                               rm_elc_pipeline_cfg_t const * const     p_cfg);
+fsp_err_t RM_ELC_PIPELINE_Start(rm_elc_pipeline_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_ELC_PIPELINE_Stop(rm_elc_pipeline_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_ELC_PIPELINE_Close(rm_elc_pipeline_instance_ctrl_t * const p_ctrl);
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 // RM_ELC_PIPELINE_H
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_ELC_PIPELINE)
+ **********************************************************************************************************************/
@@ -44,6 +44,23 @@ FSP_HEADER
  * Typedef definitions
  **********************************************************************************************************************/
 
+/** Extended configuration for request merging. Set rm_filex_block_media_cfg_t::p_extend to NULL to issue every FileX
+ * request to the block media driver directly. */
+typedef struct st_rm_filex_block_media_extended_cfg
+{
+    /** Read buffer, read_buffer_sectors * sector size bytes. Small reads fill the whole buffer so following reads of
+     * adjacent sectors are served without a media request. When a read reaches the end of the buffer, the next
+     * sectors are requested before returning so the transfer overlaps with FileX processing the data. */
+    uint8_t * p_read_buffer;
+    uint32_t  read_buffer_sectors;     ///< Sectors in the read buffer, 0 disables read merging
+
+    /** Write buffer, 2 * write_buffer_sectors * sector size bytes. Writes to adjacent sectors are collected in one
+     * half and written with one media request while the other half collects the next writes. Errors of a write that
+     * completes after the driver returned are reported on the next request. */
+    uint8_t * p_write_buffer;
+    uint32_t  write_buffer_sectors;    ///< Sectors in each half of the write buffer, 0 disables write merging
+} rm_filex_block_media_extended_cfg_t;
+
 /** FileX block media private control block. DO NOT MODIFY.  Initialization occurs when RM_FILEX_BLOCK_MEDIA_Open is called. */
 typedef struct
 {
@@ -51,6 +68,16 @@ typedef struct
     rm_filex_block_media_cfg_t const * p_cfg;
     volatile rm_block_media_event_t    last_event;
     volatile bool event_ready;
+    uint32_t      sector_size_bytes;
+    uint32_t      sector_count;
+    bool          transfer_pending;
+    bool          transfer_is_write;
+    uint32_t      read_sector;
+    uint32_t      read_count;
+    uint32_t      write_sector;
+    uint32_t      write_count;
+    uint32_t      write_half;
+    rm_filex_block_media_stats_t stats;
 } rm_filex_block_media_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -59,6 +86,9 @@ typedef struct
 fsp_err_t RM_FILEX_BLOCK_MEDIA_Open(rm_filex_block_media_ctrl_t * const      p_ctrl,
                                     rm_filex_block_media_cfg_t const * const p_cfg);
 fsp_err_t RM_FILEX_BLOCK_MEDIA_Close(rm_filex_block_media_ctrl_t * const p_ctrl);
+fsp_err_t RM_FILEX_BLOCK_MEDIA_StatsGet(rm_filex_block_media_ctrl_t * const  p_ctrl,
+                                        rm_filex_block_media_stats_t * const p_stats,
+                                        bool                                 reset);
 void      RM_FILEX_BLOCK_MEDIA_BlockDriver(FX_MEDIA * p_fx_media);
 
 /**********************************************************************************************************************
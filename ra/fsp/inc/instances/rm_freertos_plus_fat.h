@@ -49,6 +49,31 @@ FSP_HEADER
  * Typedef definitions
  **********************************************************************************************************************/
 
+/** Sector cache entry. One entry is required for each sector of sector cache memory. */
+typedef struct st_rm_freertos_plus_fat_cache_entry
+{
+    uint32_t sector;                   ///< Sector held by this entry
+    uint32_t last_use;                 ///< Least recently used timestamp
+    uint32_t state;                    ///< Valid and dirty flags
+} rm_freertos_plus_fat_cache_entry_t;
+
+/** Extended configuration for the port layer sector cache. Set rm_freertos_plus_fat_cfg_t::p_extend to NULL to
+ * forward every request to the block media driver. */
+typedef struct st_rm_freertos_plus_fat_extended_cfg
+{
+    /** Write-back sector cache memory, num_cache_sectors * sector size bytes. Writes are collected in the cache and
+     * written to the media in runs of adjacent sectors when entries are evicted or the cache is flushed. */
+    uint8_t * p_cache;
+    rm_freertos_plus_fat_cache_entry_t * p_cache_entries; ///< Array of num_cache_sectors cache entries
+    uint32_t num_cache_sectors;                           ///< Number of sectors in the cache, 0 disables write-back caching
+
+    /** Read-ahead buffer, read_ahead_sectors * sector size bytes. When sequential reads are detected, the sectors
+     * following the last read are requested from the media before returning so the transfer overlaps with the
+     * caller processing the data. */
+    uint8_t * p_read_ahead_buffer;
+    uint32_t  read_ahead_sectors;      ///< Number of sectors to read ahead, 0 disables read-ahead
+} rm_freertos_plus_fat_extended_cfg_t;
+
 /** FreeRTOS plus FAT private control block. DO NOT MODIFY.  Initialization occurs when RM_FREERTOS_PLUS_FAT_Open is called. */
 typedef struct
 {
@@ -62,6 +87,13 @@ typedef struct
  #else
     volatile bool event_ready;
  #endif
+    uint32_t      sector_size_bytes;
+    uint32_t      sector_count;
+    uint32_t      cache_tick;
+    uint32_t      next_read_sector;
+    uint32_t      read_ahead_sector;
+    uint32_t      read_ahead_count;
+    volatile bool read_ahead_pending;
 } rm_freertos_plus_fat_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -80,6 +112,7 @@ fsp_err_t RM_FREERTOS_PLUS_FAT_InfoGet(rm_freertos_plus_fat_ctrl_t * const p_ctr
                                        FF_Disk_t * const                   p_disk,
                                        rm_freertos_plus_fat_info_t * const p_info);
 fsp_err_t RM_FREERTOS_PLUS_FAT_Close(rm_freertos_plus_fat_ctrl_t * const p_ctrl);
+fsp_err_t RM_FREERTOS_PLUS_FAT_CacheFlush(rm_freertos_plus_fat_ctrl_t * const p_ctrl);
 
  #ifdef __cplusplus
 }                                      /* extern "C" */
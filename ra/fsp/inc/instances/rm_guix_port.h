@@ -68,6 +68,29 @@ typedef struct st_rm_guix_port_callback_args
     uint32_t              error;       ///< Error code if RM_GUIX_PORT_EVENT_ERROR
 } rm_guix_port_callback_args_t;
 
+/** Compressed frame supplied by an MJPEG source */
+typedef struct st_rm_guix_port_mjpeg_frame
+{
+    uint8_t const * p_data;            ///< JPEG bitstream of the frame (8-byte aligned)
+    uint32_t        size;              ///< Size of the bitstream in bytes
+} rm_guix_port_mjpeg_frame_t;
+
+/** MJPEG source callback. Fill in p_frame with the next frame and return true, or return false if no new frame is
+ * available yet (the previous frame is shown again). The bitstream must remain valid until the next call. */
+typedef bool (* rm_guix_port_mjpeg_source_t)(rm_guix_port_mjpeg_frame_t * p_frame, void * p_context);
+
+/** MJPEG playback statistics. Times are in ThreadX ticks. */
+typedef struct st_rm_guix_port_mjpeg_stats
+{
+    uint32_t frames_drawn;             ///< Number of new frames drawn
+    uint32_t frames_dropped;           ///< Number of frames that failed to decode
+    uint32_t source_underruns;         ///< Number of times the source had no new frame
+    uint32_t frame_time_last;          ///< Time between the two most recent new frames
+    uint32_t frame_time_max;           ///< Longest time between two new frames
+    uint32_t decode_wait_last;         ///< Time the most recent draw spent waiting for the JPEG Codec
+    uint32_t decode_wait_max;          ///< Longest time a draw spent waiting for the JPEG Codec
+} rm_guix_port_mjpeg_stats_t;
+
 /* Configuration structure for the FSP GUIX Port */
 typedef struct st_rm_guix_port_cfg
 {
@@ -110,6 +133,10 @@ typedef struct st_rm_guix_port_instance_ctrl
  * Public APIs
  **********************************************************************************************************************/
 UINT rm_guix_port_hw_initialize(GX_DISPLAY * p_display);
+UINT rm_guix_port_mjpeg_start(rm_guix_port_mjpeg_source_t p_source, void * p_context);
+UINT rm_guix_port_mjpeg_stop(void);
+VOID rm_guix_port_mjpeg_draw(GX_DRAW_CONTEXT * p_context, INT x, INT y);
+UINT rm_guix_port_mjpeg_stats_get(rm_guix_port_mjpeg_stats_t * p_stats);
 
 /*******************************************************************************************************************//**
  * @} (end addtogroup RM_GUIX_PORT)
@@ -0,0 +1,129 @@
+/***********************************************************************************************************************
+ * Copyright [2020-2024] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_JPEG_CAPTURE
+ * @{
+ **********************************************************************************************************************/
+
+#ifndef RM_JPEG_CAPTURE_H
+#define RM_JPEG_CAPTURE_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "r_capture_api.h"
+#include "r_jpeg_api.h"
+#include "r_ceu.h"
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Pipeline events. More than one event may be reported in a single callback. */
+typedef enum e_rm_jpeg_capture_event
+{
+    RM_JPEG_CAPTURE_EVENT_CHUNK_READY   = 0x01, ///< Newly encoded data is available at p_data
+    RM_JPEG_CAPTURE_EVENT_FRAME_END     = 0x02, ///< The current frame is completely encoded
+    RM_JPEG_CAPTURE_EVENT_STRIP_OVERRUN = 0x04, ///< The camera overwrote a strip before the encoder consumed it
+    RM_JPEG_CAPTURE_EVENT_CAPTURE_ERROR = 0x08, ///< The CEU reported a capture error; the frame was abandoned
+    RM_JPEG_CAPTURE_EVENT_ENCODE_ERROR  = 0x10, ///< The JPEG codec reported an error; the frame was abandoned
+} rm_jpeg_capture_event_t;
+
+/** Callback function parameter data */
+typedef struct st_rm_jpeg_capture_callback_args
+{
+    uint32_t        event;             ///< Bitmask of rm_jpeg_capture_event_t
+    uint8_t const * p_data;            ///< Start of the new encoded data (CHUNK_READY) or of the frame (FRAME_END)
+    uint32_t        length;            ///< Length of the new encoded data (CHUNK_READY) or of the frame (FRAME_END)
+    uint32_t        frame_count;       ///< Number of frames started since RM_JPEG_CAPTURE_Start
+    void const    * p_context;         ///< Placeholder for user data
+} rm_jpeg_capture_callback_args_t;
+
+/** User configuration structure, used in open function */
+typedef struct st_rm_jpeg_capture_cfg
+{
+    /** CEU instance. The CEU must be configured for bundle write mode with 8 or 16 lines per bundle and its
+     * interrupts must include CEU_EVENT_BUNDLE_A_END, CEU_EVENT_BUNDLE_B_END and CEU_EVENT_FRAME_END. */
+    capture_instance_t const * p_capture;
+
+    /** JPEG instance in encode mode. Its encode callback must be rm_jpeg_capture_jpeg_callback with this module's
+     * control block as the encode context. */
+    jpeg_instance_t const * p_jpeg;
+
+    uint8_t  * p_strip_buffer;                                         ///< Two strips of captured lines (2 x bundle size), 8-byte aligned
+    uint8_t ** pp_frame_buffers;                                       ///< Ring of encoded frame buffers, each 8-byte aligned
+    uint8_t    frame_buffer_count;                                     ///< Number of buffers in pp_frame_buffers
+    uint32_t   frame_buffer_size;                                      ///< Size of each encoded frame buffer in bytes
+    void (* p_callback)(rm_jpeg_capture_callback_args_t * p_args);     ///< Pointer to callback function
+    void const * p_context;                                            ///< Placeholder for user data
+} rm_jpeg_capture_cfg_t;
+
+/** Instance control block. This is private to the FSP and should not be used or modified by the application. */
+typedef struct st_rm_jpeg_capture_instance_ctrl
+{
+    uint32_t                      open;
+    rm_jpeg_capture_cfg_t const * p_cfg;
+    uint32_t                      strip_size;       // Bytes per strip (CEU bundle size)
+    uint16_t                      strips_per_frame; // Number of strips in one frame
+    volatile uint16_t             strips_captured;  // Strips written by the CEU in the current frame
+    volatile uint16_t             strips_submitted; // Strips handed to the JPEG encoder in the current frame
+    volatile bool                 encoding;         // The JPEG encoder is consuming a strip
+    volatile bool                 streaming;        // Restart capture when the current frame completes
+    volatile bool                 frame_active;     // A frame is being captured and encoded
+    volatile bool                 stale_frame_end;  // A FRAME_END of an aborted frame may still arrive
+    uint8_t                       frame_index;      // Index of the active buffer in pp_frame_buffers
+    uint32_t                      frame_events;     // Error events accumulated for the current frame
+    uint32_t                      frame_count;      // Number of frames started since RM_JPEG_CAPTURE_Start
+    uint32_t                      bytes_reported;   // Encoded bytes of the current frame already reported
+} rm_jpeg_capture_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Public APIs
+ **********************************************************************************************************************/
+fsp_err_t RM_JPEG_CAPTURE_Open(rm_jpeg_capture_instance_ctrl_t * const p_ctrl,
+                               rm_jpeg_capture_cfg_t const * const     p_cfg);
+fsp_err_t RM_JPEG_CAPTURE_Start(rm_jpeg_capture_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_JPEG_CAPTURE_Stop(rm_jpeg_capture_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_JPEG_CAPTURE_Close(rm_jpeg_capture_instance_ctrl_t * const p_ctrl);
+
+void rm_jpeg_capture_jpeg_callback(jpeg_callback_args_t * p_args);
+void rm_jpeg_capture_ceu_callback(capture_callback_args_t * p_args);
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 // RM_JPEG_CAPTURE_H
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_JPEG_CAPTURE)
+ **********************************************************************************************************************/
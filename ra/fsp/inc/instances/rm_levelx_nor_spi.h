@@ -41,6 +41,9 @@ FSP_HEADER
  * Macro definitions
  ***********************************************************************************************************************/
 
+/** Number of 32-bit words required for rm_levelx_nor_spi_cfg_t::p_erased_block_map. */
+#define RM_LEVELX_NOR_SPI_ERASED_BLOCK_MAP_WORDS(size, erase_size)    ((((size) / (erase_size)) + 31U) / 32U)
+
 /**********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -69,6 +72,12 @@ typedef struct st_rm_levelx_nor_spi_cfg
     uint32_t     poll_status_count;                                  ///< Number of times to poll for operation complete status before returning an error.
     void const * p_context;                                          ///< Placeholder for user data. Passed to the user callback.
     void (* p_callback)(rm_levelx_nor_spi_callback_args_t * p_args); ///< Callback function
+
+    /** Optional RAM bitmap with one bit per block, RM_LEVELX_NOR_SPI_ERASED_BLOCK_MAP_WORDS words. A bit is set when
+     * a block passes erased verification and cleared when the block is written or erased, so verifying a block again
+     * returns without reading the flash. Set to NULL to read the flash on every verification. The bitmap is only
+     * valid while all writes to the partition go through this driver. */
+    uint32_t * p_erased_block_map;
 } rm_levelx_nor_spi_cfg_t;
 
 /** SF_EL_LX_NOR Control Block Type */
@@ -56,7 +56,7 @@ typedef __PACKED_STRUCT st_rai_data_shipper_header_buffer_type
     uint8_t  version;                                                     // Version
     uint8_t  crc_enable;                                                  // CRC enabled or not
     uint8_t  instance_id;                                                 // Data collector instance id
-    uint8_t  reserved;                                                    // Reserved
+    uint8_t  encoding;                                                    // Channel encoding, see rai_data_shipper_compression_t
     uint16_t events;                                                      // Events e.g buffer overflow
     uint16_t diagnostic_data_len;                                         // Diagnostic data length in bytes
     uint32_t frame_buf_len;                                               // Frame buffer length in data samples
@@ -76,6 +76,9 @@ typedef struct st_rai_data_shipper_tx_info_type
     uint8_t channels;                                                                  // Total number of channels
     uint8_t write_requests;                                                            // Skipped write request counter
     uint8_t crc;                                                                       // 8-bit CRC value
+    uint32_t packed_len;                                                               // Bytes of the frame in the transmit buffer, 0 if sent segment by segment
+    volatile bool crc_ready;                                                           // CRC of the frame has been calculated
+    volatile bool send_deferred;                                                       // CRC segment is sent when the CRC calculation finishes
 
     rai_data_shipper_data_buffer_t   data[RM_RAI_DATA_COLLECTOR_CFG_MAX_CHANNELS + 2]; // Array of sensor buffers + Debug data + CRC
     rai_data_shipper_header_buffer_t header;                                           // Header buffer
@@ -89,6 +92,7 @@ typedef struct st_rai_data_shipper_instance_ctrl
     rai_data_shipper_tx_info_t     tx_info[RM_RAI_DATA_SHIPPER_MAX_NUMBER_OF_DC_INSTANCES]; // Cached tx info. Data collector instance will be indexed by its ID.
     volatile uint8_t               data_ready_mask;                                         // Bit mask of data collector instances that have data ready to be sent.
     uint8_t index;                                                                          // Instance being sent
+    volatile bool                  tx_buffer_busy;                                          // Transmit buffer holds a frame that is queued or being sent
 } rai_data_shipper_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -0,0 +1,153 @@
+/***********************************************************************************************************************
+ * Copyright [2020-2024] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef RM_RTOS_TRACE_H
+#define RM_RTOS_TRACE_H
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_RTOS_TRACE
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "rm_rtos_trace_cfg.h"
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/** Marker at the start of every frame written to the sink ("RTTR" in little endian). */
+#define RM_RTOS_TRACE_FRAME_MAGIC       (0x52545452U)
+
+/** Version of the frame format. */
+#define RM_RTOS_TRACE_FRAME_VERSION     (1U)
+
+/** Length of the task name reported in task frames, including the terminator. */
+#define RM_RTOS_TRACE_TASK_NAME_LENGTH  (16U)
+
+/** Event ID used for the SysTick interrupt. */
+#define RM_RTOS_TRACE_ID_SYSTICK        (0xFFFFU)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Event types stored in the ring. */
+typedef enum e_rm_rtos_trace_event_type
+{
+    RM_RTOS_TRACE_EVENT_TYPE_TASK_SWITCH = 1, ///< A task was switched in. ID is the task slot.
+    RM_RTOS_TRACE_EVENT_TYPE_ISR_ENTER   = 2, ///< An interrupt started. ID is the IRQ number.
+    RM_RTOS_TRACE_EVENT_TYPE_ISR_EXIT    = 3, ///< An interrupt finished. ID is the IRQ number.
+    RM_RTOS_TRACE_EVENT_TYPE_MARK        = 4, ///< User marker from RM_RTOS_TRACE_Mark. ID is user defined.
+} rm_rtos_trace_event_type_t;
+
+/** Frame types written to the sink. */
+typedef enum e_rm_rtos_trace_frame_type
+{
+    RM_RTOS_TRACE_FRAME_TYPE_INFO   = 1,   ///< Payload is rm_rtos_trace_frame_info_t
+    RM_RTOS_TRACE_FRAME_TYPE_TASK   = 2,   ///< Payload is rm_rtos_trace_frame_task_t
+    RM_RTOS_TRACE_FRAME_TYPE_EVENTS = 3,   ///< Payload is an array of rm_rtos_trace_event_t
+} rm_rtos_trace_frame_type_t;
+
+/** One event in the ring. */
+typedef struct st_rm_rtos_trace_event
+{
+    uint32_t timestamp;                ///< Timestamp counter (DWT CYCCNT by default)
+    uint8_t  type;                     ///< Event type, see rm_rtos_trace_event_type_t
+    uint8_t  nesting;                  ///< Interrupt nesting level after the event
+    uint16_t id;                       ///< Task slot, IRQ number or marker ID
+} rm_rtos_trace_event_t;
+
+/** Header that starts every frame written to the sink. All fields are little endian. */
+typedef struct st_rm_rtos_trace_frame_header
+{
+    uint32_t magic;                    ///< RM_RTOS_TRACE_FRAME_MAGIC
+    uint8_t  type;                     ///< Frame type, see rm_rtos_trace_frame_type_t
+    uint8_t  version;                  ///< RM_RTOS_TRACE_FRAME_VERSION
+    uint16_t length;                   ///< Payload length in bytes
+} rm_rtos_trace_frame_header_t;
+
+/** Payload of an info frame. */
+typedef struct st_rm_rtos_trace_frame_info
+{
+    uint32_t timestamp_hz;             ///< Timestamp counter frequency
+    uint32_t timestamp;                ///< Timestamp when the frame was written
+    uint32_t lost;                     ///< Events overwritten before they could be flushed since the last info frame
+    uint32_t reserved;
+    uint64_t isr_cycles;               ///< Total time spent in interrupts
+} rm_rtos_trace_frame_info_t;
+
+/** Payload of a task frame. */
+typedef struct st_rm_rtos_trace_frame_task
+{
+    uint16_t slot;                                 ///< Task slot used as the ID of task switch events
+    uint16_t reserved;
+    uint32_t handle;                               ///< RTOS task handle
+    uint64_t cycles;                               ///< Total time the task ran, excluding interrupts
+    char     name[RM_RTOS_TRACE_TASK_NAME_LENGTH]; ///< Task name, NUL terminated
+} rm_rtos_trace_frame_task_t;
+
+/** Context for the memory sink. */
+typedef struct st_rm_rtos_trace_memory_sink
+{
+    uint8_t * p_buffer;                ///< Destination buffer
+    uint32_t  size;                    ///< Size of p_buffer in bytes
+    uint32_t  used;                    ///< Bytes written so far. Set to 0 to restart the dump.
+} rm_rtos_trace_memory_sink_t;
+
+/** Accumulated statistics for one task. */
+typedef struct st_rm_rtos_trace_task_stats
+{
+    void const * p_handle;             ///< RTOS task handle, NULL for time spent with no task running
+    char const * p_name;               ///< Task name
+    uint64_t     cycles;               ///< Total time the task ran, excluding interrupts
+} rm_rtos_trace_task_stats_t;
+
+/***********************************************************************************************************************
+ * Public APIs
+ **********************************************************************************************************************/
+fsp_err_t RM_RTOS_TRACE_Open(bsp_sink_t const * const p_sink);
+fsp_err_t RM_RTOS_TRACE_Start(void);
+fsp_err_t RM_RTOS_TRACE_Stop(void);
+fsp_err_t RM_RTOS_TRACE_Flush(void);
+fsp_err_t RM_RTOS_TRACE_TaskStatsGet(uint32_t slot, rm_rtos_trace_task_stats_t * const p_stats);
+void      RM_RTOS_TRACE_Mark(uint16_t id);
+fsp_err_t RM_RTOS_TRACE_Close(void);
+fsp_err_t RM_RTOS_TRACE_MemorySinkWrite(void * p_context, uint8_t const * p_data, uint32_t bytes);
+
+/* Hooks called by the RTOS ports and FSP_CONTEXT_SAVE/FSP_CONTEXT_RESTORE. */
+void rm_rtos_trace_task_switch(void const * p_handle, char const * p_name);
+void rm_rtos_trace_isr_enter(uint32_t irq);
+void rm_rtos_trace_isr_exit(uint32_t irq);
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_RTOS_TRACE)
+ **********************************************************************************************************************/
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif
@@ -55,6 +55,15 @@
 
 #define ARMV8_MPU_REGION_MIN_SIZE                     (32U)
 
+/* Boot stages are timestamped with the DWT cycle counter. */
+#if BSP_CFG_BOOT_PROFILE_ENABLE && BSP_FEATURE_DWT_CYCCNT
+ #define BSP_PRV_BOOT_PROFILE                        (1)
+ #define BSP_PRV_BOOT_STAGE_RECORD(stage)            (g_bsp_boot_profile.timestamp[(stage)] = DWT->CYCCNT)
+#else
+ #define BSP_PRV_BOOT_PROFILE                        (0)
+ #define BSP_PRV_BOOT_STAGE_RECORD(stage)
+#endif
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -66,6 +75,12 @@
 /** System Clock Frequency (Core Clock) */
 uint32_t SystemCoreClock BSP_SECTION_EARLY_INIT;
 
+#if BSP_CFG_BOOT_PROFILE_ENABLE
+
+/** Cycle counts of the latest boot. This is not initialized by the C runtime environment. */
+bsp_boot_profile_t g_bsp_boot_profile BSP_PLACE_IN_SECTION(BSP_SECTION_NOINIT);
+#endif
+
 #if defined(__ARMCC_VERSION)
 extern uint32_t Image$$BSS$$ZI$$Base;
 extern uint32_t Image$$BSS$$ZI$$Length;
@@ -228,6 +243,19 @@ static void bsp_init_mpu(void);
  **********************************************************************************************************************/
 BSP_SECTION_FLASH_GAP void SystemInit (void)
 {
+#if BSP_CFG_BOOT_PROFILE_ENABLE
+
+    /* Invalidate the previous record. The magic number is written again once every stage has been recorded. */
+    memset(&g_bsp_boot_profile, 0, sizeof(g_bsp_boot_profile));
+#endif
+
+#if BSP_PRV_BOOT_PROFILE
+
+    /* Restart the cycle counter so that stages are recorded as cycles since SystemInit entry. */
+    R_BSP_CycleCounterEnable();
+    DWT->CYCCNT = 0U;
+#endif
+
 #if defined(RENESAS_CORTEX_M85)
 
     /* Enable the instruction cache, branch prediction, and the branch cache (required for Low Overhead Branch (LOB) extension).
@@ -302,6 +330,8 @@ BSP_SECTION_FLASH_GAP void SystemInit (void)
     /* Call pre clock initialization hook. */
     R_BSP_WarmStart(BSP_WARM_START_RESET);
 
+    BSP_PRV_BOOT_STAGE_RECORD(BSP_BOOT_STAGE_CLOCK_START);
+
 #if BSP_TZ_CFG_SKIP_INIT
 
     /* Initialize clock variables to be used with R_BSP_SoftwareDelay. */
@@ -320,6 +350,8 @@ BSP_SECTION_FLASH_GAP void SystemInit (void)
  #endif
 #endif
 
+    BSP_PRV_BOOT_STAGE_RECORD(BSP_BOOT_STAGE_CLOCK_DONE);
+
     /* Call post clock initialization hook. */
     R_BSP_WarmStart(BSP_WARM_START_POST_CLOCK);
 
@@ -350,52 +382,10 @@ BSP_SECTION_FLASH_GAP void SystemInit (void)
 #endif
 
 #if BSP_CFG_C_RUNTIME_INIT
+ #if !BSP_PRV_FAST_BOOT
 
-    /* Initialize C runtime environment. */
-    /* Zero out BSS */
- #if defined(__ARMCC_VERSION)
-    memset((uint8_t *) &Image$$BSS$$ZI$$Base, 0U, (uint32_t) &Image$$BSS$$ZI$$Length);
- #elif defined(__GNUC__)
-    memset(&__bss_start__, 0U, ((uint32_t) &__bss_end__ - (uint32_t) &__bss_start__));
- #elif defined(__ICCARM__)
-    memset((uint32_t *) __section_begin(".bss"), 0U, (uint32_t) __section_size(".bss"));
- #endif
-
-    /* Copy initialized RAM data from ROM to RAM. */
- #if defined(__ARMCC_VERSION)
-    memcpy((uint8_t *) &Image$$DATA$$Base, (uint8_t *) &Load$$DATA$$Base, (uint32_t) &Image$$DATA$$Length);
- #elif defined(__GNUC__)
-    memcpy(&__data_start__, &__etext, ((uint32_t) &__data_end__ - (uint32_t) &__data_start__));
- #elif defined(__ICCARM__)
-    memcpy((uint32_t *) __section_begin(".data"), (uint32_t *) __section_begin(".data_init"),
-           (uint32_t) __section_size(".data"));
-
-    /* Copy functions to be executed from RAM. */
-  #pragma section=".code_in_ram"
-  #pragma section=".code_in_ram_init"
-    memcpy((uint32_t *) __section_begin(".code_in_ram"),
-           (uint32_t *) __section_begin(".code_in_ram_init"),
-           (uint32_t) __section_size(".code_in_ram"));
-
-    /* Copy main thread TLS to RAM. */
-  #pragma section="__DLIB_PERTHREAD_init"
-  #pragma section="__DLIB_PERTHREAD"
-    memcpy((uint32_t *) __section_begin("__DLIB_PERTHREAD"), (uint32_t *) __section_begin("__DLIB_PERTHREAD_init"),
-           (uint32_t) __section_size("__DLIB_PERTHREAD_init"));
- #endif
-
-    /* Initialize TCM memory. */
- #if BSP_FEATURE_BSP_HAS_ITCM
-    bsp_init_itcm();
- #endif
- #if BSP_FEATURE_BSP_HAS_DTCM
-    bsp_init_dtcm();
- #endif
-
- #if defined(RENESAS_CORTEX_M85)
-
-    /* Invalidate I-Cache after initializing the .code_in_ram section. */
-    SCB_InvalidateICache();
+    /* Initialize C runtime environment. In fast boot mode this was done during clock initialization. */
+    bsp_ram_init();
  #endif
 
  #if defined(__GNUC__) && defined(__llvm__) && !defined(__CLANG_TIDY__) && !(defined __ARMCC_VERSION)
@@ -427,6 +417,8 @@ BSP_SECTION_FLASH_GAP void SystemInit (void)
     void const * ilimit = __section_end("SHT$$INIT_ARRAY");
     __call_ctors(pibase, ilimit);
  #endif
+
+    BSP_PRV_BOOT_STAGE_RECORD(BSP_BOOT_STAGE_C_RUNTIME_DONE);
 #endif                                 // BSP_CFG_C_RUNTIME_INIT
 
     /* Initialize SystemCoreClock variable. */
@@ -506,6 +498,8 @@ BSP_SECTION_FLASH_GAP void SystemInit (void)
     }
 #endif
 
+    BSP_PRV_BOOT_STAGE_RECORD(BSP_BOOT_STAGE_POST_C);
+
     /* Call Post C runtime initialization hook. */
     R_BSP_WarmStart(BSP_WARM_START_POST_C);
 
@@ -514,8 +508,74 @@ BSP_SECTION_FLASH_GAP void SystemInit (void)
 
     /* Call any BSP specific code. No arguments are needed so NULL is sent. */
     bsp_init(NULL);
+
+#if BSP_PRV_BOOT_PROFILE
+    BSP_PRV_BOOT_STAGE_RECORD(BSP_BOOT_STAGE_DONE);
+    g_bsp_boot_profile.magic = BSP_BOOT_PROFILE_MAGIC;
+#endif
 }
 
+#if BSP_CFG_C_RUNTIME_INIT
+
+/*******************************************************************************************************************//**
+ * Zero .bss, copy initialized data from ROM to RAM and initialize TCM. Called from SystemInit after clock
+ * initialization, or from bsp_clock_init while the oscillators stabilize when BSP_CFG_FAST_BOOT_ENABLE is set.
+ **********************************************************************************************************************/
+void bsp_ram_init (void)
+{
+    BSP_PRV_BOOT_STAGE_RECORD(BSP_BOOT_STAGE_RAM_INIT_START);
+
+    /* Zero out BSS */
+ #if defined(__ARMCC_VERSION)
+    memset((uint8_t *) &Image$$BSS$$ZI$$Base, 0U, (uint32_t) &Image$$BSS$$ZI$$Length);
+ #elif defined(__GNUC__)
+    memset(&__bss_start__, 0U, ((uint32_t) &__bss_end__ - (uint32_t) &__bss_start__));
+ #elif defined(__ICCARM__)
+    memset((uint32_t *) __section_begin(".bss"), 0U, (uint32_t) __section_size(".bss"));
+ #endif
+
+    /* Copy initialized RAM data from ROM to RAM. */
+ #if defined(__ARMCC_VERSION)
+    memcpy((uint8_t *) &Image$$DATA$$Base, (uint8_t *) &Load$$DATA$$Base, (uint32_t) &Image$$DATA$$Length);
+ #elif defined(__GNUC__)
+    memcpy(&__data_start__, &__etext, ((uint32_t) &__data_end__ - (uint32_t) &__data_start__));
+ #elif defined(__ICCARM__)
+    memcpy((uint32_t *) __section_begin(".data"), (uint32_t *) __section_begin(".data_init"),
+           (uint32_t) __section_size(".data"));
+
+    /* Copy functions to be executed from RAM. */
+  #pragma section=".code_in_ram"
+  #pragma section=".code_in_ram_init"
+    memcpy((uint32_t *) __section_begin(".code_in_ram"),
+           (uint32_t *) __section_begin(".code_in_ram_init"),
+           (uint32_t) __section_size(".code_in_ram"));
+
+    /* Copy main thread TLS to RAM. */
+  #pragma section="__DLIB_PERTHREAD_init"
+  #pragma section="__DLIB_PERTHREAD"
+    memcpy((uint32_t *) __section_begin("__DLIB_PERTHREAD"), (uint32_t *) __section_begin("__DLIB_PERTHREAD_init"),
+           (uint32_t) __section_size("__DLIB_PERTHREAD_init"));
+ #endif
+
+    /* Initialize TCM memory. */
+ #if BSP_FEATURE_BSP_HAS_ITCM
+    bsp_init_itcm();
+ #endif
+ #if BSP_FEATURE_BSP_HAS_DTCM
+    bsp_init_dtcm();
+ #endif
+
+ #if defined(RENESAS_CORTEX_M85)
+
+    /* Invalidate I-Cache after initializing the .code_in_ram section. */
+    SCB_InvalidateICache();
+ #endif
+
+    BSP_PRV_BOOT_STAGE_RECORD(BSP_BOOT_STAGE_RAM_INIT_DONE);
+}
+
+#endif
+
 /*******************************************************************************************************************//**
  * This function is called at various points during the startup process.
  * This function is declared as a weak symbol higher up in this file because it is meant to be overridden by a user
@@ -629,6 +629,21 @@ void bsp_soft_reset_prepare(void);
  #endif
 #endif
 
+#if BSP_PRV_FAST_BOOT
+
+/* In fast boot mode RAM is initialized during the longest stabilization wait. The HOCO wait is only used when neither
+ * the main oscillator nor the PLL is waited on. */
+ #if (BSP_PRV_MAIN_OSC_USED && BSP_PRV_STABILIZE_MAIN_OSC) || \
+    (BSP_PRV_PLL_SUPPORTED && BSP_PRV_PLL_USED && BSP_PRV_STABILIZE_PLL)
+  #define BSP_PRV_FAST_BOOT_USE_HOCO_WAIT    (0)
+ #else
+  #define BSP_PRV_FAST_BOOT_USE_HOCO_WAIT    (1)
+ #endif
+
+static void bsp_prv_fast_boot_ram_init(bool * p_pending);
+
+#endif
+
 /* This array stores the clock frequency of each system clock. This section of RAM should not be initialized by the C
  * runtime environment. This is initialized and used in bsp_clock_init, which is called before the C runtime
  * environment is initialized. */
@@ -1879,11 +1894,39 @@ static void bsp_prv_operating_mode_flmode_set (uint8_t operating_mode)
 
 #endif
 
+#if BSP_PRV_FAST_BOOT
+
+/*******************************************************************************************************************//**
+ * Initializes RAM sections the first time it is called from bsp_clock_init, so that the copy runs while an oscillator
+ * or the PLL is stabilizing.
+ *
+ * @param[in,out]  p_pending  Cleared once RAM has been initialized.
+ **********************************************************************************************************************/
+static void bsp_prv_fast_boot_ram_init (bool * p_pending)
+{
+    if (*p_pending)
+    {
+        *p_pending = false;
+
+        bsp_ram_init();
+
+        /* SystemCoreClock is cleared with .bss unless BSP_CFG_EARLY_INIT is set. Restore it for R_BSP_SoftwareDelay
+         * and for the clock switch that follows. */
+        SystemCoreClockUpdate();
+    }
+}
+
+#endif
+
 /*******************************************************************************************************************//**
  * Initializes system clocks.  Makes no assumptions about current register settings.
  **********************************************************************************************************************/
 void bsp_clock_init (void)
 {
+#if BSP_PRV_FAST_BOOT
+    bool ram_init_pending = true;
+#endif
+
     /* Unlock CGC and LPM protection registers. */
 #if BSP_FEATURE_TZ_VERSION == 2 && BSP_TZ_NONSECURE_BUILD == 1
     R_SYSTEM->PRCR_NS = (uint16_t) BSP_PRV_PRCR_UNLOCK;
@@ -2035,6 +2078,11 @@ void bsp_clock_init (void)
  #endif
 
  #if BSP_PRV_STABILIZE_HOCO
+  #if BSP_PRV_FAST_BOOT && BSP_PRV_FAST_BOOT_USE_HOCO_WAIT
+
+    /* Initialize RAM while HOCO stabilizes. */
+    bsp_prv_fast_boot_ram_init(&ram_init_pending);
+  #endif
 
     /* Wait for HOCO to stabilize. */
     FSP_HARDWARE_REGISTER_WAIT(R_SYSTEM->OSCSF_b.HOCOSF, 1U);
@@ -2088,6 +2136,11 @@ void bsp_clock_init (void)
         R_SYSTEM->MOSCCR = 0U;
 
  #if BSP_PRV_STABILIZE_MAIN_OSC
+  #if BSP_PRV_FAST_BOOT
+
+        /* Initialize RAM while the main oscillator stabilizes. */
+        bsp_prv_fast_boot_ram_init(&ram_init_pending);
+  #endif
 
         /* Wait for main oscillator to stabilize. */
   #if BSP_FEATURE_CGC_REGISTER_SET_B
@@ -2158,6 +2211,11 @@ void bsp_clock_init (void)
         R_SYSTEM->PLLCR = 0U;
 
  #if BSP_PRV_STABILIZE_PLL
+  #if BSP_PRV_FAST_BOOT
+
+        /* Initialize RAM while the PLL stabilizes, unless that was already done during the main oscillator wait. */
+        bsp_prv_fast_boot_ram_init(&ram_init_pending);
+  #endif
 
         /* Wait for PLL to stabilize. */
         FSP_HARDWARE_REGISTER_WAIT(R_SYSTEM->OSCSF_b.PLLSF, 1U);
@@ -2165,6 +2223,12 @@ void bsp_clock_init (void)
     }
 #endif
 
+#if BSP_PRV_FAST_BOOT
+
+    /* Initialize RAM now if no stabilization wait was needed, so that it is always done before the clock switch. */
+    bsp_prv_fast_boot_ram_init(&ram_init_pending);
+#endif
+
     /* Set source clock and dividers. */
 #if !BSP_FEATURE_CGC_REGISTER_SET_B
  #if BSP_CFG_STARTUP_CLOCK_REG_NOT_RESET
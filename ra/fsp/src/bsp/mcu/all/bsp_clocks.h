@@ -1109,6 +1109,18 @@ typedef enum e_cgc_pll_mul
 /* Public functions defined in bsp.h */
 void bsp_clock_init(void);             // Used internally by BSP
 
+#if BSP_CFG_C_RUNTIME_INIT
+void bsp_ram_init(void);               // Used internally by BSP
+
+#endif
+
+/* Fast boot initializes RAM from bsp_clock_init, so it is not available when clock initialization is skipped. */
+#if BSP_CFG_FAST_BOOT_ENABLE && BSP_CFG_C_RUNTIME_INIT && !BSP_TZ_CFG_SKIP_INIT
+ #define BSP_PRV_FAST_BOOT    (1)
+#else
+ #define BSP_PRV_FAST_BOOT    (0)
+#endif
+
 #if BSP_TZ_NONSECURE_BUILD
 void bsp_clock_freq_var_init(void);    // Used internally by BSP
 
@@ -58,24 +58,87 @@ FSP_HEADER
 
 /* Version of this module's code and API. */
 
+/* Set to 1 to record context switches and ISR entry/exit with rm_rtos_trace. */
+#ifndef BSP_CFG_RTOS_TRACE_ENABLE
+ #define BSP_CFG_RTOS_TRACE_ENABLE    (0)
+#endif
+
+/* Set to 1 to record the DWT cycle count at each SystemInit stage in g_bsp_boot_profile. Only MCUs with
+ * BSP_FEATURE_DWT_CYCCNT record timestamps. */
+#ifndef BSP_CFG_BOOT_PROFILE_ENABLE
+ #define BSP_CFG_BOOT_PROFILE_ENABLE    (0)
+#endif
+
+/* Set to 1 to initialize RAM sections (.bss, .data and TCM) from bsp_clock_init while the oscillators and PLL
+ * stabilize instead of after clock initialization. R_BSP_WarmStart(BSP_WARM_START_POST_CLOCK) then runs with
+ * initialized RAM. */
+#ifndef BSP_CFG_FAST_BOOT_ENABLE
+ #define BSP_CFG_FAST_BOOT_ENABLE       (0)
+#endif
+
+/* Set to 1 to let drivers register per instance performance counters (see bsp_perf.h). Only MCUs with
+ * BSP_FEATURE_DWT_CYCCNT measure time spent in ISRs. */
+#ifndef BSP_CFG_PERF_COUNTERS_ENABLE
+ #define BSP_CFG_PERF_COUNTERS_ENABLE   (0)
+#endif
+
+/** Value of bsp_boot_profile_t::magic once SystemInit has recorded every stage of the latest boot. */
+#define BSP_BOOT_PROFILE_MAGIC          (0x544F4F42U)
+
+#if BSP_CFG_RTOS_TRACE_ENABLE
+
+/* ISR hooks implemented by rm_rtos_trace. */
+void rm_rtos_trace_isr_enter(uint32_t irq);
+void rm_rtos_trace_isr_exit(uint32_t irq);
+
+ #define BSP_PRV_RTOS_TRACE_ISR_ENTER    rm_rtos_trace_isr_enter((uint32_t) R_FSP_CurrentIrqGet());
+ #define BSP_PRV_RTOS_TRACE_ISR_EXIT     rm_rtos_trace_isr_exit((uint32_t) R_FSP_CurrentIrqGet());
+#else
+ #define BSP_PRV_RTOS_TRACE_ISR_ENTER
+ #define BSP_PRV_RTOS_TRACE_ISR_EXIT
+#endif
+
+/* Set to 1 to record FSP_LOG_PRINT messages with rm_binlog. Formatting is deferred to a low priority task or the
+ * host. */
+#ifndef BSP_CFG_BINLOG_ENABLE
+ #define BSP_CFG_BINLOG_ENABLE        (0)
+#endif
+
+#if BSP_CFG_BINLOG_ENABLE
+
+/* Record function implemented by rm_binlog. */
+void rm_binlog_write(char const * p_format, uint32_t count, uint32_t const * p_args);
+
+#endif
+
 #if 1 == BSP_CFG_RTOS                  /* ThreadX */
  #include "tx_user.h"
  #if defined(TX_ENABLE_EVENT_TRACE) || defined(TX_ENABLE_EXECUTION_CHANGE_NOTIFY)
   #include "tx_port.h"
-  #define FSP_CONTEXT_SAVE       tx_isr_start((uint32_t) R_FSP_CurrentIrqGet());
-  #define FSP_CONTEXT_RESTORE    tx_isr_end((uint32_t) R_FSP_CurrentIrqGet());
+  #define FSP_CONTEXT_SAVE       tx_isr_start((uint32_t) R_FSP_CurrentIrqGet()); BSP_PRV_RTOS_TRACE_ISR_ENTER
+  #define FSP_CONTEXT_RESTORE    BSP_PRV_RTOS_TRACE_ISR_EXIT tx_isr_end((uint32_t) R_FSP_CurrentIrqGet());
  #else
-  #define FSP_CONTEXT_SAVE
-  #define FSP_CONTEXT_RESTORE
+  #define FSP_CONTEXT_SAVE       BSP_PRV_RTOS_TRACE_ISR_ENTER
+  #define FSP_CONTEXT_RESTORE    BSP_PRV_RTOS_TRACE_ISR_EXIT
  #endif
 #else
- #define FSP_CONTEXT_SAVE
- #define FSP_CONTEXT_RESTORE
+ #define FSP_CONTEXT_SAVE        BSP_PRV_RTOS_TRACE_ISR_ENTER
+ #define FSP_CONTEXT_RESTORE     BSP_PRV_RTOS_TRACE_ISR_EXIT
 #endif
 
 /** Macro that can be defined in order to enable logging in FSP modules. */
 #ifndef FSP_LOG_PRINT
- #define FSP_LOG_PRINT(X)
+ #if BSP_CFG_BINLOG_ENABLE
+
+/* Same record as RM_BINLOG_0(X). The format string stays in flash, RM_BINLOG_CFG_FORMAT_SECTION does not apply. */
+  #define FSP_LOG_PRINT(X)                            \
+    do {                                              \
+        static const char bsp_log_format[] = X;       \
+        rm_binlog_write(bsp_log_format, 0U, NULL);    \
+    } while (0)
+ #else
+  #define FSP_LOG_PRINT(X)
+ #endif
 #endif
 
 /** Macro to log and return error without an assertion. */
@@ -323,6 +386,37 @@ typedef enum e_fsp_priv_source_clock
     FSP_PRIV_CLOCK_PLL2     = 6,       ///< The PLL2 oscillator
 } fsp_priv_source_clock_t;
 
+/** Startup stages recorded in g_bsp_boot_profile when BSP_CFG_BOOT_PROFILE_ENABLE is set. */
+typedef enum e_bsp_boot_stage
+{
+    BSP_BOOT_STAGE_CLOCK_START = 0,    ///< Before clock initialization. The cycle counter is reset at SystemInit entry.
+    BSP_BOOT_STAGE_RAM_INIT_START,     ///< Before RAM sections are initialized
+    BSP_BOOT_STAGE_RAM_INIT_DONE,      ///< After RAM sections are initialized
+    BSP_BOOT_STAGE_CLOCK_DONE,         ///< After clock initialization
+    BSP_BOOT_STAGE_C_RUNTIME_DONE,     ///< After static constructors have run
+    BSP_BOOT_STAGE_POST_C,             ///< Before R_BSP_WarmStart(BSP_WARM_START_POST_C)
+    BSP_BOOT_STAGE_DONE,               ///< End of SystemInit
+    BSP_BOOT_STAGE_NUM,
+} bsp_boot_stage_t;
+
+/** Boot profile. Placed in uninitialized RAM so the record survives C runtime initialization and warm resets. */
+typedef struct st_bsp_boot_profile
+{
+    uint32_t magic;                              ///< BSP_BOOT_PROFILE_MAGIC once every stage has been recorded
+    uint32_t timestamp[BSP_BOOT_STAGE_NUM];      ///< Core clock cycles from SystemInit entry to each stage
+} bsp_boot_profile_t;
+
+/** Function that writes diagnostic output (trace, log or counter dumps) to the host. Data must be consumed or copied
+ * before returning. Implement with SEGGER_RTT_Write or a blocking UART write. */
+typedef fsp_err_t (* bsp_sink_write_t)(void * p_context, uint8_t const * p_data, uint32_t bytes);
+
+/** Destination for diagnostic output. */
+typedef struct st_bsp_sink
+{
+    bsp_sink_write_t p_write;          ///< Write function
+    void           * p_context;        ///< Passed to p_write
+} bsp_sink_t;
+
 typedef struct st_bsp_unique_id
 {
     union
@@ -340,6 +434,9 @@ uint32_t R_BSP_SourceClockHzGet(fsp_priv_source_clock_t clock);
 /***********************************************************************************************************************
  * Global variables (defined in other files)
  **********************************************************************************************************************/
+#if BSP_CFG_BOOT_PROFILE_ENABLE
+extern bsp_boot_profile_t g_bsp_boot_profile;
+#endif
 
 /***********************************************************************************************************************
  * Inline Functions
@@ -561,6 +658,20 @@ __STATIC_INLINE void R_BSP_FlashCacheEnable (void)
 #endif
 }
 
+/*******************************************************************************************************************//**
+ * Starts the DWT cycle counter (DWT->CYCCNT) if the MCU has one. The counter keeps its current value.
+ **********************************************************************************************************************/
+__STATIC_INLINE void R_BSP_CycleCounterEnable (void)
+{
+#if BSP_FEATURE_DWT_CYCCNT
+
+    /* The cycle counter only runs when trace is enabled in the debug block, which is not the case without a
+     * debugger attached. */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= (uint32_t) DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
 /***********************************************************************************************************************
  * Exported global functions (to be accessed by other files)
  **********************************************************************************************************************/
@@ -43,6 +43,17 @@ FSP_HEADER
 #define BSP_IO_PWPR_PFSWE_OFFSET      (6U)
 #define BSP_IO_PFS_PDR_OUTPUT         (4U)
 #define BSP_IO_PRV_PIN_WRITE_MASK     (0xFFFE3FFE)
+#define BSP_IO_PRV_PORT_ADDRESS(port_number)    ((R_PORT0_Type *) (R_PORT0_BASE + \
+                                                                   ((R_PORT1_BASE - R_PORT0_BASE) * (port_number))))
+
+/** Initializer for a bsp_io_fast_pin_t that describes a single pin, for example
+ * static const bsp_io_fast_pin_t g_debug_pin = BSP_IO_FAST_PIN(BSP_IO_PORT_01_PIN_06); */
+#define BSP_IO_FAST_PIN(pin)            {BSP_IO_PRV_PORT_ADDRESS((uint32_t) (pin) >> 8),                    \
+                                         (uint16_t) (1U << ((uint32_t) (pin) & BSP_IO_PRV_8BIT_MASK))}
+
+/** Initializer for a bsp_io_fast_pin_t that describes a group of pins on one port, for example
+ * BSP_IO_FAST_PINS(BSP_IO_PORT_04, 0x00F0) for pins 4 to 7 of port 4. */
+#define BSP_IO_FAST_PINS(port, mask)    {BSP_IO_PRV_PORT_ADDRESS((uint32_t) (port) >> 8), (uint16_t) (mask)}
 
 /***********************************************************************************************************************
  * Typedef definitions
@@ -341,6 +352,15 @@ typedef enum e_bsp_io_port_pin_t
     BSP_IO_PORT_14_PIN_15 = 0x0E0F,    ///< IO port 14 pin 15
 } bsp_io_port_pin_t;
 
+/** Pin descriptor for the R_BSP_FastPin functions. It holds the port register block and the pins on that port, so
+ * that it can be resolved at compile time and every access is a single register store. Initialize it with
+ * BSP_IO_FAST_PIN() or BSP_IO_FAST_PINS(). */
+typedef struct st_bsp_io_fast_pin
+{
+    R_PORT0_Type * p_port;             ///< Port register block
+    uint16_t       mask;               ///< Pins of the port described by this descriptor
+} bsp_io_fast_pin_t;
+
 /***********************************************************************************************************************
  * Exported global variables
  **********************************************************************************************************************/
@@ -470,6 +490,82 @@ __STATIC_INLINE void R_BSP_PinAccessDisable (void)
 #endif
 }
 
+/*******************************************************************************************************************//**
+ * Drive the pins of a fast pin descriptor high. The pins must already be configured as outputs. Only the pins in the
+ * descriptor are affected, so this is safe to use from an ISR while other pins of the same port are written elsewhere.
+ *
+ * @param[in]  pins     Pins to drive high
+ **********************************************************************************************************************/
+__STATIC_INLINE void R_BSP_FastPinSet (bsp_io_fast_pin_t pins)
+{
+#if (3U == BSP_FEATURE_IOPORT_VERSION)
+    pins.p_port->POSR = pins.mask;
+#else
+
+    /* PCNTR3 register: lower word = set data, upper word = reset_data */
+    pins.p_port->PCNTR3 = pins.mask;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Drive the pins of a fast pin descriptor low. The pins must already be configured as outputs.
+ *
+ * @param[in]  pins     Pins to drive low
+ **********************************************************************************************************************/
+__STATIC_INLINE void R_BSP_FastPinClear (bsp_io_fast_pin_t pins)
+{
+#if (3U == BSP_FEATURE_IOPORT_VERSION)
+    pins.p_port->PORR = pins.mask;
+#else
+    pins.p_port->PCNTR3 = (uint32_t) pins.mask << 16;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Write the pins of a fast pin descriptor. Pins whose bit is set in value are driven high and the other pins in the
+ * descriptor are driven low. On MCUs with PCNTR3 all pins change with one store. On MCUs with separate PORR and POSR
+ * registers the pins going low change one store before the pins going high.
+ *
+ * @param[in]  pins     Pins to write
+ * @param[in]  value    Port value. Bits outside the descriptor mask are ignored.
+ **********************************************************************************************************************/
+__STATIC_INLINE void R_BSP_FastPinWrite (bsp_io_fast_pin_t pins, uint16_t value)
+{
+    uint32_t setbits = (uint32_t) (value & pins.mask);
+    uint32_t clrbits = (uint32_t) (~value & pins.mask);
+
+#if (3U == BSP_FEATURE_IOPORT_VERSION)
+    pins.p_port->PORR = (uint16_t) clrbits;
+    pins.p_port->POSR = (uint16_t) setbits;
+#else
+    pins.p_port->PCNTR3 = (clrbits << 16) | setbits;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Invert the output level of the pins of a fast pin descriptor. The output data register is read first, so a write to
+ * the same pins from an interrupt between the read and the store is overwritten. Other pins of the port are not
+ * affected.
+ *
+ * @param[in]  pins     Pins to invert
+ **********************************************************************************************************************/
+__STATIC_INLINE void R_BSP_FastPinToggle (bsp_io_fast_pin_t pins)
+{
+    R_BSP_FastPinWrite(pins, (uint16_t) ~pins.p_port->PODR);
+}
+
+/*******************************************************************************************************************//**
+ * Read the input level of the pins of a fast pin descriptor.
+ *
+ * @param[in]  pins     Pins to read
+ *
+ * @retval     Port input levels masked to the pins of the descriptor
+ **********************************************************************************************************************/
+__STATIC_INLINE uint16_t R_BSP_FastPinRead (bsp_io_fast_pin_t pins)
+{
+    return (uint16_t) (pins.p_port->PIDR & pins.mask);
+}
+
 /** @} (end addtogroup BSP_IO) */
 
 /* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
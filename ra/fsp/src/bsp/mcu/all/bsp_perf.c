@@ -0,0 +1,297 @@
+/***********************************************************************************************************************
+ * Copyright [2020-2024] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes   <System Includes> , "Project Includes"
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+
+#if BSP_CFG_PERF_COUNTERS_ENABLE
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* Large enough for one line with every counter at its maximum value and a 32 character name. Longer names are
+ * truncated. */
+ #define BSP_PRV_PERF_LINE_SIZE       (320U)
+ #define BSP_PRV_PERF_NAME_MAX        (32U)
+
+/* Digits in the largest uint64_t value. */
+ #define BSP_PRV_PERF_DIGITS_MAX      (20U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+typedef struct st_bsp_prv_perf_line
+{
+    char     text[BSP_PRV_PERF_LINE_SIZE];
+    uint32_t length;
+} bsp_prv_perf_line_t;
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static void bsp_prv_perf_unlink(bsp_perf_entry_t * const p_entry);
+static void bsp_prv_perf_append(bsp_prv_perf_line_t * const p_line, char const * p_text, uint32_t max);
+static void bsp_prv_perf_append_value(bsp_prv_perf_line_t * const p_line, char const * const p_label, uint64_t value);
+
+/***********************************************************************************************************************
+ * Exported global variables (to be accessed by other files)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private global variables and functions
+ **********************************************************************************************************************/
+
+/* Most recently registered instance. */
+static bsp_perf_entry_t * gp_bsp_prv_perf_list = NULL;
+
+/*******************************************************************************************************************//**
+ * @addtogroup BSP_MCU
+ * @{
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Clears the counters of a driver instance and adds it to the list of registered instances. Drivers call this from
+ * their open function through BSP_PERF_REGISTER. Registering an instance again restarts its counters.
+ *
+ * The first registration also starts the DWT cycle counter used to time ISRs.
+ *
+ * @param[in]  p_entry   Counters of the instance. Must stay valid until R_BSP_PerfUnregister is called.
+ * @param[in]  p_name    Driver name reported by R_BSP_PerfDump. Must stay valid while registered.
+ * @param[in]  channel   Peripheral channel reported by R_BSP_PerfDump.
+ **********************************************************************************************************************/
+void R_BSP_PerfRegister (bsp_perf_entry_t * const p_entry, char const * const p_name, uint32_t channel)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    bsp_prv_perf_unlink(p_entry);
+
+    memset(&p_entry->counters, 0, sizeof(p_entry->counters));
+    p_entry->p_name      = p_name;
+    p_entry->channel     = channel;
+    p_entry->p_next      = gp_bsp_prv_perf_list;
+    gp_bsp_prv_perf_list = p_entry;
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    R_BSP_CycleCounterEnable();
+}
+
+/*******************************************************************************************************************//**
+ * Removes a driver instance from the list of registered instances. Drivers call this from their close function
+ * through BSP_PERF_UNREGISTER. Does nothing if the instance is not registered.
+ *
+ * @param[in]  p_entry   Counters of the instance.
+ **********************************************************************************************************************/
+void R_BSP_PerfUnregister (bsp_perf_entry_t * const p_entry)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    bsp_prv_perf_unlink(p_entry);
+
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+/*******************************************************************************************************************//**
+ * Enumerates the registered instances.
+ *
+ * Example:
+ * @code
+ * for (bsp_perf_entry_t * p_entry = R_BSP_PerfNext(NULL); NULL != p_entry; p_entry = R_BSP_PerfNext(p_entry))
+ * {
+ *     uint32_t rx_bytes = p_entry->counters.rx_bytes;
+ * }
+ * @endcode
+ *
+ * Instances must not be closed while they are being enumerated.
+ *
+ * @param[in]  p_entry   Previous instance, or NULL to get the first one.
+ *
+ * @return The next registered instance, or NULL after the last one.
+ **********************************************************************************************************************/
+bsp_perf_entry_t * R_BSP_PerfNext (bsp_perf_entry_t const * const p_entry)
+{
+    if (NULL == p_entry)
+    {
+        return gp_bsp_prv_perf_list;
+    }
+
+    return p_entry->p_next;
+}
+
+/*******************************************************************************************************************//**
+ * Clears the counters of every registered instance, for example at the start of a measurement window.
+ **********************************************************************************************************************/
+void R_BSP_PerfReset (void)
+{
+    for (bsp_perf_entry_t * p_entry = gp_bsp_prv_perf_list; NULL != p_entry; p_entry = p_entry->p_next)
+    {
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+
+        memset(&p_entry->counters, 0, sizeof(p_entry->counters));
+
+        FSP_CRITICAL_SECTION_EXIT;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Writes the counters of every registered instance as text, one line per instance, for example:
+ *
+ * @code
+ * perf hz=200000000
+ * r_sci_uart ch=9 tx_bytes=1024 rx_bytes=12 tx_frames=0 rx_frames=0 interrupts=1037 overruns=0 errors=0 retries=0 isr_cycles=311100 isr_cycles_max=612
+ * @endcode
+ *
+ * The first line gives the frequency of the cycle counter used for isr_cycles. Each instance is copied with interrupts
+ * disabled so its counters are consistent, but the text is written with interrupts enabled. Call from a low priority
+ * task. Instances must not be closed during the dump.
+ *
+ * @param[in]  p_sink      Destination of the text. p_sink->p_write is called once per line.
+ *
+ * @retval FSP_SUCCESS                 All lines written.
+ * @retval FSP_ERR_ASSERTION           p_sink or p_sink->p_write is NULL.
+ * @return See the write function for other possible return codes.
+ **********************************************************************************************************************/
+fsp_err_t R_BSP_PerfDump (bsp_sink_t const * const p_sink)
+{
+ #if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_sink);
+    FSP_ASSERT(NULL != p_sink->p_write);
+ #endif
+
+    bsp_prv_perf_line_t line;
+    bsp_perf_entry_t    entry;
+    fsp_err_t           err;
+
+    line.length = 0U;
+    bsp_prv_perf_append_value(&line, "perf hz", SystemCoreClock);
+    bsp_prv_perf_append(&line, "\r\n", 2U);
+    err = p_sink->p_write(p_sink->p_context, (uint8_t const *) line.text, line.length);
+
+    for (bsp_perf_entry_t * p_entry = gp_bsp_prv_perf_list; (FSP_SUCCESS == err) && (NULL != p_entry);
+         p_entry = entry.p_next)
+    {
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+
+        entry = *p_entry;
+
+        FSP_CRITICAL_SECTION_EXIT;
+
+        line.length = 0U;
+        bsp_prv_perf_append(&line, entry.p_name, BSP_PRV_PERF_NAME_MAX);
+        bsp_prv_perf_append_value(&line, " ch", entry.channel);
+        bsp_prv_perf_append_value(&line, " tx_bytes", entry.counters.tx_bytes);
+        bsp_prv_perf_append_value(&line, " rx_bytes", entry.counters.rx_bytes);
+        bsp_prv_perf_append_value(&line, " tx_frames", entry.counters.tx_frames);
+        bsp_prv_perf_append_value(&line, " rx_frames", entry.counters.rx_frames);
+        bsp_prv_perf_append_value(&line, " interrupts", entry.counters.interrupts);
+        bsp_prv_perf_append_value(&line, " overruns", entry.counters.overruns);
+        bsp_prv_perf_append_value(&line, " errors", entry.counters.errors);
+        bsp_prv_perf_append_value(&line, " retries", entry.counters.retries);
+        bsp_prv_perf_append_value(&line, " isr_cycles", entry.counters.isr_cycles);
+        bsp_prv_perf_append_value(&line, " isr_cycles_max", entry.counters.isr_cycles_max);
+        bsp_prv_perf_append(&line, "\r\n", 2U);
+
+        err = p_sink->p_write(p_sink->p_context, (uint8_t const *) line.text, line.length);
+    }
+
+    return err;
+}
+
+/** @} (end addtogroup BSP_MCU) */
+
+/*******************************************************************************************************************//**
+ * Removes an instance from the list. Must be called with interrupts disabled.
+ *
+ * @param[in]  p_entry   Counters of the instance.
+ **********************************************************************************************************************/
+static void bsp_prv_perf_unlink (bsp_perf_entry_t * const p_entry)
+{
+    bsp_perf_entry_t ** pp_link = &gp_bsp_prv_perf_list;
+
+    while (NULL != *pp_link)
+    {
+        if (p_entry == *pp_link)
+        {
+            *pp_link        = p_entry->p_next;
+            p_entry->p_next = NULL;
+
+            return;
+        }
+
+        pp_link = &(*pp_link)->p_next;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Appends up to max characters of a string to a line. Text that does not fit is dropped.
+ *
+ * @param[in]  p_line   Line being built.
+ * @param[in]  p_text   Null terminated text. NULL is treated as an empty string.
+ * @param[in]  max      Maximum number of characters to append.
+ **********************************************************************************************************************/
+static void bsp_prv_perf_append (bsp_prv_perf_line_t * const p_line, char const * p_text, uint32_t max)
+{
+    if (NULL == p_text)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0U; (i < max) && ('\0' != p_text[i]) && (p_line->length < BSP_PRV_PERF_LINE_SIZE); i++)
+    {
+        p_line->text[p_line->length] = p_text[i];
+        p_line->length++;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Appends "label=value" to a line, with the value in decimal. The BSP does not use the C library formatting
+ * functions.
+ *
+ * @param[in]  p_line    Line being built.
+ * @param[in]  p_label   Label written before the value.
+ * @param[in]  value     Value to write.
+ **********************************************************************************************************************/
+static void bsp_prv_perf_append_value (bsp_prv_perf_line_t * const p_line, char const * const p_label, uint64_t value)
+{
+    char     digits[BSP_PRV_PERF_DIGITS_MAX + 1U];
+    uint32_t index = BSP_PRV_PERF_DIGITS_MAX;
+
+    digits[index] = '\0';
+    do
+    {
+        index--;
+        digits[index] = (char) ('0' + (value % 10U));
+        value        /= 10U;
+    } while (0U != value);
+
+    bsp_prv_perf_append(p_line, p_label, BSP_PRV_PERF_LINE_SIZE);
+    bsp_prv_perf_append(p_line, "=", 1U);
+    bsp_prv_perf_append(p_line, &digits[index], BSP_PRV_PERF_DIGITS_MAX);
+}
+
+#endif
@@ -0,0 +1,139 @@
+/***********************************************************************************************************************
+ * Copyright [2020-2024] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef BSP_PERF_H
+#define BSP_PERF_H
+
+/***********************************************************************************************************************
+ * Includes   <System Includes> , "Project Includes"
+ **********************************************************************************************************************/
+
+/** Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup BSP_MCU
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* Drivers use the macros below so the counters cost nothing when BSP_CFG_PERF_COUNTERS_ENABLE is 0. Each instance
+ * control structure that supports counters has a bsp_perf_entry_t member named perf. */
+#if BSP_CFG_PERF_COUNTERS_ENABLE
+
+/** Adds n to one of the bsp_perf_counters_t fields of a driver instance. */
+ #define BSP_PERF_COUNT(p_ctrl, counter, n)          ((p_ctrl)->perf.counters.counter += (uint32_t) (n))
+
+/** Adds a driver instance to the list returned by R_BSP_PerfNext. Called from the driver open function. */
+ #define BSP_PERF_REGISTER(p_ctrl, name, channel)    R_BSP_PerfRegister(&(p_ctrl)->perf, (name), (uint32_t) (channel))
+
+/** Removes a driver instance from the list. Called from the driver close function. */
+ #define BSP_PERF_UNREGISTER(p_ctrl)                 R_BSP_PerfUnregister(&(p_ctrl)->perf)
+
+/** Records the ISR start time. Must be placed where a declaration is allowed, before BSP_PERF_ISR_EXIT. */
+ #if BSP_FEATURE_DWT_CYCCNT
+  #define BSP_PERF_ISR_ENTER()                       uint32_t bsp_perf_isr_start = DWT->CYCCNT
+  #define BSP_PERF_ISR_EXIT(p_ctrl)                  bsp_perf_isr_exit(&(p_ctrl)->perf.counters, DWT->CYCCNT - \
+                                                                       bsp_perf_isr_start)
+ #else
+  #define BSP_PERF_ISR_ENTER()
+  #define BSP_PERF_ISR_EXIT(p_ctrl)                  bsp_perf_isr_exit(&(p_ctrl)->perf.counters, 0U)
+ #endif
+#else
+ #define BSP_PERF_COUNT(p_ctrl, counter, n)
+ #define BSP_PERF_REGISTER(p_ctrl, name, channel)
+ #define BSP_PERF_UNREGISTER(p_ctrl)
+ #define BSP_PERF_ISR_ENTER()
+ #define BSP_PERF_ISR_EXIT(p_ctrl)
+#endif
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Counters kept for each registered driver instance. Drivers only update the fields that apply to them.
+ *
+ * Counters are updated without locking. An update from an ISR that preempts an update of the same field from a
+ * thread can be lost, which is acceptable for load statistics. */
+typedef struct st_bsp_perf_counters
+{
+    uint32_t tx_bytes;                 ///< Bytes handed to the peripheral for transmission
+    uint32_t rx_bytes;                 ///< Bytes received
+    uint32_t tx_frames;                ///< Frames, blocks or transfers transmitted
+    uint32_t rx_frames;                ///< Frames, blocks or transfers received
+    uint32_t interrupts;               ///< Interrupts handled
+    uint32_t overruns;                 ///< Data lost because a FIFO, buffer or descriptor ring was full
+    uint32_t errors;                   ///< Other errors reported by the peripheral
+    uint32_t retries;                  ///< Operations retried by the driver
+    uint32_t isr_cycles_max;           ///< Longest time spent in one ISR in core clock cycles
+    uint64_t isr_cycles;               ///< Total time spent in ISRs in core clock cycles
+} bsp_perf_counters_t;
+
+/** Registration of one driver instance. */
+typedef struct st_bsp_perf_entry
+{
+    char const               * p_name;   ///< Driver name, for example "r_sci_uart"
+    uint32_t                   channel;  ///< Peripheral channel
+    bsp_perf_counters_t        counters; ///< Counters, see bsp_perf_counters_t
+    struct st_bsp_perf_entry * p_next;   ///< Next registered instance. Internal, use R_BSP_PerfNext.
+} bsp_perf_entry_t;
+
+/** @} (end addtogroup BSP_MCU) */
+
+/***********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Exported global functions (to be accessed by other files)
+ **********************************************************************************************************************/
+void               R_BSP_PerfRegister(bsp_perf_entry_t * const p_entry, char const * const p_name, uint32_t channel);
+void               R_BSP_PerfUnregister(bsp_perf_entry_t * const p_entry);
+bsp_perf_entry_t * R_BSP_PerfNext(bsp_perf_entry_t const * const p_entry);
+void               R_BSP_PerfReset(void);
+fsp_err_t          R_BSP_PerfDump(bsp_sink_t const * const p_sink);
+
+/***********************************************************************************************************************
+ * Inline Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Updates the interrupt counters at the end of an ISR. Called by BSP_PERF_ISR_EXIT.
+ *
+ * @param[in]  p_counters  Counters of the instance that handled the interrupt.
+ * @param[in]  cycles      Core clock cycles spent in the ISR.
+ **********************************************************************************************************************/
+__STATIC_INLINE void bsp_perf_isr_exit (bsp_perf_counters_t * const p_counters, uint32_t cycles)
+{
+    p_counters->interrupts++;
+    p_counters->isr_cycles += cycles;
+    if (cycles > p_counters->isr_cycles_max)
+    {
+        p_counters->isr_cycles_max = cycles;
+    }
+}
+
+/** Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif
@@ -141,6 +141,12 @@ static void    r_adc_irq_enable(IRQn_Type irq, uint8_t ipl, void * p_context);
 static void    r_adc_irq_disable(IRQn_Type irq);
 static int32_t r_adc_lowest_channel_get(uint32_t adc_mask);
 static void    r_adc_scan_end_common_isr(adc_event_t event);
+static uint16_t * r_adc_stream_block_get(adc_instance_ctrl_t * const p_instance_ctrl, uint32_t block);
+static fsp_err_t  r_adc_stream_arm(adc_instance_ctrl_t * const p_instance_ctrl);
+static void       r_adc_stream_stop(adc_instance_ctrl_t * const p_instance_ctrl);
+static void       r_adc_stream_decimate(adc_instance_ctrl_t * const p_instance_ctrl, uint16_t * p_block);
+static void       r_adc_stream_block_complete(adc_instance_ctrl_t * const p_instance_ctrl);
+static void       r_adc_stream_transfer_callback(transfer_callback_args_t * p_args);
 
 /** Look-up table for ADSTRGR values */
 static const uint32_t adc_elc_trigger_lut[] =
@@ -247,6 +253,7 @@ fsp_err_t R_ADC_Open (adc_ctrl_t * p_ctrl, adc_cfg_t const * const p_cfg)
     p_instance_ctrl->p_callback        = p_cfg->p_callback;
     p_instance_ctrl->p_context         = p_cfg->p_context;
     p_instance_ctrl->p_callback_memory = NULL;
+    p_instance_ctrl->p_stream_cfg      = NULL;
 
     /* Calculate the register base address. */
     uint32_t address_gap = (uint32_t) R_ADC1 - (uint32_t) R_ADC0;
@@ -700,6 +707,12 @@ fsp_err_t R_ADC_Close (adc_ctrl_t * p_ctrl)
     FSP_ERROR_RETURN(ADC_OPEN == p_instance_ctrl->opened, FSP_ERR_NOT_OPEN);
 #endif
 
+    /* Stop streaming before the transfer end interrupts are lost. */
+    if (NULL != p_instance_ctrl->p_stream_cfg)
+    {
+        r_adc_stream_stop(p_instance_ctrl);
+    }
+
     /* Mark driver as closed   */
     p_instance_ctrl->opened      = 0U;
     p_instance_ctrl->initialized = 0U;
@@ -805,6 +818,203 @@ fsp_err_t R_ADC_OffsetSet (adc_ctrl_t * const p_ctrl, adc_channel_t const reg_id
     return FSP_ERR_UNSUPPORTED;
 }
 
+/*******************************************************************************************************************//**
+ * Starts streaming scan results into a ring of blocks. Each scan end event activates the transfer instance in
+ * p_stream_cfg, which copies all data registers reported by R_ADC_InfoGet into the next frame of the current block
+ * without CPU involvement. When frames_per_block scans have been copied the block is decimated (if enabled), the
+ * transfer is rearmed on the next free block and the callback is called with ADC_EVENT_STREAM_BLOCK_COMPLETE.
+ * Completed blocks are read in order with R_ADC_StreamBlockGet and returned with R_ADC_StreamBlockRelease.
+ *
+ * When decimation is greater than 1, every group of decimation frames is reduced in place to one frame: positions set
+ * in decimation_mask hold the average of the group and the other positions hold the newest sample of the group.
+ *
+ * If all other blocks are still held by the application when a block completes, its data is discarded, the block is
+ * refilled and the callback is called with ADC_EVENT_OVERFLOW.
+ *
+ * The transfer instance must be activated by adc_info_t::elc_event. With a DMAC instance the block completion is
+ * reported by the DMAC interrupt and the scan end interrupt is disabled while streaming. With a DTC instance the
+ * completion is reported by the scan end interrupt, which must be enabled.
+ *
+ * @note Scans are started by this function, so the unit must be configured for continuous scan or a hardware trigger.
+ *
+ * @retval FSP_SUCCESS                 Streaming started.
+ * @retval FSP_ERR_ASSERTION           An input argument is invalid.
+ * @retval FSP_ERR_NOT_OPEN            Unit is not open.
+ * @retval FSP_ERR_NOT_INITIALIZED     Unit is not initialized.
+ * @retval FSP_ERR_IN_USE              Streaming is already active.
+ * @retval FSP_ERR_IRQ_BSP_DISABLED    A DTC instance is used but the scan end interrupt is not enabled.
+ * @return                             See @ref RENESAS_ERROR_CODES or functions called by this function for other possible
+ *                                     return codes. This function calls:
+ *                                         * @ref transfer_api_t::callbackSet
+ *                                         * @ref transfer_api_t::reconfigure
+ **********************************************************************************************************************/
+fsp_err_t R_ADC_StreamStart (adc_ctrl_t * const p_ctrl, adc_stream_cfg_t const * const p_stream_cfg)
+{
+    adc_instance_ctrl_t * p_instance_ctrl = (adc_instance_ctrl_t *) p_ctrl;
+
+#if ADC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_stream_cfg);
+    FSP_ASSERT(NULL != p_stream_cfg->p_transfer);
+    FSP_ASSERT(NULL != p_stream_cfg->p_buffer);
+    FSP_ASSERT(p_stream_cfg->num_blocks >= 2U);
+    FSP_ASSERT(p_stream_cfg->frames_per_block > 0U);
+    FSP_ASSERT(p_stream_cfg->decimation > 0U);
+    FSP_ASSERT(0U == (p_stream_cfg->frames_per_block % p_stream_cfg->decimation));
+    FSP_ERROR_RETURN(ADC_OPEN == p_instance_ctrl->opened, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(ADC_OPEN == p_instance_ctrl->initialized, FSP_ERR_NOT_INITIALIZED);
+    FSP_ERROR_RETURN(NULL == p_instance_ctrl->p_stream_cfg, FSP_ERR_IN_USE);
+#endif
+
+    /* The frame is the register window that covers every scanned channel. */
+    adc_info_t info;
+    fsp_err_t  err = R_ADC_InfoGet(p_ctrl, &info);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    /* The DMAC reports the end of a block through its own interrupt. The DTC does not support callbacks; when the last
+     * frame of a block has been transferred it passes the scan end interrupt on to the CPU instead. */
+    transfer_instance_t const * p_transfer = p_stream_cfg->p_transfer;
+    err = p_transfer->p_api->callbackSet(p_transfer->p_ctrl, r_adc_stream_transfer_callback, p_instance_ctrl, NULL);
+    if (FSP_ERR_UNSUPPORTED == err)
+    {
+        FSP_ERROR_RETURN(p_instance_ctrl->p_cfg->scan_end_irq >= 0, FSP_ERR_IRQ_BSP_DISABLED);
+        p_instance_ctrl->stream_dmac = false;
+    }
+    else
+    {
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+        p_instance_ctrl->stream_dmac = true;
+    }
+
+    /* One block transfer per scan: the data registers are the repeat area and are re-read for every frame. */
+    transfer_info_t * p_info = &p_instance_ctrl->stream_info;
+    p_info->transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_info->transfer_settings_word_b.repeat_area    = TRANSFER_REPEAT_AREA_SOURCE;
+    p_info->transfer_settings_word_b.irq            = TRANSFER_IRQ_END;
+    p_info->transfer_settings_word_b.chain_mode     = TRANSFER_CHAIN_MODE_DISABLED;
+    p_info->transfer_settings_word_b.src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_info->transfer_settings_word_b.size           = TRANSFER_SIZE_2_BYTE;
+    p_info->transfer_settings_word_b.mode           = TRANSFER_MODE_BLOCK;
+    p_info->p_src = (void const *) info.p_address;
+
+    p_instance_ctrl->stream_frame_size = info.length;
+    p_instance_ctrl->stream_write      = 0U;
+    p_instance_ctrl->stream_read       = 0U;
+    p_instance_ctrl->stream_count      = 0U;
+    p_instance_ctrl->p_stream_cfg      = p_stream_cfg;
+
+    err = r_adc_stream_arm(p_instance_ctrl);
+    if (FSP_SUCCESS != err)
+    {
+        p_instance_ctrl->p_stream_cfg = NULL;
+
+        return err;
+    }
+
+    /* Scan end interrupts carry no information for the application while the DMAC is streaming. */
+    if (p_instance_ctrl->stream_dmac && (p_instance_ctrl->p_cfg->scan_end_irq >= 0))
+    {
+        R_BSP_IrqDisable(p_instance_ctrl->p_cfg->scan_end_irq);
+    }
+
+    /* Enable hardware trigger or start software scan depending on mode. */
+    p_instance_ctrl->p_reg->ADCSR = p_instance_ctrl->scan_start_adcsr;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the oldest completed streaming block. The block stays owned by the application until it is returned with
+ * R_ADC_StreamBlockRelease. The block holds p_frames frames of adc_info_t::length samples each.
+ *
+ * @retval FSP_SUCCESS                 A completed block was returned.
+ * @retval FSP_ERR_ASSERTION           An input argument is invalid.
+ * @retval FSP_ERR_NOT_OPEN            Unit is not open.
+ * @retval FSP_ERR_NOT_ENABLED         Streaming is not active.
+ * @retval FSP_ERR_BUFFER_EMPTY        No completed block is available.
+ **********************************************************************************************************************/
+fsp_err_t R_ADC_StreamBlockGet (adc_ctrl_t * const p_ctrl, uint16_t ** const pp_block, uint32_t * const p_frames)
+{
+    adc_instance_ctrl_t * p_instance_ctrl = (adc_instance_ctrl_t *) p_ctrl;
+
+#if ADC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != pp_block);
+    FSP_ASSERT(NULL != p_frames);
+    FSP_ERROR_RETURN(ADC_OPEN == p_instance_ctrl->opened, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(NULL != p_instance_ctrl->p_stream_cfg, FSP_ERR_NOT_ENABLED);
+#endif
+
+    FSP_ERROR_RETURN(0U != p_instance_ctrl->stream_count, FSP_ERR_BUFFER_EMPTY);
+
+    adc_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+    *pp_block = r_adc_stream_block_get(p_instance_ctrl, p_instance_ctrl->stream_read);
+    *p_frames = (uint32_t) p_stream_cfg->frames_per_block / p_stream_cfg->decimation;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Returns the block obtained with R_ADC_StreamBlockGet so it can be filled again.
+ *
+ * @retval FSP_SUCCESS                 Block released.
+ * @retval FSP_ERR_ASSERTION           An input argument is invalid.
+ * @retval FSP_ERR_NOT_OPEN            Unit is not open.
+ * @retval FSP_ERR_NOT_ENABLED         Streaming is not active.
+ * @retval FSP_ERR_BUFFER_EMPTY        No block is held by the application.
+ **********************************************************************************************************************/
+fsp_err_t R_ADC_StreamBlockRelease (adc_ctrl_t * const p_ctrl)
+{
+    adc_instance_ctrl_t * p_instance_ctrl = (adc_instance_ctrl_t *) p_ctrl;
+
+#if ADC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(ADC_OPEN == p_instance_ctrl->opened, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(NULL != p_instance_ctrl->p_stream_cfg, FSP_ERR_NOT_ENABLED);
+#endif
+
+    FSP_ERROR_RETURN(0U != p_instance_ctrl->stream_count, FSP_ERR_BUFFER_EMPTY);
+
+    uint16_t read = (uint16_t) (p_instance_ctrl->stream_read + 1U);
+    if (read >= p_instance_ctrl->p_stream_cfg->num_blocks)
+    {
+        read = 0U;
+    }
+
+    p_instance_ctrl->stream_read = read;
+
+    /* The count is also updated by the completion interrupt. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    p_instance_ctrl->stream_count--;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Stops scanning and streaming. Completed blocks that were not read are discarded.
+ *
+ * @retval FSP_SUCCESS                 Streaming stopped.
+ * @retval FSP_ERR_ASSERTION           An input argument is invalid.
+ * @retval FSP_ERR_NOT_OPEN            Unit is not open.
+ * @retval FSP_ERR_NOT_ENABLED         Streaming is not active.
+ **********************************************************************************************************************/
+fsp_err_t R_ADC_StreamStop (adc_ctrl_t * const p_ctrl)
+{
+    adc_instance_ctrl_t * p_instance_ctrl = (adc_instance_ctrl_t *) p_ctrl;
+
+#if ADC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(ADC_OPEN == p_instance_ctrl->opened, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(NULL != p_instance_ctrl->p_stream_cfg, FSP_ERR_NOT_ENABLED);
+#endif
+
+    r_adc_stream_stop(p_instance_ctrl);
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup ADC)
  **********************************************************************************************************************/
@@ -1652,6 +1862,169 @@ static void r_adc_call_callback (adc_instance_ctrl_t * p_ctrl, adc_callback_args
     }
 }
 
+/*******************************************************************************************************************//**
+ * Returns the start of a streaming block.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to instance control block
+ * @param[in]  block                   Block index
+ **********************************************************************************************************************/
+static uint16_t * r_adc_stream_block_get (adc_instance_ctrl_t * const p_instance_ctrl, uint32_t block)
+{
+    adc_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+
+    return p_stream_cfg->p_buffer + (block * p_stream_cfg->frames_per_block * p_instance_ctrl->stream_frame_size);
+}
+
+/*******************************************************************************************************************//**
+ * Points the transfer at the block being filled and enables it.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to instance control block
+ **********************************************************************************************************************/
+static fsp_err_t r_adc_stream_arm (adc_instance_ctrl_t * const p_instance_ctrl)
+{
+    adc_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+    transfer_info_t        * p_info       = &p_instance_ctrl->stream_info;
+
+    /* The transfer writes back the destination address and block count, so both are reloaded for every block. */
+    p_info->p_dest     = r_adc_stream_block_get(p_instance_ctrl, p_instance_ctrl->stream_write);
+    p_info->length     = (uint16_t) p_instance_ctrl->stream_frame_size;
+    p_info->num_blocks = p_stream_cfg->frames_per_block;
+
+    return p_stream_cfg->p_transfer->p_api->reconfigure(p_stream_cfg->p_transfer->p_ctrl, p_info);
+}
+
+/*******************************************************************************************************************//**
+ * Stops scanning and disables the streaming transfer.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to instance control block
+ **********************************************************************************************************************/
+static void r_adc_stream_stop (adc_instance_ctrl_t * const p_instance_ctrl)
+{
+    transfer_instance_t const * p_transfer = p_instance_ctrl->p_stream_cfg->p_transfer;
+
+    /* Disable hardware trigger or stop software scan depending on mode. */
+    p_instance_ctrl->p_reg->ADCSR = 0U;
+
+    (void) p_transfer->p_api->disable(p_transfer->p_ctrl);
+
+    IRQn_Type scan_end_irq = p_instance_ctrl->p_cfg->scan_end_irq;
+    if (p_instance_ctrl->stream_dmac && (scan_end_irq >= 0))
+    {
+        /* Discard the scan end requests that were raised while streaming and restore the interrupt. */
+        R_BSP_IrqEnable(scan_end_irq);
+    }
+
+    p_instance_ctrl->p_stream_cfg = NULL;
+}
+
+/*******************************************************************************************************************//**
+ * Reduces each group of decimation frames in a completed block to one frame, in place. Output frame n is written over
+ * the start of input group n, which is never ahead of data that is still to be read.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to instance control block
+ * @param[in]  p_block                 Completed block
+ **********************************************************************************************************************/
+static void r_adc_stream_decimate (adc_instance_ctrl_t * const p_instance_ctrl, uint16_t * p_block)
+{
+    adc_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+    uint32_t                 decimation   = p_stream_cfg->decimation;
+    uint32_t                 frame_size   = p_instance_ctrl->stream_frame_size;
+    uint32_t                 group_size   = decimation * frame_size;
+    uint32_t                 newest       = group_size - frame_size;
+    uint16_t const         * p_in         = p_block;
+    uint16_t               * p_out        = p_block;
+
+    for (uint32_t frame = 0U; frame < p_stream_cfg->frames_per_block; frame += decimation)
+    {
+        for (uint32_t i = 0U; i < frame_size; i++)
+        {
+            if (p_stream_cfg->decimation_mask & (1U << i))
+            {
+                /* Moving sum over the group, normalized to the input resolution. */
+                uint32_t sum = 0U;
+                for (uint32_t sample = i; sample < group_size; sample += frame_size)
+                {
+                    sum += p_in[sample];
+                }
+
+                p_out[i] = (uint16_t) (sum / decimation);
+            }
+            else
+            {
+                p_out[i] = p_in[newest + i];
+            }
+        }
+
+        p_in  += group_size;
+        p_out += frame_size;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Handles the end of a streaming block: decimates it, rearms the transfer on the next free block and notifies the
+ * application.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to instance control block
+ **********************************************************************************************************************/
+static void r_adc_stream_block_complete (adc_instance_ctrl_t * const p_instance_ctrl)
+{
+    adc_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+    adc_callback_args_t      args;
+
+    /* One block is always being filled, so at most num_blocks - 1 blocks can be waiting for the application. */
+    if ((uint32_t) p_instance_ctrl->stream_count + 1U < p_stream_cfg->num_blocks)
+    {
+        uint16_t * p_block = r_adc_stream_block_get(p_instance_ctrl, p_instance_ctrl->stream_write);
+
+        uint16_t write = (uint16_t) (p_instance_ctrl->stream_write + 1U);
+        if (write >= p_stream_cfg->num_blocks)
+        {
+            write = 0U;
+        }
+
+        /* Rearm first so the next scan is not missed while the block is decimated. */
+        p_instance_ctrl->stream_write = write;
+        (void) r_adc_stream_arm(p_instance_ctrl);
+
+        if (p_stream_cfg->decimation > 1U)
+        {
+            r_adc_stream_decimate(p_instance_ctrl, p_block);
+        }
+
+        p_instance_ctrl->stream_count++;
+        args.event = ADC_EVENT_STREAM_BLOCK_COMPLETE;
+    }
+    else
+    {
+        /* No free block: refill the same block and drop its data. */
+        (void) r_adc_stream_arm(p_instance_ctrl);
+        args.event = ADC_EVENT_OVERFLOW;
+    }
+
+    if (NULL != p_instance_ctrl->p_callback)
+    {
+        args.unit      = p_instance_ctrl->p_cfg->unit;
+        args.channel   = ADC_CHANNEL_0;
+        args.p_context = p_instance_ctrl->p_context;
+        r_adc_call_callback(p_instance_ctrl, &args);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * DMAC transfer end callback used while streaming.
+ *
+ * @param[in]  p_args                  Transfer callback arguments
+ **********************************************************************************************************************/
+static void r_adc_stream_transfer_callback (transfer_callback_args_t * p_args)
+{
+    adc_instance_ctrl_t * p_instance_ctrl = (adc_instance_ctrl_t *) p_args->p_context;
+
+    if (NULL != p_instance_ctrl->p_stream_cfg)
+    {
+        r_adc_stream_block_complete(p_instance_ctrl);
+    }
+}
+
 /*******************************************************************************************************************//**
  * Clears interrupt flag and calls a callback to notify application of the event.
  *
@@ -1667,33 +2040,41 @@ static void r_adc_scan_end_common_isr (adc_event_t event)
     /* Clear the BSP IRQ Flag     */
     R_BSP_IrqStatusClear(R_FSP_CurrentIrqGet());
 
-    adc_callback_args_t args;
-    args.event = event;
+    /* While streaming through the DTC, the scan end interrupt only reaches the CPU after the last frame of a block. */
+    if ((ADC_EVENT_SCAN_COMPLETE == event) && (NULL != p_instance_ctrl->p_stream_cfg) && !p_instance_ctrl->stream_dmac)
+    {
+        r_adc_stream_block_complete(p_instance_ctrl);
+    }
+    else
+    {
+        adc_callback_args_t args;
+        args.event = event;
 #if BSP_FEATURE_ADC_CALIBRATION_REG_AVAILABLE
 
-    /* Store the correct event into the callback argument */
-    if (ADC_ADICR_CALIBRATION_INTERRUPT_DISABLED != p_instance_ctrl->p_reg->ADICR)
-    {
-        args.event = ADC_EVENT_CALIBRATION_COMPLETE;
+        /* Store the correct event into the callback argument */
+        if (ADC_ADICR_CALIBRATION_INTERRUPT_DISABLED != p_instance_ctrl->p_reg->ADICR)
+        {
+            args.event = ADC_EVENT_CALIBRATION_COMPLETE;
 
-        /* Restore the interrupt source to disable interrupts after calibration is done. */
-        p_instance_ctrl->p_reg->ADICR = 0U;
-    }
+            /* Restore the interrupt source to disable interrupts after calibration is done. */
+            p_instance_ctrl->p_reg->ADICR = 0U;
+        }
 #endif
 
-    /* Store the unit number into the callback argument */
-    args.unit = p_instance_ctrl->p_cfg->unit;
+        /* Store the unit number into the callback argument */
+        args.unit = p_instance_ctrl->p_cfg->unit;
 
-    /* Initialize the channel to 0.  It is not used in this implementation. */
-    args.channel = ADC_CHANNEL_0;
+        /* Initialize the channel to 0.  It is not used in this implementation. */
+        args.channel = ADC_CHANNEL_0;
 
-    /* Populate the context field. */
-    args.p_context = p_instance_ctrl->p_context;
+        /* Populate the context field. */
+        args.p_context = p_instance_ctrl->p_context;
 
-    /* If a callback was provided, call it with the argument */
-    if (NULL != p_instance_ctrl->p_callback)
-    {
-        r_adc_call_callback(p_instance_ctrl, &args);
+        /* If a callback was provided, call it with the argument */
+        if (NULL != p_instance_ctrl->p_callback)
+        {
+            r_adc_call_callback(p_instance_ctrl, &args);
+        }
     }
 
     /* Restore context if RTOS is used */
@@ -28,6 +28,13 @@
  * Macro definitions
  **********************************************************************************************************************/
 
+#ifndef CANFD_CFG_RX_RING_ENABLE
+ #define CANFD_CFG_RX_RING_ENABLE          (0)
+#endif
+#ifndef CANFD_CFG_TX_QUEUE_ENABLE
+ #define CANFD_CFG_TX_QUEUE_ENABLE         (0)
+#endif
+
 #define CANFD_OPEN                         (0x52434644U) // "RCFD" in ASCII
 
 #define CANFD_BAUD_RATE_PRESCALER_MIN      (1U)
@@ -87,6 +94,16 @@
 
 #define CANFD_PRV_CFIFO_INDEX(buffer, channel)    ((buffer) + ((channel) * CANFD_PRV_CFIFO_CHANNEL_OFFSET))
 
+/* Convert a TX message buffer number (0-7, 32-39) into a dense index (0-15) for the transmit queue tables. */
+#define CANFD_PRV_TXQ_MB_INDEX(txmb)              (((txmb) & 7U) | (((txmb) >> 2) & 8U))
+
+/* Arbitration field layout used for transmit queue keys: base ID, SRR/RTR, IDE, extended ID, RTR. */
+#define CANFD_PRV_TXQ_KEY_BASE_ID_POS             (21U)
+#define CANFD_PRV_TXQ_KEY_SRR_POS                 (20U)
+#define CANFD_PRV_TXQ_KEY_IDE_POS                 (19U)
+#define CANFD_PRV_TXQ_KEY_EXT_ID_POS              (1U)
+#define CANFD_PRV_EXTENDED_ID_LOW_BITS            (18U)
+
 /***********************************************************************************************************************
  * Const data
  **********************************************************************************************************************/
@@ -125,6 +142,29 @@ static uint8_t r_canfd_bytes_to_dlc(uint8_t bytes);
 static void r_candfd_global_error_handler(uint32_t instance);
 static void r_canfd_rx_fifo_handler(uint32_t instance);
 static void r_canfd_mb_read(R_CANFD_Type * p_reg, uint32_t buffer, can_frame_t * const frame);
+static void r_canfd_txmb_load(canfd_instance_ctrl_t * p_ctrl, uint32_t buffer_idx, can_frame_t * const p_frame);
+
+#if CANFD_CFG_PARAM_CHECKING_ENABLE
+static fsp_err_t r_canfd_frame_parameter_check(can_frame_t * const p_frame);
+
+#endif
+
+#if CANFD_CFG_TX_QUEUE_ENABLE
+static uint32_t r_canfd_tx_queue_key(can_frame_t const * const p_frame);
+static bool     r_canfd_tx_queue_higher(uint32_t key_a, uint32_t seq_a, uint32_t key_b, uint32_t seq_b);
+static void     r_canfd_tx_queue_push(canfd_tx_queue_t * p_queue, uint32_t key, uint32_t sequence,
+                                      can_frame_t const * const p_frame);
+static void     r_canfd_tx_queue_pop(canfd_tx_queue_t * p_queue);
+static void     r_canfd_tx_queue_service(canfd_instance_ctrl_t * p_ctrl);
+static bool     r_canfd_tx_queue_mb_release(canfd_instance_ctrl_t * p_ctrl, uint32_t txmb, bool aborted);
+
+#endif
+
+#if CANFD_CFG_RX_RING_ENABLE
+static bool r_canfd_rx_ring_push(R_CANFD_Type * p_reg, uint32_t buffer, canfd_instance_ctrl_t * p_ctrl);
+static void r_canfd_rx_ring_notify(canfd_instance_ctrl_t * p_ctrl, uint32_t buffer);
+
+#endif
 static void r_canfd_call_callback(canfd_instance_ctrl_t * p_ctrl, can_callback_args_t * p_args);
 static void r_canfd_mode_transition(canfd_instance_ctrl_t * p_ctrl, can_operation_mode_t operation_mode);
 static void r_canfd_mode_ctr_set(volatile uint32_t * p_ctr_reg, can_operation_mode_t operation_mode);
@@ -182,6 +222,8 @@ const can_api_t g_canfd_on_canfd =
  * @retval FSP_ERR_ASSERTION                      A required pointer was NULL.
  * @retval FSP_ERR_CAN_INIT_FAILED                The provided nominal or data bitrate is invalid.
  * @retval FSP_ERR_CLOCK_INACTIVE                 CANFD source clock is disabled (PLL or PLL2).
+ * @retval FSP_ERR_INVALID_ARGUMENT               The receive ring length is not a power of 2, or the transmit queue
+ *                                                configuration is invalid.
  *****************************************************************************************************************/
 fsp_err_t R_CANFD_Open (can_ctrl_t * const p_api_ctrl, can_cfg_t const * const p_cfg)
 {
@@ -210,6 +252,30 @@ fsp_err_t R_CANFD_Open (can_ctrl_t * const p_api_ctrl, can_cfg_t const * const p
     canfd_extended_cfg_t * p_extend = (canfd_extended_cfg_t *) p_cfg->p_extend;
     FSP_ASSERT(p_extend->p_global_cfg);
 
+ #if CANFD_CFG_RX_RING_ENABLE
+
+    /* The receive ring length must be a non-zero power of 2 so indexes can be masked */
+    if (NULL != p_extend->p_rx_ring_buffer)
+    {
+        FSP_ERROR_RETURN((0U != p_extend->rx_ring_length) &&
+                         (0U == (p_extend->rx_ring_length & (p_extend->rx_ring_length - 1U))),
+                         FSP_ERR_INVALID_ARGUMENT);
+    }
+ #endif
+
+ #if CANFD_CFG_TX_QUEUE_ENABLE
+    if (NULL != p_extend->p_tx_queue_buffer)
+    {
+        /* The queue needs storage, at least one TX message buffer with its interrupt enabled, and ID priority
+         * transmission so the hardware sends the highest priority loaded buffer first */
+        FSP_ERROR_RETURN(0U != p_extend->tx_queue_length, FSP_ERR_INVALID_ARGUMENT);
+        FSP_ERROR_RETURN(0U != p_extend->tx_queue_mb_mask, FSP_ERR_INVALID_ARGUMENT);
+        FSP_ERROR_RETURN(0U == (p_extend->tx_queue_mb_mask & ~p_extend->txmb_txi_enable), FSP_ERR_INVALID_ARGUMENT);
+        FSP_ERROR_RETURN(p_extend->p_global_cfg->global_config & R_CANFD_CFDGCFG_TPRI_Msk, FSP_ERR_INVALID_ARGUMENT);
+        FSP_ERROR_RETURN(p_cfg->tx_irq >= 0, FSP_ERR_INVALID_ARGUMENT);
+    }
+ #endif
+
  #if BSP_CFG_CANFDCLK_SOURCE != BSP_CLOCKS_SOURCE_CLOCK_MAIN_OSC
 
     /* Check that PLL/PLL2 is running when it is selected as the DLL source clock */
@@ -266,6 +332,34 @@ fsp_err_t R_CANFD_Open (can_ctrl_t * const p_api_ctrl, can_cfg_t const * const p
     p_ctrl->p_context         = p_cfg->p_context;
     p_ctrl->p_callback_memory = NULL;
 
+    /* Initialize the software receive ring */
+#if CANFD_CFG_RX_RING_ENABLE
+    p_ctrl->rx_ring.p_frames = p_extend->p_rx_ring_buffer;
+    p_ctrl->rx_ring.mask     = p_extend->rx_ring_length - 1U;
+#else
+    p_ctrl->rx_ring.p_frames = NULL;
+    p_ctrl->rx_ring.mask     = 0U;
+#endif
+    p_ctrl->rx_ring.head           = 0U;
+    p_ctrl->rx_ring.tail           = 0U;
+    p_ctrl->rx_ring.overflow_count = 0U;
+
+    /* Initialize the software transmit queue */
+#if CANFD_CFG_TX_QUEUE_ENABLE
+    p_ctrl->tx_queue.p_heap  = p_extend->p_tx_queue_buffer;
+    p_ctrl->tx_queue.length  = p_extend->tx_queue_length;
+    p_ctrl->tx_queue.mb_mask = (NULL != p_extend->p_tx_queue_buffer) ? p_extend->tx_queue_mb_mask : 0U;
+#else
+    p_ctrl->tx_queue.p_heap  = NULL;
+    p_ctrl->tx_queue.length  = 0U;
+    p_ctrl->tx_queue.mb_mask = 0U;
+#endif
+    p_ctrl->tx_queue.count    = 0U;
+    p_ctrl->tx_queue.sequence = 0U;
+    p_ctrl->tx_queue.mb_busy  = 0U;
+    p_ctrl->tx_queue.mb_abort   = 0U;
+    p_ctrl->tx_queue.lost_count = 0U;
+
     /* Get global config */
     canfd_global_cfg_t * p_global_cfg = p_extend->p_global_cfg;
 
@@ -451,6 +545,8 @@ fsp_err_t R_CANFD_Open (can_ctrl_t * const p_api_ctrl, can_cfg_t const * const p
     p_ctrl->operation_mode = CAN_OPERATION_MODE_NORMAL;
     p_ctrl->test_mode      = CAN_TEST_MODE_DISABLED;
 
+    BSP_PERF_REGISTER(p_ctrl, "r_canfd", p_cfg->channel);
+
     /* Set driver to open */
     p_ctrl->open = CANFD_OPEN;
 
@@ -476,6 +572,8 @@ fsp_err_t R_CANFD_Close (can_ctrl_t * const p_api_ctrl)
     /* Set driver to closed */
     p_ctrl->open = 0U;
 
+    BSP_PERF_UNREGISTER(p_ctrl);
+
     /* Get config struct */
     can_cfg_t * p_cfg = (can_cfg_t *) p_ctrl->p_cfg;
 
@@ -561,6 +659,7 @@ fsp_err_t R_CANFD_Close (can_ctrl_t * const p_api_ctrl)
  * @retval FSP_ERR_INVALID_MODE             An FD option was set on a non-FD frame.
  * @retval FSP_ERR_ASSERTION                One or more pointer arguments is NULL.
  * @retval FSP_ERR_UNSUPPORTED              FD is not supported on this MCU.
+ * @retval FSP_ERR_IN_USE                   The TX message buffer is reserved for the transmit queue.
  *****************************************************************************************************************/
 fsp_err_t R_CANFD_Write (can_ctrl_t * const p_api_ctrl, uint32_t buffer, can_frame_t * const p_frame)
 {
@@ -587,39 +686,23 @@ fsp_err_t R_CANFD_Write (can_ctrl_t * const p_api_ctrl, uint32_t buffer, can_fra
  #endif
 
     /* Check DLC field */
- #if BSP_FEATURE_CANFD_FD_SUPPORT
-    if (!(p_frame->options & CANFD_FRAME_OPTION_FD))
-    {
-        FSP_ERROR_RETURN(p_frame->data_length_code <= 8, FSP_ERR_INVALID_ARGUMENT);
-        FSP_ERROR_RETURN(p_frame->options == 0, FSP_ERR_INVALID_MODE);
-    }
-    else if (p_frame->data_length_code > 0)
-    {
-        /* Make sure the supplied data size corresponds to a valid DLC value */
-        FSP_ERROR_RETURN(0U != r_canfd_bytes_to_dlc(p_frame->data_length_code), FSP_ERR_INVALID_ARGUMENT);
-    }
-    else
-    {
-        /* Do nothing. */
-    }
-
- #else
-    FSP_ERROR_RETURN(p_frame->data_length_code <= 8, FSP_ERR_INVALID_ARGUMENT);
-    FSP_ERROR_RETURN(p_frame->options == 0, FSP_ERR_UNSUPPORTED);
- #endif
+    fsp_err_t err = r_canfd_frame_parameter_check(p_frame);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
 #else
     canfd_instance_ctrl_t * p_ctrl = (canfd_instance_ctrl_t *) p_api_ctrl;
 #endif
 
+    /* TX message buffers reserved for the transmit queue cannot be written directly. This is checked even when
+     * parameter checking is disabled because a direct write would corrupt the queue state. */
+    FSP_ERROR_RETURN((buffer >= (uint32_t) CANFD_TX_BUFFER_FIFO_COMMON_0) ||
+                     !(p_ctrl->tx_queue.mb_mask & (1ULL << buffer)),
+                     FSP_ERR_IN_USE);
+
     /* Provide variables to store common values. */
     const bool     is_cfifo           = buffer >= (uint32_t) CANFD_TX_BUFFER_FIFO_COMMON_0;
     const uint32_t interlaced_channel = CANFD_INTER_CH(p_ctrl->p_cfg->channel);
 
-    const uint32_t id = p_frame->id | ((uint32_t) p_frame->type << R_CANFD_CFDTM_ID_TMRTR_Pos) |
-                        ((uint32_t) p_frame->id_mode << R_CANFD_CFDTM_ID_TMIDE_Pos);
-
-    uint32_t  buffer_idx = 0;
-    uint8_t * p_dest     = NULL;
+    uint32_t buffer_idx = 0;
 
     if (!is_cfifo)
     {
@@ -629,27 +712,14 @@ fsp_err_t R_CANFD_Write (can_ctrl_t * const p_api_ctrl, uint32_t buffer, can_fra
         /* Ensure MB is ready */
         FSP_ERROR_RETURN(0U == p_ctrl->p_reg->CFDTMSTS_b[buffer_idx].TMTRM, FSP_ERR_CAN_TRANSMIT_NOT_READY);
 
-        /* Set ID */
-        p_ctrl->p_reg->CFDTM[buffer_idx].ID = id;
-#if BSP_FEATURE_CANFD_FD_SUPPORT
-
-        /* Set DLC */
-        p_ctrl->p_reg->CFDTM[buffer_idx].PTR = (uint32_t) r_canfd_bytes_to_dlc(p_frame->data_length_code) <<
-                                               R_CANFD_CFDTM_PTR_TMDLC_Pos;
-
-        /* Set FD bits (ESI, BRS and FDF) */
-        p_ctrl->p_reg->CFDTM[buffer_idx].FDCTR = p_frame->options & 7U;
-#else
-
-        /* Set DLC */
-        p_ctrl->p_reg->CFDTM[buffer_idx].PTR = (uint32_t) p_frame->data_length_code << R_CANFD_CFDTM_PTR_TMDLC_Pos;
-#endif
-
-        /* Store the data pointer. */
-        p_dest = (uint8_t *) p_ctrl->p_reg->CFDTM[buffer_idx].DF;
+        /* Load the frame and request transmission */
+        r_canfd_txmb_load(p_ctrl, buffer_idx, p_frame);
     }
     else
     {
+        const uint32_t id = p_frame->id | ((uint32_t) p_frame->type << R_CANFD_CFDTM_ID_TMRTR_Pos) |
+                            ((uint32_t) p_frame->id_mode << R_CANFD_CFDTM_ID_TMIDE_Pos);
+
         /* Calculate the Common FIFO index. */
         buffer_idx = buffer - (uint32_t) CANFD_TX_BUFFER_FIFO_COMMON_0 +
                      (interlaced_channel * CANFD_PRV_CFIFO_CHANNEL_OFFSET);
@@ -671,30 +741,90 @@ fsp_err_t R_CANFD_Write (can_ctrl_t * const p_api_ctrl, uint32_t buffer, can_fra
         p_ctrl->p_reg->CFDTM[buffer_idx].PTR = (uint32_t) p_frame->data_length_code << R_CANFD_CFDCF_PTR_CFDLC_Pos;
 #endif
 
-        /* Store the data poitner. */
-        p_dest = (uint8_t *) p_ctrl->p_reg->CFDCF[buffer_idx].DF;
-    }
+        /* Copy data to register buffer one word at a time. The frame data buffer is word aligned and a multiple of 4
+         * bytes long, and bytes past the DLC are not transmitted, so the final partial word can be copied whole. */
+        uint32_t            len    = ((uint32_t) p_frame->data_length_code + 3U) >> 2;
+        uint32_t          * p_src  = (uint32_t *) p_frame->data;
+        volatile uint32_t * p_dest = (volatile uint32_t *) p_ctrl->p_reg->CFDCF[buffer_idx].DF;
+        while (len--)
+        {
+            *p_dest++ = *p_src++;
+        }
 
-    /* Copy data to register buffer */
-    uint32_t  len   = p_frame->data_length_code;
-    uint8_t * p_src = p_frame->data;
-    while (len--)
-    {
-        *p_dest++ = *p_src++;
+        /* Increment the FIFO pointer by writing 0xFF to CFPC. */
+        p_ctrl->p_reg->CFDCFPCTR[buffer_idx] = R_CANFD_CFDCFPCTR_CFPC_Msk;
     }
 
-    if (!is_cfifo)
-    {
-        /* Request transmission */
-        p_ctrl->p_reg->CFDTMC[buffer_idx] = 1;
-    }
-    else
+    BSP_PERF_COUNT(p_ctrl, tx_bytes, p_frame->data_length_code);
+
+    return FSP_SUCCESS;
+}
+
+/***************************************************************************************************************//**
+ * Queue a frame for transmission in CAN arbitration priority order. The TX message buffers reserved in
+ * canfd_extended_cfg_t::tx_queue_mb_mask are kept loaded with the highest priority pending frames and are refilled
+ * from the transmit ISR. Frames with the same ID are transmitted in the order they were queued.
+ *
+ * If every reserved buffer is busy with a lower priority frame and transmit abort interrupts (TAIE) are enabled for
+ * the channel, the lowest priority buffer is aborted and its frame is returned to the queue. This is not reported to
+ * the application. If the queue was filled while the abort was pending, the preempted frame is dropped, counted in
+ * canfd_tx_queue_t::lost_count and reported with CAN_EVENT_TX_ABORTED.
+ *
+ * @retval FSP_SUCCESS                      Frame queued.
+ * @retval FSP_ERR_NOT_OPEN                 Control block not open.
+ * @retval FSP_ERR_ASSERTION                One or more pointer arguments is NULL.
+ * @retval FSP_ERR_INVALID_ARGUMENT         Data length invalid.
+ * @retval FSP_ERR_INVALID_MODE             An FD option was set on a non-FD frame.
+ * @retval FSP_ERR_NOT_ENABLED              No transmit queue is configured for this channel.
+ * @retval FSP_ERR_QUEUE_FULL               The transmit queue is full.
+ * @retval FSP_ERR_UNSUPPORTED              CANFD_CFG_TX_QUEUE_ENABLE is 0, or FD is not supported on this MCU.
+ *****************************************************************************************************************/
+fsp_err_t R_CANFD_TxQueueWrite (can_ctrl_t * const p_api_ctrl, can_frame_t * const p_frame)
+{
+#if CANFD_CFG_TX_QUEUE_ENABLE
+    canfd_instance_ctrl_t * p_ctrl = (canfd_instance_ctrl_t *) p_api_ctrl;
+
+ #if CANFD_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_frame);
+    FSP_ERROR_RETURN(p_ctrl->open == CANFD_OPEN, FSP_ERR_NOT_OPEN);
+
+    fsp_err_t err = r_canfd_frame_parameter_check(p_frame);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+ #endif
+
+    canfd_tx_queue_t * p_queue = &p_ctrl->tx_queue;
+    FSP_ERROR_RETURN(NULL != p_queue->p_heap, FSP_ERR_NOT_ENABLED);
+
+    uint32_t key = r_canfd_tx_queue_key(p_frame);
+
+    /* The heap is shared with the transmit ISR */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    if (p_queue->count >= p_queue->length)
     {
-        /* Increment the FIFO pointer by writing 0xFF to CFPC. */
-        p_ctrl->p_reg->CFDCFPCTR[buffer_idx] = R_CANFD_CFDCFPCTR_CFPC_Msk;
+        FSP_CRITICAL_SECTION_EXIT;
+
+        return FSP_ERR_QUEUE_FULL;
     }
 
+    r_canfd_tx_queue_push(p_queue, key, p_queue->sequence++, p_frame);
+
+    /* Load any free buffers (or preempt a lower priority one) */
+    r_canfd_tx_queue_service(p_ctrl);
+
+    BSP_PERF_COUNT(p_ctrl, tx_bytes, p_frame->data_length_code);
+
+    FSP_CRITICAL_SECTION_EXIT;
+
     return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+    FSP_PARAMETER_NOT_USED(p_frame);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
 }
 
 /***************************************************************************************************************//**
@@ -953,6 +1083,62 @@ fsp_err_t R_CANFD_CallbackSet (can_ctrl_t * const          p_api_ctrl,
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Copy up to max_frames frames out of the software receive ring. The ring is filled by the RX FIFO and Common FIFO
+ * ISRs when canfd_extended_cfg_t::p_rx_ring_buffer is set, and CAN_EVENT_RX_BATCH_READY is raised once per interrupt.
+ * This function may be called from a single consumer context while the ISRs are running.
+ *
+ * @retval  FSP_SUCCESS                  Frames copied; *p_count holds the number copied (may be 0).
+ * @retval  FSP_ERR_ASSERTION            A required pointer is NULL.
+ * @retval  FSP_ERR_NOT_OPEN             The control block has not been opened.
+ * @retval  FSP_ERR_NOT_ENABLED          No receive ring is configured for this channel.
+ * @retval  FSP_ERR_UNSUPPORTED          CANFD_CFG_RX_RING_ENABLE is 0.
+ **********************************************************************************************************************/
+fsp_err_t R_CANFD_RxRingRead (can_ctrl_t * const  p_api_ctrl,
+                              can_frame_t * const p_frames,
+                              uint32_t const      max_frames,
+                              uint32_t * const    p_count)
+{
+#if CANFD_CFG_RX_RING_ENABLE
+    canfd_instance_ctrl_t * p_ctrl = (canfd_instance_ctrl_t *) p_api_ctrl;
+
+ #if CANFD_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_ctrl);
+    FSP_ASSERT(p_frames);
+    FSP_ASSERT(p_count);
+    FSP_ERROR_RETURN(CANFD_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+ #endif
+
+    canfd_rx_ring_t * p_ring = &p_ctrl->rx_ring;
+    FSP_ERROR_RETURN(NULL != p_ring->p_frames, FSP_ERR_NOT_ENABLED);
+
+    /* Only the ISR writes head and only this function writes tail, so no lock is required. */
+    uint32_t tail      = p_ring->tail;
+    uint32_t available = p_ring->head - tail;
+    uint32_t count     = (available < max_frames) ? available : max_frames;
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        p_frames[i] = p_ring->p_frames[(tail + i) & p_ring->mask];
+    }
+
+    /* Make sure the frames are copied out before the slots are released to the ISR. */
+    __DMB();
+    p_ring->tail = tail + count;
+
+    *p_count = count;
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+    FSP_PARAMETER_NOT_USED(p_frames);
+    FSP_PARAMETER_NOT_USED(max_frames);
+    FSP_PARAMETER_NOT_USED(p_count);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup CAN)
  **********************************************************************************************************************/
@@ -995,6 +1181,349 @@ static bool r_canfd_bit_timing_parameter_check (can_bit_timing_cfg_t * const p_b
     return true;
 }
 
+/*******************************************************************************************************************//**
+ * Check that the DLC and options of a frame to be transmitted are valid.
+ *
+ * @param[in]     p_frame    Pointer to the frame to check
+ **********************************************************************************************************************/
+static fsp_err_t r_canfd_frame_parameter_check (can_frame_t * const p_frame)
+{
+ #if BSP_FEATURE_CANFD_FD_SUPPORT
+    if (!(p_frame->options & CANFD_FRAME_OPTION_FD))
+    {
+        FSP_ERROR_RETURN(p_frame->data_length_code <= 8, FSP_ERR_INVALID_ARGUMENT);
+        FSP_ERROR_RETURN(p_frame->options == 0, FSP_ERR_INVALID_MODE);
+    }
+    else if (p_frame->data_length_code > 0)
+    {
+        /* Make sure the supplied data size corresponds to a valid DLC value */
+        FSP_ERROR_RETURN(0U != r_canfd_bytes_to_dlc(p_frame->data_length_code), FSP_ERR_INVALID_ARGUMENT);
+    }
+    else
+    {
+        /* Do nothing. */
+    }
+
+ #else
+    FSP_ERROR_RETURN(p_frame->data_length_code <= 8, FSP_ERR_INVALID_ARGUMENT);
+    FSP_ERROR_RETURN(p_frame->options == 0, FSP_ERR_UNSUPPORTED);
+ #endif
+
+    return FSP_SUCCESS;
+}
+
+#endif
+
+/*******************************************************************************************************************//**
+ * Load a frame into a TX message buffer and request transmission. The buffer must not have a transmission pending.
+ *
+ * @param[in]     p_ctrl      Pointer to CAN instance control block
+ * @param[in]     buffer_idx  Global TX message buffer index (including the channel offset)
+ * @param[in]     p_frame     Pointer to the frame to transmit
+ **********************************************************************************************************************/
+static void r_canfd_txmb_load (canfd_instance_ctrl_t * p_ctrl, uint32_t buffer_idx, can_frame_t * const p_frame)
+{
+    R_CANFD_Type * p_reg = p_ctrl->p_reg;
+
+    /* Set ID */
+    p_reg->CFDTM[buffer_idx].ID = p_frame->id | ((uint32_t) p_frame->type << R_CANFD_CFDTM_ID_TMRTR_Pos) |
+                                  ((uint32_t) p_frame->id_mode << R_CANFD_CFDTM_ID_TMIDE_Pos);
+#if BSP_FEATURE_CANFD_FD_SUPPORT
+
+    /* Set DLC */
+    p_reg->CFDTM[buffer_idx].PTR = (uint32_t) r_canfd_bytes_to_dlc(p_frame->data_length_code) <<
+                                   R_CANFD_CFDTM_PTR_TMDLC_Pos;
+
+    /* Set FD bits (ESI, BRS and FDF) */
+    p_reg->CFDTM[buffer_idx].FDCTR = p_frame->options & 7U;
+#else
+
+    /* Set DLC */
+    p_reg->CFDTM[buffer_idx].PTR = (uint32_t) p_frame->data_length_code << R_CANFD_CFDTM_PTR_TMDLC_Pos;
+#endif
+
+    /* Copy data to register buffer one word at a time. The frame data buffer is word aligned and a multiple of 4 bytes
+     * long, and bytes past the DLC are not transmitted, so the final partial word can be copied whole. */
+    uint32_t            len    = ((uint32_t) p_frame->data_length_code + 3U) >> 2;
+    uint32_t          * p_src  = (uint32_t *) p_frame->data;
+    volatile uint32_t * p_dest = (volatile uint32_t *) p_reg->CFDTM[buffer_idx].DF;
+    while (len--)
+    {
+        *p_dest++ = *p_src++;
+    }
+
+    /* Request transmission */
+    p_reg->CFDTMC[buffer_idx] = R_CANFD_CFDTMC_TMTR_Msk;
+}
+
+#if CANFD_CFG_TX_QUEUE_ENABLE
+
+/*******************************************************************************************************************//**
+ * Build the transmit queue key for a frame. The key orders frames the same way bus arbitration does: a lower key wins.
+ *
+ * @param[in]     p_frame    Pointer to the frame
+ **********************************************************************************************************************/
+static uint32_t r_canfd_tx_queue_key (can_frame_t const * const p_frame)
+{
+    uint32_t rtr = (CAN_FRAME_TYPE_REMOTE == p_frame->type) ? 1U : 0U;
+
+    if (CAN_ID_MODE_EXTENDED == p_frame->id_mode)
+    {
+        /* Extended frames send the upper 11 bits, then SRR and IDE (both recessive), then the lower 18 bits and RTR */
+        return ((p_frame->id >> CANFD_PRV_EXTENDED_ID_LOW_BITS) << CANFD_PRV_TXQ_KEY_BASE_ID_POS) |
+               (1U << CANFD_PRV_TXQ_KEY_SRR_POS) | (1U << CANFD_PRV_TXQ_KEY_IDE_POS) |
+               ((p_frame->id & ((1U << CANFD_PRV_EXTENDED_ID_LOW_BITS) - 1U)) << CANFD_PRV_TXQ_KEY_EXT_ID_POS) | rtr;
+    }
+
+    /* Standard frames send the 11-bit ID, then RTR in the SRR position and a dominant IDE */
+    return ((p_frame->id & CANFD_PRV_STANDARD_ID_MAX) << CANFD_PRV_TXQ_KEY_BASE_ID_POS) |
+           (rtr << CANFD_PRV_TXQ_KEY_SRR_POS);
+}
+
+/*******************************************************************************************************************//**
+ * Returns true if frame A must be sent before frame B.
+ **********************************************************************************************************************/
+static bool r_canfd_tx_queue_higher (uint32_t key_a, uint32_t seq_a, uint32_t key_b, uint32_t seq_b)
+{
+    if (key_a != key_b)
+    {
+        return key_a < key_b;
+    }
+
+    /* Equal keys are sent in submission order (sequence numbers wrap) */
+    return (int32_t) (seq_a - seq_b) < 0;
+}
+
+/*******************************************************************************************************************//**
+ * Insert a frame into the transmit queue heap. The caller must ensure there is space.
+ **********************************************************************************************************************/
+static void r_canfd_tx_queue_push (canfd_tx_queue_t * p_queue, uint32_t key, uint32_t sequence,
+                                   can_frame_t const * const p_frame)
+{
+    uint32_t i = p_queue->count++;
+
+    /* Sift up: move parents down until the insertion point is found */
+    while (i > 0U)
+    {
+        uint32_t parent = (i - 1U) >> 1;
+
+        if (!r_canfd_tx_queue_higher(key, sequence, p_queue->p_heap[parent].key, p_queue->p_heap[parent].sequence))
+        {
+            break;
+        }
+
+        p_queue->p_heap[i] = p_queue->p_heap[parent];
+        i                  = parent;
+    }
+
+    p_queue->p_heap[i].key      = key;
+    p_queue->p_heap[i].sequence = sequence;
+    p_queue->p_heap[i].frame    = *p_frame;
+}
+
+/*******************************************************************************************************************//**
+ * Remove the highest priority frame from the transmit queue heap. The heap must not be empty.
+ **********************************************************************************************************************/
+static void r_canfd_tx_queue_pop (canfd_tx_queue_t * p_queue)
+{
+    uint32_t                       count  = --p_queue->count;
+    canfd_tx_queue_entry_t * const p_heap = p_queue->p_heap;
+    uint32_t                       i      = 0U;
+
+    /* Sift the last entry down from the root */
+    while (true)
+    {
+        uint32_t child = (i << 1) + 1U;
+
+        if (child >= count)
+        {
+            break;
+        }
+
+        if ((child + 1U < count) &&
+            r_canfd_tx_queue_higher(p_heap[child + 1U].key, p_heap[child + 1U].sequence, p_heap[child].key,
+                                    p_heap[child].sequence))
+        {
+            child++;
+        }
+
+        if (!r_canfd_tx_queue_higher(p_heap[child].key, p_heap[child].sequence, p_heap[count].key,
+                                     p_heap[count].sequence))
+        {
+            break;
+        }
+
+        p_heap[i] = p_heap[child];
+        i         = child;
+    }
+
+    if (i != count)
+    {
+        p_heap[i] = p_heap[count];
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Load free TX message buffers owned by the transmit queue with the highest priority pending frames. If no buffer is
+ * free and a buffer holds a lower priority frame than the head of the queue, request that buffer be aborted. Must be
+ * called from the transmit ISR or with interrupts masked.
+ *
+ * @param[in]     p_ctrl     Pointer to CAN instance control block
+ **********************************************************************************************************************/
+static void r_canfd_tx_queue_service (canfd_instance_ctrl_t * p_ctrl)
+{
+    canfd_tx_queue_t * p_queue     = &p_ctrl->tx_queue;
+    uint32_t           ch_offset   = CANFD_INTER_CH(p_ctrl->p_cfg->channel) * CANFD_PRV_TXMB_CHANNEL_OFFSET;
+    uint32_t           interlaced  = CANFD_INTER_CH(p_ctrl->p_cfg->channel);
+    bool               abort_ready = (p_ctrl->p_reg->CFDC[interlaced].CTR & R_CANFD_CFDC_CTR_TAIE_Msk) != 0U;
+
+    while (p_queue->count > 0U)
+    {
+        canfd_tx_queue_entry_t * p_top = &p_queue->p_heap[0];
+
+        uint64_t busy           = p_queue->mb_busy;
+        uint32_t victim         = UINT32_MAX;
+        uint32_t victim_key     = 0U;
+        uint32_t victim_seq     = 0U;
+        bool     same_key_busy  = false;
+
+        /* Inspect the buffers that are still transmitting */
+        while (busy)
+        {
+            uint32_t txmb = (uint32_t) __CLZ(__RBIT((uint32_t) busy));
+            txmb = ((uint32_t) busy != 0U) ? txmb : (uint32_t) __CLZ(__RBIT((uint32_t) (busy >> 32))) + 32U;
+            busy &= ~(1ULL << txmb);
+
+            uint32_t idx = CANFD_PRV_TXQ_MB_INDEX(txmb);
+
+            /* Frames with the same key must leave in order, so wait until the earlier one has been sent */
+            if (p_queue->mb_key[idx] == p_top->key)
+            {
+                same_key_busy = true;
+                break;
+            }
+
+            /* Track the lowest priority buffer that is not already being aborted */
+            if (!(p_queue->mb_abort & (1ULL << txmb)) &&
+                ((UINT32_MAX == victim) ||
+                 r_canfd_tx_queue_higher(victim_key, victim_seq, p_queue->mb_key[idx], p_queue->mb_sequence[idx])))
+            {
+                victim     = txmb;
+                victim_key = p_queue->mb_key[idx];
+                victim_seq = p_queue->mb_sequence[idx];
+            }
+        }
+
+        if (same_key_busy)
+        {
+            return;
+        }
+
+        uint64_t free = p_queue->mb_mask & ~p_queue->mb_busy;
+
+        if (0U == free)
+        {
+            /* Preempt the lowest priority buffer if the head of the queue would win arbitration against it. The frame is
+             * returned to the queue when the abort completes (see r_canfd_tx_queue_mb_release). */
+            if (abort_ready && (UINT32_MAX != victim) &&
+                r_canfd_tx_queue_higher(p_top->key, p_top->sequence, victim_key, victim_seq))
+            {
+                p_queue->mb_abort |= 1ULL << victim;
+                p_ctrl->p_reg->CFDTMC[victim + ch_offset] = R_CANFD_CFDTMC_TMTR_Msk | R_CANFD_CFDTMC_TMTAR_Msk;
+            }
+
+            return;
+        }
+
+        /* Load the lowest numbered free buffer */
+        uint32_t txmb = (uint32_t) __CLZ(__RBIT((uint32_t) free));
+        txmb = ((uint32_t) free != 0U) ? txmb : (uint32_t) __CLZ(__RBIT((uint32_t) (free >> 32))) + 32U;
+
+        uint32_t idx = CANFD_PRV_TXQ_MB_INDEX(txmb);
+        p_queue->mb_key[idx]      = p_top->key;
+        p_queue->mb_sequence[idx] = p_top->sequence;
+        p_queue->mb_busy         |= 1ULL << txmb;
+
+        r_canfd_txmb_load(p_ctrl, txmb + ch_offset, &p_top->frame);
+
+        r_canfd_tx_queue_pop(p_queue);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Release a TX message buffer owned by the transmit queue after its transmission completed or was aborted, then
+ * refill the buffers. Aborted frames are read back from the buffer and returned to the queue with their original
+ * sequence number so ordering is preserved.
+ *
+ * If the queue was filled while the abort was pending, the aborted frame cannot be returned. It is counted in
+ * canfd_tx_queue_t::lost_count and reported to the application with CAN_EVENT_TX_ABORTED.
+ *
+ * @param[in]     p_ctrl     Pointer to CAN instance control block
+ * @param[in]     txmb       TX message buffer number (0-7, 32-39)
+ * @param[in]     aborted    True if the transmission was aborted
+ *
+ * @retval true   The event must be passed to the application callback.
+ * @retval false  The frame was preempted by the driver and returned to the queue, so the event is not reported.
+ **********************************************************************************************************************/
+static bool r_canfd_tx_queue_mb_release (canfd_instance_ctrl_t * p_ctrl, uint32_t txmb, bool aborted)
+{
+    canfd_tx_queue_t * p_queue = &p_ctrl->tx_queue;
+    uint32_t           idx     = CANFD_PRV_TXQ_MB_INDEX(txmb);
+    bool               notify  = true;
+
+    if (aborted && (p_queue->count >= p_queue->length))
+    {
+        /* No room to return the preempted frame. */
+        p_queue->lost_count++;
+
+        BSP_PERF_COUNT(p_ctrl, overruns, 1U);
+    }
+    else if (aborted)
+    {
+        uint32_t                buffer_idx = txmb + (CANFD_INTER_CH(p_ctrl->p_cfg->channel) *
+                                                     CANFD_PRV_TXMB_CHANNEL_OFFSET);
+        volatile R_CANFD_CFDTM_Type * p_tm = &p_ctrl->p_reg->CFDTM[buffer_idx];
+        can_frame_t frame;
+
+        /* Read the frame back out of the buffer */
+        uint32_t id = p_tm->ID;
+        frame.id      = id & R_CANFD_CFDTM_ID_TMID_Msk;
+        frame.type    = (can_frame_type_t) ((id & R_CANFD_CFDTM_ID_TMRTR_Msk) >> R_CANFD_CFDTM_ID_TMRTR_Pos);
+        frame.id_mode = (can_id_mode_t) ((id & R_CANFD_CFDTM_ID_TMIDE_Msk) >> R_CANFD_CFDTM_ID_TMIDE_Pos);
+        frame.data_length_code = dlc_to_bytes[(p_tm->PTR & R_CANFD_CFDTM_PTR_TMDLC_Msk) >> R_CANFD_CFDTM_PTR_TMDLC_Pos];
+ #if BSP_FEATURE_CANFD_FD_SUPPORT
+        frame.options = p_tm->FDCTR & 7U;
+ #else
+        frame.options = 0U;
+ #endif
+
+        uint32_t            len    = ((uint32_t) frame.data_length_code + 3U) >> 2;
+        uint32_t          * p_dest = (uint32_t *) frame.data;
+        volatile uint32_t * p_src  = (volatile uint32_t *) p_tm->DF;
+        while (len--)
+        {
+            *p_dest++ = *p_src++;
+        }
+
+        r_canfd_tx_queue_push(p_queue, p_queue->mb_key[idx], p_queue->mb_sequence[idx], &frame);
+
+        BSP_PERF_COUNT(p_ctrl, retries, 1U);
+
+        notify = false;
+    }
+    else
+    {
+        /* Transmission completed. */
+    }
+
+    p_queue->mb_busy  &= ~(1ULL << txmb);
+    p_queue->mb_abort &= ~(1ULL << txmb);
+
+    r_canfd_tx_queue_service(p_ctrl);
+
+    return notify;
+}
+
 #endif
 
 /*******************************************************************************************************************//**
@@ -1049,10 +1578,10 @@ static void r_canfd_mb_read (R_CANFD_Type * p_reg, uint32_t buffer, can_frame_t
     /* Get the frame data length code */
     frame->data_length_code = dlc_to_bytes[mb_regs->PTR >> CANFD_PRV_RMDLC_POSITION];
 
-    /* Copy data to frame */
-    uint32_t  len    = frame->data_length_code;
-    uint8_t * p_dest = frame->data;
-    uint8_t * p_src  = (uint8_t *) mb_regs->DF;
+    /* Copy data to frame one word at a time (the frame data buffer is word aligned and a multiple of 4 bytes long) */
+    uint32_t            len    = ((uint32_t) frame->data_length_code + 3U) >> 2;
+    uint32_t          * p_dest = (uint32_t *) frame->data;
+    volatile uint32_t * p_src  = (volatile uint32_t *) mb_regs->DF;
     while (len--)
     {
         *p_dest++ = *p_src++;
@@ -1075,6 +1604,77 @@ static void r_canfd_mb_read (R_CANFD_Type * p_reg, uint32_t buffer, can_frame_t
     }
 }
 
+#if CANFD_CFG_RX_RING_ENABLE
+
+/*******************************************************************************************************************//**
+ * Read one frame from a FIFO directly into the channel's software receive ring.
+ *
+ * @param[in]     p_reg      Pointer to the CANFD registers
+ * @param[in]     buffer     Index of FIFO to read from (FIFOs 32+)
+ * @param[in]     p_ctrl     Pointer to the control block of the channel that owns the frame
+ *
+ * @retval true   Frame was handled by the ring (stored or dropped on overflow).
+ * @retval false  The channel has no receive ring; the frame was not read.
+ **********************************************************************************************************************/
+static bool r_canfd_rx_ring_push (R_CANFD_Type * p_reg, uint32_t buffer, canfd_instance_ctrl_t * p_ctrl)
+{
+    canfd_rx_ring_t * p_ring = &p_ctrl->rx_ring;
+
+    if (NULL == p_ring->p_frames)
+    {
+        return false;
+    }
+
+    uint32_t head = p_ring->head;
+
+    if ((head - p_ring->tail) > p_ring->mask)
+    {
+        /* Ring is full: the frame must still be read out of the FIFO so the hardware keeps receiving. */
+        can_frame_t frame;
+        r_canfd_mb_read(p_reg, buffer, &frame);
+        p_ring->overflow_count++;
+
+        BSP_PERF_COUNT(p_ctrl, overruns, 1U);
+    }
+    else
+    {
+        r_canfd_mb_read(p_reg, buffer, &p_ring->p_frames[head & p_ring->mask]);
+
+        BSP_PERF_COUNT(p_ctrl, rx_frames, 1U);
+        BSP_PERF_COUNT(p_ctrl, rx_bytes, p_ring->p_frames[head & p_ring->mask].data_length_code);
+
+        /* Make sure the frame is written before it is published to the consumer. */
+        __DMB();
+        p_ring->head = head + 1U;
+    }
+
+    return true;
+}
+
+/*******************************************************************************************************************//**
+ * Notify the application that frames were queued to the software receive ring.
+ *
+ * @param[in]     p_ctrl     Pointer to CAN instance control block
+ * @param[in]     buffer     FIFO buffer number (canfd_rx_buffer_t) that was drained
+ **********************************************************************************************************************/
+static void r_canfd_rx_ring_notify (canfd_instance_ctrl_t * p_ctrl, uint32_t buffer)
+{
+    can_callback_args_t args;
+
+    args.event     = CAN_EVENT_RX_BATCH_READY;
+    args.channel   = p_ctrl->p_cfg->channel;
+    args.buffer    = buffer;
+    args.error     = 0U;
+    args.p_context = p_ctrl->p_context;
+
+    /* Frames are retrieved with R_CANFD_RxRingRead, so the frame argument carries no data. */
+    args.frame.data_length_code = 0U;
+
+    r_canfd_call_callback(p_ctrl, &args);
+}
+
+#endif
+
 /*******************************************************************************************************************//**
  * Calls user callback.
  *
@@ -1085,6 +1685,32 @@ static void r_canfd_call_callback (canfd_instance_ctrl_t * p_ctrl, can_callback_
 {
     can_callback_args_t args;
 
+#if BSP_CFG_PERF_COUNTERS_ENABLE
+
+    /* Every event except frames queued to the receive ring is reported through this function. */
+    if (CAN_EVENT_RX_COMPLETE == p_args->event)
+    {
+        BSP_PERF_COUNT(p_ctrl, rx_frames, 1U);
+        BSP_PERF_COUNT(p_ctrl, rx_bytes, p_args->frame.data_length_code);
+    }
+    else if (CAN_EVENT_TX_COMPLETE == p_args->event)
+    {
+        BSP_PERF_COUNT(p_ctrl, tx_frames, 1U);
+    }
+    else if ((CAN_EVENT_ERR_GLOBAL == p_args->event) && (p_args->error & CANFD_ERROR_GLOBAL_MESSAGE_LOST))
+    {
+        BSP_PERF_COUNT(p_ctrl, overruns, 1U);
+    }
+    else if ((CAN_EVENT_ERR_GLOBAL == p_args->event) || (CAN_EVENT_ERR_CHANNEL == p_args->event))
+    {
+        BSP_PERF_COUNT(p_ctrl, errors, 1U);
+    }
+    else
+    {
+        /* Other events are not counted. */
+    }
+#endif
+
     /* Store callback arguments in memory provided by user if available.  This allows callback arguments to be
      * stored in non-secure memory so they can be accessed by a non-secure callback function. */
     can_callback_args_t * p_args_memory = p_ctrl->p_callback_memory;
@@ -1176,6 +1802,7 @@ void canfd_error_isr (void)
 {
     /* Save context if RTOS is used */
     FSP_CONTEXT_SAVE
+    BSP_PERF_ISR_ENTER();
 
     /* Get IRQ and context */
     IRQn_Type irq = R_FSP_CurrentIrqGet();
@@ -1221,6 +1848,9 @@ void canfd_error_isr (void)
 
         /* Set remaining arguments and call callback */
         r_canfd_call_callback(p_callback_ctrl, &args);
+
+        /* The global error interrupt is shared by all channels, so only channel error interrupts are timed. */
+        BSP_PERF_ISR_EXIT(p_ctrl);
     }
 
     /* Clear IRQ */
@@ -1256,6 +1886,12 @@ static void r_canfd_rx_fifo_handler (uint32_t instance)
         args.event  = CAN_EVENT_RX_COMPLETE;
         args.buffer = fifo + CANFD_PRV_RXMB_MAX;
 
+#if CANFD_CFG_RX_RING_ENABLE
+
+        /* Channels that had frames queued to their receive ring during this interrupt */
+        uint32_t ring_channels = 0U;
+#endif
+
         /* Read from the FIFO until it is empty */
         while (!(p_reg->CFDFESTS & (1U << fifo)))
         {
@@ -1266,6 +1902,16 @@ static void r_canfd_rx_fifo_handler (uint32_t instance)
             args.channel = p_reg->CFDRF[fifo].FDSTS_b.RFIFL;
 #endif
 
+#if CANFD_CFG_RX_RING_ENABLE
+
+            /* Drain straight into the receive ring when one is configured for the channel */
+            if (r_canfd_rx_ring_push(p_reg, fifo + CANFD_PRV_RXMB_MAX, gp_ctrl[args.channel]))
+            {
+                ring_channels |= 1U << args.channel;
+                continue;
+            }
+#endif
+
             /* Read and index FIFO */
             r_canfd_mb_read(p_reg, fifo + CANFD_PRV_RXMB_MAX, &args.frame);
 
@@ -1276,6 +1922,17 @@ static void r_canfd_rx_fifo_handler (uint32_t instance)
 
         /* Clear RX FIFO Interrupt Flag */
         p_reg->CFDRFSTS[fifo] &= ~R_CANFD_CFDRFSTS_RFIF_Msk;
+
+#if CANFD_CFG_RX_RING_ENABLE
+
+        /* Notify each channel once for all frames queued during this interrupt */
+        while (ring_channels)
+        {
+            uint32_t channel = __CLZ(__RBIT(ring_channels));
+            ring_channels &= ~(1U << channel);
+            r_canfd_rx_ring_notify(gp_ctrl[channel], fifo + CANFD_PRV_RXMB_MAX);
+        }
+#endif
     }
 
     if (!p_reg->CFDRFISTS)
@@ -1326,6 +1983,7 @@ void canfd_channel_tx_isr (void)
 {
     /* Save context if RTOS is used */
     FSP_CONTEXT_SAVE
+    BSP_PERF_ISR_ENTER();
 
     IRQn_Type               irq      = R_FSP_CurrentIrqGet();
     canfd_instance_ctrl_t * p_ctrl   = (canfd_instance_ctrl_t *) R_FSP_IsrContextGet(irq);
@@ -1344,6 +2002,7 @@ void canfd_channel_tx_isr (void)
     while (*p_cfdgtintsts)
     {
         bool                is_cfifo = false;
+        bool                notify   = true;
         uint32_t            txmb;
         volatile uint32_t * p_cfdtm_sts;
         const uint32_t      cfdgtintsts = *p_cfdgtintsts;
@@ -1381,6 +2040,15 @@ void canfd_channel_tx_isr (void)
 
             /* Clear TX complete/abort flags */
             p_ctrl->p_reg->CFDTMSTS_b[txmb + (CANFD_PRV_TXMB_CHANNEL_OFFSET * interlaced_channel)].TMTRF = 0;
+
+#if CANFD_CFG_TX_QUEUE_ENABLE
+
+            /* Refill buffers owned by the transmit queue */
+            if (p_ctrl->tx_queue.mb_mask & (1ULL << txmb))
+            {
+                notify = r_canfd_tx_queue_mb_release(p_ctrl, txmb, CAN_EVENT_TX_ABORTED == args.event);
+            }
+#endif
         }
         else
         {
@@ -1402,14 +2070,19 @@ void canfd_channel_tx_isr (void)
             txmb += CANFD_TX_BUFFER_FIFO_COMMON_0;
         }
 
-        /* Set the callback arguments */
-        args.buffer = txmb;
-        r_canfd_call_callback(p_ctrl, &args);
+        /* Set the callback arguments. Frames preempted and requeued by the transmit queue are not reported. */
+        if (notify)
+        {
+            args.buffer = txmb;
+            r_canfd_call_callback(p_ctrl, &args);
+        }
     }
 
     /* Clear interrupt */
     R_BSP_IrqStatusClear(irq);
 
+    BSP_PERF_ISR_EXIT(p_ctrl);
+
     /* Restore context if RTOS is used */
     FSP_CONTEXT_RESTORE
 }
@@ -1424,6 +2097,7 @@ void canfd_common_fifo_rx_isr (void)
 {
     /* Save context if RTOS is used */
     FSP_CONTEXT_SAVE
+    BSP_PERF_ISR_ENTER();
 
     IRQn_Type               irq     = R_FSP_CurrentIrqGet();
     canfd_instance_ctrl_t * p_ctrl  = (canfd_instance_ctrl_t *) R_FSP_IsrContextGet(irq);
@@ -1465,6 +2139,19 @@ void canfd_common_fifo_rx_isr (void)
     /* Move buffer up to the correct range. */
     args.buffer += (uint32_t) CANFD_RX_BUFFER_FIFO_COMMON_0;
 
+#if CANFD_CFG_RX_RING_ENABLE
+    if (NULL != p_ctrl->rx_ring.p_frames)
+    {
+        /* Drain the Common FIFO into the receive ring and notify once */
+        while (!(p_ctrl->p_reg->CFDFESTS & (1U << (R_CANFD_CFDFESTS_CFXEMP_Pos + fifo))))
+        {
+            r_canfd_rx_ring_push(p_ctrl->p_reg, fifo + (uint32_t) CANFD_RX_BUFFER_FIFO_COMMON_0, p_ctrl);
+        }
+
+        r_canfd_rx_ring_notify(p_ctrl, args.buffer);
+    }
+#endif
+
     /* Read from the FIFO until it is empty */
     while (!(p_ctrl->p_reg->CFDFESTS & (1U << (R_CANFD_CFDFESTS_CFXEMP_Pos + fifo))))
     {
@@ -1492,6 +2179,8 @@ void canfd_common_fifo_rx_isr (void)
         R_BSP_IrqStatusClear(irq);
     }
 
+    BSP_PERF_ISR_EXIT(p_ctrl);
+
     /* Restore context if RTOS is used */
     FSP_CONTEXT_RESTORE
 }
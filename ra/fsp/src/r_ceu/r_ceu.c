@@ -101,6 +101,10 @@ fsp_err_t R_CEU_Open (capture_ctrl_t * const p_ctrl, capture_cfg_t const * const
     FSP_ASSERT(NULL != p_instance_ctrl);
     FSP_ASSERT(0 <= ((ceu_extended_cfg_t *) p_cfg->p_extend)->ceu_irq);
     FSP_ERROR_RETURN(CEU_OPEN != p_instance_ctrl->open, FSP_ERR_ALREADY_OPEN);
+
+    /* Bundle write mode requires the image height to be a whole number of bundles */
+    FSP_ASSERT((0U == ((ceu_extended_cfg_t *) p_cfg->p_extend)->bundle_lines) ||
+               (0U == (p_cfg->y_capture_pixels % ((ceu_extended_cfg_t *) p_cfg->p_extend)->bundle_lines)));
 #endif
 
     /* Local variables */
@@ -128,6 +132,9 @@ fsp_err_t R_CEU_Open (capture_ctrl_t * const p_ctrl, capture_cfg_t const * const
         p_instance_ctrl->image_area_size = cycles_per_line * bytes_per_line;
     }
 
+    /* In bundle write mode the CEU alternates between the CDAYR and CDAYR2 areas every bundle_lines lines */
+    p_instance_ctrl->bundle_size = bytes_per_line * p_extend->bundle_lines;
+
     /* Start the peripheral */
     R_BSP_MODULE_START(FSP_IP_CEU, 0U);
 
@@ -186,7 +193,11 @@ fsp_err_t R_CEU_Open (capture_ctrl_t * const p_ctrl, capture_cfg_t const * const
         (((uint32_t) p_extend->byte_swapping.swap_8bit_units << R_CEU_CDOCR_COBS_Pos) & R_CEU_CDOCR_COBS_Msk) |  // Swapping 8-bit units for data output from the CEU
         (((uint32_t) p_extend->byte_swapping.swap_16bit_units << R_CEU_CDOCR_COWS_Pos) & R_CEU_CDOCR_COWS_Msk) | // Swapping 16-bit units for data output from the CEU
         (((uint32_t) p_extend->byte_swapping.swap_32bit_units << R_CEU_CDOCR_COLS_Pos) & R_CEU_CDOCR_COLS_Msk) | // Swapping 32-bit units for data output from the CEU
-        (((uint32_t) 1U << R_CEU_CDOCR_CDS_Pos) & R_CEU_CDOCR_CDS_Msk);                                          // Image format for data captured in the YCbCr 422 format (Must be set for Data Fetch capture modes)
+        (((uint32_t) 1U << R_CEU_CDOCR_CDS_Pos) & R_CEU_CDOCR_CDS_Msk) |                                         // Image format for data captured in the YCbCr 422 format (Must be set for Data Fetch capture modes)
+        (((uint32_t) (0U != p_instance_ctrl->bundle_size) << R_CEU_CDOCR_CBE_Pos) & R_CEU_CDOCR_CBE_Msk);       // Bundle write mode
+
+    /* Capture Bundle Destination Size Register (CBDSR) */
+    R_CEU->CBDSR = p_instance_ctrl->bundle_size & R_CEU_CBDSR_CBVS_Msk;
 
     /* Clear any previous buffer address */
     p_instance_ctrl->p_buffer = 0U;
@@ -286,6 +297,12 @@ fsp_err_t R_CEU_CaptureStart (capture_ctrl_t * const p_ctrl, uint8_t * const p_b
 
     R_CEU->CDAYR = (uint32_t) p_instance_ctrl->p_buffer; // Set start address of memory area for write
 
+    /* In bundle write mode p_buffer holds two bundles; the second one is written through CDAYR2 */
+    if (0U != p_instance_ctrl->bundle_size)
+    {
+        R_CEU->CDAYR2 = (uint32_t) p_instance_ctrl->p_buffer + p_instance_ctrl->bundle_size;
+    }
+
     /* Clear pending flags before starting capture */
     R_CEU->CETCR = 0;
 
@@ -488,6 +505,14 @@ extern void ceu_isr (void)
         args.event     = (capture_event_t) (events & p_instance_ctrl->interrupts_enabled);
         args.p_buffer  = p_instance_ctrl->p_buffer;
         args.p_context = p_instance_ctrl->p_context;
+
+        /* Point at the bundle that was just completed: bundle A is at CDAYR, bundle B at CDAYR2. If both bundle
+         * events are pending the reader has fallen behind; report the A bundle and leave it to the application to detect the overrun from the event mask. */
+        if ((args.event & CEU_EVENT_BUNDLE_B_END) && !(args.event & CEU_EVENT_BUNDLE_A_END))
+        {
+            args.p_buffer += p_instance_ctrl->bundle_size;
+        }
+
         ceu_call_callback(p_instance_ctrl, &args);
     }
 
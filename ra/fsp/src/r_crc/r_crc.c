@@ -40,6 +40,9 @@
 #define CRC_SNOOP_ADDRESS_TYPE_MASK     (0x0FU)
 #define CRC_SNOOP_ADDRESS_TYPE_FTDRL    (0x0FU)
 
+/* Maximum number of transfers in one DMAC normal mode transfer. */
+#define CRC_TRANSFER_MAX_COUNT          (0xFFFFU)
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -53,6 +56,8 @@ static void crc_calculate_polynomial(crc_instance_ctrl_t * const p_instance_ctrl
 
 static void     crc_seed_value_update(crc_instance_ctrl_t * const p_instance_ctrl, uint32_t crc_seed);
 static uint32_t crc_calculated_value_get(crc_instance_ctrl_t * const p_instance_ctrl);
+static void     crc_transfer_chunk_start(crc_instance_ctrl_t * const p_instance_ctrl);
+static void     r_crc_transfer_callback(transfer_callback_args_t * p_args);
 
 #if CRC_CFG_PARAM_CHECKING_ENABLE
 static fsp_err_t r_crc_open_cfg_check(crc_cfg_t const * const p_cfg);
@@ -112,7 +117,19 @@ fsp_err_t R_CRC_Open (crc_ctrl_t * const p_ctrl, crc_cfg_t const * const p_cfg)
 #endif
 
     /* Save the configuration  */
-    p_instance_ctrl->p_cfg = p_cfg;
+    p_instance_ctrl->p_cfg             = p_cfg;
+    p_instance_ctrl->async_in_progress = false;
+
+    crc_extended_cfg_t const * p_extend = (crc_extended_cfg_t const *) p_cfg->p_extend;
+    if ((NULL != p_extend) && (NULL != p_extend->p_transfer))
+    {
+        /* Route transfer end interrupts to this driver */
+        fsp_err_t transfer_err = p_extend->p_transfer->p_api->callbackSet(p_extend->p_transfer->p_ctrl,
+                                                                          r_crc_transfer_callback,
+                                                                          p_instance_ctrl,
+                                                                          NULL);
+        FSP_ERROR_RETURN(FSP_SUCCESS == transfer_err, transfer_err);
+    }
 
     /* Mark driver as initialized by setting the open value to the ASCII equivalent of "CRC" */
     p_instance_ctrl->open = CRC_OPEN;
@@ -163,6 +180,14 @@ fsp_err_t R_CRC_Close (crc_ctrl_t * const p_ctrl)
     FSP_ERROR_RETURN(CRC_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
 
+    crc_extended_cfg_t const * p_extend = (crc_extended_cfg_t const *) p_instance_ctrl->p_cfg->p_extend;
+    if (p_instance_ctrl->async_in_progress && (NULL != p_extend) && (NULL != p_extend->p_transfer))
+    {
+        /* Stop an asynchronous calculation in progress */
+        (void) p_extend->p_transfer->p_api->disable(p_extend->p_transfer->p_ctrl);
+        p_instance_ctrl->async_in_progress = false;
+    }
+
     R_BSP_MODULE_STOP(FSP_IP_CRC, 0);
 
     /* Mark driver as closed */
@@ -183,6 +208,7 @@ fsp_err_t R_CRC_Close (crc_ctrl_t * const p_ctrl)
  * @retval FSP_ERR_ASSERTION        Either p_ctrl, inputBuffer, or calculatedValue is NULL.
  * @retval FSP_ERR_INVALID_ARGUMENT length value is NULL.
  * @retval FSP_ERR_NOT_OPEN         The driver is not opened.
+ * @retval FSP_ERR_IN_USE           An asynchronous calculation is in progress.
  **********************************************************************************************************************/
 fsp_err_t R_CRC_Calculate (crc_ctrl_t * const p_ctrl, crc_input_t * const p_crc_input, uint32_t * calculatedValue)
 {
@@ -194,6 +220,7 @@ fsp_err_t R_CRC_Calculate (crc_ctrl_t * const p_ctrl, crc_input_t * const p_crc_
     FSP_ERROR_RETURN((0UL != p_crc_input->num_bytes), FSP_ERR_INVALID_ARGUMENT);
     FSP_ERROR_RETURN(CRC_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
+    FSP_ERROR_RETURN(!p_instance_ctrl->async_in_progress, FSP_ERR_IN_USE);
 
     /* Calculate CRC value for the input buffer */
     crc_calculate_polynomial(p_instance_ctrl, p_crc_input, calculatedValue);
@@ -317,12 +344,218 @@ fsp_err_t R_CRC_SnoopDisable (crc_ctrl_t * const p_ctrl)
 #endif
 }
 
+/*******************************************************************************************************************//**
+ * Start a CRC calculation on a block of data using the DMAC to feed the CRC calculator.
+ *
+ * The input buffer is streamed into CRCDIR_BY (CRC-8, CRC-16, CRC-CCITT) or CRCDIR (CRC-32, CRC-32C) by the DMAC
+ * instance in @ref crc_extended_cfg_t, so the CPU is free while the calculation runs. The result is passed to the
+ * callback in @ref crc_extended_cfg_t and is also available from R_CRC_CalculatedValueGet() afterwards. The input
+ * buffer must not be modified until the callback is called.
+ *
+ * For 32-bit polynomials the input buffer must be 4-byte aligned and trailing bytes that do not fill a word are
+ * ignored, as with R_CRC_Calculate().
+ *
+ * @retval FSP_SUCCESS              Calculation started.
+ * @retval FSP_ERR_ASSERTION        Either p_ctrl, p_crc_input or the input buffer is NULL, or the input buffer is
+ *                                  not aligned for a 32-bit polynomial.
+ * @retval FSP_ERR_INVALID_ARGUMENT Length is 0, or less than 4 for a 32-bit polynomial.
+ * @retval FSP_ERR_NOT_OPEN         The driver is not opened.
+ * @retval FSP_ERR_UNSUPPORTED      No transfer instance is configured in the extended configuration.
+ * @retval FSP_ERR_IN_USE           An asynchronous calculation is already in progress.
+ **********************************************************************************************************************/
+fsp_err_t R_CRC_CalculateAsync (crc_ctrl_t * const p_ctrl, crc_input_t * const p_crc_input)
+{
+    crc_instance_ctrl_t * p_instance_ctrl = (crc_instance_ctrl_t *) p_ctrl;
+#if CRC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_ctrl);
+    FSP_ASSERT(p_crc_input);
+    FSP_ASSERT(p_crc_input->p_input_buffer);
+    FSP_ERROR_RETURN((0UL != p_crc_input->num_bytes), FSP_ERR_INVALID_ARGUMENT);
+    FSP_ERROR_RETURN(CRC_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    crc_extended_cfg_t const * p_extend = (crc_extended_cfg_t const *) p_instance_ctrl->p_cfg->p_extend;
+    FSP_ERROR_RETURN((NULL != p_extend) && (NULL != p_extend->p_transfer), FSP_ERR_UNSUPPORTED);
+
+    bool     word_input = (CRC_POLYNOMIAL_CRC_32 == p_instance_ctrl->p_cfg->polynomial) ||
+                          (CRC_POLYNOMIAL_CRC_32C == p_instance_ctrl->p_cfg->polynomial);
+    uint32_t length = p_crc_input->num_bytes;
+    if (word_input)
+    {
+#if CRC_CFG_PARAM_CHECKING_ENABLE
+        FSP_ASSERT(0U == ((uint32_t) p_crc_input->p_input_buffer & 3U));
+#endif
+
+        /* Only whole words are written to CRCDIR */
+        length &= ~3U;
+        FSP_ERROR_RETURN(0U != length, FSP_ERR_INVALID_ARGUMENT);
+    }
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    if (p_instance_ctrl->async_in_progress)
+    {
+        FSP_CRITICAL_SECTION_EXIT;
+
+        return FSP_ERR_IN_USE;
+    }
+
+    p_instance_ctrl->async_in_progress = true;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    crc_seed_value_update(p_instance_ctrl, p_crc_input->crc_seed);
+
+    /* Settings shared by all chunks: incrementing source, fixed CRC data input register */
+    transfer_info_t * p_info = &p_instance_ctrl->transfer_info;
+    p_info->transfer_settings_word                  = 0U;
+    p_info->transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_FIXED;
+    p_info->transfer_settings_word_b.repeat_area    = TRANSFER_REPEAT_AREA_SOURCE;
+    p_info->transfer_settings_word_b.irq            = TRANSFER_IRQ_END;
+    p_info->transfer_settings_word_b.chain_mode     = TRANSFER_CHAIN_MODE_DISABLED;
+    p_info->transfer_settings_word_b.src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_info->transfer_settings_word_b.size           = word_input ? TRANSFER_SIZE_4_BYTE : TRANSFER_SIZE_1_BYTE;
+    p_info->transfer_settings_word_b.mode           = TRANSFER_MODE_NORMAL;
+    p_info->p_dest     = word_input ? (void *) &R_CRC->CRCDIR : (void *) &R_CRC->CRCDIR_BY;
+    p_info->num_blocks = 0U;
+
+    p_instance_ctrl->p_next    = (uint8_t const *) p_crc_input->p_input_buffer;
+    p_instance_ctrl->remaining = length;
+
+    crc_transfer_chunk_start(p_instance_ctrl);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Measures the time taken to calculate the CRC of a buffer with the CPU feeding the CRC peripheral
+ * (R_CRC_Calculate), with the DMAC feeding it (R_CRC_CalculateAsync) and with a software implementation of
+ * @ref crc_api_t such as rm_crc_sw. Use it to choose the implementation for the buffer sizes and polynomial used by the
+ * application on a given MCU.
+ *
+ * The DMAC time is measured from the call to R_CRC_CalculateAsync until the transfer end interrupt of the last chunk
+ * has completed the calculation, so it includes the setup and the interrupts between chunks. It is skipped if no
+ * transfer instance is configured. p_software must be open with the same polynomial and bit order as p_ctrl; pass
+ * NULL to skip it. Call from a thread while no asynchronous calculation is in progress; the DMAC interrupt must be able
+ * to preempt the caller. The callback in @ref crc_extended_cfg_t is called for the DMAC calculation.
+ *
+ * @retval FSP_SUCCESS              p_result holds the measurement.
+ * @retval FSP_ERR_ASSERTION        p_ctrl, p_crc_input, its input buffer or p_result is NULL.
+ * @retval FSP_ERR_NOT_OPEN         The driver is not opened.
+ * @retval FSP_ERR_UNSUPPORTED      The MCU has no DWT cycle counter.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ **********************************************************************************************************************/
+fsp_err_t R_CRC_Benchmark (crc_ctrl_t * const           p_ctrl,
+                           crc_instance_t const * const p_software,
+                           crc_input_t * const          p_crc_input,
+                           crc_benchmark_t * const      p_result)
+{
+    crc_instance_ctrl_t * p_instance_ctrl = (crc_instance_ctrl_t *) p_ctrl;
+#if CRC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_ctrl);
+    FSP_ASSERT(p_crc_input);
+    FSP_ASSERT(p_crc_input->p_input_buffer);
+    FSP_ASSERT(p_result);
+    FSP_ERROR_RETURN(CRC_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+#if BSP_FEATURE_DWT_CYCCNT
+    fsp_err_t err;
+    uint32_t  cpu_value;
+    uint32_t  value;
+
+    R_BSP_CycleCounterEnable();
+
+    /* Cycles taken to read the counter twice, subtracted from all results. */
+    uint32_t start    = DWT->CYCCNT;
+    uint32_t overhead = DWT->CYCCNT - start;
+
+    p_result->num_bytes       = p_crc_input->num_bytes;
+    p_result->dmac_cycles     = 0U;
+    p_result->software_cycles = 0U;
+    p_result->results_match   = true;
+
+    start = DWT->CYCCNT;
+    err   = R_CRC_Calculate(p_ctrl, p_crc_input, &cpu_value);
+    p_result->cpu_cycles = (DWT->CYCCNT - start) - overhead;
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    crc_extended_cfg_t const * p_extend = (crc_extended_cfg_t const *) p_instance_ctrl->p_cfg->p_extend;
+    if ((NULL != p_extend) && (NULL != p_extend->p_transfer))
+    {
+        start = DWT->CYCCNT;
+        err   = R_CRC_CalculateAsync(p_ctrl, p_crc_input);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+        while (p_instance_ctrl->async_in_progress)
+        {
+            /* Wait for the transfer end interrupt of the last chunk. */
+        }
+
+        p_result->dmac_cycles = (DWT->CYCCNT - start) - overhead;
+
+        value                   = crc_calculated_value_get(p_instance_ctrl);
+        p_result->results_match = p_result->results_match && (cpu_value == value);
+    }
+
+    if (NULL != p_software)
+    {
+        start = DWT->CYCCNT;
+        err   = p_software->p_api->calculate(p_software->p_ctrl, p_crc_input, &value);
+        p_result->software_cycles = (DWT->CYCCNT - start) - overhead;
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        p_result->results_match = p_result->results_match && (cpu_value == value);
+    }
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_instance_ctrl);
+    FSP_PARAMETER_NOT_USED(p_software);
+    FSP_PARAMETER_NOT_USED(p_crc_input);
+    FSP_PARAMETER_NOT_USED(p_result);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
 /** @} (end addtogroup CRC) */
 
 /***********************************************************************************************************************
  * Private Functions
  **********************************************************************************************************************/
 
+/*******************************************************************************************************************//**
+ * Transfer end callback for asynchronous calculations. Starts the next chunk or reports the result.
+ *
+ * @param[in]  p_args                  Transfer callback arguments. The context is the CRC instance control block.
+ **********************************************************************************************************************/
+static void r_crc_transfer_callback (transfer_callback_args_t * p_args)
+{
+    crc_instance_ctrl_t * p_instance_ctrl = (crc_instance_ctrl_t *) p_args->p_context;
+
+    if (!p_instance_ctrl->async_in_progress)
+    {
+        return;
+    }
+
+    if (0U != p_instance_ctrl->remaining)
+    {
+        crc_transfer_chunk_start(p_instance_ctrl);
+
+        return;
+    }
+
+    p_instance_ctrl->async_in_progress = false;
+
+    crc_extended_cfg_t const * p_extend = (crc_extended_cfg_t const *) p_instance_ctrl->p_cfg->p_extend;
+    if (NULL != p_extend->p_callback)
+    {
+        crc_callback_args_t args;
+        args.crc_result = crc_calculated_value_get(p_instance_ctrl);
+        args.p_context  = p_extend->p_context;
+        p_extend->p_callback(&args);
+    }
+}
+
 /*******************************************************************************************************************//**
  * Update CRC seed value
  *
@@ -461,6 +694,33 @@ static void crc_calculate_polynomial (crc_instance_ctrl_t * const p_instance_ctr
     *calculatedValue = crc_calculated_value_get(p_instance_ctrl);
 }
 
+/*******************************************************************************************************************//**
+ * Start the DMAC for the next chunk of an asynchronous calculation.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to instance control block
+ **********************************************************************************************************************/
+static void crc_transfer_chunk_start (crc_instance_ctrl_t * const p_instance_ctrl)
+{
+    transfer_info_t * p_info = &p_instance_ctrl->transfer_info;
+    uint32_t          shift  = (uint32_t) p_info->transfer_settings_word_b.size;
+    uint32_t          count  = p_instance_ctrl->remaining >> shift;
+
+    if (CRC_TRANSFER_MAX_COUNT < count)
+    {
+        count = CRC_TRANSFER_MAX_COUNT;
+    }
+
+    p_info->p_src  = p_instance_ctrl->p_next;
+    p_info->length = (uint16_t) count;
+
+    p_instance_ctrl->p_next    += count << shift;
+    p_instance_ctrl->remaining -= count << shift;
+
+    transfer_instance_t const * p_transfer = ((crc_extended_cfg_t const *) p_instance_ctrl->p_cfg->p_extend)->p_transfer;
+    (void) p_transfer->p_api->reconfigure(p_transfer->p_ctrl, p_info);
+    (void) p_transfer->p_api->softwareStart(p_transfer->p_ctrl, TRANSFER_START_MODE_REPEAT);
+}
+
 #if CRC_CFG_PARAM_CHECKING_ENABLE
 
 /*******************************************************************************************************************//**
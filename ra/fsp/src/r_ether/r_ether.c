@@ -223,6 +223,7 @@ const ether_api_t g_ether_on_ether =
     .wakeOnLANEnable = R_ETHER_WakeOnLANEnable,
     .txStatusGet     = R_ETHER_TxStatusGet,
     .callbackSet     = R_ETHER_CallbackSet,
+    .writeFragments  = R_ETHER_WriteFragments,
 };
 
 /*
@@ -367,6 +368,8 @@ fsp_err_t R_ETHER_Open (ether_ctrl_t * const p_ctrl, ether_cfg_t const * const p
         /* Set Ethernet interrupt level and enable */
         ether_enable_icu(p_instance_ctrl);
 
+        BSP_PERF_REGISTER(p_instance_ctrl, "r_ether", p_cfg->channel);
+
         p_instance_ctrl->open = ETHER_OPEN;
 
         err = FSP_SUCCESS;
@@ -438,6 +441,8 @@ fsp_err_t R_ETHER_Close (ether_ctrl_t * const p_ctrl)
     /** Mark the channel not open so other APIs cannot use it. */
     p_instance_ctrl->open = 0U;
 
+    BSP_PERF_UNREGISTER(p_instance_ctrl);
+
     return err;
 }                                      /* End of function R_ETHER_Close() */
 
@@ -980,6 +985,9 @@ fsp_err_t R_ETHER_Read (ether_ctrl_t * const p_ctrl, void * const p_buffer, uint
             }
 
             *length_bytes = received_size;
+
+            BSP_PERF_COUNT(p_instance_ctrl, rx_frames, 1U);
+            BSP_PERF_COUNT(p_instance_ctrl, rx_bytes, received_size);
         }
         /* When there is no data to receive */
         else
@@ -1073,6 +1081,9 @@ fsp_err_t R_ETHER_Write (ether_ctrl_t * const p_ctrl, void * const p_buffer, uin
         p_instance_ctrl->p_tx_descriptor->status     |= ((ETHER_TD0_TFP1 | ETHER_TD0_TFP0) | ETHER_TD0_TACT);
         p_instance_ctrl->p_tx_descriptor              = p_instance_ctrl->p_tx_descriptor->p_next;
 
+        BSP_PERF_COUNT(p_instance_ctrl, tx_frames, 1U);
+        BSP_PERF_COUNT(p_instance_ctrl, tx_bytes, frame_length);
+
         p_reg_edmac = (R_ETHERC_EDMAC_Type *) p_instance_ctrl->p_reg_edmac;
 
         if (ETHER_EDMAC_EDTRR_TRANSMIT_REQUEST != p_reg_edmac->EDTRR)
@@ -1085,6 +1096,128 @@ fsp_err_t R_ETHER_Write (ether_ctrl_t * const p_ctrl, void * const p_buffer, uin
     return err;
 }                                      /* End of function R_ETHER_Write() */
 
+/********************************************************************************************************************//**
+ * @brief Transmit an Ethernet frame stored in several buffers without copying it. Each buffer is assigned to its own
+ *  transmit descriptor, so the frame needs as many free descriptors as it has buffers. The buffers must stay valid
+ *  until R_ETHER_TxStatusGet reports the last buffer of the frame as sent. Implements
+ *  @ref ether_api_t::writeFragments.
+ *
+ * @retval  FSP_SUCCESS                                 Processing completed successfully.
+ * @retval  FSP_ERR_ASSERTION                           Pointer to ETHER control block is NULL.
+ * @retval  FSP_ERR_NOT_OPEN                            The control block has not been opened.
+ * @retval  FSP_ERR_INVALID_MODE                        Driver is configured to non zero copy mode.
+ * @retval  FSP_ERR_ETHER_ERROR_LINK                    Auto-negotiation is not completed, and reception is not enabled.
+ * @retval  FSP_ERR_ETHER_ERROR_MAGIC_PACKET_MODE       As a Magic Packet is being detected, transmission and reception
+ *                                                      is not enabled.
+ * @retval  FSP_ERR_ETHER_ERROR_TRANSMIT_BUFFER_FULL    Not enough transmit descriptors are free.
+ * @retval  FSP_ERR_INVALID_POINTER                     Value of a pointer is NULL.
+ * @retval  FSP_ERR_INVALID_ARGUMENT                    The number of buffers, a buffer length or the frame size is out
+ *                                                      of range.
+ ***********************************************************************************************************************/
+fsp_err_t R_ETHER_WriteFragments (ether_ctrl_t * const              p_ctrl,
+                                  ether_tx_fragment_t const * const p_fragments,
+                                  uint32_t const                    num_fragments)
+{
+    ether_instance_ctrl_t * p_instance_ctrl = (ether_instance_ctrl_t *) p_ctrl;
+    R_ETHERC_EDMAC_Type * p_reg_edmac;
+    ether_instance_descriptor_t * p_descriptor;
+    ether_instance_descriptor_t * p_first_descriptor;
+    uint32_t i;
+
+    /* Check argument */
+#if (ETHER_CFG_PARAM_CHECKING_ENABLE)
+    uint32_t frame_length = 0U;
+
+    FSP_ASSERT(p_instance_ctrl);
+    ETHER_ERROR_RETURN(ETHER_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    ETHER_ERROR_RETURN(NULL != p_fragments, FSP_ERR_INVALID_POINTER);
+    ETHER_ERROR_RETURN(ETHER_ZEROCOPY_ENABLE == p_instance_ctrl->p_ether_cfg->zerocopy, FSP_ERR_INVALID_MODE);
+
+    for (i = 0U; i < num_fragments; i++)
+    {
+        ETHER_ERROR_RETURN(NULL != p_fragments[i].p_buffer, FSP_ERR_INVALID_POINTER);
+        ETHER_ERROR_RETURN(0U < p_fragments[i].length, FSP_ERR_INVALID_ARGUMENT);
+        frame_length += p_fragments[i].length;
+    }
+
+    ETHER_ERROR_RETURN((ETHER_MINIMUM_FRAME_SIZE <= frame_length) && (ETHER_MAXIMUM_FRAME_SIZE >= frame_length),
+                       FSP_ERR_INVALID_ARGUMENT);
+#endif
+
+    /* The free descriptor scan below walks the ring once per fragment, so a frame with more fragments than the ring
+     * has descriptors would find the first descriptors again and describe them twice. */
+    ETHER_ERROR_RETURN((0U < num_fragments) && (p_instance_ctrl->p_ether_cfg->num_tx_descriptors >= num_fragments),
+                       FSP_ERR_INVALID_ARGUMENT);
+
+    /* When the Link up processing is not completed, return error */
+    ETHER_ERROR_RETURN(ETHER_LINK_ESTABLISH_STATUS_UP == p_instance_ctrl->link_establish_status,
+                       FSP_ERR_ETHER_ERROR_LINK);
+
+    /* In case of detection mode of magic packet, return error. */
+    ETHER_ERROR_RETURN(0 == ether_check_magic_packet_detection_bit(p_instance_ctrl),
+                       FSP_ERR_ETHER_ERROR_MAGIC_PACKET_MODE);
+
+    /* Every descriptor of the frame must be free before any of them is given to the EDMAC. */
+    p_descriptor = p_instance_ctrl->p_tx_descriptor;
+    for (i = 0U; i < num_fragments; i++)
+    {
+        if (ETHER_TD0_TACT == (p_descriptor->status & ETHER_TD0_TACT))
+        {
+            return FSP_ERR_ETHER_ERROR_TRANSMIT_BUFFER_FULL;
+        }
+
+        p_descriptor = p_descriptor->p_next;
+    }
+
+    /* Mark the first and last descriptors of the frame. The first descriptor is activated last so the EDMAC never
+     * starts a frame that is not completely described. */
+    p_first_descriptor = p_instance_ctrl->p_tx_descriptor;
+    p_descriptor       = p_first_descriptor;
+    for (i = 0U; i < num_fragments; i++)
+    {
+        uint32_t status = p_descriptor->status & (~(ETHER_TD0_TFP1 | ETHER_TD0_TFP0));
+
+        if (0U == i)
+        {
+            status |= ETHER_TD0_TFP1;
+        }
+        else
+        {
+            status |= ETHER_TD0_TACT;
+        }
+
+        if ((num_fragments - 1U) == i)
+        {
+            status |= ETHER_TD0_TFP0;
+        }
+
+        p_descriptor->p_buffer    = (uint8_t *) p_fragments[i].p_buffer;
+        p_descriptor->buffer_size = (uint16_t) p_fragments[i].length;
+        p_descriptor->status      = status;
+        p_descriptor              = p_descriptor->p_next;
+
+        BSP_PERF_COUNT(p_instance_ctrl, tx_bytes, p_fragments[i].length);
+    }
+
+    BSP_PERF_COUNT(p_instance_ctrl, tx_frames, 1U);
+
+    p_instance_ctrl->p_tx_descriptor = p_descriptor;
+
+    /* Make sure the other descriptors are written before the frame is started. */
+    __DMB();
+    p_first_descriptor->status |= ETHER_TD0_TACT;
+
+    p_reg_edmac = (R_ETHERC_EDMAC_Type *) p_instance_ctrl->p_reg_edmac;
+
+    if (ETHER_EDMAC_EDTRR_TRANSMIT_REQUEST != p_reg_edmac->EDTRR)
+    {
+        /* Restart if stopped */
+        p_reg_edmac->EDTRR = ETHER_EDMAC_EDTRR_TRANSMIT_REQUEST;
+    }
+
+    return FSP_SUCCESS;
+}                                      /* End of function R_ETHER_WriteFragments() */
+
 /**********************************************************************************************************************//**
  * Provides status of Ethernet driver in the user provided pointer. Implements @ref ether_api_t::txStatusGet.
  *
@@ -1127,6 +1260,16 @@ fsp_err_t R_ETHER_TxStatusGet (ether_ctrl_t * const p_ctrl, void * const p_buffe
             p_descriptor = &p_tx_descriptors[num_tx_descriptors - 1];
         }
 
+        /* A frame written by R_ETHER_WriteFragments uses several descriptors. If the EDMAC is in the middle of such
+         * a frame, report the end of the last frame that was completely sent. */
+        for (uint32_t i = 0U;
+             (i < num_tx_descriptors) && (ETHER_TD0_TFP0 != (p_descriptor->status & ETHER_TD0_TFP0));
+             i++)
+        {
+            p_descriptor = (p_descriptor == p_tx_descriptors) ?
+                           &p_tx_descriptors[num_tx_descriptors - 1] : (p_descriptor - 1);
+        }
+
         /* Check that the descriptor is not overridden. */
         if ((NULL != p_descriptor->p_buffer) && (ETHER_TD0_TACT != (p_descriptor->status & ETHER_TD0_TACT)))
         {
@@ -1909,6 +2052,7 @@ void ether_eint_isr (void)
 {
     /* Save context if RTOS is used */
     FSP_CONTEXT_SAVE
+    BSP_PERF_ISR_ENTER();
 
     uint32_t status_ecsr;
     uint32_t status_eesr;
@@ -1926,6 +2070,14 @@ void ether_eint_isr (void)
     status_ecsr = p_reg_etherc->ECSR;
     status_eesr = p_reg_edmac->EESR;
 
+    /* Receive FIFO overflow, receive frame counter overflow and receive descriptor empty all mean frames were
+     * dropped because the receive buffers were not released fast enough. */
+    if (status_eesr &
+        (ETHER_EDMAC_INTERRUPT_FACTOR_RFOF | ETHER_EDMAC_INTERRUPT_FACTOR_RFCOF | ETHER_EDMAC_INTERRUPT_FACTOR_RDE))
+    {
+        BSP_PERF_COUNT(p_instance_ctrl, overruns, 1U);
+    }
+
     /* When the ETHERC status interrupt is generated */
     if (status_eesr & ETHER_EDMAC_INTERRUPT_FACTOR_ECI)
     {
@@ -1982,6 +2134,8 @@ void ether_eint_isr (void)
      * after exiting. */
     R_BSP_IrqStatusClear(R_FSP_CurrentIrqGet());
 
+    BSP_PERF_ISR_EXIT(p_instance_ctrl);
+
     /* Restore context if RTOS is used */
     FSP_CONTEXT_RESTORE
 }                                      /* End of function ether_eint_isr() */
@@ -59,6 +59,15 @@
 /* GPT_CFG_OUTPUT_SUPPORT_ENABLE is set to 2 to enable extra features. */
 #define GPT_PRV_EXTRA_FEATURES_ENABLED                   (2U)
 
+/* GPT_CFG_STATIC_MODE is project-wide: when every GPT instance in the project uses the same timer mode, it can be
+ * defined to that ::timer_mode_t value so the mode checks in the runtime APIs resolve at compile time. R_GPT_Open
+ * rejects instances configured for another mode, also when parameter checking is disabled. */
+#ifdef GPT_CFG_STATIC_MODE
+ #define GPT_PRV_MODE(p_instance_ctrl)                   (GPT_CFG_STATIC_MODE)
+#else
+ #define GPT_PRV_MODE(p_instance_ctrl)                   ((p_instance_ctrl)->p_cfg->mode)
+#endif
+
 #define R_GPT0_GTINTAD_ADTRAUEN_Pos                      (16U)
 
 /***********************************************************************************************************************
@@ -193,6 +202,7 @@ const timer_api_t g_timer_on_gpt =
  * @retval FSP_ERR_INVALID_MODE           Triangle wave PWM is only supported if GPT_CFG_OUTPUT_SUPPORT_ENABLE is 2.
  *                                        Selected channel does not support external count sources.
  *                                        External and event count sources not are available in this mode.
+ *                                        timer_cfg_t::mode does not match GPT_CFG_STATIC_MODE.
  * @retval FSP_ERR_IP_CHANNEL_NOT_PRESENT The channel requested in the p_cfg parameter is not available on this device.
  **********************************************************************************************************************/
 fsp_err_t R_GPT_Open (timer_ctrl_t * const p_ctrl, timer_cfg_t const * const p_cfg)
@@ -216,10 +226,15 @@ fsp_err_t R_GPT_Open (timer_ctrl_t * const p_ctrl, timer_cfg_t const * const p_c
  #if GPT_PRV_EXTRA_FEATURES_ENABLED != GPT_CFG_OUTPUT_SUPPORT_ENABLE
     FSP_ERROR_RETURN(p_cfg->mode <= TIMER_MODE_ONE_SHOT_PULSE, FSP_ERR_INVALID_MODE);
  #endif
-
     FSP_ERROR_RETURN(GPT_OPEN != p_instance_ctrl->open, FSP_ERR_ALREADY_OPEN);
 #endif
 
+#ifdef GPT_CFG_STATIC_MODE
+
+    /* The runtime APIs use GPT_CFG_STATIC_MODE instead of the mode of the instance. */
+    FSP_ERROR_RETURN(GPT_CFG_STATIC_MODE == p_cfg->mode, FSP_ERR_INVALID_MODE);
+#endif
+
     p_instance_ctrl->channel_mask = 1U << p_cfg->channel;
 
 #if GPT_CFG_PARAM_CHECKING_ENABLE
@@ -442,7 +457,7 @@ fsp_err_t R_GPT_PeriodSet (timer_ctrl_t * const p_ctrl, uint32_t const period_co
      * triangle waves. */
     uint32_t new_gtpr = period_counts - 1U;
 #if GPT_PRV_EXTRA_FEATURES_ENABLED == GPT_CFG_OUTPUT_SUPPORT_ENABLE
-    if (p_instance_ctrl->p_cfg->mode >= TIMER_MODE_TRIANGLE_WAVE_SYMMETRIC_PWM)
+    if (GPT_PRV_MODE(p_instance_ctrl) >= TIMER_MODE_TRIANGLE_WAVE_SYMMETRIC_PWM)
     {
         new_gtpr = period_counts;
     }
@@ -453,7 +468,7 @@ fsp_err_t R_GPT_PeriodSet (timer_ctrl_t * const p_ctrl, uint32_t const period_co
 #if GPT_CFG_OUTPUT_SUPPORT_ENABLE
 
     /* Set a 50% duty cycle so the period of the waveform on the output pin matches the requested period. */
-    if (TIMER_MODE_PERIODIC == p_instance_ctrl->p_cfg->mode)
+    if (TIMER_MODE_PERIODIC == GPT_PRV_MODE(p_instance_ctrl))
     {
         /* The  GTIOCA/GTIOCB pins transition 1 cycle after compare match when buffer operation is used. Reference
          * Figure 23.34 "Example setting for saw-wave PWM mode" in the RA6M3 manual R01UH0886EJ0100. To get a duty cycle
@@ -510,14 +525,14 @@ fsp_err_t R_GPT_DutyCycleSet (timer_ctrl_t * const p_ctrl, uint32_t const duty_c
     FSP_ASSERT(NULL != p_instance_ctrl);
     FSP_ASSERT(tmp_pin <= GPT_IO_PIN_GTIOCA_AND_GTIOCB);
     bool pwm_mode3_pin = 0 != (pin & (GPT_IO_PIN_CREST | GPT_IO_PIN_TROUGH));
-    if (TIMER_MODE_TRIANGLE_WAVE_ASYMMETRIC_PWM_MODE3 == p_instance_ctrl->p_cfg->mode)
+    if (TIMER_MODE_TRIANGLE_WAVE_ASYMMETRIC_PWM_MODE3 == GPT_PRV_MODE(p_instance_ctrl))
     {
         /* In TIMER_MODE_TRIANGLE_WAVE_ASYMMETRIC_PWM_MODE3, the duty cycle must be for either a trough or crest. */
         FSP_ERROR_RETURN(pwm_mode3_pin, FSP_ERR_INVALID_MODE);
     }
     else
     {
-        FSP_ERROR_RETURN((!pwm_mode3_pin) || (TIMER_MODE_ONE_SHOT_PULSE == p_instance_ctrl->p_cfg->mode),
+        FSP_ERROR_RETURN((!pwm_mode3_pin) || (TIMER_MODE_ONE_SHOT_PULSE == GPT_PRV_MODE(p_instance_ctrl)),
                          FSP_ERR_INVALID_MODE);
     }
 
@@ -628,7 +643,7 @@ fsp_err_t R_GPT_InfoGet (timer_ctrl_t * const p_ctrl, timer_info_t * const p_inf
     uint32_t gtpr          = p_instance_ctrl->p_reg->GTPR;
     uint32_t period_counts = gtpr + 1;
 #if GPT_PRV_EXTRA_FEATURES_ENABLED == GPT_CFG_OUTPUT_SUPPORT_ENABLE
-    if (p_instance_ctrl->p_cfg->mode >= TIMER_MODE_TRIANGLE_WAVE_SYMMETRIC_PWM)
+    if (GPT_PRV_MODE(p_instance_ctrl) >= TIMER_MODE_TRIANGLE_WAVE_SYMMETRIC_PWM)
     {
         period_counts = gtpr;
     }
@@ -830,7 +845,7 @@ fsp_err_t R_GPT_PwmOutputDelaySet (timer_ctrl_t * const           p_ctrl,
                      FSP_ERR_INVALID_CHANNEL);
     FSP_ERROR_RETURN(0U != (R_GPT_ODC->GTDLYCR1 & R_GPT_ODC_GTDLYCR1_DLLEN_Msk), FSP_ERR_NOT_INITIALIZED);
 
-    if (TIMER_MODE_PWM == p_instance_ctrl->p_cfg->mode)
+    if (TIMER_MODE_PWM == GPT_PRV_MODE(p_instance_ctrl))
     {
         /* In Saw-wave mode, do not change the settings for the delay while the compare-match value is greater than or
          * equal to GTPR - 2. */
@@ -841,8 +856,8 @@ fsp_err_t R_GPT_PwmOutputDelaySet (timer_ctrl_t * const           p_ctrl,
     else
     {
         uint32_t compare_match;
-        if ((TIMER_MODE_TRIANGLE_WAVE_ASYMMETRIC_PWM_MODE3 == p_instance_ctrl->p_cfg->mode) ||
-            (TIMER_MODE_ONE_SHOT_PULSE == p_instance_ctrl->p_cfg->mode))
+        if ((TIMER_MODE_TRIANGLE_WAVE_ASYMMETRIC_PWM_MODE3 == GPT_PRV_MODE(p_instance_ctrl)) ||
+            (TIMER_MODE_ONE_SHOT_PULSE == GPT_PRV_MODE(p_instance_ctrl)))
         {
             /* In TIMER_MODE_TRIANGLE_WAVE_ASYMMETRIC_PWM_MODE3, the trough compare match value is set in
              * GTCCRD, and GTCCRF. */
@@ -1546,7 +1561,7 @@ static void gpt_calculate_duty_cycle (gpt_instance_ctrl_t * const p_instance_ctr
      * triangle waves. */
     uint32_t current_period = p_instance_ctrl->p_reg->GTPBR;
  #if GPT_PRV_EXTRA_FEATURES_ENABLED == GPT_CFG_OUTPUT_SUPPORT_ENABLE
-    if (p_instance_ctrl->p_cfg->mode < TIMER_MODE_TRIANGLE_WAVE_SYMMETRIC_PWM)
+    if (GPT_PRV_MODE(p_instance_ctrl) < TIMER_MODE_TRIANGLE_WAVE_SYMMETRIC_PWM)
  #endif
     {
         current_period++;
@@ -1570,7 +1585,7 @@ static void gpt_calculate_duty_cycle (gpt_instance_ctrl_t * const p_instance_ctr
 
         bool first_level_low;
 
-        if (p_instance_ctrl->p_cfg->mode >= TIMER_MODE_TRIANGLE_WAVE_SYMMETRIC_PWM)
+        if (GPT_PRV_MODE(p_instance_ctrl) >= TIMER_MODE_TRIANGLE_WAVE_SYMMETRIC_PWM)
         {
             /* In triangle PWM modes use the initial pin level to determine 0%/100% setting. */
             first_level_low = !(gtior & 0x10);
@@ -1595,7 +1610,7 @@ static void gpt_calculate_duty_cycle (gpt_instance_ctrl_t * const p_instance_ctr
         uint32_t temp_duty_cycle = duty_cycle_counts;
 
  #if GPT_PRV_EXTRA_FEATURES_ENABLED == GPT_CFG_OUTPUT_SUPPORT_ENABLE
-        if (p_instance_ctrl->p_cfg->mode >= TIMER_MODE_TRIANGLE_WAVE_SYMMETRIC_PWM)
+        if (GPT_PRV_MODE(p_instance_ctrl) >= TIMER_MODE_TRIANGLE_WAVE_SYMMETRIC_PWM)
         {
             p_duty_reg->gtccr_buffer = temp_duty_cycle;
         }
@@ -1756,7 +1771,7 @@ static void r_gpt_capture_common_isr (gpt_prv_capture_event_t event)
     uint32_t counter = p_instance_ctrl->p_reg->GTCCR[event];
 
     /* If we captured a one-shot pulse, then disable future captures. */
-    if (TIMER_MODE_ONE_SHOT == p_instance_ctrl->p_cfg->mode)
+    if (TIMER_MODE_ONE_SHOT == GPT_PRV_MODE(p_instance_ctrl))
     {
         /* Disable captures. */
         gpt_hardware_events_disable(p_instance_ctrl);
@@ -1794,7 +1809,7 @@ void gpt_counter_overflow_isr (void)
     gpt_instance_ctrl_t * p_instance_ctrl = (gpt_instance_ctrl_t *) R_FSP_IsrContextGet(irq);
 
     /* If one-shot mode is selected, stop the timer since period has expired. */
-    if (TIMER_MODE_ONE_SHOT == p_instance_ctrl->p_cfg->mode)
+    if (TIMER_MODE_ONE_SHOT == GPT_PRV_MODE(p_instance_ctrl))
     {
         uint32_t wp = r_gpt_write_protect_disable(p_instance_ctrl);
 
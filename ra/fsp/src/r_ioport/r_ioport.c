@@ -700,6 +700,80 @@ fsp_err_t R_IOPORT_PinEventOutputWrite (ioport_ctrl_t * const p_ctrl, bsp_io_por
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Measures the time taken to drive an output pin high and then low with R_IOPORT_PinWrite, R_IOPORT_PortWrite and the
+ * R_BSP_FastPin functions in bsp_io.h. Use it to decide whether a pin toggled in a time critical path is worth
+ * describing with a bsp_io_fast_pin_t.
+ *
+ * The pin must be configured as an output; it is left at the level it had before the call. Interrupts are disabled
+ * while the pin is written so the measurements are not disturbed.
+ *
+ * @retval FSP_SUCCESS                  p_result holds the measurement.
+ * @retval FSP_ERR_ASSERTION            p_ctrl or p_result is NULL.
+ * @retval FSP_ERR_NOT_OPEN             The module has not been opened.
+ * @retval FSP_ERR_UNSUPPORTED          The MCU has no DWT cycle counter.
+ **********************************************************************************************************************/
+fsp_err_t R_IOPORT_FastPinBenchmark (ioport_ctrl_t * const               p_ctrl,
+                                    bsp_io_port_pin_t                   pin,
+                                    ioport_fast_pin_benchmark_t * const p_result)
+{
+#if (1 == IOPORT_CFG_PARAM_CHECKING_ENABLE)
+    ioport_instance_ctrl_t * p_instance_ctrl = (ioport_instance_ctrl_t *) p_ctrl;
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_result);
+    FSP_ERROR_RETURN(IOPORT_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+#if BSP_FEATURE_DWT_CYCCNT
+    bsp_io_fast_pin_t fast_pin = BSP_IO_FAST_PIN(pin);
+    bsp_io_port_t     port     = (bsp_io_port_t) (IOPORT_PRV_PORT_BITS & (ioport_size_t) pin);
+    uint16_t          level    = fast_pin.p_port->PODR;
+    uint32_t          start;
+
+    R_BSP_CycleCounterEnable();
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    /* Cycles taken to read the counter twice, subtracted from all results. */
+    start = DWT->CYCCNT;
+    uint32_t overhead = DWT->CYCCNT - start;
+
+    start = DWT->CYCCNT;
+    R_IOPORT_PinWrite(p_ctrl, pin, BSP_IO_LEVEL_HIGH);
+    R_IOPORT_PinWrite(p_ctrl, pin, BSP_IO_LEVEL_LOW);
+    p_result->pin_write_cycles = (DWT->CYCCNT - start) - overhead;
+
+    start = DWT->CYCCNT;
+    R_IOPORT_PortWrite(p_ctrl, port, fast_pin.mask, fast_pin.mask);
+    R_IOPORT_PortWrite(p_ctrl, port, 0U, fast_pin.mask);
+    p_result->port_write_cycles = (DWT->CYCCNT - start) - overhead;
+
+    start = DWT->CYCCNT;
+    R_BSP_FastPinWrite(fast_pin, fast_pin.mask);
+    R_BSP_FastPinWrite(fast_pin, 0U);
+    p_result->fast_pin_write_cycles = (DWT->CYCCNT - start) - overhead;
+
+    start = DWT->CYCCNT;
+    R_BSP_FastPinSet(fast_pin);
+    R_BSP_FastPinClear(fast_pin);
+    p_result->fast_pin_set_clear_cycles = (DWT->CYCCNT - start) - overhead;
+
+    /* Restore the level the pin had before the measurement. */
+    R_BSP_FastPinWrite(fast_pin, level);
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+    FSP_PARAMETER_NOT_USED(pin);
+    FSP_PARAMETER_NOT_USED(p_result);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup IOPORT)
  **********************************************************************************************************************/
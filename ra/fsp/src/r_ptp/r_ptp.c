@@ -48,6 +48,12 @@
 #define PTP_TIMEOUT_DIVIDER           (1024U)
 #define PTP_PCLKA_RESET_CYCLES        (64U)
 
+/* Fixed point format of the servo gains. */
+#define PTP_SERVO_GAIN_SHIFT          (16U)
+
+/* Number of consecutive rejected samples before the meanPathDelay filter is reseeded. */
+#define PTP_SERVO_MAX_REJECTED        (4U)
+
 #define PTP_BYTES_TO_UINT32(ary)    ((uint32_t) (((ary)[0] << 24U) | ((ary)[1] << 16U) | ((ary)[2] << 8U) | \
                                                  ((ary)[3] << 0U)))
 
@@ -220,6 +226,14 @@ static uint32_t r_ptp_calculate_timeout(ptp_instance_ctrl_t * p_instance_ctrl, i
 
 void r_ptp_local_clock_value_get(ptp_time_t * const p_time);
 
+static void r_ptp_local_clock_step(int64_t step);
+
+static int64_t r_ptp_time_diff(ptp_time_t const * const p_time1, ptp_time_t const * const p_time2);
+
+static int64_t r_ptp_servo_filter(int64_t filtered, int64_t sample, uint8_t shift);
+
+static bool r_ptp_servo_process(ptp_instance_ctrl_t * p_instance_ctrl);
+
 static void r_ptp_message_endian_swap(ptp_message_t * p_message);
 
 static fsp_err_t r_ptp_process_llc_snap_packet(uint8_t const * const p_llc_snap_packet,
@@ -418,6 +432,12 @@ fsp_err_t R_PTP_Open (ptp_ctrl_t * const p_ctrl, ptp_cfg_t const * const p_cfg)
         FSP_ASSERT(0U != p_cfg->stca.gradient_worst10_interval);
     }
 
+    /* The software servo relies on the STCA gradient correction to adjust the rate of the local clock. */
+    if ((NULL != p_cfg->p_extend) && (NULL != ((ptp_extended_cfg_t const *) p_cfg->p_extend)->p_servo_cfg))
+    {
+        FSP_ASSERT(PTP_CLOCK_CORRECTION_MODE2 == p_cfg->stca.clock_correction_mode);
+    }
+
     FSP_ASSERT(NULL != p_cfg->p_callback);
     FSP_ASSERT(p_cfg->mint_irq >= 0);
     FSP_ASSERT(p_cfg->ipls_irq >= 0);
@@ -426,6 +446,17 @@ fsp_err_t R_PTP_Open (ptp_ctrl_t * const p_ctrl, ptp_cfg_t const * const p_cfg)
     p_instance_ctrl->p_cfg  = p_cfg;
     p_instance_ctrl->tslatr = 0U;
 
+    ptp_extended_cfg_t const * p_extend = (ptp_extended_cfg_t const *) p_cfg->p_extend;
+    if ((NULL != p_extend) && (NULL != p_extend->p_servo_cfg))
+    {
+        fsp_err_t servo_err = R_PTP_ServoInit(&p_instance_ctrl->servo, p_extend->p_servo_cfg);
+        FSP_ERROR_RETURN(FSP_SUCCESS == servo_err, servo_err);
+    }
+    else
+    {
+        p_instance_ctrl->servo.p_cfg = NULL;
+    }
+
     r_ptp_hw_config(p_instance_ctrl);
 
     p_instance_ctrl->rx_buffer_index          = 0U;
@@ -735,6 +766,12 @@ fsp_err_t R_PTP_PortStateSet (ptp_ctrl_t * const p_ctrl, uint32_t state)
     /* Disable clock synchronization when changing port state. */
     R_ETHERC_EPTPC_COMMON->SYNSTARTR = 0U;
 
+    /* Restart the software servo so that it steps to the (possibly new) master clock on the first sample. */
+    if (NULL != p_instance_ctrl->servo.p_cfg)
+    {
+        (void) R_PTP_ServoInit(&p_instance_ctrl->servo, p_instance_ctrl->servo.p_cfg);
+    }
+
     /* Enum values defined in ptp_port_state_t related to SYRFL1R map directly to the bitfields. */
     R_ETHERC_EPTPC->SYRFL1R = state & PTP_SYRFL1R_MASK;
 
@@ -1250,6 +1287,234 @@ fsp_err_t R_PTP_BestMasterClock (ptp_message_t const * const p_announce1,
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * This function calculates offsetFromMaster and meanPathDelay from the timestamps of an end to end delay measurement.
+ *
+ * - p_t1: Sync origin timestamp (from the Sync or Follow_up message).
+ * - p_t2: Sync receive timestamp.
+ * - p_t3: Delay_req transmit timestamp.
+ * - p_t4: Delay_req receive timestamp (from the Delay_resp message).
+ *
+ * Correction fields from the messages should be removed from the timestamps before calling this function.
+ * The result can be passed to @ref R_PTP_ServoUpdate.
+ *
+ * @retval     FSP_SUCCESS                     The offset and delay have been calculated.
+ * @retval     FSP_ERR_ASSERTION               An argument was NULL.
+ **********************************************************************************************************************/
+fsp_err_t R_PTP_OffsetCalculate (ptp_time_t const * const p_t1,
+                                 ptp_time_t const * const p_t2,
+                                 ptp_time_t const * const p_t3,
+                                 ptp_time_t const * const p_t4,
+                                 int64_t * const          p_offset,
+                                 int64_t * const          p_delay)
+{
+#if PTP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_t1);
+    FSP_ASSERT(NULL != p_t2);
+    FSP_ASSERT(NULL != p_t3);
+    FSP_ASSERT(NULL != p_t4);
+    FSP_ASSERT(NULL != p_offset);
+    FSP_ASSERT(NULL != p_delay);
+#endif
+
+    /* Master to slave and slave to master delays (See IEEE 1588-2008 section 11.3). */
+    int64_t master_to_slave = r_ptp_time_diff(p_t2, p_t1);
+    int64_t slave_to_master = r_ptp_time_diff(p_t4, p_t3);
+
+    *p_delay  = (master_to_slave + slave_to_master) / 2;
+    *p_offset = master_to_slave - *p_delay;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * This function initializes a software clock servo. The servo does not access the PTP peripheral so it may be used
+ * to discipline any clock from any source of offsetFromMaster and meanPathDelay samples.
+ *
+ * @retval     FSP_SUCCESS                     The servo has been initialized.
+ * @retval     FSP_ERR_ASSERTION               An argument was NULL or invalid.
+ **********************************************************************************************************************/
+fsp_err_t R_PTP_ServoInit (ptp_servo_t * const p_servo, ptp_servo_cfg_t const * const p_cfg)
+{
+#if PTP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_servo);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(0 < p_cfg->max_frequency);
+    FSP_ASSERT(0U < p_cfg->lock_count);
+    FSP_ASSERT(32U > p_cfg->offset_filter_shift);
+    FSP_ASSERT(32U > p_cfg->delay_filter_shift);
+#endif
+
+    memset(p_servo, 0, sizeof(ptp_servo_t));
+    p_servo->p_cfg       = p_cfg;
+    p_servo->stats.state = PTP_SERVO_STATE_UNLOCKED;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * This function processes one offsetFromMaster and meanPathDelay sample and calculates the correction for the local
+ * clock. The first sample after initialization always steps the local clock. Subsequent samples are filtered and used
+ * by a proportional-integral controller to calculate a frequency adjustment.
+ *
+ * This function is called from the MINT ISR when @ref ptp_extended_cfg_t::p_servo_cfg is set, in which case the driver
+ * applies steps to the local clock and the STCA gradient correction adjusts its rate. It may also be called directly
+ * with simulated timestamps (see @ref R_PTP_OffsetCalculate), in which case the caller applies the result.
+ *
+ * @retval     FSP_SUCCESS                     The sample has been processed and the result written to p_output.
+ * @retval     FSP_ERR_ASSERTION               An argument was NULL.
+ * @retval     FSP_ERR_NOT_INITIALIZED         The servo has not been initialized.
+ **********************************************************************************************************************/
+fsp_err_t R_PTP_ServoUpdate (ptp_servo_t * const p_servo, int64_t offset, int64_t delay, ptp_servo_output_t * const p_output)
+{
+#if PTP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_servo);
+    FSP_ASSERT(NULL != p_output);
+    FSP_ERROR_RETURN(NULL != p_servo->p_cfg, FSP_ERR_NOT_INITIALIZED);
+#endif
+
+    ptp_servo_cfg_t const * p_cfg   = p_servo->p_cfg;
+    ptp_servo_stats_t     * p_stats = &p_servo->stats;
+
+    p_output->p_stats   = p_stats;
+    p_output->step      = 0;
+    p_output->frequency = p_stats->frequency;
+
+    p_stats->samples++;
+    p_stats->offset = offset;
+    p_stats->delay  = delay;
+
+    /* Reject samples with a meanPathDelay outlier (Usually caused by queuing in a switch). */
+    if ((PTP_SERVO_STATE_UNLOCKED != p_stats->state) && (0U != p_cfg->delay_outlier_threshold))
+    {
+        int64_t delay_error = delay - p_stats->delay_filtered;
+        if ((delay_error > (int64_t) p_cfg->delay_outlier_threshold) ||
+            (delay_error < -(int64_t) p_cfg->delay_outlier_threshold))
+        {
+            p_servo->reject_counter++;
+
+            /* If the path delay has changed permanently then reseed the filter instead of rejecting every sample. */
+            if (PTP_SERVO_MAX_REJECTED > p_servo->reject_counter)
+            {
+                p_stats->rejected++;
+                p_output->action = PTP_SERVO_ACTION_NONE;
+
+                return FSP_SUCCESS;
+            }
+
+            p_stats->delay_filtered = delay;
+        }
+    }
+
+    p_servo->reject_counter = 0U;
+
+    if (PTP_SERVO_STATE_UNLOCKED == p_stats->state)
+    {
+        /* Seed the filters and statistics with the first sample. */
+        p_stats->delay_filtered = delay;
+        p_stats->offset_min     = offset;
+        p_stats->offset_max     = offset;
+        p_stats->delay_min      = delay;
+        p_stats->delay_max      = delay;
+    }
+    else
+    {
+        p_stats->delay_filtered = r_ptp_servo_filter(p_stats->delay_filtered, delay, p_cfg->delay_filter_shift);
+        p_stats->offset_min     = (offset < p_stats->offset_min) ? offset : p_stats->offset_min;
+        p_stats->offset_max     = (offset > p_stats->offset_max) ? offset : p_stats->offset_max;
+        p_stats->delay_min      = (delay < p_stats->delay_min) ? delay : p_stats->delay_min;
+        p_stats->delay_max      = (delay > p_stats->delay_max) ? delay : p_stats->delay_max;
+    }
+
+    int64_t offset_abs = (offset < 0) ? -offset : offset;
+
+    /* Step the clock on the first sample or if the offset is too large to slew in a reasonable time. */
+    if ((PTP_SERVO_STATE_UNLOCKED == p_stats->state) ||
+        ((0U != p_cfg->step_threshold) && (offset_abs > (int64_t) p_cfg->step_threshold)))
+    {
+        p_stats->steps++;
+        p_stats->state           = PTP_SERVO_STATE_LOCKING;
+        p_stats->offset_filtered = 0;
+        p_servo->lock_counter    = 0U;
+
+        p_output->action = PTP_SERVO_ACTION_STEP;
+        p_output->step   = offset;
+
+        return FSP_SUCCESS;
+    }
+
+    p_stats->offset_filtered = r_ptp_servo_filter(p_stats->offset_filtered, offset, p_cfg->offset_filter_shift);
+
+    /* Limit the offset so that the products below cannot overflow. */
+    int64_t error = p_stats->offset_filtered;
+    error = (error > INT32_MAX) ? INT32_MAX : ((error < -INT32_MAX) ? -INT32_MAX : error);
+
+    /* Accumulate the integral term and limit it to the maximum frequency adjustment (anti-windup). */
+    int64_t integral_limit = (int64_t) p_cfg->max_frequency << PTP_SERVO_GAIN_SHIFT;
+    p_servo->integral += (int64_t) p_cfg->ki * error;
+    p_servo->integral  = (p_servo->integral > integral_limit) ? integral_limit : p_servo->integral;
+    p_servo->integral  = (p_servo->integral < -integral_limit) ? -integral_limit : p_servo->integral;
+
+    /* A positive offset means the local clock is ahead of the master so the frequency must be reduced. */
+    int64_t frequency = -(((int64_t) p_cfg->kp * error + p_servo->integral) / (1LL << PTP_SERVO_GAIN_SHIFT));
+    frequency = (frequency > p_cfg->max_frequency) ? p_cfg->max_frequency : frequency;
+    frequency = (frequency < -p_cfg->max_frequency) ? -p_cfg->max_frequency : frequency;
+
+    p_stats->frequency = (int32_t) frequency;
+
+    /* Update the lock state. */
+    if (error <= (int64_t) p_cfg->lock_threshold && error >= -(int64_t) p_cfg->lock_threshold)
+    {
+        if (p_servo->lock_counter < p_cfg->lock_count)
+        {
+            p_servo->lock_counter++;
+        }
+
+        if (p_servo->lock_counter >= p_cfg->lock_count)
+        {
+            p_stats->state = PTP_SERVO_STATE_LOCKED;
+        }
+    }
+    else
+    {
+        p_servo->lock_counter = 0U;
+        p_stats->state        = PTP_SERVO_STATE_LOCKING;
+    }
+
+    p_output->action    = PTP_SERVO_ACTION_ADJUST;
+    p_output->frequency = p_stats->frequency;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * This function gets the statistics of the software clock servo running in the MINT ISR.
+ *
+ * @retval     FSP_SUCCESS                     The statistics have been written to p_stats.
+ * @retval     FSP_ERR_NOT_OPEN                The instance has not been opened.
+ * @retval     FSP_ERR_ASSERTION               An argument was NULL.
+ * @retval     FSP_ERR_NOT_ENABLED             The software clock servo is not configured.
+ **********************************************************************************************************************/
+fsp_err_t R_PTP_ServoStatsGet (ptp_ctrl_t * const p_ctrl, ptp_servo_stats_t * const p_stats)
+{
+    ptp_instance_ctrl_t * p_instance_ctrl = (ptp_instance_ctrl_t *) p_ctrl;
+#if PTP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(PTP_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT(NULL != p_stats);
+#endif
+
+    FSP_ERROR_RETURN(NULL != p_instance_ctrl->servo.p_cfg, FSP_ERR_NOT_ENABLED);
+
+    /* The statistics are updated in the MINT ISR. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    *p_stats = p_instance_ctrl->servo.stats;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup PTP)
  **********************************************************************************************************************/
@@ -1521,6 +1786,126 @@ void r_ptp_local_clock_value_get (ptp_time_t * const p_time)
     p_time->nanoseconds   = R_ETHERC_EPTPC_COMMON->LCCVRL;
 }
 
+/*******************************************************************************************************************//**
+ * Step the local clock by subtracting an offset from the current value.
+ *
+ * @param[in]  step                   Offset in nanoseconds to subtract from the local clock.
+ **********************************************************************************************************************/
+static void r_ptp_local_clock_step (int64_t step)
+{
+    ptp_time_t time;
+
+    /* Prevent interrupts so that the time between reading and writing the local clock is deterministic. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    r_ptp_local_clock_value_get(&time);
+
+    uint64_t seconds     = ((uint64_t) time.seconds_upper << PTP_SHIFT_32) | time.seconds_lower;
+    int64_t  nanoseconds = (int64_t) time.nanoseconds - (step % (int64_t) PTP_NANOSECONDS_IN_SECOND);
+    seconds -= (uint64_t) (step / (int64_t) PTP_NANOSECONDS_IN_SECOND);
+
+    /* Normalize the nanoseconds field. */
+    if (nanoseconds < 0)
+    {
+        nanoseconds += PTP_NANOSECONDS_IN_SECOND;
+        seconds--;
+    }
+    else if (nanoseconds >= (int64_t) PTP_NANOSECONDS_IN_SECOND)
+    {
+        nanoseconds -= PTP_NANOSECONDS_IN_SECOND;
+        seconds++;
+    }
+    else
+    {
+    }
+
+    /* Set the new value in the local clock counter (See R_PTP_LocalClockValueSet). */
+    R_ETHERC_EPTPC_COMMON->LCIVRU = (uint32_t) (seconds >> PTP_SHIFT_32) & UINT16_MAX;
+    R_ETHERC_EPTPC_COMMON->LCIVRM = (uint32_t) (seconds & UINT32_MAX);
+    R_ETHERC_EPTPC_COMMON->LCIVRL = (uint32_t) nanoseconds;
+    R_ETHERC_EPTPC_COMMON->LCIVLDR = 1;
+
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+/*******************************************************************************************************************//**
+ * Calculate the difference between two timestamps.
+ *
+ * @param[in]  p_time1                Pointer to the first timestamp.
+ * @param[in]  p_time2                Pointer to the second timestamp.
+ *
+ * @return     p_time1 - p_time2 in nanoseconds.
+ **********************************************************************************************************************/
+static int64_t r_ptp_time_diff (ptp_time_t const * const p_time1, ptp_time_t const * const p_time2)
+{
+    int64_t seconds1 = (int64_t) (((uint64_t) p_time1->seconds_upper << PTP_SHIFT_32) | p_time1->seconds_lower);
+    int64_t seconds2 = (int64_t) (((uint64_t) p_time2->seconds_upper << PTP_SHIFT_32) | p_time2->seconds_lower);
+
+    return ((seconds1 - seconds2) * (int64_t) PTP_NANOSECONDS_IN_SECOND) +
+           ((int64_t) p_time1->nanoseconds - (int64_t) p_time2->nanoseconds);
+}
+
+/*******************************************************************************************************************//**
+ * First order low pass filter used by the software servo.
+ *
+ * @param[in]  filtered               Previous filter output.
+ * @param[in]  sample                 New sample.
+ * @param[in]  shift                  The new sample is weighted by 1 / 2^shift.
+ *
+ * @return     New filter output.
+ **********************************************************************************************************************/
+static int64_t r_ptp_servo_filter (int64_t filtered, int64_t sample, uint8_t shift)
+{
+    return filtered + ((sample - filtered) / (1LL << shift));
+}
+
+/*******************************************************************************************************************//**
+ * Run the software servo on the offsetFromMaster and meanPathDelay calculated by the SYNFP, step the local clock if
+ * required and notify the application of the result. Called from the MINT ISR so that the step is applied with minimal
+ * latency. The rate of the local clock is adjusted continuously by the STCA gradient correction; stepping the counter
+ * to apply a rate would add a phase sawtooth at the sync interval.
+ *
+ * @param[in]  p_instance_ctrl        Instance control block.
+ *
+ * @return     true if the local clock was stepped.
+ **********************************************************************************************************************/
+static bool r_ptp_servo_process (ptp_instance_ctrl_t * p_instance_ctrl)
+{
+    /* Read the offsetFromMaster and meanPathDelay values calculated from the hardware timestamps. */
+    int64_t offset = (int64_t) (((uint64_t) R_ETHERC_EPTPC->OFMRU << PTP_SHIFT_32) | R_ETHERC_EPTPC->OFMRL);
+    int64_t delay  = (int64_t) (((uint64_t) R_ETHERC_EPTPC->MPDRU << PTP_SHIFT_32) | R_ETHERC_EPTPC->MPDRL);
+
+    ptp_servo_output_t servo_output;
+    fsp_err_t          err = R_PTP_ServoUpdate(&p_instance_ctrl->servo, offset, delay, &servo_output);
+    if (FSP_SUCCESS != err)
+    {
+        return false;
+    }
+
+    bool stepped = (PTP_SERVO_ACTION_STEP == servo_output.action);
+    if (stepped)
+    {
+        /* Stop the STCA correction so that the step is not measured as a gradient. It restarts on the next sample. */
+        R_ETHERC_EPTPC_COMMON->SYNSTARTR = 0U;
+
+        r_ptp_local_clock_step(servo_output.step);
+    }
+
+    /* The correction has already been applied; the callback is only a notification. */
+    ptp_callback_args_t callback_args =
+    {
+        .event          = PTP_EVENT_SERVO_UPDATED,
+        .p_message      = NULL,
+        .p_servo_output = &servo_output,
+        .p_context      = p_instance_ctrl->p_cfg->p_context
+    };
+
+    p_instance_ctrl->p_cfg->p_callback(&callback_args);
+
+    return stepped;
+}
+
 /*******************************************************************************************************************//**
  * Performs endian swap on PTP message fields.
  *
@@ -2197,7 +2582,15 @@ void r_ptp_mint_isr (void)
     if ((sysr & R_ETHERC_EPTPC_SYSR_OFMUD_Msk) != 0)
     {
         /* offsetFromMaster value updated. */
-        if (0U == R_ETHERC_EPTPC_COMMON->SYNSTARTR)
+        bool stepped = false;
+        if (NULL != p_instance_ctrl->servo.p_cfg)
+        {
+            /* Filter the sample and step the local clock if the software servo requests it. */
+            stepped = r_ptp_servo_process(p_instance_ctrl);
+        }
+
+        /* The STCA corrects the rate of the local clock. After a step it is restarted from the next sample. */
+        if (!stepped && (0U == R_ETHERC_EPTPC_COMMON->SYNSTARTR))
         {
             /* Clear SYNTOUT and SYNCOUT flags immediately after starting synchronization
              * (See 30.2.5 of the RA6M3 manual R01UH0886EJ0100). */
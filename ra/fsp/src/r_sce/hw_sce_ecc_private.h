@@ -212,6 +212,14 @@ fsp_err_t HW_SCE_ECC_521WrappedScalarMultiplication(const uint32_t * InData_Curv
                                                     uint32_t       * OutData_R);
 #endif
 
+/* Plaintext ECC key install with optional wrapped key cache */
+fsp_err_t HW_SCE_ECC_PlainKeyInstall(uint32_t        key_command,
+                                     const uint8_t * p_plain_key,
+                                     uint32_t        key_bytes,
+                                     uint32_t      * p_wrapped_key,
+                                     uint32_t        wrapped_words);
+void HW_SCE_ECC_PlainKeyCacheFlush(void);
+
 /* ECC - 224 HW Procedure definitions */
 fsp_err_t HW_SCE_ECC_224GenerateSign(const uint32_t * InData_DomainParam,
                                      const uint32_t * InData_G,
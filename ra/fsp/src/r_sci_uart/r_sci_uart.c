@@ -35,6 +35,56 @@
  #define SCI_UART_CFG_TX_ENABLE                 1
 #endif
 
+/* Static instance configuration. These settings are project-wide: set one to 1 in r_sci_uart_cfg.h only when every
+ * SCI_UART instance in the project uses the feature. The per-instance checks in the transfer functions and interrupts
+ * are then resolved at compile time. R_SCI_UART_Open rejects instances that do not match, also when parameter checking
+ * is disabled, since the interrupts would otherwise use a FIFO or transfer instance the instance does not have. */
+#ifndef SCI_UART_CFG_STATIC_FIFO_ENABLE
+ #define SCI_UART_CFG_STATIC_FIFO_ENABLE        0
+#endif
+#ifndef SCI_UART_CFG_STATIC_DTC_TX_ENABLE
+ #define SCI_UART_CFG_STATIC_DTC_TX_ENABLE      0
+#endif
+#ifndef SCI_UART_CFG_STATIC_DTC_RX_ENABLE
+ #define SCI_UART_CFG_STATIC_DTC_RX_ENABLE      0
+#endif
+#ifndef SCI_UART_CFG_STATIC_RS485_ENABLE
+ #define SCI_UART_CFG_STATIC_RS485_ENABLE       0
+#endif
+
+#if SCI_UART_CFG_STATIC_FIFO_ENABLE && !SCI_UART_CFG_FIFO_SUPPORT
+ #error "SCI_UART_CFG_STATIC_FIFO_ENABLE requires SCI_UART_CFG_FIFO_SUPPORT."
+#endif
+#if (SCI_UART_CFG_STATIC_DTC_TX_ENABLE || SCI_UART_CFG_STATIC_DTC_RX_ENABLE) && !SCI_UART_CFG_DTC_SUPPORTED
+ #error "SCI_UART_CFG_STATIC_DTC_TX_ENABLE and SCI_UART_CFG_STATIC_DTC_RX_ENABLE require SCI_UART_CFG_DTC_SUPPORTED."
+#endif
+#if SCI_UART_CFG_STATIC_RS485_ENABLE && !SCI_UART_CFG_RS485_SUPPORT
+ #error "SCI_UART_CFG_STATIC_RS485_ENABLE requires SCI_UART_CFG_RS485_SUPPORT."
+#endif
+
+#if SCI_UART_CFG_STATIC_FIFO_ENABLE
+ #define SCI_UART_PRV_FIFO_USED(p_ctrl)         (true)
+ #define SCI_UART_PRV_FIFO_DEPTH(p_ctrl)        (BSP_FEATURE_SCI_UART_FIFO_DEPTH)
+#else
+ #define SCI_UART_PRV_FIFO_USED(p_ctrl)         (0U != (p_ctrl)->fifo_depth)
+ #define SCI_UART_PRV_FIFO_DEPTH(p_ctrl)        ((p_ctrl)->fifo_depth)
+#endif
+#if SCI_UART_CFG_STATIC_DTC_TX_ENABLE
+ #define SCI_UART_PRV_DTC_TX_USED(p_ctrl)       (true)
+#else
+ #define SCI_UART_PRV_DTC_TX_USED(p_ctrl)       (NULL != (p_ctrl)->p_cfg->p_transfer_tx)
+#endif
+#if SCI_UART_CFG_STATIC_DTC_RX_ENABLE
+ #define SCI_UART_PRV_DTC_RX_USED(p_ctrl)       (true)
+#else
+ #define SCI_UART_PRV_DTC_RX_USED(p_ctrl)       (NULL != (p_ctrl)->p_cfg->p_transfer_rx)
+#endif
+#if SCI_UART_CFG_STATIC_RS485_ENABLE
+ #define SCI_UART_PRV_RS485_USED(p_extend)      (true)
+#else
+ #define SCI_UART_PRV_RS485_USED(p_extend)      (SCI_UART_RS485_ENABLE == (p_extend)->rs485_setting.enable)
+#endif
+
 /* Number of divisors in the data table used for baud rate calculation. */
 #define SCI_UART_NUM_DIVISORS_ASYNC             (13U)
 
@@ -303,7 +353,8 @@ const uart_api_t g_uart_on_sci =
  * @retval  FSP_ERR_ASSERTION              Pointer to UART control block or configuration structure is NULL.
  * @retval  FSP_ERR_IP_CHANNEL_NOT_PRESENT The requested channel does not exist on this MCU.
  * @retval  FSP_ERR_INVALID_ARGUMENT       Flow control is enabled but flow control pin is not defined or selected channel
- *                                         does not support "Hardware CTS and Hardware RTS" flow control.
+ *                                         does not support "Hardware CTS and Hardware RTS" flow control, or the
+ *                                         instance does not match the SCI_UART_CFG_STATIC_* settings.
  * @retval  FSP_ERR_ALREADY_OPEN           Control block has already been opened or channel is being used by another
  *                                         instance. Call close() then open() to reconfigure.
  *
@@ -356,6 +407,22 @@ fsp_err_t R_SCI_UART_Open (uart_ctrl_t * const p_api_ctrl, uart_cfg_t const * co
     FSP_ASSERT(p_cfg->eri_irq >= 0);
 #endif
 
+    /* Make sure the instance matches the static instance configuration. */
+#if SCI_UART_CFG_STATIC_FIFO_ENABLE
+    FSP_ERROR_RETURN(BSP_FEATURE_SCI_UART_FIFO_CHANNELS & (1U << p_cfg->channel), FSP_ERR_INVALID_ARGUMENT);
+#endif
+#if SCI_UART_CFG_STATIC_DTC_TX_ENABLE && SCI_UART_CFG_TX_ENABLE
+    FSP_ERROR_RETURN(NULL != p_cfg->p_transfer_tx, FSP_ERR_INVALID_ARGUMENT);
+#endif
+#if SCI_UART_CFG_STATIC_DTC_RX_ENABLE && SCI_UART_CFG_RX_ENABLE
+    FSP_ERROR_RETURN(NULL != p_cfg->p_transfer_rx, FSP_ERR_INVALID_ARGUMENT);
+#endif
+#if SCI_UART_CFG_STATIC_RS485_ENABLE
+    FSP_ERROR_RETURN((NULL != p_cfg->p_extend) &&
+                     (SCI_UART_RS485_ENABLE == ((sci_uart_extended_cfg_t *) p_cfg->p_extend)->rs485_setting.enable),
+                     FSP_ERR_INVALID_ARGUMENT);
+#endif
+
     p_ctrl->p_reg = ((R_SCI0_Type *) (R_SCI0_BASE + (SCI_REG_SIZE * p_cfg->channel)));
 
     p_ctrl->fifo_depth = 0U;
@@ -455,6 +522,8 @@ fsp_err_t R_SCI_UART_Open (uart_ctrl_t * const p_api_ctrl, uart_cfg_t const * co
     }
 #endif
 
+    BSP_PERF_REGISTER(p_ctrl, "r_sci_uart", p_cfg->channel);
+
     p_ctrl->open = SCI_UART_OPEN;
 
     return FSP_SUCCESS;
@@ -479,6 +548,8 @@ fsp_err_t R_SCI_UART_Close (uart_ctrl_t * const p_api_ctrl)
     /* Mark the channel not open so other APIs cannot use it. */
     p_ctrl->open = 0U;
 
+    BSP_PERF_UNREGISTER(p_ctrl);
+
     /* Disable interrupts, receiver, and transmitter. Disable baud clock output.*/
     p_ctrl->p_reg->SCR = 0U;
 
@@ -542,7 +613,7 @@ fsp_err_t R_SCI_UART_Read (uart_ctrl_t * const p_api_ctrl, uint8_t * const p_des
  #if SCI_UART_CFG_DTC_SUPPORTED
 
     /* Configure transfer instance to receive the requested number of bytes if transfer is used for reception. */
-    if (NULL != p_ctrl->p_cfg->p_transfer_rx)
+    if (SCI_UART_PRV_DTC_RX_USED(p_ctrl))
     {
         uint32_t size = bytes >> (p_ctrl->data_bytes - 1);
   #if (SCI_UART_CFG_PARAM_CHECKING_ENABLE)
@@ -606,7 +677,7 @@ fsp_err_t R_SCI_UART_Write (uart_ctrl_t * const p_api_ctrl, uint8_t const * cons
     sci_uart_extended_cfg_t * p_extend = (sci_uart_extended_cfg_t *) p_ctrl->p_cfg->p_extend;
 
     /* If RS-485 is enabled, then assert the driver enable pin at the start of a write transfer. */
-    if (p_extend->rs485_setting.enable)
+    if (SCI_UART_PRV_RS485_USED(p_extend))
     {
         R_BSP_PinAccessEnable();
 
@@ -624,7 +695,7 @@ fsp_err_t R_SCI_UART_Write (uart_ctrl_t * const p_api_ctrl, uint8_t const * cons
     /* If the fifo is not used the first write will be done from this function. Subsequent writes will be done
      * from txi_isr. */
  #if SCI_UART_CFG_FIFO_SUPPORT
-    if (p_ctrl->fifo_depth > 0U)
+    if (SCI_UART_PRV_FIFO_USED(p_ctrl))
     {
         p_ctrl->tx_src_bytes = bytes;
         p_ctrl->p_tx_src     = p_src;
@@ -640,7 +711,7 @@ fsp_err_t R_SCI_UART_Write (uart_ctrl_t * const p_api_ctrl, uint8_t const * cons
 
     /* If a transfer instance is used for transmission, reset the transfer instance to transmit the requested
      * data. */
-    if ((NULL != p_ctrl->p_cfg->p_transfer_tx) && p_ctrl->tx_src_bytes)
+    if (SCI_UART_PRV_DTC_TX_USED(p_ctrl) && p_ctrl->tx_src_bytes)
     {
         uint32_t data_bytes    = p_ctrl->data_bytes;
         uint32_t num_transfers = p_ctrl->tx_src_bytes >> (data_bytes - 1);
@@ -659,11 +730,14 @@ fsp_err_t R_SCI_UART_Write (uart_ctrl_t * const p_api_ctrl, uint8_t const * cons
     }
  #endif
 
+    BSP_PERF_COUNT(p_ctrl, tx_frames, 1U);
+    BSP_PERF_COUNT(p_ctrl, tx_bytes, bytes);
+
     /* Trigger a TXI interrupt. This triggers the transfer instance or a TXI interrupt if the transfer instance is
      * not used. */
     p_ctrl->p_reg->SCR |= SCI_SCR_TIE_MASK;
  #if SCI_UART_CFG_FIFO_SUPPORT
-    if (p_ctrl->fifo_depth == 0U)
+    if (!SCI_UART_PRV_FIFO_USED(p_ctrl))
  #endif
     {
         /* On channels with no FIFO, the first byte is sent from this function to trigger the first TXI event.  This
@@ -1133,7 +1207,7 @@ static void r_sci_negate_de_pin (sci_uart_instance_ctrl_t const * const p_ctrl)
     sci_uart_extended_cfg_t * p_extend = (sci_uart_extended_cfg_t *) p_ctrl->p_cfg->p_extend;
 
     /* If RS-485 is enabled, then negate the driver enable pin at the end of a write transfer. */
-    if (p_extend->rs485_setting.enable)
+    if (SCI_UART_PRV_RS485_USED(p_extend))
     {
         R_BSP_PinAccessEnable();
 
@@ -1608,6 +1682,7 @@ void sci_uart_txi_isr (void)
 {
     /* Save context if RTOS is used */
     FSP_CONTEXT_SAVE
+    BSP_PERF_ISR_ENTER();
 
     IRQn_Type irq = R_FSP_CurrentIrqGet();
 
@@ -1617,15 +1692,15 @@ void sci_uart_txi_isr (void)
     /* Recover ISR context saved in open. */
     sci_uart_instance_ctrl_t * p_ctrl = (sci_uart_instance_ctrl_t *) R_FSP_IsrContextGet(irq);
 
-    if ((NULL == p_ctrl->p_cfg->p_transfer_tx) && (0U != p_ctrl->tx_src_bytes))
+    if (!SCI_UART_PRV_DTC_TX_USED(p_ctrl) && (0U != p_ctrl->tx_src_bytes))
     {
         /* Write the data to the FIFO if the channel has a FIFO.  Otherwise write data based on size to the transmit
          * register.  Write to 16-bit TDRHL for 9-bit data, or 8-bit TDR otherwise. */
  #if SCI_UART_CFG_FIFO_SUPPORT
-        if (0U != p_ctrl->fifo_depth)
+        if (SCI_UART_PRV_FIFO_USED(p_ctrl))
         {
             uint32_t fifo_count = (uint32_t) p_ctrl->p_reg->FDR_b.T;
-            for (uint32_t cnt = fifo_count; (cnt < p_ctrl->fifo_depth) && p_ctrl->tx_src_bytes; cnt++)
+            for (uint32_t cnt = fifo_count; (cnt < SCI_UART_PRV_FIFO_DEPTH(p_ctrl)) && p_ctrl->tx_src_bytes; cnt++)
             {
                 if (2U == p_ctrl->data_bytes)
                 {
@@ -1686,6 +1761,8 @@ void sci_uart_txi_isr (void)
         }
     }
 
+    BSP_PERF_ISR_EXIT(p_ctrl);
+
     /* Restore context if RTOS is used */
     FSP_CONTEXT_RESTORE
 }
@@ -1711,6 +1788,7 @@ void sci_uart_rxi_isr (void)
 {
     /* Save context if RTOS is used */
     FSP_CONTEXT_SAVE
+    BSP_PERF_ISR_ENTER();
 
     IRQn_Type irq = R_FSP_CurrentIrqGet();
 
@@ -1721,7 +1799,7 @@ void sci_uart_rxi_isr (void)
     sci_uart_instance_ctrl_t * p_ctrl = (sci_uart_instance_ctrl_t *) R_FSP_IsrContextGet(irq);
 
  #if SCI_UART_CFG_DTC_SUPPORTED
-    if ((p_ctrl->p_cfg->p_transfer_rx == NULL) || (0 == p_ctrl->rx_dest_bytes))
+    if (!SCI_UART_PRV_DTC_RX_USED(p_ctrl) || (0 == p_ctrl->rx_dest_bytes))
  #endif
     {
  #if (SCI_UART_CFG_FLOW_CONTROL_SUPPORT)
@@ -1738,7 +1816,7 @@ void sci_uart_rxi_isr (void)
  #if SCI_UART_CFG_FIFO_SUPPORT
         do
         {
-            if ((p_ctrl->fifo_depth > 0U))
+            if (SCI_UART_PRV_FIFO_USED(p_ctrl))
             {
                 if (p_ctrl->p_reg->FDR_b.R > 0U)
                 {
@@ -1762,6 +1840,8 @@ void sci_uart_rxi_isr (void)
                 data = p_ctrl->p_reg->RDR;
             }
 
+            BSP_PERF_COUNT(p_ctrl, rx_bytes, p_ctrl->data_bytes);
+
             if (0 == p_ctrl->rx_dest_bytes)
             {
                 /* If a callback was provided, call it with the argument */
@@ -1779,6 +1859,8 @@ void sci_uart_rxi_isr (void)
 
                 if (0 == p_ctrl->rx_dest_bytes)
                 {
+                    BSP_PERF_COUNT(p_ctrl, rx_frames, 1U);
+
                     /* If a callback was provided, call it with the argument */
                     if (NULL != p_ctrl->p_callback)
                     {
@@ -1788,9 +1870,9 @@ void sci_uart_rxi_isr (void)
             }
 
  #if SCI_UART_CFG_FIFO_SUPPORT
-        } while ((p_ctrl->fifo_depth > 0U) && ((p_ctrl->p_reg->FDR_b.R) > 0U));
+        } while (SCI_UART_PRV_FIFO_USED(p_ctrl) && ((p_ctrl->p_reg->FDR_b.R) > 0U));
 
-        if (p_ctrl->fifo_depth > 0U)
+        if (SCI_UART_PRV_FIFO_USED(p_ctrl))
         {
             p_ctrl->p_reg->SSR_FIFO = (uint8_t) ~(SCI_UART_SSR_FIFO_DR_RDF);
         }
@@ -1811,6 +1893,9 @@ void sci_uart_rxi_isr (void)
  #if SCI_UART_CFG_DTC_SUPPORTED
     else
     {
+        BSP_PERF_COUNT(p_ctrl, rx_frames, 1U);
+        BSP_PERF_COUNT(p_ctrl, rx_bytes, p_ctrl->rx_dest_bytes);
+
         p_ctrl->rx_dest_bytes = 0;
 
         p_ctrl->p_rx_dest = NULL;
@@ -1824,6 +1909,8 @@ void sci_uart_rxi_isr (void)
     }
  #endif
 
+    BSP_PERF_ISR_EXIT(p_ctrl);
+
     /* Restore context if RTOS is used */
     FSP_CONTEXT_RESTORE
 }
@@ -1841,6 +1928,7 @@ void sci_uart_tei_isr (void)
 {
     /* Save context if RTOS is used */
     FSP_CONTEXT_SAVE
+    BSP_PERF_ISR_ENTER();
 
     IRQn_Type irq = R_FSP_CurrentIrqGet();
 
@@ -1862,6 +1950,8 @@ void sci_uart_tei_isr (void)
     /* Clear pending IRQ to make sure it doesn't fire again after exiting */
     R_BSP_IrqStatusClear(irq);
 
+    BSP_PERF_ISR_EXIT(p_ctrl);
+
     /* Restore context if RTOS is used */
     FSP_CONTEXT_RESTORE
 }
@@ -1878,6 +1968,7 @@ void sci_uart_eri_isr (void)
 {
     /* Save context if RTOS is used */
     FSP_CONTEXT_SAVE;
+    BSP_PERF_ISR_ENTER();
 
     IRQn_Type irq = R_FSP_CurrentIrqGet();
 
@@ -1890,7 +1981,7 @@ void sci_uart_eri_isr (void)
     /* Read data. */
     if (
  #if SCI_UART_CFG_FIFO_SUPPORT
-        (p_ctrl->fifo_depth > 0U) ||
+        SCI_UART_PRV_FIFO_USED(p_ctrl) ||
  #endif
         (2U == p_ctrl->data_bytes))
     {
@@ -1912,6 +2003,17 @@ void sci_uart_eri_isr (void)
         event |= UART_EVENT_BREAK_DETECT;
     }
 
+ #if BSP_CFG_PERF_COUNTERS_ENABLE
+    if (UART_EVENT_ERR_OVERFLOW == (event & UART_EVENT_ERR_OVERFLOW))
+    {
+        BSP_PERF_COUNT(p_ctrl, overruns, 1U);
+    }
+    else
+    {
+        BSP_PERF_COUNT(p_ctrl, errors, 1U);
+    }
+ #endif
+
     /* Clear error condition. */
     p_ctrl->p_reg->SSR &= (uint8_t) (~SCI_RCVR_ERR_MASK);
 
@@ -1928,6 +2030,8 @@ void sci_uart_eri_isr (void)
     /* Clear pending IRQ to make sure it doesn't fire again after exiting */
     R_BSP_IrqStatusClear(irq);
 
+    BSP_PERF_ISR_EXIT(p_ctrl);
+
     /* Restore context if RTOS is used */
     FSP_CONTEXT_RESTORE;
 }
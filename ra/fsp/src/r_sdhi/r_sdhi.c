@@ -414,6 +414,8 @@ fsp_err_t R_SDHI_Open (sdmmc_ctrl_t * const p_api_ctrl, sdmmc_cfg_t const * cons
     r_sdhi_irq_enable(p_cfg->sdio_irq, p_cfg->sdio_ipl, p_ctrl);
     r_sdhi_irq_enable(p_cfg->dma_req_irq, p_cfg->dma_req_ipl, p_ctrl);
 
+    BSP_PERF_REGISTER(p_ctrl, "r_sdhi", p_cfg->channel);
+
     p_ctrl->initialized = false;
     p_ctrl->open        = SDHI_PRV_OPEN;
 
@@ -533,6 +535,9 @@ fsp_err_t R_SDHI_Read (sdmmc_ctrl_t * const p_api_ctrl,
         command = SDHI_PRV_CMD_READ_SINGLE_BLOCK;
     }
 
+    BSP_PERF_COUNT(p_ctrl, rx_frames, sector_count);
+    BSP_PERF_COUNT(p_ctrl, rx_bytes, sector_count * p_ctrl->p_cfg->block_size);
+
     r_sdhi_read_write_common(p_ctrl, sector_count, p_ctrl->p_cfg->block_size, command, argument);
 
     return FSP_SUCCESS;
@@ -596,6 +601,9 @@ fsp_err_t R_SDHI_Write (sdmmc_ctrl_t * const  p_api_ctrl,
         command = SDHI_PRV_CMD_WRITE_SINGLE_BLOCK;
     }
 
+    BSP_PERF_COUNT(p_ctrl, tx_frames, sector_count);
+    BSP_PERF_COUNT(p_ctrl, tx_bytes, sector_count * p_ctrl->p_cfg->block_size);
+
     /* Casting to uint16_t safe because block size verified in R_SDHI_Open */
     r_sdhi_read_write_common(p_ctrl, sector_count, p_ctrl->p_cfg->block_size, command, argument);
 
@@ -1103,6 +1111,8 @@ fsp_err_t R_SDHI_Close (sdmmc_ctrl_t * const p_api_ctrl)
 
     p_ctrl->open = 0U;
 
+    BSP_PERF_UNREGISTER(p_ctrl);
+
     /* Disable SDHI interrupts. */
     r_sdhi_irq_disable(p_ctrl->p_cfg->access_irq);
     r_sdhi_irq_disable(p_ctrl->p_cfg->card_irq);
@@ -2754,6 +2764,7 @@ void sdhimmc_accs_isr (void)
 {
     /* Save context if RTOS is used */
     FSP_CONTEXT_SAVE
+    BSP_PERF_ISR_ENTER();
 
     IRQn_Type              irq    = R_FSP_CurrentIrqGet();
     sdhi_instance_ctrl_t * p_ctrl = (sdhi_instance_ctrl_t *) R_FSP_IsrContextGet(irq);
@@ -2762,6 +2773,11 @@ void sdhimmc_accs_isr (void)
     memset(&args, 0U, sizeof(args));
     r_sdhi_access_irq_process(p_ctrl, &args);
 
+    if (0U != (args.event & SDMMC_EVENT_TRANSFER_ERROR))
+    {
+        BSP_PERF_COUNT(p_ctrl, errors, 1U);
+    }
+
     /* Call user callback */
     if ((p_ctrl->initialized) && (0U != args.event))
     {
@@ -2772,6 +2788,8 @@ void sdhimmc_accs_isr (void)
     /* Clearing the IR bit must be done after clearing the interrupt source in the the peripheral */
     R_BSP_IrqStatusClear(irq);
 
+    BSP_PERF_ISR_EXIT(p_ctrl);
+
     /* Restore context if RTOS is used */
     FSP_CONTEXT_RESTORE
 }
@@ -2783,6 +2801,7 @@ void sdhimmc_card_isr (void)
 {
     /* Save context if RTOS is used */
     FSP_CONTEXT_SAVE
+    BSP_PERF_ISR_ENTER();
     sdmmc_callback_args_t args;
     memset(&args, 0U, sizeof(args));
 
@@ -2815,6 +2834,8 @@ void sdhimmc_card_isr (void)
     /* Clearing the IR bit must be done after clearing the interrupt source in the the peripheral */
     R_BSP_IrqStatusClear(irq);
 
+    BSP_PERF_ISR_EXIT(p_ctrl);
+
     /* Restore context if RTOS is used */
     FSP_CONTEXT_RESTORE
 }
@@ -2828,6 +2849,7 @@ void sdhimmc_dma_req_isr (void)
 {
     /* Save context if RTOS is used */
     FSP_CONTEXT_SAVE
+    BSP_PERF_ISR_ENTER();
 
     IRQn_Type irq = R_FSP_CurrentIrqGet();
 
@@ -2839,6 +2861,8 @@ void sdhimmc_dma_req_isr (void)
      * This must be after the callback because the next DTC transfer will begin when this bit is cleared. */
     R_BSP_IrqStatusClear(irq);
 
+    BSP_PERF_ISR_EXIT(p_ctrl);
+
     /* Restore context if RTOS is used */
     FSP_CONTEXT_RESTORE
 }
@@ -2850,6 +2874,7 @@ void sdhimmc_sdio_isr (void)
 {
     /* Save context if RTOS is used */
     FSP_CONTEXT_SAVE
+    BSP_PERF_ISR_ENTER();
 
     IRQn_Type              irq    = R_FSP_CurrentIrqGet();
     sdhi_instance_ctrl_t * p_ctrl = (sdhi_instance_ctrl_t *) R_FSP_IsrContextGet(irq);
@@ -2882,6 +2907,8 @@ void sdhimmc_sdio_isr (void)
     /* Clearing the IR bit must be done after clearing the interrupt source in the the peripheral */
     R_BSP_IrqStatusClear(irq);
 
+    BSP_PERF_ISR_EXIT(p_ctrl);
+
     /* Restore context if RTOS is used */
     FSP_CONTEXT_RESTORE
 }
@@ -31,6 +31,35 @@
 /** "SPI" in ASCII, used to determine if channel is open. */
 #define SPI_OPEN                        (0x52535049ULL)
 
+/* Optional static configuration. These settings are project-wide: when every SPI instance in the project uses a
+ * transfer instance for transmit (or receive), setting the matching option to 1 removes the runtime checks for the
+ * transfer instance from the transfer paths. R_SPI_Open rejects instances without the transfer instance, also when
+ * parameter checking is disabled. */
+#ifndef SPI_CFG_STATIC_TRANSFER_TX_ENABLE
+ #define SPI_CFG_STATIC_TRANSFER_TX_ENABLE    0
+#endif
+#ifndef SPI_CFG_STATIC_TRANSFER_RX_ENABLE
+ #define SPI_CFG_STATIC_TRANSFER_RX_ENABLE    0
+#endif
+
+#if (SPI_CFG_STATIC_TRANSFER_TX_ENABLE || SPI_CFG_STATIC_TRANSFER_RX_ENABLE) && (SPI_DMA_SUPPORT_ENABLE != 1)
+ #error "SPI_CFG_STATIC_TRANSFER_TX_ENABLE and SPI_CFG_STATIC_TRANSFER_RX_ENABLE require SPI_DMA_SUPPORT_ENABLE."
+#endif
+#if (SPI_TRANSMIT_FROM_RXI_ISR == 1) && SPI_CFG_STATIC_TRANSFER_RX_ENABLE && !SPI_CFG_STATIC_TRANSFER_TX_ENABLE
+ #error "SPI_CFG_STATIC_TRANSFER_RX_ENABLE requires SPI_CFG_STATIC_TRANSFER_TX_ENABLE when SPI_TRANSMIT_FROM_RXI_ISR is set."
+#endif
+
+#if SPI_CFG_STATIC_TRANSFER_TX_ENABLE
+ #define SPI_PRV_TRANSFER_TX_USED(p_ctrl)     (true)
+#else
+ #define SPI_PRV_TRANSFER_TX_USED(p_ctrl)     (NULL != (p_ctrl)->p_cfg->p_transfer_tx)
+#endif
+#if SPI_CFG_STATIC_TRANSFER_RX_ENABLE
+ #define SPI_PRV_TRANSFER_RX_USED(p_ctrl)     (true)
+#else
+ #define SPI_PRV_TRANSFER_RX_USED(p_ctrl)     (NULL != (p_ctrl)->p_cfg->p_transfer_rx)
+#endif
+
 /** SPI base register access macro.  */
 #define SPI_REG(channel)    ((R_SPI0_Type *) ((uint32_t) R_SPI0 +                       \
                                               ((uint32_t) R_SPI1 - (uint32_t) R_SPI0) * \
@@ -101,6 +130,18 @@ static fsp_err_t r_spi_write_read_common(spi_ctrl_t * const    p_api_ctrl,
 static void r_spi_receive(spi_instance_ctrl_t * p_ctrl);
 static void r_spi_transmit(spi_instance_ctrl_t * p_ctrl);
 static void r_spi_call_callback(spi_instance_ctrl_t * p_ctrl, spi_event_t event);
+static fsp_err_t r_spi_transfer_setup(spi_instance_ctrl_t * p_ctrl,
+                                     void const          * p_src,
+                                     void                * p_dest,
+                                     uint32_t const        length,
+                                     spi_bit_width_t const bit_width);
+static void                      r_spi_queue_cs_write(spi_queue_device_t const * p_device, bool active);
+static fsp_err_t                 r_spi_queue_segment_start(spi_instance_ctrl_t * p_ctrl);
+static spi_queue_transaction_t * r_spi_queue_pop(spi_instance_ctrl_t * p_ctrl);
+static void                      r_spi_queue_notify(spi_queue_transaction_t * p_transaction, spi_event_t event);
+static void                      r_spi_queue_run(spi_instance_ctrl_t * p_ctrl);
+static void                      r_spi_queue_transaction_end(spi_instance_ctrl_t * p_ctrl, spi_event_t event);
+static void                      r_spi_queue_segment_complete(spi_instance_ctrl_t * p_ctrl);
 
 /***********************************************************************************************************************
  * ISR prototypes
@@ -155,6 +196,8 @@ const spi_api_t g_spi_on_spi =
  * @retval     FSP_ERR_UNSUPPORTED             A requested setting is not possible on this device with the current build
  *                                             configuration.
  * @retval     FSP_ERR_IP_CHANNEL_NOT_PRESENT  The channel number is invalid.
+ * @retval     FSP_ERR_INVALID_ARGUMENT        The transfer instances in the configuration do not match the
+ *                                             SPI_CFG_STATIC_TRANSFER_* settings.
  * @return     See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes. This
  *             function calls: @ref transfer_api_t::open
  * @note       This function is reentrant.
@@ -207,6 +250,14 @@ fsp_err_t R_SPI_Open (spi_ctrl_t * p_api_ctrl, spi_cfg_t const * const p_cfg)
  #endif
 #endif
 
+    /* Make sure the instance matches the static instance configuration. */
+#if SPI_CFG_STATIC_TRANSFER_TX_ENABLE
+    FSP_ERROR_RETURN(NULL != p_cfg->p_transfer_tx, FSP_ERR_INVALID_ARGUMENT);
+#endif
+#if SPI_CFG_STATIC_TRANSFER_RX_ENABLE
+    FSP_ERROR_RETURN(NULL != p_cfg->p_transfer_rx, FSP_ERR_INVALID_ARGUMENT);
+#endif
+
     /* Configure transfers if they are provided in p_cfg. */
     err = r_spi_transfer_config(p_cfg);
     FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
@@ -216,6 +267,10 @@ fsp_err_t R_SPI_Open (spi_ctrl_t * p_api_ctrl, spi_cfg_t const * const p_cfg)
     p_ctrl->p_callback        = p_cfg->p_callback;
     p_ctrl->p_context         = p_cfg->p_context;
     p_ctrl->p_callback_memory = NULL;
+    p_ctrl->p_queue_head      = NULL;
+    p_ctrl->p_queue_tail      = NULL;
+    p_ctrl->p_queue_device    = NULL;
+    p_ctrl->queue_dispatching = false;
 
     p_ctrl->p_regs = SPI_REG(p_ctrl->p_cfg->channel);
 
@@ -371,6 +426,12 @@ fsp_err_t R_SPI_Close (spi_ctrl_t * const p_api_ctrl)
 
     p_ctrl->open = 0;
 
+    /* Abort queued transactions. */
+    while (NULL != p_ctrl->p_queue_head)
+    {
+        r_spi_queue_notify(r_spi_queue_pop(p_ctrl), SPI_EVENT_TRANSFER_ABORTED);
+    }
+
 #if SPI_DMA_SUPPORT_ENABLE == 1
     if (NULL != p_ctrl->p_cfg->p_transfer_rx)
     {
@@ -480,6 +541,126 @@ fsp_err_t R_SPI_CalculateBitrate (uint32_t bitrate, rspck_div_setting_t * spck_d
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Queues a transaction made of one or more segments. Segments are started back to back from the transfer end
+ * interrupt, and transactions queued behind it follow without returning to the application. Each segment addresses
+ * a device: the clock phase, polarity, bit order and bitrate settings are only rewritten when the device changes, and
+ * the chip select is either the SSLn signal driven by the peripheral or a GPIO pin that the driver asserts before the
+ * segment and negates after it unless spi_queue_segment_t::cs_hold is set. The transfer instances of the channel are
+ * used for every segment.
+ *
+ * The instance callback is not called for queued segments. When a transaction ends, busy is cleared, result is set
+ * and spi_queue_transaction_t::p_callback is called. A transaction ended by an error does not stop the transactions
+ * queued behind it.
+ *
+ * @note Only master mode is supported. SPI_QUEUE_CS_MODE_SSL devices require the channel to be in 4-wire mode
+ * (SPI_SSL_MODE_SPI) and SPI_QUEUE_CS_MODE_PIN devices require 3-wire mode (SPI_SSL_MODE_CLK_SYN), so the two kinds
+ * cannot share a channel. R_SPI_Read, R_SPI_Write and R_SPI_WriteRead return FSP_ERR_IN_USE until the queue drains.
+ *
+ * @retval  FSP_SUCCESS                   Transaction queued.
+ * @retval  FSP_ERR_ASSERTION             An argument is invalid.
+ * @retval  FSP_ERR_NOT_OPEN              The channel has not been opened. Open channel first.
+ * @retval  FSP_ERR_UNSUPPORTED           The channel is not in master mode, or a segment addresses a device whose
+ *                                        chip select mode does not match the SSL mode of the channel.
+ * @retval  FSP_ERR_IN_USE                The transaction is already queued or a transfer started with R_SPI_WriteRead
+ *                                        is in progress.
+ **********************************************************************************************************************/
+fsp_err_t R_SPI_QueueSubmit (spi_ctrl_t * const p_api_ctrl, spi_queue_transaction_t * const p_transaction)
+{
+    spi_instance_ctrl_t * p_ctrl = (spi_instance_ctrl_t *) p_api_ctrl;
+
+#if SPI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_transaction);
+    FSP_ASSERT(NULL != p_transaction->p_segments);
+    FSP_ASSERT(0U != p_transaction->num_segments);
+    FSP_ERROR_RETURN(SPI_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+
+    for (uint32_t i = 0U; i < p_transaction->num_segments; i++)
+    {
+        spi_queue_segment_t const * p_segment = &p_transaction->p_segments[i];
+        FSP_ASSERT(NULL != p_segment->p_device);
+        FSP_ASSERT(0U != p_segment->length);
+        FSP_ASSERT(!((p_segment->bit_width < SPI_BIT_WIDTH_8_BITS) ||
+                     ((p_segment->bit_width > SPI_BIT_WIDTH_16_BITS) && ((p_segment->bit_width + 1) & 0x3)) ||
+                     (p_segment->bit_width == SPI_BIT_WIDTH_28_BITS)));
+ #if SPI_DMA_SUPPORT_ENABLE == 1
+        if ((NULL != p_ctrl->p_cfg->p_transfer_rx) || (NULL != p_ctrl->p_cfg->p_transfer_tx))
+        {
+            FSP_ASSERT(p_segment->length <= UINT16_MAX);
+        }
+ #endif
+
+        /* A held chip select must be followed by a segment for the same device. */
+        if (p_segment->cs_hold && (SPI_QUEUE_CS_MODE_PIN == p_segment->p_device->cs_mode))
+        {
+            FSP_ASSERT(i + 1U < p_transaction->num_segments);
+            FSP_ASSERT(p_segment->p_device == p_transaction->p_segments[i + 1U].p_device);
+        }
+    }
+#endif
+
+    FSP_ERROR_RETURN(SPI_MODE_MASTER == p_ctrl->p_cfg->operating_mode, FSP_ERR_UNSUPPORTED);
+    FSP_ERROR_RETURN(!p_transaction->busy, FSP_ERR_IN_USE);
+
+    /* In 4-wire mode the peripheral asserts the SSLn signal selected in SPCMD for every segment, so a pin chip select
+     * segment would also select the last SSLn device. In 3-wire mode SSLn is not driven at all. Each chip select mode
+     * is therefore only accepted in the SSL mode that matches it. */
+    bool ssl_mode = (SPI_SSL_MODE_SPI == ((spi_extended_cfg_t *) p_ctrl->p_cfg->p_extend)->spi_clksyn);
+    for (uint32_t i = 0U; i < p_transaction->num_segments; i++)
+    {
+        FSP_ERROR_RETURN((SPI_QUEUE_CS_MODE_SSL == p_transaction->p_segments[i].p_device->cs_mode) == ssl_mode,
+                         FSP_ERR_UNSUPPORTED);
+    }
+
+    fsp_err_t err = FSP_SUCCESS;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    if ((NULL == p_ctrl->p_queue_head) && !p_ctrl->queue_dispatching &&
+        (0U != (p_ctrl->p_regs->SPCR & R_SPI0_SPCR_SPE_Msk)))
+    {
+        /* A transfer started with R_SPI_WriteRead is in progress. */
+        err = FSP_ERR_IN_USE;
+    }
+    else
+    {
+        p_transaction->busy    = true;
+        p_transaction->result  = SPI_EVENT_TRANSFER_COMPLETE;
+        p_transaction->segment = 0U;
+        p_transaction->p_next  = NULL;
+
+        if (NULL != p_ctrl->p_queue_head)
+        {
+            p_ctrl->p_queue_tail->p_next = p_transaction;
+            p_ctrl->p_queue_tail         = p_transaction;
+        }
+        else
+        {
+            p_ctrl->p_queue_head = p_transaction;
+            p_ctrl->p_queue_tail = p_transaction;
+
+            /* When submitted from a transaction callback, the transfer end interrupt starts the transaction after the
+             * callback returns. */
+            if (!p_ctrl->queue_dispatching)
+            {
+                /* Save the settings used by R_SPI_WriteRead so they can be restored when the queue drains. */
+                p_ctrl->queue_saved_spcmd = p_ctrl->p_regs->SPCMD[0];
+                p_ctrl->queue_saved_spbr  = p_ctrl->p_regs->SPBR;
+                p_ctrl->queue_saved_sslp  = p_ctrl->p_regs->SSLP;
+                p_ctrl->p_queue_device    = NULL;
+
+                r_spi_queue_run(p_ctrl);
+            }
+        }
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return err;
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup SPI)
  **********************************************************************************************************************/
@@ -769,7 +950,7 @@ static void r_spi_bit_width_config (spi_instance_ctrl_t * p_ctrl)
 static void r_spi_start_transfer (spi_instance_ctrl_t * p_ctrl)
 {
 #if SPI_TRANSMIT_FROM_RXI_ISR == 1
-    if (!p_ctrl->p_cfg->p_transfer_tx)
+    if (!SPI_PRV_TRANSFER_TX_USED(p_ctrl))
     {
         /* Handle the first two transmit empty events here because transmit interrupt may not be enabled. */
 
@@ -862,6 +1043,31 @@ static fsp_err_t r_spi_write_read_common (spi_ctrl_t * const    p_api_ctrl,
 
     FSP_ERROR_RETURN(0 == (p_ctrl->p_regs->SPCR & R_SPI0_SPCR_SPE_Msk), FSP_ERR_IN_USE);
 
+    /* The bus belongs to the transaction queue until it drains. */
+    FSP_ERROR_RETURN(NULL == p_ctrl->p_queue_head, FSP_ERR_IN_USE);
+
+    return r_spi_transfer_setup(p_ctrl, p_src, p_dest, length, bit_width);
+}
+
+/*******************************************************************************************************************//**
+ * Programs the transfer state and the transfer instances and starts the transfer.
+ *
+ * @param[in]  p_ctrl            pointer to control structure.
+ * @param      p_src             Buffer to transmit data from.
+ * @param      p_dest            Buffer to store received data in.
+ * @param[in]  length            Number of transfers
+ * @param[in]  bit_width         Data frame size (8-Bit, 16-Bit, 32-Bit)
+ *
+ * @retval     FSP_SUCCESS       Transfer was started successfully.
+ * @return                       See @ref RENESAS_ERROR_CODES for other possible return codes. This function internally
+ *                               calls @ref transfer_api_t::reconfigure.
+ **********************************************************************************************************************/
+static fsp_err_t r_spi_transfer_setup (spi_instance_ctrl_t * p_ctrl,
+                                       void const          * p_src,
+                                       void                * p_dest,
+                                       uint32_t const        length,
+                                       spi_bit_width_t const bit_width)
+{
     p_ctrl->p_tx_data = p_src;
     p_ctrl->p_rx_data = p_dest;
     p_ctrl->tx_count  = 0;
@@ -870,7 +1076,7 @@ static fsp_err_t r_spi_write_read_common (spi_ctrl_t * const    p_api_ctrl,
     p_ctrl->bit_width = bit_width;
 
 #if SPI_DMA_SUPPORT_ENABLE == 1
-    if (p_ctrl->p_cfg->p_transfer_rx)
+    if (SPI_PRV_TRANSFER_RX_USED(p_ctrl))
     {
         /* When the rxi interrupt is called, all transfers will be finished. */
         p_ctrl->rx_count = length;
@@ -908,7 +1114,7 @@ static fsp_err_t r_spi_write_read_common (spi_ctrl_t * const    p_api_ctrl,
         FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
     }
 
-    if (p_ctrl->p_cfg->p_transfer_tx)
+    if (SPI_PRV_TRANSFER_TX_USED(p_ctrl))
     {
         /* When the txi interrupt is called, all transfers will be finished. */
         p_ctrl->tx_count = length;
@@ -1034,6 +1240,194 @@ static void r_spi_transmit (spi_instance_ctrl_t * p_ctrl)
     p_ctrl->tx_count = tx_count + 1;
 }
 
+/*******************************************************************************************************************//**
+ * Drives the chip select pin of a device. Devices that use an SSLn signal are not affected.
+ *
+ * @param[in]  p_device        Device
+ * @param[in]  active          True to assert the chip select.
+ **********************************************************************************************************************/
+static void r_spi_queue_cs_write (spi_queue_device_t const * p_device, bool active)
+{
+    if (SPI_QUEUE_CS_MODE_PIN == p_device->cs_mode)
+    {
+        bsp_io_level_t level = (bsp_io_level_t) ((SPI_SSLP_HIGH == p_device->cs_polarity) == active);
+
+        R_BSP_PinAccessEnable();
+        R_BSP_PinWrite(p_device->cs_pin, level);
+        R_BSP_PinAccessDisable();
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Selects the device of the current segment of the queue head and starts the segment.
+ *
+ * @param[in]  p_ctrl          pointer to control structure.
+ *
+ * @retval     FSP_SUCCESS     Segment started.
+ * @return                     See @ref RENESAS_ERROR_CODES for other possible return codes. This function internally
+ *                             calls @ref transfer_api_t::reconfigure.
+ **********************************************************************************************************************/
+static fsp_err_t r_spi_queue_segment_start (spi_instance_ctrl_t * p_ctrl)
+{
+    spi_queue_transaction_t  * p_transaction = p_ctrl->p_queue_head;
+    spi_queue_segment_t const * p_segment    = &p_transaction->p_segments[p_transaction->segment];
+    spi_queue_device_t const  * p_device     = p_segment->p_device;
+
+    /* Consecutive segments for the same device reuse the register settings. */
+    if (p_device != p_ctrl->p_queue_device)
+    {
+        uint32_t spcmd0 = p_ctrl->p_regs->SPCMD[0];
+        spcmd0 &= ~(R_SPI0_SPCMD0_CPHA_Msk | R_SPI0_SPCMD0_CPOL_Msk | R_SPI0_SPCMD0_BRDV_Msk | R_SPI0_SPCMD0_LSBF_Msk);
+        spcmd0 |= (uint32_t) p_device->clk_phase << R_SPI0_SPCMD0_CPHA_Pos;
+        spcmd0 |= (uint32_t) p_device->clk_polarity << R_SPI0_SPCMD0_CPOL_Pos;
+        spcmd0 |= (uint32_t) p_device->spck_div.brdv << R_SPI0_SPCMD0_BRDV_Pos;
+        spcmd0 |= (uint32_t) p_device->bit_order << R_SPI0_SPCMD0_LSBF_Pos;
+
+        if (SPI_QUEUE_CS_MODE_SSL == p_device->cs_mode)
+        {
+            spcmd0 &= ~R_SPI0_SPCMD0_SSLA_Msk;
+            spcmd0 |= (uint32_t) p_device->ssl_select << R_SPI0_SPCMD0_SSLA_Pos;
+
+            uint32_t sslp = p_ctrl->p_regs->SSLP & ~(1U << p_device->ssl_select);
+            sslp |= (uint32_t) p_device->cs_polarity << p_device->ssl_select;
+            p_ctrl->p_regs->SSLP = (uint8_t) sslp;
+        }
+
+        p_ctrl->p_regs->SPBR     = p_device->spck_div.spbr;
+        p_ctrl->p_regs->SPCMD[0] = (uint16_t) spcmd0;
+        p_ctrl->p_queue_device   = p_device;
+    }
+
+    r_spi_queue_cs_write(p_device, true);
+
+    return r_spi_transfer_setup(p_ctrl, p_segment->p_src, p_segment->p_dest, p_segment->length, p_segment->bit_width);
+}
+
+/*******************************************************************************************************************//**
+ * Removes the transaction at the head of the queue and negates its chip select.
+ *
+ * @param[in]  p_ctrl          pointer to control structure.
+ *
+ * @return     The removed transaction.
+ **********************************************************************************************************************/
+static spi_queue_transaction_t * r_spi_queue_pop (spi_instance_ctrl_t * p_ctrl)
+{
+    spi_queue_transaction_t * p_transaction = p_ctrl->p_queue_head;
+
+    uint32_t segment = p_transaction->segment;
+    if (segment >= p_transaction->num_segments)
+    {
+        segment = p_transaction->num_segments - 1U;
+    }
+
+    r_spi_queue_cs_write(p_transaction->p_segments[segment].p_device, false);
+
+    p_ctrl->p_queue_head = p_transaction->p_next;
+    if (NULL == p_ctrl->p_queue_head)
+    {
+        p_ctrl->p_queue_tail = NULL;
+    }
+
+    return p_transaction;
+}
+
+/*******************************************************************************************************************//**
+ * Reports the end of a transaction to the application.
+ *
+ * @param[in]  p_transaction   Transaction that ended.
+ * @param[in]  event           SPI_EVENT_TRANSFER_COMPLETE or the event that ended the transaction.
+ **********************************************************************************************************************/
+static void r_spi_queue_notify (spi_queue_transaction_t * p_transaction, spi_event_t event)
+{
+    p_transaction->result = event;
+    p_transaction->busy   = false;
+
+    if (NULL != p_transaction->p_callback)
+    {
+        p_transaction->p_callback(p_transaction);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Starts the current segment of the queue head. Transactions whose segment cannot be started are ended with
+ * SPI_EVENT_TRANSFER_ABORTED. When the queue is empty the settings used by R_SPI_WriteRead are restored.
+ *
+ * @param[in]  p_ctrl          pointer to control structure.
+ **********************************************************************************************************************/
+static void r_spi_queue_run (spi_instance_ctrl_t * p_ctrl)
+{
+    while (NULL != p_ctrl->p_queue_head)
+    {
+        if (FSP_SUCCESS == r_spi_queue_segment_start(p_ctrl))
+        {
+            return;
+        }
+
+        r_spi_queue_notify(r_spi_queue_pop(p_ctrl), SPI_EVENT_TRANSFER_ABORTED);
+    }
+
+    if (NULL != p_ctrl->p_queue_device)
+    {
+        p_ctrl->p_regs->SPCMD[0] = p_ctrl->queue_saved_spcmd;
+        p_ctrl->p_regs->SPBR     = p_ctrl->queue_saved_spbr;
+        p_ctrl->p_regs->SSLP     = p_ctrl->queue_saved_sslp;
+        p_ctrl->p_queue_device   = NULL;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Ends the transaction at the head of the queue, starts the next one and then notifies the application, so the bus
+ * is already busy with the next transaction while the callback runs.
+ *
+ * @param[in]  p_ctrl          pointer to control structure.
+ * @param[in]  event           SPI_EVENT_TRANSFER_COMPLETE or the event that ended the transaction.
+ **********************************************************************************************************************/
+static void r_spi_queue_transaction_end (spi_instance_ctrl_t * p_ctrl, spi_event_t event)
+{
+    p_ctrl->queue_dispatching = true;
+
+    spi_queue_transaction_t * p_transaction = r_spi_queue_pop(p_ctrl);
+    r_spi_queue_run(p_ctrl);
+    r_spi_queue_notify(p_transaction, event);
+
+    /* Start a transaction submitted by the callback to an idle queue. */
+    if ((NULL != p_ctrl->p_queue_head) && (0U == (p_ctrl->p_regs->SPCR & R_SPI0_SPCR_SPE_Msk)))
+    {
+        r_spi_queue_run(p_ctrl);
+    }
+
+    p_ctrl->queue_dispatching = false;
+}
+
+/*******************************************************************************************************************//**
+ * Advances the queue after a segment has completed.
+ *
+ * @param[in]  p_ctrl          pointer to control structure.
+ **********************************************************************************************************************/
+static void r_spi_queue_segment_complete (spi_instance_ctrl_t * p_ctrl)
+{
+    spi_queue_transaction_t   * p_transaction = p_ctrl->p_queue_head;
+    spi_queue_segment_t const * p_segment     = &p_transaction->p_segments[p_transaction->segment];
+
+    p_transaction->segment++;
+    if (p_transaction->segment >= p_transaction->num_segments)
+    {
+        r_spi_queue_transaction_end(p_ctrl, SPI_EVENT_TRANSFER_COMPLETE);
+
+        return;
+    }
+
+    if (!p_segment->cs_hold)
+    {
+        r_spi_queue_cs_write(p_segment->p_device, false);
+    }
+
+    if (FSP_SUCCESS != r_spi_queue_segment_start(p_ctrl))
+    {
+        r_spi_queue_transaction_end(p_ctrl, SPI_EVENT_TRANSFER_ABORTED);
+    }
+}
+
 /*******************************************************************************************************************//**
  * Calls user callback.
  *
@@ -1186,7 +1580,7 @@ void spi_txi_isr (void)
              * By enabling the transfer end ISR here, all of the transfers are guaranteed to be completed. */
             R_BSP_IrqEnable(p_ctrl->p_cfg->tei_irq);
         }
-        else if (p_ctrl->p_cfg->p_transfer_tx)
+        else if (SPI_PRV_TRANSFER_TX_USED(p_ctrl))
         {
             /* If DMA is used to transmit data, enable the interrupt after all the data has been transfered, but do not
              * clear the IRQ Pending Bit. */
@@ -1239,8 +1633,16 @@ void spi_tei_isr (void)
             R_BSP_IrqEnable(p_ctrl->p_cfg->txi_irq);
         }
 
-        /* Signal that a transfer has completed. */
-        r_spi_call_callback(p_ctrl, SPI_EVENT_TRANSFER_COMPLETE);
+        if (NULL != p_ctrl->p_queue_head)
+        {
+            /* Start the next queued segment. */
+            r_spi_queue_segment_complete(p_ctrl);
+        }
+        else
+        {
+            /* Signal that a transfer has completed. */
+            r_spi_call_callback(p_ctrl, SPI_EVENT_TRANSFER_COMPLETE);
+        }
     }
 
     /* Restore context if RTOS is used */
@@ -1280,25 +1682,53 @@ void spi_eri_isr (void)
     /* Clear the status register. */
     p_ctrl->p_regs->SPSR = 0;
 
-    /* Check if the error is a Parity Error. */
-    if (R_SPI0_SPSR_PERF_Msk & status)
+    if (NULL != p_ctrl->p_queue_head)
     {
-        r_spi_call_callback(p_ctrl, SPI_EVENT_ERR_PARITY);
-    }
+        /* The segment was aborted. Make sure the transfer end interrupt of the aborted segment cannot complete the
+         * next one, then end the transaction with the error. */
+        R_BSP_IrqDisable(p_ctrl->p_cfg->tei_irq);
 
-    /* Check if the error is a Receive Buffer Overflow Error. */
-    if (R_SPI0_SPSR_OVRF_Msk & status)
-    {
-        r_spi_call_callback(p_ctrl, SPI_EVENT_ERR_READ_OVERFLOW);
-    }
+        spi_event_t event = SPI_EVENT_ERR_MODE_FAULT;
+        if (R_SPI0_SPSR_PERF_Msk & status)
+        {
+            event = SPI_EVENT_ERR_PARITY;
+        }
+        else if (R_SPI0_SPSR_OVRF_Msk & status)
+        {
+            event = SPI_EVENT_ERR_READ_OVERFLOW;
+        }
+        else if (R_SPI0_SPSR_UDRF_Msk & status)
+        {
+            event = SPI_EVENT_ERR_MODE_UNDERRUN;
+        }
+        else
+        {
+        }
 
-    /* Check if the error is a Mode Fault Error. */
-    if (R_SPI0_SPSR_MODF_Msk & status)
+        r_spi_queue_transaction_end(p_ctrl, event);
+    }
+    else
     {
-        /* Check if the error is a Transmit Buffer Underflow Error. */
-        if (R_SPI0_SPSR_UDRF_Msk & status)
+        /* Check if the error is a Parity Error. */
+        if (R_SPI0_SPSR_PERF_Msk & status)
+        {
+            r_spi_call_callback(p_ctrl, SPI_EVENT_ERR_PARITY);
+        }
+
+        /* Check if the error is a Receive Buffer Overflow Error. */
+        if (R_SPI0_SPSR_OVRF_Msk & status)
+        {
+            r_spi_call_callback(p_ctrl, SPI_EVENT_ERR_READ_OVERFLOW);
+        }
+
+        /* Check if the error is a Mode Fault Error. */
+        if (R_SPI0_SPSR_MODF_Msk & status)
         {
-            r_spi_call_callback(p_ctrl, SPI_EVENT_ERR_MODE_UNDERRUN);
+            /* Check if the error is a Transmit Buffer Underflow Error. */
+            if (R_SPI0_SPSR_UDRF_Msk & status)
+            {
+                r_spi_call_callback(p_ctrl, SPI_EVENT_ERR_MODE_UNDERRUN);
+            }
         }
     }
 
@@ -21,6 +21,7 @@
 /***********************************************************************************************************************
  * Includes
  **********************************************************************************************************************/
+#include <string.h>
 #include "r_i2s_api.h"
 #include "r_ssi.h"
 #include "r_ssi_cfg.h"
@@ -71,6 +72,10 @@
 #define SSI_PRV_I2S_CHANNELS               (2U)
 #define SSI_PRV_BITS_PER_BYTE              (8U)
 
+/* Number of bits in each PCM width, indexed by i2s_pcm_width_t. */
+#define SSI_PRV_PCM_WIDTH_BITS             {8U, 16U, 18U, 20U, 22U, 24U, 32U}
+#define SSI_PRV_STREAM_SAMPLE_BITS         (16U)
+
 /* "SSI" in ASCII, used to determine if driver is open. */
 #define SSI_PRV_OPEN                       (0x535349U)
 
@@ -142,6 +147,22 @@ fsp_err_t r_ssi_tx_load_fifo(ssi_instance_ctrl_t * const p_instance_ctrl, void c
                              uint32_t const bytes);
 fsp_err_t r_ssi_rx_unload_fifo(ssi_instance_ctrl_t * const p_instance_ctrl, void * const p_dest, uint32_t const bytes);
 
+/* Streaming subroutines */
+static fsp_err_t r_ssi_stream_arm(ssi_instance_ctrl_t * const p_instance_ctrl, ssi_dir_t dir, uint32_t period);
+static uint32_t  r_ssi_stream_app_frame_bytes(ssi_instance_ctrl_t * const p_instance_ctrl);
+static uint32_t  r_ssi_stream_sample_load(void const * p_buffer, uint32_t index, transfer_size_t size);
+static void      r_ssi_stream_sample_store(void * p_buffer, uint32_t index, transfer_size_t size, uint32_t sample);
+static void      r_ssi_stream_ring_write(ssi_instance_ctrl_t * const p_instance_ctrl,
+                                         uint32_t                    offset,
+                                         uint8_t const             * p_src,
+                                         uint32_t                    frames);
+static void r_ssi_stream_ring_read(ssi_instance_ctrl_t * const p_instance_ctrl,
+                                   uint32_t                    offset,
+                                   uint8_t                   * p_dest,
+                                   uint32_t                    frames);
+static void r_ssi_stream_tx_period_complete(ssi_instance_ctrl_t * const p_instance_ctrl);
+static void r_ssi_stream_rx_period_complete(ssi_instance_ctrl_t * const p_instance_ctrl);
+
 /***********************************************************************************************************************
  * Private global variables
  **********************************************************************************************************************/
@@ -300,6 +321,7 @@ fsp_err_t R_SSI_Open (i2s_ctrl_t * const p_ctrl, i2s_cfg_t const * const p_cfg)
     p_instance_ctrl->p_callback        = p_cfg->p_callback;
     p_instance_ctrl->p_context         = p_cfg->p_context;
     p_instance_ctrl->p_callback_memory = NULL;
+    p_instance_ctrl->p_stream_cfg      = NULL;
 
     /* Enable PCLK to SSIE. */
     R_BSP_MODULE_START(FSP_IP_SSI, p_instance_ctrl->p_cfg->channel);
@@ -662,6 +684,285 @@ fsp_err_t R_SSI_CallbackSet (i2s_ctrl_t * const          p_api_ctrl,
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Starts circular streaming. The transmit and receive transfers run continuously over the rings in p_stream_cfg, one
+ * period at a time. When a period ends, the SSI interrupt immediately rearms the transfer on the next period, so
+ * continuity does not depend on the application.
+ *
+ * The callback is called with I2S_EVENT_TX_EMPTY after each transmit period and with I2S_EVENT_RX_FULL after each
+ * receive period. Use R_SSI_StreamWrite and R_SSI_StreamRead to move data in and out of the rings. The first transmit
+ * period is sent as silence so the application has the rest of the ring to fill before the first underrun.
+ *
+ * A transmit period that is not completely written when it starts is padded with silence and counted as an underrun. A
+ * receive period that is not read before it is overwritten is dropped and counted as an overrun.
+ *
+ * Streaming ends when R_SSI_Stop is called or when a FIFO error occurs. Write(), read() and writeRead() return
+ * FSP_ERR_IN_USE while streaming.
+ *
+ * @retval FSP_SUCCESS                 Streaming started.
+ * @retval FSP_ERR_ASSERTION           An input parameter was invalid, or the transfer instance for a ring is missing.
+ * @retval FSP_ERR_NOT_OPEN            The channel is not opened.
+ * @retval FSP_ERR_IN_USE              The SSI is not idle.
+ * @retval FSP_ERR_UNSUPPORTED         DTC support is not enabled (SSI_CFG_DTC_ENABLE).
+ * @return                             See @ref RENESAS_ERROR_CODES or functions called by this function for other
+ *                                     possible return codes. This function calls:
+ *                                         * @ref transfer_api_t::reset
+ **********************************************************************************************************************/
+fsp_err_t R_SSI_StreamStart (i2s_ctrl_t * const p_ctrl, ssi_stream_cfg_t const * const p_stream_cfg)
+{
+    ssi_instance_ctrl_t * p_instance_ctrl = (ssi_instance_ctrl_t *) p_ctrl;
+
+#if SSI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_stream_cfg);
+    FSP_ERROR_RETURN(SSI_PRV_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT((NULL != p_stream_cfg->p_tx_buffer) || (NULL != p_stream_cfg->p_rx_buffer));
+    FSP_ASSERT((NULL == p_stream_cfg->p_tx_buffer) || (NULL != p_instance_ctrl->p_cfg->p_transfer_tx));
+    FSP_ASSERT((NULL == p_stream_cfg->p_rx_buffer) || (NULL != p_instance_ctrl->p_cfg->p_transfer_rx));
+    FSP_ASSERT(p_stream_cfg->num_periods >= 2U);
+
+    /* Each period must be a whole number of transfer blocks (one frame each). */
+    uint32_t frame_bytes = SSI_PRV_TRANSFER_BLOCK_SIZE << p_instance_ctrl->fifo_access_size;
+    FSP_ASSERT(p_stream_cfg->period_bytes > 0U);
+    FSP_ASSERT(0U == (p_stream_cfg->period_bytes % frame_bytes));
+    FSP_ASSERT((p_stream_cfg->period_bytes / frame_bytes) <= UINT16_MAX);
+    FSP_ASSERT((SSI_STREAM_SAMPLE_16_BIT != p_stream_cfg->sample) ||
+               (p_instance_ctrl->p_cfg->pcm_width >= I2S_PCM_WIDTH_16_BITS));
+#endif
+
+    /* The rings are moved by the DTC, which is only configured when DTC support is enabled. */
+    FSP_ERROR_RETURN(0 != SSI_CFG_DTC_ENABLE, FSP_ERR_UNSUPPORTED);
+
+    /* The transfers can only be rearmed while the SSI is idle. */
+    FSP_ERROR_RETURN(NULL == p_instance_ctrl->p_stream_cfg, FSP_ERR_IN_USE);
+    FSP_ERROR_RETURN(0U == (p_instance_ctrl->p_reg->SSICR & SSI_PRV_SSICR_REN_TEN_MASK), FSP_ERR_IN_USE);
+    FSP_ERROR_RETURN(1U == p_instance_ctrl->p_reg->SSISR_b.IIRQ, FSP_ERR_IN_USE);
+
+    static const uint8_t pcm_width_bits[] = SSI_PRV_PCM_WIDTH_BITS;
+
+    p_instance_ctrl->stream_ring_bytes   = p_stream_cfg->period_bytes * p_stream_cfg->num_periods;
+    p_instance_ctrl->stream_pcm_shift    =
+        (uint8_t) (pcm_width_bits[p_instance_ctrl->p_cfg->pcm_width] - SSI_PRV_STREAM_SAMPLE_BITS);
+    p_instance_ctrl->stream_tx_period    = 0U;
+    p_instance_ctrl->stream_rx_period    = 0U;
+    p_instance_ctrl->stream_tx_level     = p_stream_cfg->period_bytes;
+    p_instance_ctrl->stream_rx_level     = 0U;
+    p_instance_ctrl->stream_tx_underruns = 0U;
+    p_instance_ctrl->stream_rx_overruns  = 0U;
+    p_instance_ctrl->p_stream_cfg        = p_stream_cfg;
+
+    fsp_err_t err = FSP_SUCCESS;
+    uint32_t  dir = 0U;
+    if (NULL != p_stream_cfg->p_tx_buffer)
+    {
+        /* Start with a period of silence in front of the producer. */
+        memset(p_stream_cfg->p_tx_buffer, 0, p_instance_ctrl->stream_ring_bytes);
+        err  = r_ssi_stream_arm(p_instance_ctrl, SSI_DIR_TX, 0U);
+        dir |= SSI_DIR_TX;
+    }
+
+    if ((FSP_SUCCESS == err) && (NULL != p_stream_cfg->p_rx_buffer))
+    {
+        err  = r_ssi_stream_arm(p_instance_ctrl, SSI_DIR_RX, 0U);
+        dir |= SSI_DIR_RX;
+    }
+
+    if (FSP_SUCCESS == err)
+    {
+        err = r_ssi_start(p_instance_ctrl, (ssi_dir_t) dir);
+    }
+
+    if (FSP_SUCCESS != err)
+    {
+        r_ssi_stop_sub(p_instance_ctrl);
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Copies frames from the application into the transmit ring, converting them from the sample format and channel
+ * layout in ssi_stream_cfg_t. Only the frames that fit are copied; this function never blocks.
+ *
+ * @retval FSP_SUCCESS                 *p_frames_written frames were queued. This can be less than frames, including 0
+ *                                     when the ring is full or when an underrun resynchronized the ring during the
+ *                                     copy (write the same frames again).
+ * @retval FSP_ERR_ASSERTION           An input parameter was null.
+ * @retval FSP_ERR_NOT_OPEN            The channel is not opened.
+ * @retval FSP_ERR_NOT_ENABLED         Transmit streaming is not running.
+ **********************************************************************************************************************/
+fsp_err_t R_SSI_StreamWrite (i2s_ctrl_t * const p_ctrl,
+                             void const * const p_src,
+                             uint32_t const     frames,
+                             uint32_t * const   p_frames_written)
+{
+    ssi_instance_ctrl_t * p_instance_ctrl = (ssi_instance_ctrl_t *) p_ctrl;
+
+#if SSI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_src);
+    FSP_ASSERT(NULL != p_frames_written);
+    FSP_ERROR_RETURN(SSI_PRV_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    ssi_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+    FSP_ERROR_RETURN((NULL != p_stream_cfg) && (NULL != p_stream_cfg->p_tx_buffer), FSP_ERR_NOT_ENABLED);
+
+    /* The period and level change together when a period ends, so the write offset taken here stays valid during
+     * the copy unless an underrun moves it. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    uint32_t level     = p_instance_ctrl->stream_tx_level;
+    uint32_t period    = p_instance_ctrl->stream_tx_period;
+    uint32_t underruns = p_instance_ctrl->stream_tx_underruns;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    uint32_t frame_bytes = SSI_PRV_TRANSFER_BLOCK_SIZE << p_instance_ctrl->fifo_access_size;
+    uint32_t count       = (p_instance_ctrl->stream_ring_bytes - level) / frame_bytes;
+    if (count > frames)
+    {
+        count = frames;
+    }
+
+    uint32_t offset = ((period * p_stream_cfg->period_bytes) + level) % p_instance_ctrl->stream_ring_bytes;
+    r_ssi_stream_ring_write(p_instance_ctrl, offset, p_src, count);
+
+    FSP_CRITICAL_SECTION_ENTER;
+    if (underruns == p_instance_ctrl->stream_tx_underruns)
+    {
+        p_instance_ctrl->stream_tx_level += count * frame_bytes;
+    }
+    else
+    {
+        count = 0U;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    *p_frames_written = count;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Copies received frames from the receive ring to the application, converting them to the sample format and channel
+ * layout in ssi_stream_cfg_t. Only the frames available are copied; this function never blocks.
+ *
+ * @retval FSP_SUCCESS                 *p_frames_read frames were read. This can be less than frames, including 0 when
+ *                                     the ring is empty or when an overrun dropped the oldest period during the copy
+ *                                     (the copied data is discarded, read again).
+ * @retval FSP_ERR_ASSERTION           An input parameter was null.
+ * @retval FSP_ERR_NOT_OPEN            The channel is not opened.
+ * @retval FSP_ERR_NOT_ENABLED         Receive streaming is not running.
+ **********************************************************************************************************************/
+fsp_err_t R_SSI_StreamRead (i2s_ctrl_t * const p_ctrl,
+                            void * const       p_dest,
+                            uint32_t const     frames,
+                            uint32_t * const   p_frames_read)
+{
+    ssi_instance_ctrl_t * p_instance_ctrl = (ssi_instance_ctrl_t *) p_ctrl;
+
+#if SSI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_dest);
+    FSP_ASSERT(NULL != p_frames_read);
+    FSP_ERROR_RETURN(SSI_PRV_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    ssi_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+    FSP_ERROR_RETURN((NULL != p_stream_cfg) && (NULL != p_stream_cfg->p_rx_buffer), FSP_ERR_NOT_ENABLED);
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    uint32_t level    = p_instance_ctrl->stream_rx_level;
+    uint32_t period   = p_instance_ctrl->stream_rx_period;
+    uint32_t overruns = p_instance_ctrl->stream_rx_overruns;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    uint32_t frame_bytes = SSI_PRV_TRANSFER_BLOCK_SIZE << p_instance_ctrl->fifo_access_size;
+    uint32_t count       = level / frame_bytes;
+    if (count > frames)
+    {
+        count = frames;
+    }
+
+    /* Received data ends where the period being received starts. */
+    uint32_t ring_bytes = p_instance_ctrl->stream_ring_bytes;
+    uint32_t offset     = ((period * p_stream_cfg->period_bytes) + ring_bytes - level) % ring_bytes;
+    r_ssi_stream_ring_read(p_instance_ctrl, offset, p_dest, count);
+
+    FSP_CRITICAL_SECTION_ENTER;
+    if (overruns == p_instance_ctrl->stream_rx_overruns)
+    {
+        p_instance_ctrl->stream_rx_level -= count * frame_bytes;
+    }
+    else
+    {
+        count = 0U;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    *p_frames_read = count;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the ring positions and error counters of circular streaming. The counters keep their values after streaming
+ * ends until the next call to R_SSI_StreamStart.
+ *
+ * @retval FSP_SUCCESS                 Status stored in p_status.
+ * @retval FSP_ERR_ASSERTION           An input parameter was null.
+ * @retval FSP_ERR_NOT_OPEN            The channel is not opened.
+ **********************************************************************************************************************/
+fsp_err_t R_SSI_StreamStatusGet (i2s_ctrl_t * const p_ctrl, ssi_stream_status_t * const p_status)
+{
+    ssi_instance_ctrl_t * p_instance_ctrl = (ssi_instance_ctrl_t *) p_ctrl;
+
+#if SSI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_status);
+    FSP_ERROR_RETURN(SSI_PRV_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    uint32_t frame_bytes = SSI_PRV_TRANSFER_BLOCK_SIZE << p_instance_ctrl->fifo_access_size;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    ssi_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+
+    p_status->tx_frames_free      = 0U;
+    p_status->tx_write_offset     = 0U;
+    p_status->rx_frames_available = 0U;
+    p_status->rx_read_offset      = 0U;
+    p_status->tx_underruns        = p_instance_ctrl->stream_tx_underruns;
+    p_status->rx_overruns         = p_instance_ctrl->stream_rx_overruns;
+
+    if (NULL != p_stream_cfg)
+    {
+        uint32_t ring_bytes = p_instance_ctrl->stream_ring_bytes;
+        uint32_t tx_start   = p_instance_ctrl->stream_tx_period * p_stream_cfg->period_bytes;
+        uint32_t rx_start   = p_instance_ctrl->stream_rx_period * p_stream_cfg->period_bytes;
+
+        if (NULL != p_stream_cfg->p_tx_buffer)
+        {
+            p_status->tx_frames_free  = (ring_bytes - p_instance_ctrl->stream_tx_level) / frame_bytes;
+            p_status->tx_write_offset = (tx_start + p_instance_ctrl->stream_tx_level) % ring_bytes;
+        }
+
+        if (NULL != p_stream_cfg->p_rx_buffer)
+        {
+            p_status->rx_frames_available = p_instance_ctrl->stream_rx_level / frame_bytes;
+            p_status->rx_read_offset      = (rx_start + ring_bytes - p_instance_ctrl->stream_rx_level) % ring_bytes;
+        }
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup R_SSI)
  **********************************************************************************************************************/
@@ -818,6 +1119,7 @@ static void r_ssi_stop_sub (ssi_instance_ctrl_t * const p_instance_ctrl)
     p_instance_ctrl->tx_src_samples  = 0U;
     p_instance_ctrl->p_rx_dest       = NULL;
     p_instance_ctrl->rx_dest_samples = 0U;
+    p_instance_ctrl->p_stream_cfg    = NULL;
 }
 
 /*******************************************************************************************************************//**
@@ -837,6 +1139,9 @@ fsp_err_t r_ssi_tx_load_fifo (ssi_instance_ctrl_t * const p_instance_ctrl,
                               void const * const          p_src,
                               uint32_t const              bytes)
 {
+    /* The transmit transfer belongs to the ring while streaming. */
+    FSP_ERROR_RETURN(NULL == p_instance_ctrl->p_stream_cfg, FSP_ERR_IN_USE);
+
     void   * p_data  = (void *) p_src;
     uint32_t samples = bytes >> p_instance_ctrl->fifo_access_size;
 #if SSI_CFG_DTC_ENABLE
@@ -879,6 +1184,9 @@ fsp_err_t r_ssi_tx_load_fifo (ssi_instance_ctrl_t * const p_instance_ctrl,
  **********************************************************************************************************************/
 fsp_err_t r_ssi_rx_unload_fifo (ssi_instance_ctrl_t * const p_instance_ctrl, void * const p_dest, uint32_t const bytes)
 {
+    /* The receive transfer belongs to the ring while streaming. */
+    FSP_ERROR_RETURN(NULL == p_instance_ctrl->p_stream_cfg, FSP_ERR_IN_USE);
+
     void   * p_data  = p_dest;
     uint32_t samples = bytes >> p_instance_ctrl->fifo_access_size;
 #if SSI_CFG_DTC_ENABLE
@@ -1124,6 +1432,291 @@ static void r_ssi_rx_fifo_read (ssi_instance_ctrl_t * p_instance_ctrl, uint32_t
     }
 }
 
+/*******************************************************************************************************************//**
+ * Points a streaming transfer at a period of its ring and enables it.
+ *
+ * @param[in] p_instance_ctrl          Pointer to the control block.
+ * @param[in] dir                      SSI_DIR_TX or SSI_DIR_RX.
+ * @param[in] period                   Period of the ring to transfer.
+ *
+ * @retval FSP_SUCCESS                 Transfer armed.
+ * @return                             See @ref RENESAS_ERROR_CODES or functions called by this function for other
+ *                                     possible return codes. This function calls:
+ *                                         * @ref transfer_api_t::reset
+ **********************************************************************************************************************/
+static fsp_err_t r_ssi_stream_arm (ssi_instance_ctrl_t * const p_instance_ctrl, ssi_dir_t dir, uint32_t period)
+{
+    ssi_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+    uint32_t                 offset       = period * p_stream_cfg->period_bytes;
+    uint16_t                 blocks       =
+        (uint16_t) (p_stream_cfg->period_bytes >> (p_instance_ctrl->fifo_access_size + 1U));
+
+    if (SSI_DIR_TX == dir)
+    {
+        transfer_instance_t const * p_transfer = p_instance_ctrl->p_cfg->p_transfer_tx;
+
+        return p_transfer->p_api->reset(p_transfer->p_ctrl,
+                                        (uint8_t *) p_stream_cfg->p_tx_buffer + offset,
+                                        NULL,
+                                        blocks);
+    }
+
+    transfer_instance_t const * p_transfer = p_instance_ctrl->p_cfg->p_transfer_rx;
+
+    return p_transfer->p_api->reset(p_transfer->p_ctrl, NULL, (uint8_t *) p_stream_cfg->p_rx_buffer + offset, blocks);
+}
+
+/*******************************************************************************************************************//**
+ * Returns the size of one frame in the application format.
+ *
+ * @param[in] p_instance_ctrl          Pointer to the control block.
+ **********************************************************************************************************************/
+static uint32_t r_ssi_stream_app_frame_bytes (ssi_instance_ctrl_t * const p_instance_ctrl)
+{
+    ssi_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+
+    uint32_t sample_bytes = (SSI_STREAM_SAMPLE_16_BIT == p_stream_cfg->sample) ?
+                            sizeof(uint16_t) : (1U << p_instance_ctrl->fifo_access_size);
+
+    return (SSI_STREAM_CHANNELS_MONO == p_stream_cfg->channels) ? sample_bytes : (sample_bytes * SSI_PRV_I2S_CHANNELS);
+}
+
+/*******************************************************************************************************************//**
+ * Loads a sample of the given size from a buffer.
+ *
+ * @param[in] p_buffer                 Buffer of samples.
+ * @param[in] index                    Sample index.
+ * @param[in] size                     Sample size.
+ **********************************************************************************************************************/
+static uint32_t r_ssi_stream_sample_load (void const * p_buffer, uint32_t index, transfer_size_t size)
+{
+    if (TRANSFER_SIZE_4_BYTE == size)
+    {
+        return ((uint32_t const *) p_buffer)[index];
+    }
+
+    if (TRANSFER_SIZE_2_BYTE == size)
+    {
+        return ((uint16_t const *) p_buffer)[index];
+    }
+
+    return ((uint8_t const *) p_buffer)[index];
+}
+
+/*******************************************************************************************************************//**
+ * Stores a sample of the given size to a buffer.
+ *
+ * @param[in] p_buffer                 Buffer of samples.
+ * @param[in] index                    Sample index.
+ * @param[in] size                     Sample size.
+ * @param[in] sample                   Sample to store, truncated to size.
+ **********************************************************************************************************************/
+static void r_ssi_stream_sample_store (void * p_buffer, uint32_t index, transfer_size_t size, uint32_t sample)
+{
+    if (TRANSFER_SIZE_4_BYTE == size)
+    {
+        ((uint32_t *) p_buffer)[index] = sample;
+    }
+    else if (TRANSFER_SIZE_2_BYTE == size)
+    {
+        ((uint16_t *) p_buffer)[index] = (uint16_t) sample;
+    }
+    else
+    {
+        ((uint8_t *) p_buffer)[index] = (uint8_t) sample;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Copies application frames into the transmit ring, wrapping at the end of the ring and converting to the FIFO format.
+ *
+ * @param[in] p_instance_ctrl          Pointer to the control block.
+ * @param[in] offset                   Byte offset in the ring of the first frame.
+ * @param[in] p_src                    Application frames.
+ * @param[in] frames                   Number of frames, at most the free space in the ring.
+ **********************************************************************************************************************/
+static void r_ssi_stream_ring_write (ssi_instance_ctrl_t * const p_instance_ctrl,
+                                     uint32_t                    offset,
+                                     uint8_t const             * p_src,
+                                     uint32_t                    frames)
+{
+    ssi_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+    transfer_size_t          size         = p_instance_ctrl->fifo_access_size;
+    uint32_t                 frame_bytes  = SSI_PRV_TRANSFER_BLOCK_SIZE << size;
+    uint32_t                 app_bytes    = r_ssi_stream_app_frame_bytes(p_instance_ctrl);
+    bool                     mono         = (SSI_STREAM_CHANNELS_MONO == p_stream_cfg->channels);
+
+    while (frames > 0U)
+    {
+        uint32_t chunk = (p_instance_ctrl->stream_ring_bytes - offset) / frame_bytes;
+        if (chunk > frames)
+        {
+            chunk = frames;
+        }
+
+        uint8_t * p_ring = (uint8_t *) p_stream_cfg->p_tx_buffer + offset;
+        if (app_bytes == frame_bytes)
+        {
+            /* Same format as the FIFO. */
+            memcpy(p_ring, p_src, chunk * frame_bytes);
+        }
+        else
+        {
+            for (uint32_t i = 0U; i < (chunk * SSI_PRV_I2S_CHANNELS); i++)
+            {
+                /* Mono frames send the same sample on both channels. */
+                uint32_t index = mono ? (i / SSI_PRV_I2S_CHANNELS) : i;
+                uint32_t sample;
+                if (SSI_STREAM_SAMPLE_16_BIT == p_stream_cfg->sample)
+                {
+                    int32_t value = ((int16_t const *) p_src)[index];
+                    sample = (uint32_t) value << p_instance_ctrl->stream_pcm_shift;
+                }
+                else
+                {
+                    sample = r_ssi_stream_sample_load(p_src, index, size);
+                }
+
+                r_ssi_stream_sample_store(p_ring, i, size, sample);
+            }
+        }
+
+        p_src  += chunk * app_bytes;
+        frames -= chunk;
+        offset  = 0U;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Copies frames from the receive ring to the application, wrapping at the end of the ring and converting from the FIFO
+ * format.
+ *
+ * @param[in] p_instance_ctrl          Pointer to the control block.
+ * @param[in] offset                   Byte offset in the ring of the first frame.
+ * @param[out] p_dest                  Application frames.
+ * @param[in] frames                   Number of frames, at most the frames available in the ring.
+ **********************************************************************************************************************/
+static void r_ssi_stream_ring_read (ssi_instance_ctrl_t * const p_instance_ctrl,
+                                    uint32_t                    offset,
+                                    uint8_t                   * p_dest,
+                                    uint32_t                    frames)
+{
+    ssi_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+    transfer_size_t          size         = p_instance_ctrl->fifo_access_size;
+    uint32_t                 frame_bytes  = SSI_PRV_TRANSFER_BLOCK_SIZE << size;
+    uint32_t                 app_bytes    = r_ssi_stream_app_frame_bytes(p_instance_ctrl);
+    uint32_t                 channels     =
+        (SSI_STREAM_CHANNELS_MONO == p_stream_cfg->channels) ? 1U : SSI_PRV_I2S_CHANNELS;
+
+    while (frames > 0U)
+    {
+        uint32_t chunk = (p_instance_ctrl->stream_ring_bytes - offset) / frame_bytes;
+        if (chunk > frames)
+        {
+            chunk = frames;
+        }
+
+        uint8_t const * p_ring = (uint8_t const *) p_stream_cfg->p_rx_buffer + offset;
+        if (app_bytes == frame_bytes)
+        {
+            /* Same format as the FIFO. */
+            memcpy(p_dest, p_ring, chunk * frame_bytes);
+        }
+        else
+        {
+            for (uint32_t i = 0U; i < (chunk * channels); i++)
+            {
+                /* Mono frames keep the left channel. */
+                uint32_t index  = (1U == channels) ? (i * SSI_PRV_I2S_CHANNELS) : i;
+                uint32_t sample = r_ssi_stream_sample_load(p_ring, index, size);
+                if (SSI_STREAM_SAMPLE_16_BIT == p_stream_cfg->sample)
+                {
+                    ((uint16_t *) p_dest)[i] = (uint16_t) (sample >> p_instance_ctrl->stream_pcm_shift);
+                }
+                else
+                {
+                    r_ssi_stream_sample_store(p_dest, i, size, sample);
+                }
+            }
+        }
+
+        p_dest += chunk * app_bytes;
+        frames -= chunk;
+        offset  = 0U;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Handles the end of a transmit period: rearms the transfer on the next period, frees the period that was sent and
+ * notifies the application.
+ *
+ * @param[in] p_instance_ctrl          Pointer to the control block.
+ **********************************************************************************************************************/
+static void r_ssi_stream_tx_period_complete (ssi_instance_ctrl_t * const p_instance_ctrl)
+{
+    ssi_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+    uint32_t                 period_bytes = p_stream_cfg->period_bytes;
+
+    /* Rearm first. The FIFO only holds a few frames. */
+    uint32_t period = p_instance_ctrl->stream_tx_period + 1U;
+    if (period >= p_stream_cfg->num_periods)
+    {
+        period = 0U;
+    }
+
+    (void) r_ssi_stream_arm(p_instance_ctrl, SSI_DIR_TX, period);
+    p_instance_ctrl->stream_tx_period = (uint8_t) period;
+
+    /* The level always includes the period being sent, so it is at least one period here. */
+    uint32_t level = p_instance_ctrl->stream_tx_level - period_bytes;
+    if (level < period_bytes)
+    {
+        /* The period now being sent is not completely written. Pad it with silence and continue the producer at the
+         * next period so that new data is never written behind the transfer. */
+        memset((uint8_t *) p_stream_cfg->p_tx_buffer + (period * period_bytes) + level, 0, period_bytes - level);
+        level = period_bytes;
+        p_instance_ctrl->stream_tx_underruns++;
+    }
+
+    p_instance_ctrl->stream_tx_level = level;
+
+    r_ssi_call_callback(p_instance_ctrl, I2S_EVENT_TX_EMPTY);
+}
+
+/*******************************************************************************************************************//**
+ * Handles the end of a receive period: rearms the transfer on the next period, makes the received period available and
+ * notifies the application.
+ *
+ * @param[in] p_instance_ctrl          Pointer to the control block.
+ **********************************************************************************************************************/
+static void r_ssi_stream_rx_period_complete (ssi_instance_ctrl_t * const p_instance_ctrl)
+{
+    ssi_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+    uint32_t                 period_bytes = p_stream_cfg->period_bytes;
+
+    /* Rearm first. The FIFO only holds a few frames. */
+    uint32_t period = p_instance_ctrl->stream_rx_period + 1U;
+    if (period >= p_stream_cfg->num_periods)
+    {
+        period = 0U;
+    }
+
+    (void) r_ssi_stream_arm(p_instance_ctrl, SSI_DIR_RX, period);
+    p_instance_ctrl->stream_rx_period = (uint8_t) period;
+
+    /* If unread data reaches into the period now being received, drop the oldest period. */
+    uint32_t level = p_instance_ctrl->stream_rx_level;
+    if (level > (p_instance_ctrl->stream_ring_bytes - (2U * period_bytes)))
+    {
+        level -= period_bytes;
+        p_instance_ctrl->stream_rx_overruns++;
+    }
+
+    p_instance_ctrl->stream_rx_level = level + period_bytes;
+
+    r_ssi_call_callback(p_instance_ctrl, I2S_EVENT_RX_FULL);
+}
+
 /*******************************************************************************************************************//**
  * Calls user callback.
  *
@@ -1192,17 +1785,26 @@ void ssi_txi_isr (void)
     /* Clear the IR flag in the ICU */
     R_BSP_IrqStatusClear(irq);
 
-    if (NULL != p_instance_ctrl->p_tx_src)
+    if ((NULL != p_instance_ctrl->p_stream_cfg) && (NULL != p_instance_ctrl->p_stream_cfg->p_tx_buffer))
     {
-        /* If transfer is not used, write data. */
-        r_ssi_fifo_write(p_instance_ctrl);
+        /* The DTC passes the transmit interrupt on after the last block of a ring period. */
+        r_ssi_stream_tx_period_complete(p_instance_ctrl);
     }
-
-    /* If there are more samples to write to the FIFO or the FIFO is above the watermark, don't call the callback. */
-    if ((p_instance_ctrl->tx_src_samples == 0) &&
-        (p_instance_ctrl->p_reg->SSIFSR_b.TDC > (BSP_FEATURE_SSI_FIFO_NUM_STAGES / 2U)))
+    else
     {
-        r_ssi_call_callback(p_instance_ctrl, I2S_EVENT_TX_EMPTY);
+        if (NULL != p_instance_ctrl->p_tx_src)
+        {
+            /* If transfer is not used, write data. */
+            r_ssi_fifo_write(p_instance_ctrl);
+        }
+
+        /* If there are more samples to write to the FIFO or the FIFO is above the watermark, don't call the
+         * callback. */
+        if ((p_instance_ctrl->tx_src_samples == 0) &&
+            (p_instance_ctrl->p_reg->SSIFSR_b.TDC > (BSP_FEATURE_SSI_FIFO_NUM_STAGES / 2U)))
+        {
+            r_ssi_call_callback(p_instance_ctrl, I2S_EVENT_TX_EMPTY);
+        }
     }
 
     /* Restore context if RTOS is used */
@@ -1223,23 +1825,31 @@ void ssi_rxi_isr (void)
     /* Clear the IR flag in the ICU */
     R_BSP_IrqStatusClear(irq);
 
-    bool call_callback = true;
-
-    if (NULL != p_instance_ctrl->p_rx_dest)
+    if ((NULL != p_instance_ctrl->p_stream_cfg) && (NULL != p_instance_ctrl->p_stream_cfg->p_rx_buffer))
+    {
+        /* The DTC passes the receive interrupt on after the last block of a ring period. */
+        r_ssi_stream_rx_period_complete(p_instance_ctrl);
+    }
+    else
     {
-        /* If transfer is not used, read data into the destination buffer. */
-        r_ssi_fifo_read(p_instance_ctrl);
+        bool call_callback = true;
 
-        /* If there is more space in the buffer, don't call the callback. */
-        if (p_instance_ctrl->rx_dest_samples > 0U)
+        if (NULL != p_instance_ctrl->p_rx_dest)
         {
-            call_callback = false;
+            /* If transfer is not used, read data into the destination buffer. */
+            r_ssi_fifo_read(p_instance_ctrl);
+
+            /* If there is more space in the buffer, don't call the callback. */
+            if (p_instance_ctrl->rx_dest_samples > 0U)
+            {
+                call_callback = false;
+            }
         }
-    }
 
-    if (call_callback)
-    {
-        r_ssi_call_callback(p_instance_ctrl, I2S_EVENT_RX_FULL);
+        if (call_callback)
+        {
+            r_ssi_call_callback(p_instance_ctrl, I2S_EVENT_RX_FULL);
+        }
     }
 
     /* Restore context if RTOS is used */
@@ -1264,7 +1874,8 @@ void ssi_int_isr (void)
 
     /* Clear all flags in SSISR. These bits can only be cleared after reading them as 1.  Reference section 41.4.2
      * "Status Register (SSISR)" of the RA6M3 manual R01UH0886EJ0100. */
-    uint32_t iirq_flag = p_instance_ctrl->p_reg->SSISR_b.IIRQ;
+    uint32_t ssisr     = p_instance_ctrl->p_reg->SSISR;
+    uint32_t iirq_flag = (ssisr & R_SSI0_SSISR_IIRQ_Msk) >> R_SSI0_SSISR_IIRQ_Pos;
     p_instance_ctrl->p_reg->SSISR = 0U;
 
     if (1U == iirq_flag)
@@ -1277,6 +1888,20 @@ void ssi_int_isr (void)
     }
     else
     {
+        if (NULL != p_instance_ctrl->p_stream_cfg)
+        {
+            /* A FIFO error ends streaming. Count it with the ring errors so the application sees every glitch. */
+            if (0U != (ssisr & R_SSI0_SSISR_TUIRQ_Msk))
+            {
+                p_instance_ctrl->stream_tx_underruns++;
+            }
+
+            if (0U != (ssisr & R_SSI0_SSISR_ROIRQ_Msk))
+            {
+                p_instance_ctrl->stream_rx_overruns++;
+            }
+        }
+
         if (NULL != p_instance_ctrl->p_rx_dest)
         {
             /* If there's more data to read, flush read data into the destination buffer. */
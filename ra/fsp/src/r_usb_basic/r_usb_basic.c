@@ -196,6 +196,10 @@ volatile uint16_t g_usb_usbmode[USB_NUM_USBIP] =
 #endif
 };
 
+#if BSP_CFG_PERF_COUNTERS_ENABLE
+usb_perf_t g_usb_perf[USB_NUM_USBIP];
+#endif
+
 #if defined(USB_CFG_OTG_USE)
 void (* g_p_otg_callback[USB_NUM_USBIP])(ULONG mode);
 #endif                                 /* USB_CFG_OTG_USE */
@@ -627,6 +631,8 @@ fsp_err_t R_USB_Open (usb_ctrl_t * const p_api_ctrl, usb_cfg_t const * const p_c
 
     is_init[p_ctrl->module_number] = USB_YES;
 
+    BSP_PERF_REGISTER(&g_usb_perf[p_ctrl->module_number], "r_usb_basic", p_ctrl->module_number);
+
     g_usb_open_class[p_ctrl->module_number] = 0;
 
 #if (BSP_CFG_RTOS == 0)
@@ -1049,6 +1055,8 @@ fsp_err_t R_USB_Close (usb_ctrl_t * const p_api_ctrl)
     {
         is_init[p_ctrl->module_number] = USB_NO;
 
+        BSP_PERF_UNREGISTER(&g_usb_perf[p_ctrl->module_number]);
+
         utr.ip  = p_ctrl->module_number;
         utr.ipp = usb_hstd_get_usb_ip_adr(utr.ip);
 
@@ -1290,6 +1298,8 @@ fsp_err_t R_USB_Close (usb_ctrl_t * const p_api_ctrl)
     {
         is_init[p_ctrl->module_number] = USB_NO;
 
+        BSP_PERF_UNREGISTER(&g_usb_perf[p_ctrl->module_number]);
+
         if (USB_MODE_HOST == g_usb_usbmode[p_ctrl->module_number])
         {
  #if ((USB_CFG_MODE & USB_CFG_HOST) == USB_CFG_HOST)
@@ -1696,6 +1706,8 @@ fsp_err_t R_USB_Write (usb_ctrl_t * const p_api_ctrl, uint8_t const * const p_bu
 
         if (USB_OK == err)
         {
+            BSP_PERF_COUNT(&g_usb_perf[p_ctrl->module_number], tx_frames, 1U);
+            BSP_PERF_COUNT(&g_usb_perf[p_ctrl->module_number], tx_bytes, size);
             result = FSP_SUCCESS;
         }
         else if (USB_QOVR == err)
@@ -133,6 +133,10 @@ extern uint16_t g_usb_pstd_remote_wakeup_state;        /* Result for Remote wake
 
 extern volatile uint16_t g_usb_usbmode[USB_NUM_USBIP]; /* USB mode HOST/PERI */
 
+#if BSP_CFG_PERF_COUNTERS_ENABLE
+extern usb_perf_t g_usb_perf[USB_NUM_USBIP];
+#endif
+
 #if ((USB_CFG_MODE & USB_CFG_HOST) == USB_CFG_HOST)
 extern usb_utr_t g_usb_hdata[USB_NUM_USBIP][USB_MAXPIPE_NUM + 1];
 
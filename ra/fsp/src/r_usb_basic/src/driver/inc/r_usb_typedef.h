@@ -264,6 +264,15 @@ typedef enum e_usb_class_internal
     USB_CLASS_INTERNAL_END,            ///< USB Class       19
 } usb_class_internal_t;
 
+#if BSP_CFG_PERF_COUNTERS_ENABLE
+
+/* Performance counters of one USB module (USB_IP0 or USB_IP1), see bsp_perf.h. */
+typedef struct st_usb_perf
+{
+    bsp_perf_entry_t perf;
+} usb_perf_t;
+#endif
+
 /** Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
 FSP_FOOTER
 
@@ -443,6 +443,32 @@ static void usb_call_callback (usb_instance_ctrl_t * p_ctrl)
  ******************************************************************************/
 void usb_set_event (usb_status_t event, usb_instance_ctrl_t * p_ctrl)
 {
+ #if BSP_CFG_PERF_COUNTERS_ENABLE
+    if ((USB_STATUS_READ_COMPLETE == event) || (USB_STATUS_WRITE_COMPLETE == event))
+    {
+        usb_perf_t * p_perf = &g_usb_perf[p_ctrl->module_number];
+
+        if (USB_STATUS_READ_COMPLETE == event)
+        {
+            BSP_PERF_COUNT(p_perf, rx_frames, 1U);
+            BSP_PERF_COUNT(p_perf, rx_bytes, p_ctrl->data_size);
+        }
+
+        if (FSP_ERR_USB_SIZE_OVER == p_ctrl->status)
+        {
+            BSP_PERF_COUNT(p_perf, overruns, 1U);
+        }
+        else if ((FSP_SUCCESS != p_ctrl->status) && (FSP_ERR_USB_SIZE_SHORT != p_ctrl->status))
+        {
+            BSP_PERF_COUNT(p_perf, errors, 1U);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+ #endif                                /* BSP_CFG_PERF_COUNTERS_ENABLE */
+
  #if (BSP_CFG_RTOS != 0)
     static uint16_t count = 0;
 
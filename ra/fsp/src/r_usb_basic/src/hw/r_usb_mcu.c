@@ -1073,6 +1073,7 @@ void usbfs_interrupt_handler (void)
 {
     /* Save context if RTOS is used */
     FSP_CONTEXT_SAVE
+    BSP_PERF_ISR_ENTER();
 
     IRQn_Type irq = R_FSP_CurrentIrqGet();
     R_BSP_IrqStatusClear(irq);
@@ -1082,6 +1083,8 @@ void usbfs_interrupt_handler (void)
 
     usbfs_usbi_isr();
 
+    BSP_PERF_ISR_EXIT(&g_usb_perf[USB_IP0]);
+
     /* Restore context if RTOS is used */
     FSP_CONTEXT_RESTORE
 }
@@ -1090,6 +1093,7 @@ void usbfs_resume_handler (void)
 {
     /* Save context if RTOS is used */
     FSP_CONTEXT_SAVE
+    BSP_PERF_ISR_ENTER();
 
     IRQn_Type irq = R_FSP_CurrentIrqGet();
     R_BSP_IrqStatusClear(irq);
@@ -1101,6 +1105,8 @@ void usbfs_resume_handler (void)
     usb_cpu_usb_int_hand_isr(p_cfg->module_number);
 #endif                                 /* ((USB_CFG_MODE & USB_CFG_PERI) == USB_CFG_PERI) */
 
+    BSP_PERF_ISR_EXIT(&g_usb_perf[USB_IP0]);
+
     /* Restore context if RTOS is used */
     FSP_CONTEXT_RESTORE
 }
@@ -1109,6 +1115,7 @@ void usbfs_d0fifo_handler (void)
 {
     /* Save context if RTOS is used */
     FSP_CONTEXT_SAVE
+    BSP_PERF_ISR_ENTER();
 
     IRQn_Type irq = R_FSP_CurrentIrqGet();
     R_BSP_IrqStatusClear(irq);
@@ -1117,6 +1124,8 @@ void usbfs_d0fifo_handler (void)
     usb_cpu_d0fifo_int_hand();
 #endif                                 /* USB_CFG_DTC == USB_CFG_ENABLE */
 
+    BSP_PERF_ISR_EXIT(&g_usb_perf[USB_IP0]);
+
     /* Restore context if RTOS is used */
     FSP_CONTEXT_RESTORE
 }
@@ -1125,6 +1134,7 @@ void usbfs_d1fifo_handler (void)
 {
     /* Save context if RTOS is used */
     FSP_CONTEXT_SAVE
+    BSP_PERF_ISR_ENTER();
 
     IRQn_Type irq = R_FSP_CurrentIrqGet();
     R_BSP_IrqStatusClear(irq);
@@ -1133,6 +1143,8 @@ void usbfs_d1fifo_handler (void)
     usb_cpu_d1fifo_int_hand();
 #endif                                 /* USB_CFG_DTC == USB_CFG_ENABLE */
 
+    BSP_PERF_ISR_EXIT(&g_usb_perf[USB_IP0]);
+
     /* Restore context if RTOS is used */
     FSP_CONTEXT_RESTORE
 }
@@ -1141,12 +1153,17 @@ void usbhs_interrupt_handler (void)
 {
     /* Save context if RTOS is used */
     FSP_CONTEXT_SAVE
+#if defined(USB_HIGH_SPEED_MODULE)
+    BSP_PERF_ISR_ENTER();
+#endif                                 /* defined(USB_HIGH_SPEED_MODULE) */
 
     IRQn_Type irq = R_FSP_CurrentIrqGet();
     R_BSP_IrqStatusClear(irq);
 
 #if defined(USB_HIGH_SPEED_MODULE)
     usbhs_usbir_isr();
+
+    BSP_PERF_ISR_EXIT(&g_usb_perf[USB_IP1]);
 #endif                                 /* defined  (USB_HIGH_SPEED_MODULE) */
 
     /* Restore context if RTOS is used */
@@ -1157,6 +1174,9 @@ void usbhs_d0fifo_handler (void)
 {
     /* Save context if RTOS is used */
     FSP_CONTEXT_SAVE
+#if defined(USB_HIGH_SPEED_MODULE)
+    BSP_PERF_ISR_ENTER();
+#endif                                 /* defined(USB_HIGH_SPEED_MODULE) */
 
     IRQn_Type irq = R_FSP_CurrentIrqGet();
     R_BSP_IrqStatusClear(irq);
@@ -1167,6 +1187,10 @@ void usbhs_d0fifo_handler (void)
  #endif                                /* defined (USB_HIGH_SPEED_MODULE) */
 #endif                                 /* USB_CFG_DTC == USB_CFG_ENABLE */
 
+#if defined(USB_HIGH_SPEED_MODULE)
+    BSP_PERF_ISR_EXIT(&g_usb_perf[USB_IP1]);
+#endif                                 /* defined(USB_HIGH_SPEED_MODULE) */
+
     /* Restore context if RTOS is used */
     FSP_CONTEXT_RESTORE
 }
@@ -1175,6 +1199,9 @@ void usbhs_d1fifo_handler (void)
 {
     /* Save context if RTOS is used */
     FSP_CONTEXT_SAVE
+#if defined(USB_HIGH_SPEED_MODULE)
+    BSP_PERF_ISR_ENTER();
+#endif                                 /* defined(USB_HIGH_SPEED_MODULE) */
 
     IRQn_Type irq = R_FSP_CurrentIrqGet();
     R_BSP_IrqStatusClear(irq);
@@ -1185,6 +1212,10 @@ void usbhs_d1fifo_handler (void)
  #endif                                /* defined (USB_HIGH_SPEED_MODULE) */
 #endif                                 /* USB_CFG_DTC == USB_CFG_ENABLE */
 
+#if defined(USB_HIGH_SPEED_MODULE)
+    BSP_PERF_ISR_EXIT(&g_usb_perf[USB_IP1]);
+#endif                                 /* defined(USB_HIGH_SPEED_MODULE) */
+
     /* Restore context if RTOS is used */
     FSP_CONTEXT_RESTORE
 }
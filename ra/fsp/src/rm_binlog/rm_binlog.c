@@ -0,0 +1,540 @@
+/***********************************************************************************************************************
+ * Copyright [2020-2024] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include <stdio.h>
+#include "rm_binlog.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* "BLOG" in ASCII, used to determine if the module is open. */
+#define RM_BINLOG_OPEN                      (0x424C4F47U)
+
+/* Size of the message ring in 32-bit words. Must be a power of 2. A message takes 3 words plus one per argument. */
+#ifndef RM_BINLOG_CFG_WORDS
+ #define RM_BINLOG_CFG_WORDS                (1024U)
+#endif
+
+#if (RM_BINLOG_CFG_WORDS < 16U) || (0U != (RM_BINLOG_CFG_WORDS & (RM_BINLOG_CFG_WORDS - 1U)))
+ #error "RM_BINLOG_CFG_WORDS must be a power of 2 and at least 16."
+#endif
+
+/* The timestamp source defaults to the DWT cycle counter. MCUs without CYCCNT must supply a free running 32-bit
+ * counter, for example a GPT counter register. */
+#ifndef RM_BINLOG_CFG_TIMESTAMP_GET
+ #if BSP_FEATURE_DWT_CYCCNT
+  #define RM_BINLOG_CFG_TIMESTAMP_GET()    (DWT->CYCCNT)
+  #define RM_BINLOG_PRV_USE_CYCCNT         (1)
+ #else
+  #error "This MCU has no DWT CYCCNT. Define RM_BINLOG_CFG_TIMESTAMP_GET() and RM_BINLOG_CFG_TIMESTAMP_HZ."
+ #endif
+#endif
+
+#ifndef RM_BINLOG_PRV_USE_CYCCNT
+ #define RM_BINLOG_PRV_USE_CYCCNT           (0)
+#endif
+
+#ifndef RM_BINLOG_CFG_TIMESTAMP_HZ
+ #define RM_BINLOG_CFG_TIMESTAMP_HZ         (SystemCoreClock)
+#endif
+
+#define RM_BINLOG_WORD_MASK                 (RM_BINLOG_CFG_WORDS - 1U)
+
+/* Words stored in front of the arguments of every message: header, timestamp and format. */
+#define RM_BINLOG_MESSAGE_WORDS             (3U)
+#define RM_BINLOG_MESSAGE_MAX_WORDS         (RM_BINLOG_MESSAGE_WORDS + RM_BINLOG_MAX_ARGS)
+
+/* Set in the header word of a message in the ring once all of its words are written. */
+#define RM_BINLOG_HEADER_COMMITTED          (0x80000000U)
+#define RM_BINLOG_HEADER_COUNT_MASK         (0xFFU)
+
+/* ARMv6-M has no exclusive load and store instructions. Space is claimed with interrupts masked instead. */
+#if defined(__CORE_CM0PLUS_H_GENERIC)
+ #define RM_BINLOG_PRV_USE_EXCLUSIVE        (0)
+#else
+ #define RM_BINLOG_PRV_USE_EXCLUSIVE        (1)
+#endif
+
+/* Words sent per messages frame. Keeps each write to the sink at 512 bytes of payload or less. */
+#define RM_BINLOG_FRAME_WORDS               (128U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/* Log state. There is only one instance so messages can be recorded from any module without passing a handle. */
+typedef struct st_rm_binlog_ctrl
+{
+    uint32_t                 open;
+    bsp_sink_t const       * p_sink;            // Destination used by RM_BINLOG_Flush
+    volatile uint32_t        head;              // Free running word index of the next space to claim
+    volatile uint32_t        tail;              // Free running word index of the oldest message not read yet
+    volatile uint32_t        dropped;           // Messages dropped because the ring was full
+    uint32_t                 dropped_reported;  // Value of dropped when the last info frame was written
+    uint32_t                 peak;              // Highest number of words in use
+    uint32_t                 frame[RM_BINLOG_FRAME_WORDS];
+    volatile uint32_t        ring[RM_BINLOG_CFG_WORDS];
+} rm_binlog_ctrl_t;
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static uint32_t  rm_binlog_message_read(uint32_t position, uint32_t end, uint32_t * p_words);
+static void      rm_binlog_release(uint32_t end);
+static fsp_err_t rm_binlog_frame_write(rm_binlog_frame_type_t type, void const * p_payload, uint32_t length);
+
+#if RM_BINLOG_PRV_USE_EXCLUSIVE
+static void rm_binlog_dropped_increment(void);
+
+#endif
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/* Kept in RAM where a debugger or crash handler can dump it directly. */
+static rm_binlog_ctrl_t g_rm_binlog;
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_BINLOG
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Clears the message ring, enables the timestamp counter and stores the sink used by RM_BINLOG_Flush. Messages are
+ * recorded from this point on.
+ *
+ * Messages are recorded with the RM_BINLOG_0 to RM_BINLOG_4 macros. Set BSP_CFG_BINLOG_ENABLE to 1 to also record
+ * FSP_LOG_PRINT messages from FSP modules. p_sink can be NULL when messages are only read with
+ * RM_BINLOG_MessageGet. To capture frames in RAM, use RM_BINLOG_MemorySinkWrite with a rm_binlog_memory_sink_t
+ * context.
+ *
+ * @retval FSP_SUCCESS                 Log opened.
+ * @retval FSP_ERR_ASSERTION           p_sink is not NULL but p_sink->p_write is NULL.
+ * @retval FSP_ERR_ALREADY_OPEN        Log is already open.
+ **********************************************************************************************************************/
+fsp_err_t RM_BINLOG_Open (bsp_sink_t const * const p_sink)
+{
+#if RM_BINLOG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT((NULL == p_sink) || (NULL != p_sink->p_write));
+    FSP_ERROR_RETURN(RM_BINLOG_OPEN != g_rm_binlog.open, FSP_ERR_ALREADY_OPEN);
+#endif
+
+    memset(&g_rm_binlog, 0, sizeof(g_rm_binlog));
+    g_rm_binlog.p_sink = p_sink;
+
+#if RM_BINLOG_PRV_USE_CYCCNT
+    R_BSP_CycleCounterEnable();
+#endif
+
+    g_rm_binlog.open = RM_BINLOG_OPEN;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Writes an info frame and all messages recorded before the call to the sink. Messages recorded while the flush is in
+ * progress are left for the next call, so a flush always finishes even when messages arrive faster than the sink can
+ * take them. Messages and dropped counts are only removed once the sink accepted them, so after a sink error they are
+ * written by the next call.
+ *
+ * Call from a low priority task. Only one task may read messages, with either this function or RM_BINLOG_MessageGet.
+ *
+ * @retval FSP_SUCCESS                 Data written to the sink.
+ * @retval FSP_ERR_ASSERTION           The log was opened without a sink.
+ * @retval FSP_ERR_NOT_OPEN            Log is not open.
+ * @return See @ref RENESAS_ERROR_CODES or the sink write function for other possible return codes.
+ **********************************************************************************************************************/
+fsp_err_t RM_BINLOG_Flush (void)
+{
+#if RM_BINLOG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ERROR_RETURN(RM_BINLOG_OPEN == g_rm_binlog.open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT(NULL != g_rm_binlog.p_sink);
+#endif
+
+    uint32_t end     = g_rm_binlog.head;
+    uint32_t dropped = g_rm_binlog.dropped;
+
+    rm_binlog_frame_info_t info =
+    {
+        .timestamp_hz = RM_BINLOG_CFG_TIMESTAMP_HZ,
+        .timestamp    = RM_BINLOG_CFG_TIMESTAMP_GET(),
+        .dropped      = dropped - g_rm_binlog.dropped_reported,
+        .reserved     = 0U,
+    };
+
+    fsp_err_t err = rm_binlog_frame_write(RM_BINLOG_FRAME_TYPE_INFO, &info, sizeof(info));
+    if (FSP_SUCCESS == err)
+    {
+        g_rm_binlog.dropped_reported = dropped;
+    }
+
+    bool more = true;
+    while ((FSP_SUCCESS == err) && more)
+    {
+        /* Fill a frame with whole messages. */
+        uint32_t position = g_rm_binlog.tail;
+        uint32_t used     = 0U;
+        uint32_t words;
+        do
+        {
+            words     = rm_binlog_message_read(position, end, &g_rm_binlog.frame[used]);
+            position += words;
+            used     += words;
+        } while ((0U != words) && (used <= (RM_BINLOG_FRAME_WORDS - RM_BINLOG_MESSAGE_MAX_WORDS)));
+
+        more = (0U != words);
+        if (used > 0U)
+        {
+            /* Messages stay in the ring until the sink has taken them, so a failed write loses nothing. */
+            err = rm_binlog_frame_write(RM_BINLOG_FRAME_TYPE_MESSAGES, g_rm_binlog.frame, used * sizeof(uint32_t));
+            if (FSP_SUCCESS == err)
+            {
+                rm_binlog_release(position);
+            }
+        }
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Removes the oldest message from the ring so it can be formatted on the target, for example with
+ * RM_BINLOG_MessageFormat.
+ *
+ * Call from a low priority task. Only one task may read messages, with either this function or RM_BINLOG_Flush.
+ *
+ * @retval FSP_SUCCESS                 Message copied to p_message.
+ * @retval FSP_ERR_ASSERTION           p_message is NULL.
+ * @retval FSP_ERR_NOT_OPEN            Log is not open.
+ * @retval FSP_ERR_NOT_FOUND           No complete message is available.
+ **********************************************************************************************************************/
+fsp_err_t RM_BINLOG_MessageGet (rm_binlog_message_t * const p_message)
+{
+#if RM_BINLOG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_message);
+    FSP_ERROR_RETURN(RM_BINLOG_OPEN == g_rm_binlog.open, FSP_ERR_NOT_OPEN);
+#endif
+
+    uint32_t words[RM_BINLOG_MESSAGE_MAX_WORDS];
+    uint32_t tail  = g_rm_binlog.tail;
+    uint32_t count = rm_binlog_message_read(tail, g_rm_binlog.head, words);
+    FSP_ERROR_RETURN(0U != count, FSP_ERR_NOT_FOUND);
+    rm_binlog_release(tail + count);
+
+    p_message->argument_count = words[0];
+    p_message->timestamp      = words[1];
+    p_message->p_format       = (char const *) words[2];
+    for (uint32_t i = 0U; i < RM_BINLOG_MAX_ARGS; i++)
+    {
+        p_message->arguments[i] = (i < words[0]) ? words[RM_BINLOG_MESSAGE_WORDS + i] : 0U;
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Formats a message read with RM_BINLOG_MessageGet into a NUL terminated string. Arguments are passed to snprintf as
+ * 32-bit words: 64-bit and floating point conversions are not supported, and %s arguments must point to strings that
+ * are still valid when the message is formatted. The format string must be in memory, which is not the case when
+ * RM_BINLOG_CFG_FORMAT_SECTION places the strings in a section that is not loaded.
+ *
+ * @retval FSP_SUCCESS                 Message formatted. Output longer than the buffer is truncated.
+ * @retval FSP_ERR_ASSERTION           p_message, p_message->p_format or p_buffer is NULL, or size is 0.
+ * @retval FSP_ERR_INVALID_ARGUMENT    The format string could not be processed.
+ **********************************************************************************************************************/
+fsp_err_t RM_BINLOG_MessageFormat (rm_binlog_message_t const * const p_message, char * const p_buffer, uint32_t size)
+{
+#if RM_BINLOG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_message);
+    FSP_ASSERT(NULL != p_message->p_format);
+    FSP_ASSERT(NULL != p_buffer);
+    FSP_ASSERT(0U != size);
+#endif
+
+    /* Unused trailing arguments are ignored by snprintf. */
+    int length = snprintf(p_buffer,
+                          size,
+                          p_message->p_format,
+                          p_message->arguments[0],
+                          p_message->arguments[1],
+                          p_message->arguments[2],
+                          p_message->arguments[3]);
+    FSP_ERROR_RETURN(length >= 0, FSP_ERR_INVALID_ARGUMENT);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the number of dropped messages and the ring usage.
+ *
+ * @retval FSP_SUCCESS                 Status copied to p_status.
+ * @retval FSP_ERR_ASSERTION           p_status is NULL.
+ * @retval FSP_ERR_NOT_OPEN            Log is not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_BINLOG_StatusGet (rm_binlog_status_t * const p_status)
+{
+#if RM_BINLOG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_status);
+    FSP_ERROR_RETURN(RM_BINLOG_OPEN == g_rm_binlog.open, FSP_ERR_NOT_OPEN);
+#endif
+
+    uint32_t tail = g_rm_binlog.tail;
+    p_status->dropped = g_rm_binlog.dropped;
+    p_status->used    = g_rm_binlog.head - tail;
+    p_status->peak    = g_rm_binlog.peak;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Closes the log. Messages recorded after this call are discarded without being counted.
+ *
+ * @retval FSP_SUCCESS                 Log closed.
+ * @retval FSP_ERR_NOT_OPEN            Log is not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_BINLOG_Close (void)
+{
+#if RM_BINLOG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ERROR_RETURN(RM_BINLOG_OPEN == g_rm_binlog.open, FSP_ERR_NOT_OPEN);
+#endif
+
+    g_rm_binlog.open = 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Sink write function that appends log data to a RAM buffer described by rm_binlog_memory_sink_t. The buffer can be
+ * read by a debugger or saved by the application and decoded on the host.
+ *
+ * @retval FSP_SUCCESS                 Data appended.
+ * @retval FSP_ERR_ASSERTION           p_context is NULL.
+ * @retval FSP_ERR_OVERFLOW            The buffer is full. Nothing was written.
+ **********************************************************************************************************************/
+fsp_err_t RM_BINLOG_MemorySinkWrite (void * p_context, uint8_t const * p_data, uint32_t bytes)
+{
+    rm_binlog_memory_sink_t * p_sink = (rm_binlog_memory_sink_t *) p_context;
+
+#if RM_BINLOG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_sink);
+#endif
+    FSP_ERROR_RETURN(bytes <= (p_sink->size - p_sink->used), FSP_ERR_OVERFLOW);
+
+    memcpy(&p_sink->p_buffer[p_sink->used], p_data, bytes);
+    p_sink->used += bytes;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_BINLOG)
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Records one message. Called by the RM_BINLOG_n macros from tasks and ISRs at any priority.
+ *
+ * Space is claimed with an exclusive load and store of the head index, so writers never mask interrupts or wait for
+ * each other or the reader. An exception between the load and the store clears the exclusive monitor and the claim is
+ * retried, which also keeps messages in timestamp order. On ARMv6-M the claim masks interrupts for a few instructions.
+ * The message becomes visible to the reader when its header word is written last. When the ring is full the message is
+ * dropped and counted.
+ *
+ * @param[in] p_format  Format string. Its address identifies the message.
+ * @param[in] count     Number of arguments. Arguments beyond RM_BINLOG_MAX_ARGS are ignored.
+ * @param[in] p_args    Arguments.
+ **********************************************************************************************************************/
+void rm_binlog_write (char const * p_format, uint32_t count, uint32_t const * p_args)
+{
+    if (RM_BINLOG_OPEN != g_rm_binlog.open)
+    {
+        return;
+    }
+
+    count = (count > RM_BINLOG_MAX_ARGS) ? RM_BINLOG_MAX_ARGS : count;
+
+    uint32_t words = RM_BINLOG_MESSAGE_WORDS + count;
+    uint32_t head;
+    uint32_t timestamp;
+    uint32_t used;
+
+#if RM_BINLOG_PRV_USE_EXCLUSIVE
+    do
+    {
+        head      = __LDREXW(&g_rm_binlog.head);
+        timestamp = RM_BINLOG_CFG_TIMESTAMP_GET();
+        used      = (head + words) - g_rm_binlog.tail;
+        if (used > RM_BINLOG_CFG_WORDS)
+        {
+            __CLREX();
+            rm_binlog_dropped_increment();
+
+            return;
+        }
+    } while (0U != __STREXW(head + words, &g_rm_binlog.head));
+#else
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    head      = g_rm_binlog.head;
+    timestamp = RM_BINLOG_CFG_TIMESTAMP_GET();
+    used      = (head + words) - g_rm_binlog.tail;
+    if (used > RM_BINLOG_CFG_WORDS)
+    {
+        g_rm_binlog.dropped++;
+        __set_PRIMASK(primask);
+
+        return;
+    }
+
+    g_rm_binlog.head = head + words;
+    __set_PRIMASK(primask);
+#endif
+
+    /* Statistics only. A concurrent writer can lose an update, which makes the peak slightly low at worst. */
+    if (used > g_rm_binlog.peak)
+    {
+        g_rm_binlog.peak = used;
+    }
+
+    g_rm_binlog.ring[(head + 1U) & RM_BINLOG_WORD_MASK] = timestamp;
+    g_rm_binlog.ring[(head + 2U) & RM_BINLOG_WORD_MASK] = (uint32_t) p_format;
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        g_rm_binlog.ring[(head + RM_BINLOG_MESSAGE_WORDS + i) & RM_BINLOG_WORD_MASK] = p_args[i];
+    }
+
+    /* Commit the message after its contents. */
+    __DMB();
+    g_rm_binlog.ring[head & RM_BINLOG_WORD_MASK] = RM_BINLOG_HEADER_COMMITTED | count;
+}
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Copies the message at position out of the ring. The space stays claimed until it is freed with rm_binlog_release.
+ * Only one reader may call this function.
+ *
+ * @param[in]  position Word index of the message, at or after the tail.
+ * @param[in]  end      Head index at which to stop reading.
+ * @param[out] p_words  Destination with room for RM_BINLOG_MESSAGE_MAX_WORDS words. The header word is replaced by
+ *                      the argument count.
+ *
+ * @return Number of words copied. 0 if the ring is empty up to end or the message is still being written.
+ **********************************************************************************************************************/
+static uint32_t rm_binlog_message_read (uint32_t position, uint32_t end, uint32_t * p_words)
+{
+    if (position == end)
+    {
+        return 0U;
+    }
+
+    /* A writer that claimed this space was interrupted before committing. Messages after it are read once it is done. */
+    uint32_t header = g_rm_binlog.ring[position & RM_BINLOG_WORD_MASK];
+    if (0U == (header & RM_BINLOG_HEADER_COMMITTED))
+    {
+        return 0U;
+    }
+
+    __DMB();
+
+    uint32_t count = header & RM_BINLOG_HEADER_COUNT_MASK;
+    uint32_t words = RM_BINLOG_MESSAGE_WORDS + count;
+    for (uint32_t i = 0U; i < words; i++)
+    {
+        p_words[i] = g_rm_binlog.ring[(position + i) & RM_BINLOG_WORD_MASK];
+    }
+
+    p_words[0] = count;
+
+    return words;
+}
+
+/*******************************************************************************************************************//**
+ * Frees the space of the messages from the tail up to end. The words are cleared before the space is released so an
+ * uncommitted header always reads as 0.
+ *
+ * @param[in]  end      Word index following the last message to free.
+ **********************************************************************************************************************/
+static void rm_binlog_release (uint32_t end)
+{
+    for (uint32_t i = g_rm_binlog.tail; i != end; i++)
+    {
+        g_rm_binlog.ring[i & RM_BINLOG_WORD_MASK] = 0U;
+    }
+
+    /* Release the space only after it is cleared. */
+    __DMB();
+    g_rm_binlog.tail = end;
+}
+
+#if RM_BINLOG_PRV_USE_EXCLUSIVE
+
+/*******************************************************************************************************************//**
+ * Counts a dropped message without masking interrupts.
+ **********************************************************************************************************************/
+static void rm_binlog_dropped_increment (void)
+{
+    uint32_t dropped;
+    do
+    {
+        dropped = __LDREXW(&g_rm_binlog.dropped);
+    } while (0U != __STREXW(dropped + 1U, &g_rm_binlog.dropped));
+}
+
+#endif
+
+/*******************************************************************************************************************//**
+ * Writes one frame header and its payload to the sink.
+ *
+ * @param[in] type       Frame type.
+ * @param[in] p_payload  Frame payload.
+ * @param[in] length     Payload length in bytes.
+ *
+ * @return See the sink write function.
+ **********************************************************************************************************************/
+static fsp_err_t rm_binlog_frame_write (rm_binlog_frame_type_t type, void const * p_payload, uint32_t length)
+{
+    bsp_sink_t const * p_sink = g_rm_binlog.p_sink;
+    rm_binlog_frame_header_t header =
+    {
+        .magic   = RM_BINLOG_FRAME_MAGIC,
+        .type    = (uint8_t) type,
+        .version = RM_BINLOG_FRAME_VERSION,
+        .length  = (uint16_t) length,
+    };
+
+    fsp_err_t err = p_sink->p_write(p_sink->p_context, (uint8_t const *) &header, sizeof(header));
+    if (FSP_SUCCESS == err)
+    {
+        err = p_sink->p_write(p_sink->p_context, (uint8_t const *) p_payload, length);
+    }
+
+    return err;
+}
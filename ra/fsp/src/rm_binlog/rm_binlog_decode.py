@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+#
+# Decodes the frames written by rm_binlog (RM_BINLOG_Flush) and prints the messages. Format strings are looked up in the
+# ELF file of the build that produced the log, because the target only records their addresses.
+#
+# Usage:
+#   python rm_binlog_decode.py log.bin app.elf [--csv messages.csv]
+#
+# The input is the raw byte stream sent to the sink: an RTT capture, a UART capture or a memory dump of the buffer used
+# with RM_BINLOG_MemorySinkWrite. Several flushes can be concatenated.
+
+import argparse
+import re
+import struct
+import sys
+
+FRAME_MAGIC = 0x474F4C42
+FRAME_VERSION = 1
+
+FRAME_TYPE_INFO = 1
+FRAME_TYPE_MESSAGES = 2
+
+HEADER = struct.Struct('<IBBH')
+INFO = struct.Struct('<IIII')
+MESSAGE = struct.Struct('<III')
+
+ARGUMENT_COUNT_MASK = 0xFF
+
+# printf conversion: flags, width, precision, length modifier and conversion character.
+CONVERSION = re.compile(r'%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d+))?(hh|h|ll|l|j|z|t|L)?([diouxXcspfFeEgGaA%])')
+
+SHT_NOBITS = 8
+
+
+class Elf:
+    """Minimal ELF32 little endian reader that returns the bytes stored at a target address."""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self.data = f.read()
+        if self.data[:4] != b'\x7fELF' or self.data[4] != 1 or self.data[5] != 1:
+            raise ValueError('%s is not a 32-bit little endian ELF file' % path)
+        shoff, = struct.unpack_from('<I', self.data, 0x20)
+        shentsize, shnum = struct.unpack_from('<HH', self.data, 0x2E)
+        self.sections = []
+        for index in range(shnum):
+            _, sh_type, _, addr, offset, size = struct.unpack_from('<IIIIII', self.data, shoff + index * shentsize)
+
+            # Sections that are not allocated (for example ones marked (INFO) in the linker script) are included so
+            # format strings can be kept out of flash.
+            if sh_type != SHT_NOBITS and addr != 0 and size != 0:
+                self.sections.append((addr, offset, size))
+
+    def string(self, address):
+        for addr, offset, size in self.sections:
+            if addr <= address < addr + size:
+                start = offset + address - addr
+                end = self.data.find(b'\0', start, offset + size)
+                if end < 0:
+                    end = offset + size
+                return self.data[start:end].decode('utf-8', 'replace')
+        return None
+
+
+def read_frames(data):
+    """Yields (type, payload) for every frame, skipping bytes that do not start a valid frame."""
+    magic = struct.pack('<I', FRAME_MAGIC)
+    offset = 0
+    while True:
+        offset = data.find(magic, offset)
+        if offset < 0 or offset + HEADER.size > len(data):
+            return
+        _, frame_type, version, length = HEADER.unpack_from(data, offset)
+        end = offset + HEADER.size + length
+        if version != FRAME_VERSION or end > len(data):
+            offset += 1
+            continue
+        yield frame_type, data[offset + HEADER.size:end]
+        offset = end
+
+
+def format_message(elf, fmt, args):
+    """Applies 32-bit arguments to a C format string."""
+    pending = list(args)
+
+    def take():
+        return pending.pop(0) if pending else None
+
+    def replace(match):
+        flags, width, precision, _, conversion = match.groups()
+        if conversion == '%':
+            return '%'
+        if width == '*':
+            value = take()
+            width = str(value if value is not None else 0)
+        if precision == '*':
+            value = take()
+            precision = str(value if value is not None else 0)
+        spec = '%' + flags + (width or '') + ('.' + precision if precision is not None else '')
+
+        value = take()
+        if value is None:
+            return '<missing>'
+        if conversion in 'di':
+            return (spec + 'd') % (value - (1 << 32) if value & 0x80000000 else value)
+        if conversion == 'u':
+            return (spec + 'd') % value
+        if conversion in 'oxX':
+            return (spec + conversion) % value
+        if conversion == 'c':
+            return (spec + 'c') % chr(value & 0xFF)
+        if conversion == 'p':
+            return '0x%08x' % value
+        if conversion == 's':
+            text = elf.string(value)
+            return (spec + 's') % (text if text is not None else '<0x%08x>' % value)
+
+        # Floating point values do not fit the 32-bit arguments recorded by the target.
+        return '<0x%08x>' % value
+
+    return CONVERSION.sub(replace, fmt)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode rm_binlog data.')
+    parser.add_argument('input', help='binary log data written by the sink')
+    parser.add_argument('elf', help='ELF file of the build that wrote the log')
+    parser.add_argument('--csv', help='also write the messages to this CSV file')
+    args = parser.parse_args()
+
+    with open(args.input, 'rb') as f:
+        data = f.read()
+    elf = Elf(args.elf)
+
+    hz = 0
+    last_raw = None
+    now = 0
+    first = None
+    rows = []
+    dropped_total = 0
+
+    for frame_type, payload in read_frames(data):
+        if frame_type == FRAME_TYPE_INFO and len(payload) >= INFO.size:
+            hz, _, dropped, _ = INFO.unpack_from(payload)
+            if dropped:
+                dropped_total += dropped
+                rows.append((now, '[%d messages dropped]' % dropped))
+        elif frame_type == FRAME_TYPE_MESSAGES:
+            offset = 0
+            while offset + MESSAGE.size <= len(payload):
+                header, timestamp, address = MESSAGE.unpack_from(payload, offset)
+                count = header & ARGUMENT_COUNT_MASK
+                offset += MESSAGE.size
+                if offset + 4 * count > len(payload):
+                    break
+                values = struct.unpack_from('<%dI' % count, payload, offset)
+                offset += 4 * count
+
+                # Timestamps are free running 32-bit counters. Consecutive messages must be less than one wrap apart.
+                if last_raw is not None:
+                    now += (timestamp - last_raw) & 0xFFFFFFFF
+                last_raw = timestamp
+                if first is None:
+                    first = now
+
+                fmt = elf.string(address)
+                if fmt is None:
+                    text = ' '.join(['<unknown format 0x%08x>' % address] + ['0x%08x' % v for v in values])
+                else:
+                    text = format_message(elf, fmt, values).rstrip('\r\n')
+                rows.append((now, text))
+
+    unit = 'us' if hz else 'cycles'
+    base = first or 0
+    for when, text in rows:
+        elapsed = (when - base) * 1e6 / hz if hz else float(when - base)
+        print('%14.1f %s  %s' % (elapsed, unit, text))
+    if dropped_total:
+        print('%d messages dropped in total' % dropped_total, file=sys.stderr)
+
+    if args.csv:
+        with open(args.csv, 'w') as f:
+            f.write('time_%s,message\n' % unit)
+            for when, text in rows:
+                elapsed = (when - base) * 1e6 / hz if hz else float(when - base)
+                f.write('%.3f,"%s"\n' % (elapsed, text.replace('"', '""')))
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -37,13 +37,21 @@
 /***********************************************************************************************************************
  * Private function prototypes
  **********************************************************************************************************************/
+static void     rm_cellular_comm_uart_aws_read_arm(rm_cellular_comm_uart_aws_instance_ctrl_t * p_instance_ctrl);
+static void     rm_cellular_comm_uart_aws_read_harvest(rm_cellular_comm_uart_aws_instance_ctrl_t * p_instance_ctrl);
+static uint32_t rm_cellular_comm_uart_aws_ring_copy(rm_cellular_comm_uart_aws_instance_ctrl_t * p_instance_ctrl,
+                                                    uint8_t                                   * p_dest,
+                                                    uint32_t                                    length);
 
 /***********************************************************************************************************************
  * Global Variables
  **********************************************************************************************************************/
 
 /*******************************************************************************************************************//**
- * Callback for UART driver
+ * Callback for UART driver. Received data is collected in the rx_buffer ring. The first byte of a burst arrives with
+ * UART_EVENT_RX_CHAR, after which a lower level read is armed so the rest of the burst is moved into the ring by the
+ * UART driver (DTC when enabled). The cellular library is notified once at the start of a burst and once each time
+ * RM_CELLULAR_COMM_UART_AWS_RECEIVE_CLUSTER_BYTE_COUNT bytes have been collected, instead of once per byte.
  *
  * @param[in]     p_args  Arguments from UART RX/TX callback
  **********************************************************************************************************************/
@@ -52,39 +60,31 @@ void comm_uart_aws_callback (uart_callback_args_t * p_args)
     BaseType_t xHigherPriorityTaskWoken = pdFALSE; // Initialized to pdFALSE.
     rm_cellular_comm_uart_aws_instance_ctrl_t * p_instance_ctrl =
         (rm_cellular_comm_uart_aws_instance_ctrl_t *) p_args->p_context;
-    uart_instance_t * p_uart_instance = p_instance_ctrl->p_lower_level_instance;
 
     switch (p_args->event)
     {
         case UART_EVENT_RX_CHAR:
         {
-            uint8_t data_byte = (uint8_t) p_args->data;
-
-            if (NULL == p_instance_ctrl->p_recv_buffer)
-            {
-                /* Read into temp buffer */
-                if (p_instance_ctrl->read_count < RM_CELLULAR_COMM_UART_AWS_RX_BUFFER_SIZE)
-                {
-                    p_instance_ctrl->rx_buffer[p_instance_ctrl->read_count] = data_byte;
-                    p_instance_ctrl->read_count++;
-
-                    p_instance_ctrl->receive_callback(p_instance_ctrl->p_user_data,
-                                                      (CellularCommInterfaceHandle_t) p_instance_ctrl);
-                }
-            }
-            else
+            /* Byte received while no read is armed, drop it if the ring is full */
+            if (p_instance_ctrl->rx_count < RM_CELLULAR_COMM_UART_AWS_RX_BUFFER_SIZE)
             {
-                /* Kick off zero-copy transfer */
-                p_instance_ctrl->p_recv_buffer[0] = data_byte;
-                p_instance_ctrl->remaining_recv_read_length--;
-                p_instance_ctrl->p_recv_buffer++;
-                p_instance_ctrl->current_recv_read_length--;
+                uint32_t head = p_instance_ctrl->rx_head;
+
+                p_instance_ctrl->rx_buffer[head] = (uint8_t) p_args->data;
+
+                head++;
+                p_instance_ctrl->rx_head = (head >= RM_CELLULAR_COMM_UART_AWS_RX_BUFFER_SIZE) ? 0U : head;
+                p_instance_ctrl->rx_count++;
+
+                /* Start of a burst, let the UART driver collect the following bytes */
+                rm_cellular_comm_uart_aws_read_arm(p_instance_ctrl);
 
-                p_uart_instance->p_api->read(p_uart_instance->p_ctrl,
-                                             p_instance_ctrl->p_recv_buffer,
-                                             p_instance_ctrl->current_recv_read_length);
+                p_instance_ctrl->receive_callback(p_instance_ctrl->p_user_data,
+                                                  (CellularCommInterfaceHandle_t) p_instance_ctrl);
 
-                p_instance_ctrl->transfer_in_progress = true;
+                xSemaphoreGiveFromISR(p_instance_ctrl->rx_semaphore_handle, &xHigherPriorityTaskWoken);
+
+                portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
             }
 
             break;
@@ -92,38 +92,26 @@ void comm_uart_aws_callback (uart_callback_args_t * p_args)
 
         case UART_EVENT_RX_COMPLETE:
         {
-            /* Read complete, update remaining length */
-            p_instance_ctrl->remaining_recv_read_length = p_instance_ctrl->remaining_recv_read_length -
-                                                          p_instance_ctrl->current_recv_read_length;
-
-            if (p_instance_ctrl->remaining_recv_read_length > 0)
-            {
-                p_instance_ctrl->p_recv_buffer += p_instance_ctrl->current_recv_read_length;
-
-                /* Buffer hasn't been filled yet, continue reading */
-                if (p_instance_ctrl->remaining_recv_read_length > RM_CELLULAR_COMM_UART_AWS_RECEIVE_CLUSTER_BYTE_COUNT)
-                {
-                    p_instance_ctrl->current_recv_read_length = RM_CELLULAR_COMM_UART_AWS_RECEIVE_CLUSTER_BYTE_COUNT;
-                }
-                else
-                {
-                    p_instance_ctrl->current_recv_read_length = p_instance_ctrl->remaining_recv_read_length;
-                }
-
-                p_uart_instance->p_api->read(p_uart_instance->p_ctrl,
-                                             p_instance_ctrl->p_recv_buffer,
-                                             p_instance_ctrl->current_recv_read_length);
-            }
-            else
+            /* Ignore a completion for a read that was already stopped and harvested by receive */
+            if (p_instance_ctrl->transfer_in_progress)
             {
-                /* Buffer has been filled, don't read any more bytes into buffer */
-                p_instance_ctrl->p_recv_buffer = NULL;
-            }
+                uint32_t head = p_instance_ctrl->rx_head + p_instance_ctrl->rx_armed_length;
 
-            /* Notify of byte read */
-            xSemaphoreGiveFromISR(p_instance_ctrl->rx_semaphore_handle, &xHigherPriorityTaskWoken);
+                p_instance_ctrl->rx_head  = (head >= RM_CELLULAR_COMM_UART_AWS_RX_BUFFER_SIZE) ? 0U : head;
+                p_instance_ctrl->rx_count = p_instance_ctrl->rx_count + p_instance_ctrl->rx_armed_length;
+                p_instance_ctrl->transfer_in_progress = false;
+
+                /* Watermark reached, continue collecting the burst */
+                rm_cellular_comm_uart_aws_read_arm(p_instance_ctrl);
+
+                p_instance_ctrl->receive_callback(p_instance_ctrl->p_user_data,
+                                                  (CellularCommInterfaceHandle_t) p_instance_ctrl);
+
+                xSemaphoreGiveFromISR(p_instance_ctrl->rx_semaphore_handle, &xHigherPriorityTaskWoken);
+
+                portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+            }
 
-            portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
             break;
         }
 
@@ -170,8 +158,10 @@ CellularCommInterfaceError_t RM_CELLULAR_COMM_UART_AWS_Open (
 
     p_instance_ctrl->p_user_data          = pUserData;
     p_instance_ctrl->receive_callback     = receive_callback;
-    p_instance_ctrl->read_count           = 0;
-    p_instance_ctrl->p_recv_buffer        = NULL;
+    p_instance_ctrl->rx_head              = 0;
+    p_instance_ctrl->rx_tail              = 0;
+    p_instance_ctrl->rx_count             = 0;
+    p_instance_ctrl->rx_armed_length      = 0;
     p_instance_ctrl->transfer_in_progress = false;
 
     p_uart_instance = p_instance_ctrl->p_lower_level_instance;
@@ -262,8 +252,9 @@ CellularCommInterfaceError_t RM_CELLULAR_COMM_UART_AWS_Send (CellularCommInterfa
 }
 
 /*******************************************************************************************************************//**
- * Implements receive for CellularCommInterface_t. This function will block the
- * calling thread until data is received.
+ * Implements receive for CellularCommInterface_t. Data already collected in the receive ring is copied out
+ * immediately. If the ring is empty, bytes of a burst still being collected by the lower level read are harvested, and
+ * if there are none this function blocks the calling thread until data is received or the timeout expires.
  *
  * @param[in] commInterfaceHandle   CellularCommInterfaceHandle_t assigned in open
  * @param[in] pBuffer               Pointer to buffer to receive to
@@ -284,6 +275,7 @@ CellularCommInterfaceError_t RM_CELLULAR_COMM_UART_AWS_Receive (CellularCommInte
 {
     rm_cellular_comm_uart_aws_instance_ctrl_t * p_instance_ctrl =
         (rm_cellular_comm_uart_aws_instance_ctrl_t *) commInterfaceHandle;
+    uint32_t received;
 
 #if RM_CELLULAR_COMM_UART_AWS_PARAM_CHECKING_ENABLE
     FSP_ERROR_RETURN(NULL != p_instance_ctrl, IOT_COMM_INTERFACE_BAD_PARAMETER);
@@ -292,125 +284,26 @@ CellularCommInterfaceError_t RM_CELLULAR_COMM_UART_AWS_Receive (CellularCommInte
     FSP_ERROR_RETURN(RM_CELLULAR_COMM_UART_AWS_OPEN == p_instance_ctrl->open, IOT_COMM_INTERFACE_FAILURE);
 #endif
 
-    FSP_CRITICAL_SECTION_DEFINE;
-    FSP_CRITICAL_SECTION_ENTER;
+    received = rm_cellular_comm_uart_aws_ring_copy(p_instance_ctrl, pBuffer, bufferLength);
 
-    if (bufferLength > p_instance_ctrl->read_count)
+    if (0U == received)
     {
-        p_instance_ctrl->remaining_recv_read_length = bufferLength - p_instance_ctrl->read_count;
-        p_instance_ctrl->p_recv_buffer              = pBuffer + p_instance_ctrl->read_count;
-
-        if (p_instance_ctrl->remaining_recv_read_length > RM_CELLULAR_COMM_UART_AWS_RECEIVE_CLUSTER_BYTE_COUNT)
-        {
-#if RM_CELLULAR_COMM_UART_AWS_RECEIVE_CLUSTER_BYTE_COUNT > 1
-            p_instance_ctrl->current_recv_read_length = RM_CELLULAR_COMM_UART_AWS_RECEIVE_CLUSTER_BYTE_COUNT;
-#else
+        /* Discard notifications for data that has already been consumed */
+        xSemaphoreTake(p_instance_ctrl->rx_semaphore_handle, 0);
 
-            /* Special case for 1 */
-            p_instance_ctrl->current_recv_read_length = RM_CELLULAR_COMM_UART_AWS_RECEIVE_CLUSTER_BYTE_COUNT + 1;
-#endif
-        }
-        else
-        {
-            p_instance_ctrl->current_recv_read_length = p_instance_ctrl->remaining_recv_read_length;
-        }
+        /* Collect the tail of a burst that did not reach the watermark */
+        rm_cellular_comm_uart_aws_read_harvest(p_instance_ctrl);
 
-        memcpy(pBuffer, p_instance_ctrl->rx_buffer, p_instance_ctrl->read_count);
+        received = rm_cellular_comm_uart_aws_ring_copy(p_instance_ctrl, pBuffer, bufferLength);
 
-        p_instance_ctrl->read_count = 0;
-    }
-    else
-    {
-        /* Amount to store in read buffer is less than or equal to what has been read in rx_buffer, only copy bufferLength */
-        memcpy(pBuffer, p_instance_ctrl->rx_buffer, bufferLength);
-
-        if (bufferLength < p_instance_ctrl->read_count)
-        {
-            /* Buffer length is less than read count, move bytes not copied to pBuffer to front of rx_buffer */
-            p_instance_ctrl->read_count = p_instance_ctrl->read_count - bufferLength;
-
-            memcpy(p_instance_ctrl->rx_buffer, p_instance_ctrl->rx_buffer + bufferLength, p_instance_ctrl->read_count);
-        }
-        else
+        if ((0U == received) &&
+            (pdTRUE == xSemaphoreTake(p_instance_ctrl->rx_semaphore_handle, pdMS_TO_TICKS(timeoutMilliseconds))))
         {
-            p_instance_ctrl->read_count = 0;
+            received = rm_cellular_comm_uart_aws_ring_copy(p_instance_ctrl, pBuffer, bufferLength);
         }
-
-        *pDataReceivedLength = bufferLength;
     }
 
-    FSP_CRITICAL_SECTION_EXIT;
-
-    if (NULL != p_instance_ctrl->p_recv_buffer)
-    {
-        /* Loop until timeout/transfer complete */
-        while (true)
-        {
-            /* Wait for UART_EVENT_RX_COMPLETE semaphore */
-            if (pdTRUE == xSemaphoreTake(p_instance_ctrl->rx_semaphore_handle, pdMS_TO_TICKS(timeoutMilliseconds)))
-            {
-                if ((0 == p_instance_ctrl->remaining_recv_read_length) && (NULL == p_instance_ctrl->p_recv_buffer))
-                {
-                    /* Full bufferLength was read */
-                    *pDataReceivedLength = bufferLength;
-                    break;
-                }
-            }
-            else
-            {
-                /* Byte read timed out */
-                FSP_CRITICAL_SECTION_ENTER;
-
-                p_instance_ctrl->p_recv_buffer = NULL;
-
-                /* Check for semaphore one more time inside critical section */
-                if (pdTRUE != xSemaphoreTake(p_instance_ctrl->rx_semaphore_handle, 0))
-                {
-                    /* Semaphore not posted, continue to abort read */
-                    uart_instance_t * p_uart_instance = p_instance_ctrl->p_lower_level_instance;
-                    uint32_t          remaining_bytes;
-
-                    if (p_instance_ctrl->transfer_in_progress)
-                    {
-                        if (FSP_SUCCESS != p_uart_instance->p_api->readStop(p_uart_instance->p_ctrl, &remaining_bytes))
-                        {
-                            /* No more data received, cancel transfer */
-                            FSP_CRITICAL_SECTION_EXIT;
-                            *pDataReceivedLength = 0;
-
-                            return IOT_COMM_INTERFACE_DRIVER_ERROR;
-                        }
-
-                        /* Get received data length */
-                        uint32_t current_bytes_read    = p_instance_ctrl->current_recv_read_length - remaining_bytes;
-                        uint32_t total_remaining_bytes = p_instance_ctrl->remaining_recv_read_length -
-                                                         current_bytes_read;
-                        *pDataReceivedLength = bufferLength - total_remaining_bytes;
-                    }
-                    else
-                    {
-                        /* Transfer never started */
-                        *pDataReceivedLength = bufferLength - p_instance_ctrl->remaining_recv_read_length;
-                    }
-
-                    FSP_CRITICAL_SECTION_EXIT;
-                    break;
-                }
-
-                if ((0 == p_instance_ctrl->remaining_recv_read_length) && (NULL == p_instance_ctrl->p_recv_buffer))
-                {
-                    /* Full bufferLength was read */
-                    *pDataReceivedLength = bufferLength;
-                    FSP_CRITICAL_SECTION_EXIT;
-                    break;
-                }
-
-                FSP_CRITICAL_SECTION_EXIT;
-            }
-        }
-
-        p_instance_ctrl->transfer_in_progress = false;
-    }
+    *pDataReceivedLength = received;
 
     return IOT_COMM_INTERFACE_SUCCESS;
 }
@@ -445,3 +338,118 @@ CellularCommInterfaceError_t RM_CELLULAR_COMM_UART_AWS_Close (CellularCommInterf
 
     return IOT_COMM_INTERFACE_SUCCESS;
 }
+
+/*******************************************************************************************************************//**
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Arms a lower level read into the free space at the ring head. The read is limited to the watermark, the end of the
+ * ring and the free space, so no bytes that have not been consumed yet are overwritten. If the ring is full no read is
+ * armed and further bytes arrive as UART_EVENT_RX_CHAR. Called from the UART callback.
+ *
+ * @param[in] p_instance_ctrl       Pointer to a rm_cellular_comm_uart_aws_instance_ctrl_t
+ **********************************************************************************************************************/
+static void rm_cellular_comm_uart_aws_read_arm (rm_cellular_comm_uart_aws_instance_ctrl_t * p_instance_ctrl)
+{
+    uart_instance_t * p_uart_instance = p_instance_ctrl->p_lower_level_instance;
+    uint32_t          head            = p_instance_ctrl->rx_head;
+    uint32_t          length          = RM_CELLULAR_COMM_UART_AWS_RX_BUFFER_SIZE - p_instance_ctrl->rx_count;
+
+    if (length > (RM_CELLULAR_COMM_UART_AWS_RX_BUFFER_SIZE - head))
+    {
+        length = RM_CELLULAR_COMM_UART_AWS_RX_BUFFER_SIZE - head;
+    }
+
+    if (length > RM_CELLULAR_COMM_UART_AWS_RECEIVE_CLUSTER_BYTE_COUNT)
+    {
+        length = RM_CELLULAR_COMM_UART_AWS_RECEIVE_CLUSTER_BYTE_COUNT;
+    }
+
+    if ((length > 0U) &&
+        (FSP_SUCCESS ==
+         p_uart_instance->p_api->read(p_uart_instance->p_ctrl, &p_instance_ctrl->rx_buffer[head], length)))
+    {
+        p_instance_ctrl->rx_armed_length      = length;
+        p_instance_ctrl->transfer_in_progress = true;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Stops the armed lower level read and commits the bytes it has already moved into the ring. The next byte received
+ * arrives as UART_EVENT_RX_CHAR, which notifies the cellular library and arms a new read.
+ *
+ * @param[in] p_instance_ctrl       Pointer to a rm_cellular_comm_uart_aws_instance_ctrl_t
+ **********************************************************************************************************************/
+static void rm_cellular_comm_uart_aws_read_harvest (rm_cellular_comm_uart_aws_instance_ctrl_t * p_instance_ctrl)
+{
+    uart_instance_t * p_uart_instance = p_instance_ctrl->p_lower_level_instance;
+    uint32_t          remaining_bytes = 0;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    if (p_instance_ctrl->transfer_in_progress)
+    {
+        p_instance_ctrl->transfer_in_progress = false;
+
+        if (FSP_SUCCESS == p_uart_instance->p_api->readStop(p_uart_instance->p_ctrl, &remaining_bytes))
+        {
+            uint32_t received = p_instance_ctrl->rx_armed_length - remaining_bytes;
+            uint32_t head     = p_instance_ctrl->rx_head + received;
+
+            p_instance_ctrl->rx_head  = (head >= RM_CELLULAR_COMM_UART_AWS_RX_BUFFER_SIZE) ? 0U : head;
+            p_instance_ctrl->rx_count = p_instance_ctrl->rx_count + received;
+        }
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+/*******************************************************************************************************************//**
+ * Copies up to length bytes out of the receive ring in at most two contiguous spans. The UART callback only writes to
+ * the free part of the ring, so the copy is done outside of the critical section.
+ *
+ * @param[in]  p_instance_ctrl      Pointer to a rm_cellular_comm_uart_aws_instance_ctrl_t
+ * @param[out] p_dest               Destination buffer
+ * @param[in]  length               Size of the destination buffer
+ *
+ * @return Number of bytes copied.
+ **********************************************************************************************************************/
+static uint32_t rm_cellular_comm_uart_aws_ring_copy (rm_cellular_comm_uart_aws_instance_ctrl_t * p_instance_ctrl,
+                                                     uint8_t                                   * p_dest,
+                                                     uint32_t                                    length)
+{
+    uint32_t tail  = p_instance_ctrl->rx_tail;
+    uint32_t count = p_instance_ctrl->rx_count;
+
+    if (count > length)
+    {
+        count = length;
+    }
+
+    if (count > 0U)
+    {
+        uint32_t first = RM_CELLULAR_COMM_UART_AWS_RX_BUFFER_SIZE - tail;
+
+        if (first > count)
+        {
+            first = count;
+        }
+
+        memcpy(p_dest, &p_instance_ctrl->rx_buffer[tail], first);
+        memcpy(p_dest + first, &p_instance_ctrl->rx_buffer[0], count - first);
+
+        tail += count;
+        p_instance_ctrl->rx_tail = (tail >= RM_CELLULAR_COMM_UART_AWS_RX_BUFFER_SIZE) ?
+                                   (tail - RM_CELLULAR_COMM_UART_AWS_RX_BUFFER_SIZE) : tail;
+
+        /* Release the space to the UART callback */
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+        p_instance_ctrl->rx_count = p_instance_ctrl->rx_count - count;
+        FSP_CRITICAL_SECTION_EXIT;
+    }
+
+    return count;
+}
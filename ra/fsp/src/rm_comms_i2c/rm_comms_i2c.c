@@ -163,6 +163,7 @@ fsp_err_t RM_COMMS_I2C_Close (rm_comms_ctrl_t * const p_api_ctrl)
  * @retval FSP_SUCCESS              Successfully data decoded.
  * @retval FSP_ERR_ASSERTION        Null pointer passed as a parameter.
  * @retval FSP_ERR_NOT_OPEN         Module is not open.
+ * @retval FSP_ERR_IN_USE           A bus scheduler is open on the bus of this device.
  **********************************************************************************************************************/
 fsp_err_t RM_COMMS_I2C_Read (rm_comms_ctrl_t * const p_api_ctrl, uint8_t * const p_dest, uint32_t const bytes)
 {
@@ -189,6 +190,7 @@ fsp_err_t RM_COMMS_I2C_Read (rm_comms_ctrl_t * const p_api_ctrl, uint8_t * const
  * @retval FSP_SUCCESS              Successfully writing data .
  * @retval FSP_ERR_ASSERTION        Null pointer passed as a parameter.
  * @retval FSP_ERR_NOT_OPEN         Module is not open.
+ * @retval FSP_ERR_IN_USE           A bus scheduler is open on the bus of this device.
  **********************************************************************************************************************/
 fsp_err_t RM_COMMS_I2C_Write (rm_comms_ctrl_t * const p_api_ctrl, uint8_t * const p_src, uint32_t const bytes)
 {
@@ -215,6 +217,7 @@ fsp_err_t RM_COMMS_I2C_Write (rm_comms_ctrl_t * const p_api_ctrl, uint8_t * cons
  * @retval FSP_SUCCESS              Successfully data decoded.
  * @retval FSP_ERR_ASSERTION        Null pointer passed as a parameter.
  * @retval FSP_ERR_NOT_OPEN         Module is not open.
+ * @retval FSP_ERR_IN_USE           A bus scheduler is open on the bus of this device.
  **********************************************************************************************************************/
 fsp_err_t RM_COMMS_I2C_WriteRead (rm_comms_ctrl_t * const            p_api_ctrl,
                                   rm_comms_write_read_params_t const write_read_params)
@@ -339,6 +339,20 @@ static fsp_err_t rm_comms_i2c_bus_reconfigure (rm_comms_ctrl_t * const p_api_ctr
     }
 #endif
 
+    /* A scheduler owns the driver callback and slave address of the bus until it is closed */
+    if (NULL != p_ctrl->p_bus->p_scheduler)
+    {
+#if BSP_CFG_RTOS
+        if (NULL != p_ctrl->p_bus->p_bus_recursive_mutex)
+        {
+            /* Release a mutex */
+            (void) rm_comms_i2c_os_recursive_mutex_release(p_ctrl->p_bus->p_bus_recursive_mutex);
+        }
+#endif
+
+        return FSP_ERR_IN_USE;
+    }
+
     if (p_ctrl->p_bus->p_current_ctrl != p_ctrl)
     {
         /* Update a slave address */
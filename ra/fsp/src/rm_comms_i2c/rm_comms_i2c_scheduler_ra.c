@@ -0,0 +1,630 @@
+/***********************************************************************************************************************
+ * Copyright [2020-2024] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "rm_comms_i2c.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* Definitions of Open flag */
+#define RM_COMMS_I2C_SCHEDULER_OPEN    (0x49325343UL) // Open state
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static void      rm_comms_i2c_scheduler_ready_insert(rm_comms_i2c_scheduler_instance_ctrl_t * const p_ctrl,
+                                                     rm_comms_i2c_transaction_t * const             p_transaction);
+static bool      rm_comms_i2c_scheduler_list_remove(rm_comms_i2c_transaction_t ** pp_head,
+                                                    rm_comms_i2c_transaction_t * const p_transaction);
+static void      rm_comms_i2c_scheduler_run(rm_comms_i2c_scheduler_instance_ctrl_t * const p_ctrl);
+static fsp_err_t rm_comms_i2c_scheduler_transfer_start(rm_comms_i2c_scheduler_instance_ctrl_t * const p_ctrl,
+                                                       rm_comms_i2c_transaction_t * const             p_transaction);
+static void rm_comms_i2c_scheduler_complete(rm_comms_i2c_scheduler_instance_ctrl_t * const p_ctrl,
+                                            rm_comms_event_t const                         event);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Global variables
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_COMMS_I2C
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief Opens a transaction scheduler on an I2C bus.
+ *
+ * The scheduler takes over the I2C driver callback of the bus. Transactions submitted with
+ * RM_COMMS_I2C_TransactionSubmit() are started back-to-back from the driver completion interrupt, so devices on the bus
+ * do not need a task switch per transfer. While the scheduler is open, the bus can only be accessed through the
+ * scheduler: RM_COMMS_I2C_Read/Write/WriteRead on a device of the bus return FSP_ERR_IN_USE until
+ * RM_COMMS_I2C_SchedulerClose() is called. Open the scheduler when no blocking transfer is in progress on the bus.
+ *
+ * Periodic transactions are timed in scheduler ticks. Call RM_COMMS_I2C_SchedulerTick() from a periodic timer
+ * callback to advance the tick.
+ *
+ * @retval FSP_SUCCESS                  Scheduler successfully opened.
+ * @retval FSP_ERR_ASSERTION            Null pointer passed as a parameter.
+ * @retval FSP_ERR_ALREADY_OPEN         Scheduler is already open.
+ * @retval FSP_ERR_IN_USE               Another scheduler is open on the bus.
+ * @retval FSP_ERR_COMMS_BUS_NOT_OPEN   I2C driver is not open.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ **********************************************************************************************************************/
+fsp_err_t RM_COMMS_I2C_SchedulerOpen (rm_comms_i2c_scheduler_instance_ctrl_t * const p_ctrl,
+                                      rm_comms_i2c_bus_extended_cfg_t * const        p_bus)
+{
+    fsp_err_t               err = FSP_SUCCESS;
+    i2c_master_instance_t * p_driver_instance;
+    i2c_master_status_t     status;
+
+#if RM_COMMS_I2C_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_bus);
+    FSP_ASSERT(NULL != p_bus->p_driver_instance);
+    FSP_ERROR_RETURN(RM_COMMS_I2C_SCHEDULER_OPEN != p_ctrl->open, FSP_ERR_ALREADY_OPEN);
+#endif
+
+    p_driver_instance = (i2c_master_instance_t *) p_bus->p_driver_instance;
+
+    /* Check if RA I2C driver has already been opened */
+    err = p_driver_instance->p_api->statusGet(p_driver_instance->p_ctrl, &status);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    FSP_ERROR_RETURN(true == status.open, FSP_ERR_COMMS_BUS_NOT_OPEN);
+    FSP_ERROR_RETURN(NULL == p_bus->p_scheduler, FSP_ERR_IN_USE);
+
+    p_ctrl->p_bus            = p_bus;
+    p_ctrl->p_ready          = NULL;
+    p_ctrl->p_waiting        = NULL;
+    p_ctrl->p_active         = NULL;
+    p_ctrl->p_current_device = NULL;
+    p_ctrl->tick             = 0U;
+    p_ctrl->read_pending     = false;
+    p_ctrl->cancel_active    = false;
+    p_ctrl->p_restore_device = p_bus->p_current_ctrl;
+
+    /* Claim the bus before taking over the callback so that the blocking APIs stop reconfiguring the driver */
+    p_bus->p_scheduler = p_ctrl;
+
+    /* Route driver completions to the scheduler */
+    err = p_driver_instance->p_api->callbackSet(p_driver_instance->p_ctrl,
+                                                rm_comms_i2c_scheduler_callback,
+                                                p_ctrl,
+                                                NULL);
+    if (FSP_SUCCESS != err)
+    {
+        p_bus->p_scheduler = NULL;
+
+        return err;
+    }
+
+    /* Force the blocking APIs to reinstall their callback and address once the scheduler is closed */
+    p_bus->p_current_ctrl = NULL;
+
+    p_ctrl->open = RM_COMMS_I2C_SCHEDULER_OPEN;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Submits a transaction to the bus scheduler.
+ *
+ * The transaction is inserted into the ready queue behind all queued transactions of the same or higher priority and
+ * the bus is started if it is idle. A transaction with a non-zero period runs once immediately and then once every
+ * period scheduler ticks until it is cancelled. The callback of the transaction is called from the I2C interrupt
+ * after each run.
+ *
+ * This function may be called from a thread, from a transaction callback or from another interrupt.
+ *
+ * @retval FSP_SUCCESS                  Transaction queued.
+ * @retval FSP_ERR_ASSERTION            Null pointer or invalid transaction parameters.
+ * @retval FSP_ERR_NOT_OPEN             Scheduler is not open.
+ * @retval FSP_ERR_IN_USE               Transaction is already queued or on the bus.
+ **********************************************************************************************************************/
+fsp_err_t RM_COMMS_I2C_TransactionSubmit (rm_comms_i2c_scheduler_instance_ctrl_t * const p_ctrl,
+                                          rm_comms_i2c_transaction_t * const             p_transaction)
+{
+#if RM_COMMS_I2C_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_transaction);
+    FSP_ASSERT(NULL != p_transaction->p_device);
+    FSP_ERROR_RETURN(RM_COMMS_I2C_SCHEDULER_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT(((rm_comms_i2c_instance_ctrl_t *) p_transaction->p_device)->p_bus == p_ctrl->p_bus);
+    if (RM_COMMS_I2C_TRANSACTION_TYPE_READ != p_transaction->type)
+    {
+        FSP_ASSERT(NULL != p_transaction->p_src);
+        FSP_ASSERT(0U != p_transaction->src_bytes);
+    }
+
+    if (RM_COMMS_I2C_TRANSACTION_TYPE_WRITE != p_transaction->type)
+    {
+        FSP_ASSERT(NULL != p_transaction->p_dest);
+        FSP_ASSERT(0U != p_transaction->dest_bytes);
+    }
+#endif
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    if (RM_COMMS_I2C_TRANSACTION_STATE_IDLE != p_transaction->state)
+    {
+        FSP_CRITICAL_SECTION_EXIT;
+
+        return FSP_ERR_IN_USE;
+    }
+
+    /* The first run of a periodic transaction is due now */
+    p_transaction->next_tick = p_ctrl->tick;
+    rm_comms_i2c_scheduler_ready_insert(p_ctrl, p_transaction);
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    /* Start the bus if it is idle */
+    rm_comms_i2c_scheduler_run(p_ctrl);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Cancels a queued or periodic transaction.
+ *
+ * A transaction that is currently on the bus completes normally and its callback is called, but it is not
+ * rescheduled.
+ *
+ * @retval FSP_SUCCESS                  Transaction removed from the scheduler, or was not queued.
+ * @retval FSP_ERR_ASSERTION            Null pointer passed as a parameter.
+ * @retval FSP_ERR_NOT_OPEN             Scheduler is not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_COMMS_I2C_TransactionCancel (rm_comms_i2c_scheduler_instance_ctrl_t * const p_ctrl,
+                                          rm_comms_i2c_transaction_t * const             p_transaction)
+{
+#if RM_COMMS_I2C_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_transaction);
+    FSP_ERROR_RETURN(RM_COMMS_I2C_SCHEDULER_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    switch (p_transaction->state)
+    {
+        case RM_COMMS_I2C_TRANSACTION_STATE_QUEUED:
+        {
+            rm_comms_i2c_scheduler_list_remove(&p_ctrl->p_ready, p_transaction);
+            p_transaction->state = RM_COMMS_I2C_TRANSACTION_STATE_IDLE;
+            break;
+        }
+
+        case RM_COMMS_I2C_TRANSACTION_STATE_WAITING:
+        {
+            rm_comms_i2c_scheduler_list_remove(&p_ctrl->p_waiting, p_transaction);
+            p_transaction->state = RM_COMMS_I2C_TRANSACTION_STATE_IDLE;
+            break;
+        }
+
+        case RM_COMMS_I2C_TRANSACTION_STATE_ACTIVE:
+        {
+            /* Let the transfer finish; it is not rescheduled on completion */
+            p_ctrl->cancel_active = true;
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Advances the scheduler tick and releases periodic transactions that are due.
+ *
+ * Call this function from a periodic timer callback (for example GPT or AGT). Due transactions are moved into the
+ * ready queue by priority and the bus is started if it is idle.
+ *
+ * @retval FSP_SUCCESS                  Tick processed.
+ * @retval FSP_ERR_ASSERTION            Null pointer passed as a parameter.
+ * @retval FSP_ERR_NOT_OPEN             Scheduler is not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_COMMS_I2C_SchedulerTick (rm_comms_i2c_scheduler_instance_ctrl_t * const p_ctrl)
+{
+#if RM_COMMS_I2C_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_COMMS_I2C_SCHEDULER_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    uint32_t tick = p_ctrl->tick + 1U;
+    p_ctrl->tick = tick;
+
+    rm_comms_i2c_transaction_t ** pp_link = &p_ctrl->p_waiting;
+    while (NULL != *pp_link)
+    {
+        rm_comms_i2c_transaction_t * p_transaction = *pp_link;
+
+        /* Wrap-safe comparison against the due tick */
+        if ((int32_t) (tick - p_transaction->next_tick) >= 0)
+        {
+            *pp_link = p_transaction->p_next;
+            rm_comms_i2c_scheduler_ready_insert(p_ctrl, p_transaction);
+        }
+        else
+        {
+            pp_link = &p_transaction->p_next;
+        }
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    rm_comms_i2c_scheduler_run(p_ctrl);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Closes the scheduler. Any transfer on the bus is aborted and all queued transactions are returned to idle
+ * without calling their callbacks. The I2C driver callback is restored to the one installed before
+ * RM_COMMS_I2C_SchedulerOpen().
+ *
+ * @retval FSP_SUCCESS                  Scheduler closed.
+ * @retval FSP_ERR_ASSERTION            Null pointer passed as a parameter.
+ * @retval FSP_ERR_NOT_OPEN             Scheduler is not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_COMMS_I2C_SchedulerClose (rm_comms_i2c_scheduler_instance_ctrl_t * const p_ctrl)
+{
+#if RM_COMMS_I2C_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_COMMS_I2C_SCHEDULER_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    i2c_master_instance_t * p_driver_instance = (i2c_master_instance_t *) p_ctrl->p_bus->p_driver_instance;
+
+    p_ctrl->open = 0U;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    rm_comms_i2c_transaction_t * p_active = p_ctrl->p_active;
+    p_ctrl->p_active = NULL;
+
+    rm_comms_i2c_transaction_t * p_lists[2] = {p_ctrl->p_ready, p_ctrl->p_waiting};
+    p_ctrl->p_ready   = NULL;
+    p_ctrl->p_waiting = NULL;
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    if (NULL != p_active)
+    {
+        /* Safely abort RA I2C driver */
+        p_driver_instance->p_api->abort(p_driver_instance->p_ctrl);
+        p_active->state = RM_COMMS_I2C_TRANSACTION_STATE_IDLE;
+    }
+
+    for (uint32_t i = 0U; i < 2U; i++)
+    {
+        while (NULL != p_lists[i])
+        {
+            rm_comms_i2c_transaction_t * p_transaction = p_lists[i];
+            p_lists[i]             = p_transaction->p_next;
+            p_transaction->p_next = NULL;
+            p_transaction->state  = RM_COMMS_I2C_TRANSACTION_STATE_IDLE;
+        }
+    }
+
+    /* Restore the driver callback so no completion reaches the closed scheduler. The slave address was changed by
+     * the scheduler, so the blocking APIs still reprogram the address and callback on their next transfer. */
+    fsp_err_t err;
+    if (NULL != p_ctrl->p_restore_device)
+    {
+        err = p_driver_instance->p_api->callbackSet(p_driver_instance->p_ctrl,
+                                                    (void (*)(i2c_master_callback_args_t *))rm_comms_i2c_callback,
+                                                    p_ctrl->p_restore_device,
+                                                    NULL);
+    }
+    else
+    {
+        err = p_driver_instance->p_api->callbackSet(p_driver_instance->p_ctrl,
+                                                    p_driver_instance->p_cfg->p_callback,
+                                                    p_driver_instance->p_cfg->p_context,
+                                                    NULL);
+    }
+
+    p_ctrl->p_bus->p_current_ctrl = NULL;
+    p_ctrl->p_bus->p_scheduler    = NULL;
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * @brief I2C driver callback used while the scheduler owns the bus. Issues the restart read of a WRITE_READ
+ * transaction, completes the active transaction and starts the next one without leaving interrupt context.
+ **********************************************************************************************************************/
+void rm_comms_i2c_scheduler_callback (i2c_master_callback_args_t * p_args)
+{
+    rm_comms_i2c_scheduler_instance_ctrl_t * p_ctrl = (rm_comms_i2c_scheduler_instance_ctrl_t *) p_args->p_context;
+    i2c_master_instance_t * p_driver_instance       = (i2c_master_instance_t *) p_ctrl->p_bus->p_driver_instance;
+    rm_comms_i2c_transaction_t * p_transaction      = p_ctrl->p_active;
+    rm_comms_event_t             event              = RM_COMMS_EVENT_OPERATION_COMPLETE;
+
+    if (NULL == p_transaction)
+    {
+        return;
+    }
+
+    if ((I2C_MASTER_EVENT_RX_COMPLETE != p_args->event) && (I2C_MASTER_EVENT_TX_COMPLETE != p_args->event))
+    {
+        /* Safely abort RA I2C driver */
+        p_driver_instance->p_api->abort(p_driver_instance->p_ctrl);
+        event = RM_COMMS_EVENT_ERROR;
+    }
+    else if (p_ctrl->read_pending)
+    {
+        p_ctrl->read_pending = false;
+
+        /* Read data with restart */
+        fsp_err_t err = p_driver_instance->p_api->read(p_driver_instance->p_ctrl,
+                                                       p_transaction->p_dest,
+                                                       p_transaction->dest_bytes,
+                                                       false);
+        if (FSP_SUCCESS == err)
+        {
+            return;
+        }
+
+        event = RM_COMMS_EVENT_ERROR;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    rm_comms_i2c_scheduler_complete(p_ctrl, event);
+    rm_comms_i2c_scheduler_run(p_ctrl);
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_COMMS_I2C)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief Inserts a transaction into the ready queue behind all transactions of the same or higher priority. Must be
+ * called inside a critical section.
+ **********************************************************************************************************************/
+static void rm_comms_i2c_scheduler_ready_insert (rm_comms_i2c_scheduler_instance_ctrl_t * const p_ctrl,
+                                                 rm_comms_i2c_transaction_t * const             p_transaction)
+{
+    rm_comms_i2c_transaction_t ** pp_link = &p_ctrl->p_ready;
+
+    while ((NULL != *pp_link) && ((*pp_link)->priority <= p_transaction->priority))
+    {
+        pp_link = &(*pp_link)->p_next;
+    }
+
+    p_transaction->p_next = *pp_link;
+    *pp_link              = p_transaction;
+    p_transaction->state  = RM_COMMS_I2C_TRANSACTION_STATE_QUEUED;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Unlinks a transaction from a list. Must be called inside a critical section.
+ *
+ * @retval true   Transaction was found and removed.
+ * @retval false  Transaction is not in the list.
+ **********************************************************************************************************************/
+static bool rm_comms_i2c_scheduler_list_remove (rm_comms_i2c_transaction_t ** pp_head,
+                                                rm_comms_i2c_transaction_t * const p_transaction)
+{
+    rm_comms_i2c_transaction_t ** pp_link = pp_head;
+
+    while (NULL != *pp_link)
+    {
+        if (*pp_link == p_transaction)
+        {
+            *pp_link              = p_transaction->p_next;
+            p_transaction->p_next = NULL;
+
+            return true;
+        }
+
+        pp_link = &(*pp_link)->p_next;
+    }
+
+    return false;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Starts the highest priority ready transaction if the bus is idle. Transactions that fail to start are
+ * completed with RM_COMMS_EVENT_ERROR and the next one is tried.
+ **********************************************************************************************************************/
+static void rm_comms_i2c_scheduler_run (rm_comms_i2c_scheduler_instance_ctrl_t * const p_ctrl)
+{
+    while (RM_COMMS_I2C_SCHEDULER_OPEN == p_ctrl->open)
+    {
+        rm_comms_i2c_transaction_t * p_transaction = NULL;
+
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+
+        if ((NULL == p_ctrl->p_active) && (NULL != p_ctrl->p_ready))
+        {
+            /* Claim the bus for the head of the ready queue */
+            p_transaction         = p_ctrl->p_ready;
+            p_ctrl->p_ready       = p_transaction->p_next;
+            p_transaction->p_next = NULL;
+            p_transaction->state  = RM_COMMS_I2C_TRANSACTION_STATE_ACTIVE;
+            p_ctrl->p_active      = p_transaction;
+            p_ctrl->cancel_active = false;
+        }
+
+        FSP_CRITICAL_SECTION_EXIT;
+
+        if (NULL == p_transaction)
+        {
+            /* Bus is busy or there is nothing to do */
+            return;
+        }
+
+        if (FSP_SUCCESS == rm_comms_i2c_scheduler_transfer_start(p_ctrl, p_transaction))
+        {
+            return;
+        }
+
+        rm_comms_i2c_scheduler_complete(p_ctrl, RM_COMMS_EVENT_ERROR);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief Programs the device address if the device changed and starts the first phase of a transaction.
+ *
+ * @retval FSP_SUCCESS              Transfer started.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ **********************************************************************************************************************/
+static fsp_err_t rm_comms_i2c_scheduler_transfer_start (rm_comms_i2c_scheduler_instance_ctrl_t * const p_ctrl,
+                                                        rm_comms_i2c_transaction_t * const             p_transaction)
+{
+    fsp_err_t                      err               = FSP_SUCCESS;
+    i2c_master_instance_t        * p_driver_instance = (i2c_master_instance_t *) p_ctrl->p_bus->p_driver_instance;
+    rm_comms_i2c_instance_ctrl_t * p_device          = (rm_comms_i2c_instance_ctrl_t *) p_transaction->p_device;
+
+    if (p_ctrl->p_current_device != p_transaction->p_device)
+    {
+        i2c_master_cfg_t * p_lower_level_cfg = (i2c_master_cfg_t *) p_device->p_lower_level_cfg;
+
+        /* Update a slave address */
+        err = p_driver_instance->p_api->slaveAddressSet(p_driver_instance->p_ctrl,
+                                                        p_lower_level_cfg->slave,
+                                                        p_lower_level_cfg->addr_mode);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        p_ctrl->p_current_device = p_transaction->p_device;
+    }
+
+    switch (p_transaction->type)
+    {
+        case RM_COMMS_I2C_TRANSACTION_TYPE_WRITE:
+        {
+            p_ctrl->read_pending = false;
+            err = p_driver_instance->p_api->write(p_driver_instance->p_ctrl,
+                                                  p_transaction->p_src,
+                                                  p_transaction->src_bytes,
+                                                  false);
+            break;
+        }
+
+        case RM_COMMS_I2C_TRANSACTION_TYPE_READ:
+        {
+            p_ctrl->read_pending = false;
+            err = p_driver_instance->p_api->read(p_driver_instance->p_ctrl,
+                                                 p_transaction->p_dest,
+                                                 p_transaction->dest_bytes,
+                                                 false);
+            break;
+        }
+
+        case RM_COMMS_I2C_TRANSACTION_TYPE_WRITE_READ:
+        default:
+        {
+            /* The read phase is issued from the TX complete interrupt */
+            p_ctrl->read_pending = true;
+            err = p_driver_instance->p_api->write(p_driver_instance->p_ctrl,
+                                                  p_transaction->p_src,
+                                                  p_transaction->src_bytes,
+                                                  true);
+            break;
+        }
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Releases the bus from the active transaction, reschedules it if it is periodic and calls its callback.
+ **********************************************************************************************************************/
+static void rm_comms_i2c_scheduler_complete (rm_comms_i2c_scheduler_instance_ctrl_t * const p_ctrl,
+                                             rm_comms_event_t const                         event)
+{
+    rm_comms_i2c_transaction_t             * p_transaction = p_ctrl->p_active;
+    rm_comms_i2c_transaction_callback_args_t args;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    p_ctrl->p_active     = NULL;
+    p_ctrl->read_pending = false;
+
+    if ((0U != p_transaction->period) && !p_ctrl->cancel_active)
+    {
+        p_transaction->next_tick += p_transaction->period;
+
+        /* Skip periods that were missed while the bus was busy instead of running a burst to catch up */
+        if ((int32_t) (p_transaction->next_tick - p_ctrl->tick) <= 0)
+        {
+            p_transaction->next_tick = p_ctrl->tick + p_transaction->period;
+        }
+
+        p_transaction->p_next = p_ctrl->p_waiting;
+        p_ctrl->p_waiting     = p_transaction;
+        p_transaction->state  = RM_COMMS_I2C_TRANSACTION_STATE_WAITING;
+    }
+    else
+    {
+        p_transaction->state = RM_COMMS_I2C_TRANSACTION_STATE_IDLE;
+    }
+
+    p_ctrl->cancel_active = false;
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    if (NULL != p_transaction->p_callback)
+    {
+        args.event         = event;
+        args.p_transaction = p_transaction;
+        args.p_context     = p_transaction->p_context;
+
+        /* Call user callback */
+        p_transaction->p_callback(&args);
+    }
+}
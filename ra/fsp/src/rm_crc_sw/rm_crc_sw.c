@@ -0,0 +1,496 @@
+/***********************************************************************************************************************
+ * Copyright [2020-2024] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "rm_crc_sw.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* "CRCS" in ASCII, used to determine if channel is open. */
+#define RM_CRC_SW_OPEN             (0x43524353UL)
+
+/* Generator polynomials in normal (MSB first) form. */
+#define RM_CRC_SW_POLY_CRC_8       (0x07UL)
+#define RM_CRC_SW_POLY_CRC_16      (0x8005UL)
+#define RM_CRC_SW_POLY_CRC_CCITT   (0x1021UL)
+#define RM_CRC_SW_POLY_CRC_32      (0x04C11DB7UL)
+#define RM_CRC_SW_POLY_CRC_32C     (0x1EDC6F41UL)
+
+#define RM_CRC_SW_WORD_ALIGN_MASK  (3U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static void     rm_crc_sw_table_generate(rm_crc_sw_instance_ctrl_t * const p_instance_ctrl, uint32_t polynomial);
+static uint32_t rm_crc_sw_reflect(uint32_t value, uint32_t width);
+static uint32_t rm_crc_sw_update(rm_crc_sw_instance_ctrl_t * const p_instance_ctrl,
+                                 uint32_t                          crc,
+                                 uint8_t const                   * p_data,
+                                 uint32_t                          length,
+                                 bool                              word_input);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/* Filled in Interface API structure for this Instance. */
+const crc_api_t g_crc_on_crc_sw =
+{
+    .open         = RM_CRC_SW_Open,
+    .close        = RM_CRC_SW_Close,
+    .calculate    = RM_CRC_SW_Calculate,
+    .crcResultGet = RM_CRC_SW_CalculatedValueGet,
+    .snoopEnable  = RM_CRC_SW_SnoopEnable,
+    .snoopDisable = RM_CRC_SW_SnoopDisable,
+};
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_CRC_SW
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Open the software CRC module and generate the lookup tables for the configured polynomial and bit order.
+ *
+ * Implements @ref crc_api_t::open
+ *
+ * The software CRC produces the same values as the CRC calculator peripheral for the same configuration, so the two
+ * implementations can be exchanged per MCU. On parts with a fast core and cache the table-driven calculation is
+ * usually faster than feeding the peripheral one byte at a time from the CPU.
+ *
+ * @retval FSP_SUCCESS             Configuration was successful.
+ * @retval FSP_ERR_ASSERTION       p_ctrl or p_cfg is NULL, or the polynomial or bit order is invalid.
+ * @retval FSP_ERR_ALREADY_OPEN    Module already open
+ **********************************************************************************************************************/
+fsp_err_t RM_CRC_SW_Open (crc_ctrl_t * const p_ctrl, crc_cfg_t const * const p_cfg)
+{
+    rm_crc_sw_instance_ctrl_t * p_instance_ctrl = (rm_crc_sw_instance_ctrl_t *) p_ctrl;
+
+#if RM_CRC_SW_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_ctrl);
+    FSP_ASSERT(p_cfg);
+    FSP_ASSERT((CRC_POLYNOMIAL_CRC_8 <= p_cfg->polynomial) && (CRC_POLYNOMIAL_CRC_32C >= p_cfg->polynomial));
+    FSP_ASSERT(CRC_BIT_ORDER_LMS_MSB >= p_cfg->bit_order);
+    FSP_ERROR_RETURN(RM_CRC_SW_OPEN != p_instance_ctrl->open, FSP_ERR_ALREADY_OPEN);
+#endif
+
+    uint32_t polynomial;
+
+    switch (p_cfg->polynomial)
+    {
+        case CRC_POLYNOMIAL_CRC_8:
+        {
+            polynomial             = RM_CRC_SW_POLY_CRC_8;
+            p_instance_ctrl->width = 8U;
+            break;
+        }
+
+        case CRC_POLYNOMIAL_CRC_16:
+        {
+            polynomial             = RM_CRC_SW_POLY_CRC_16;
+            p_instance_ctrl->width = 16U;
+            break;
+        }
+
+        case CRC_POLYNOMIAL_CRC_CCITT:
+        {
+            polynomial             = RM_CRC_SW_POLY_CRC_CCITT;
+            p_instance_ctrl->width = 16U;
+            break;
+        }
+
+        case CRC_POLYNOMIAL_CRC_32:
+        {
+            polynomial             = RM_CRC_SW_POLY_CRC_32;
+            p_instance_ctrl->width = 32U;
+            break;
+        }
+
+        default:
+        {
+            polynomial             = RM_CRC_SW_POLY_CRC_32C;
+            p_instance_ctrl->width = 32U;
+            break;
+        }
+    }
+
+    p_instance_ctrl->p_cfg     = p_cfg;
+    p_instance_ctrl->reflected = (CRC_BIT_ORDER_LMS_LSB == p_cfg->bit_order);
+    p_instance_ctrl->result    = 0U;
+
+    rm_crc_sw_table_generate(p_instance_ctrl, polynomial);
+
+    /* Mark driver as initialized */
+    p_instance_ctrl->open = RM_CRC_SW_OPEN;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Close the software CRC module.
+ *
+ * Implements @ref crc_api_t::close
+ *
+ * @retval FSP_SUCCESS             Configuration was successful.
+ * @retval FSP_ERR_ASSERTION       p_ctrl is NULL.
+ * @retval FSP_ERR_NOT_OPEN        The driver is not opened.
+ **********************************************************************************************************************/
+fsp_err_t RM_CRC_SW_Close (crc_ctrl_t * const p_ctrl)
+{
+    rm_crc_sw_instance_ctrl_t * p_instance_ctrl = (rm_crc_sw_instance_ctrl_t *) p_ctrl;
+
+#if RM_CRC_SW_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_ctrl);
+    FSP_ERROR_RETURN(RM_CRC_SW_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    /* Mark driver as closed */
+    p_instance_ctrl->open = 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Perform a CRC calculation on a block of data in software.
+ *
+ * Implements @ref crc_api_t::calculate
+ *
+ * The input is interpreted the same way as by the CRC calculator: bytes for CRC-8, CRC-16 and CRC-CCITT, and 32-bit
+ * words for CRC-32 and CRC-32C (trailing bytes that do not fill a word are ignored). The seed is the initial value
+ * of the CRC register and no final XOR is applied.
+ *
+ * @retval FSP_SUCCESS              Calculation successful.
+ * @retval FSP_ERR_ASSERTION        Either p_ctrl, inputBuffer, or calculatedValue is NULL, or the input buffer is
+ *                                  not aligned for a 32-bit polynomial.
+ * @retval FSP_ERR_INVALID_ARGUMENT length value is NULL.
+ * @retval FSP_ERR_NOT_OPEN         The driver is not opened.
+ **********************************************************************************************************************/
+fsp_err_t RM_CRC_SW_Calculate (crc_ctrl_t * const p_ctrl, crc_input_t * const p_crc_input, uint32_t * calculatedValue)
+{
+    rm_crc_sw_instance_ctrl_t * p_instance_ctrl = (rm_crc_sw_instance_ctrl_t *) p_ctrl;
+
+#if RM_CRC_SW_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_ctrl);
+    FSP_ASSERT(NULL != p_crc_input);
+    FSP_ASSERT(NULL != p_crc_input->p_input_buffer);
+    FSP_ASSERT(calculatedValue);
+    FSP_ERROR_RETURN((0UL != p_crc_input->num_bytes), FSP_ERR_INVALID_ARGUMENT);
+    FSP_ERROR_RETURN(RM_CRC_SW_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT((32U != p_instance_ctrl->width) ||
+               (0U == ((uint32_t) p_crc_input->p_input_buffer & RM_CRC_SW_WORD_ALIGN_MASK)));
+#endif
+
+    bool word_input = (32U == p_instance_ctrl->width);
+
+    uint32_t shift  = 32U - p_instance_ctrl->width;
+    uint32_t length = word_input ? (p_crc_input->num_bytes & ~RM_CRC_SW_WORD_ALIGN_MASK) : p_crc_input->num_bytes;
+
+    /* Mask the seed to the polynomial width. MSB first calculations keep the register left aligned. */
+    uint32_t crc = (p_crc_input->crc_seed << shift) >> shift;
+    if (!p_instance_ctrl->reflected)
+    {
+        crc <<= shift;
+    }
+
+    crc = rm_crc_sw_update(p_instance_ctrl, crc, (uint8_t const *) p_crc_input->p_input_buffer, length, word_input);
+
+    if (!p_instance_ctrl->reflected)
+    {
+        crc >>= shift;
+    }
+
+    p_instance_ctrl->result = crc;
+    *calculatedValue        = crc;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Return the result of the last calculation.
+ *
+ * Implements @ref crc_api_t::crcResultGet
+ *
+ * @retval FSP_SUCCESS             Return of calculated value successful.
+ * @retval FSP_ERR_ASSERTION       Either p_ctrl or calculatedValue is NULL.
+ * @retval FSP_ERR_NOT_OPEN        The driver is not opened.
+ **********************************************************************************************************************/
+fsp_err_t RM_CRC_SW_CalculatedValueGet (crc_ctrl_t * const p_ctrl, uint32_t * calculatedValue)
+{
+    rm_crc_sw_instance_ctrl_t * p_instance_ctrl = (rm_crc_sw_instance_ctrl_t *) p_ctrl;
+
+#if RM_CRC_SW_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_ctrl);
+    FSP_ASSERT(calculatedValue);
+    FSP_ERROR_RETURN(RM_CRC_SW_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    *calculatedValue = p_instance_ctrl->result;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Snooping requires the CRC calculator peripheral.
+ *
+ * Implements @ref crc_api_t::snoopEnable
+ *
+ * @retval FSP_ERR_UNSUPPORTED     SNOOP operation is not supported.
+ **********************************************************************************************************************/
+fsp_err_t RM_CRC_SW_SnoopEnable (crc_ctrl_t * const p_ctrl, uint32_t crc_seed)
+{
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+    FSP_PARAMETER_NOT_USED(crc_seed);
+
+    return FSP_ERR_UNSUPPORTED;
+}
+
+/*******************************************************************************************************************//**
+ * Snooping requires the CRC calculator peripheral.
+ *
+ * Implements @ref crc_api_t::snoopDisable
+ *
+ * @retval FSP_ERR_UNSUPPORTED     SNOOP operation is not supported.
+ **********************************************************************************************************************/
+fsp_err_t RM_CRC_SW_SnoopDisable (crc_ctrl_t * const p_ctrl)
+{
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+
+    return FSP_ERR_UNSUPPORTED;
+}
+
+/** @} (end addtogroup RM_CRC_SW) */
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Reverse the lower bits of a value.
+ *
+ * @param[in]  value                   Value to reverse
+ * @param[in]  width                   Number of bits to reverse
+ **********************************************************************************************************************/
+static uint32_t rm_crc_sw_reflect (uint32_t value, uint32_t width)
+{
+    return __RBIT(value) >> (32U - width);
+}
+
+/*******************************************************************************************************************//**
+ * Generate the slicing-by-N lookup tables.
+ *
+ * Table 0 is the classic byte-wise table. Table k holds the CRC of a byte followed by k zero bytes, which lets the
+ * calculation fold 4 (or 8) input bytes per step. LSB first tables keep the register in the low bits; MSB first
+ * tables keep it left aligned so all widths share the same code.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to instance control block
+ * @param[in]  polynomial              Generator polynomial in normal (MSB first) form
+ **********************************************************************************************************************/
+static void rm_crc_sw_table_generate (rm_crc_sw_instance_ctrl_t * const p_instance_ctrl, uint32_t polynomial)
+{
+    uint32_t (* p_table)[256] = p_instance_ctrl->table;
+
+    if (p_instance_ctrl->reflected)
+    {
+        uint32_t reflected_polynomial = rm_crc_sw_reflect(polynomial, p_instance_ctrl->width);
+
+        for (uint32_t i = 0U; i < 256U; i++)
+        {
+            uint32_t crc = i;
+            for (uint32_t bit = 0U; bit < 8U; bit++)
+            {
+                crc = (crc & 1U) ? ((crc >> 1) ^ reflected_polynomial) : (crc >> 1);
+            }
+
+            p_table[0][i] = crc;
+        }
+
+        for (uint32_t k = 1U; k < RM_CRC_SW_CFG_SLICES; k++)
+        {
+            for (uint32_t i = 0U; i < 256U; i++)
+            {
+                p_table[k][i] = (p_table[k - 1U][i] >> 8) ^ p_table[0][p_table[k - 1U][i] & 0xFFU];
+            }
+        }
+    }
+    else
+    {
+        uint32_t aligned_polynomial = polynomial << (32U - p_instance_ctrl->width);
+
+        for (uint32_t i = 0U; i < 256U; i++)
+        {
+            uint32_t crc = i << 24;
+            for (uint32_t bit = 0U; bit < 8U; bit++)
+            {
+                crc = (crc & 0x80000000UL) ? ((crc << 1) ^ aligned_polynomial) : (crc << 1);
+            }
+
+            p_table[0][i] = crc;
+        }
+
+        for (uint32_t k = 1U; k < RM_CRC_SW_CFG_SLICES; k++)
+        {
+            for (uint32_t i = 0U; i < 256U; i++)
+            {
+                p_table[k][i] = (p_table[k - 1U][i] << 8) ^ p_table[0][p_table[k - 1U][i] >> 24];
+            }
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Update a CRC register value with a block of data.
+ *
+ * In byte input mode the data is a byte stream. In word input mode the data is a sequence of 32-bit words, each
+ * processed from its least significant bit (LSB first) or most significant bit (MSB first), as the CRC calculator
+ * does when words are written to CRCDIR.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to instance control block
+ * @param[in]  crc                     CRC register value (left aligned for MSB first)
+ * @param[in]  p_data                  Input data
+ * @param[in]  length                  Input length in bytes. Multiple of 4 in word input mode.
+ * @param[in]  word_input              True to process the data as 32-bit words
+ **********************************************************************************************************************/
+static uint32_t rm_crc_sw_update (rm_crc_sw_instance_ctrl_t * const p_instance_ctrl,
+                                  uint32_t                          crc,
+                                  uint8_t const                   * p_data,
+                                  uint32_t                          length,
+                                  bool                              word_input)
+{
+    uint32_t (* p_table)[256] = p_instance_ctrl->table;
+
+    if (p_instance_ctrl->reflected)
+    {
+        /* LSB first: a little endian word is the same bit stream as its bytes in memory order */
+        while ((0U != length) && (0U != ((uint32_t) p_data & RM_CRC_SW_WORD_ALIGN_MASK)))
+        {
+            crc = (crc >> 8) ^ p_table[0][(crc ^ *p_data) & 0xFFU];
+            p_data++;
+            length--;
+        }
+
+#if RM_CRC_SW_CFG_SLICES == 8
+        while (length >= 8U)
+        {
+            uint32_t lo = *(uint32_t const *) p_data ^ crc;
+            uint32_t hi = *(uint32_t const *) (p_data + 4U);
+
+            crc = p_table[7][lo & 0xFFU] ^ p_table[6][(lo >> 8) & 0xFFU] ^
+                  p_table[5][(lo >> 16) & 0xFFU] ^ p_table[4][lo >> 24] ^
+                  p_table[3][hi & 0xFFU] ^ p_table[2][(hi >> 8) & 0xFFU] ^
+                  p_table[1][(hi >> 16) & 0xFFU] ^ p_table[0][hi >> 24];
+            p_data += 8U;
+            length -= 8U;
+        }
+#endif
+
+#if RM_CRC_SW_CFG_SLICES >= 4
+        while (length >= 4U)
+        {
+            uint32_t word = *(uint32_t const *) p_data ^ crc;
+
+            crc = p_table[3][word & 0xFFU] ^ p_table[2][(word >> 8) & 0xFFU] ^
+                  p_table[1][(word >> 16) & 0xFFU] ^ p_table[0][word >> 24];
+            p_data += 4U;
+            length -= 4U;
+        }
+#endif
+
+        while (0U != length)
+        {
+            crc = (crc >> 8) ^ p_table[0][(crc ^ *p_data) & 0xFFU];
+            p_data++;
+            length--;
+        }
+    }
+    else
+    {
+        /* MSB first: byte streams are loaded big endian, CRCDIR words are used as is */
+        while ((0U != length) && (0U != ((uint32_t) p_data & RM_CRC_SW_WORD_ALIGN_MASK)))
+        {
+            crc = (crc << 8) ^ p_table[0][(crc >> 24) ^ *p_data];
+            p_data++;
+            length--;
+        }
+
+#if RM_CRC_SW_CFG_SLICES == 8
+        while (length >= 8U)
+        {
+            uint32_t hi = *(uint32_t const *) p_data;
+            uint32_t lo = *(uint32_t const *) (p_data + 4U);
+            if (!word_input)
+            {
+                hi = __REV(hi);
+                lo = __REV(lo);
+            }
+
+            hi ^= crc;
+            crc = p_table[7][hi >> 24] ^ p_table[6][(hi >> 16) & 0xFFU] ^
+                  p_table[5][(hi >> 8) & 0xFFU] ^ p_table[4][hi & 0xFFU] ^
+                  p_table[3][lo >> 24] ^ p_table[2][(lo >> 16) & 0xFFU] ^
+                  p_table[1][(lo >> 8) & 0xFFU] ^ p_table[0][lo & 0xFFU];
+            p_data += 8U;
+            length -= 8U;
+        }
+#endif
+
+        while (length >= 4U)
+        {
+            uint32_t word = *(uint32_t const *) p_data;
+            if (!word_input)
+            {
+                word = __REV(word);
+            }
+
+#if RM_CRC_SW_CFG_SLICES >= 4
+            word ^= crc;
+            crc   = p_table[3][word >> 24] ^ p_table[2][(word >> 16) & 0xFFU] ^
+                    p_table[1][(word >> 8) & 0xFFU] ^ p_table[0][word & 0xFFU];
+#else
+            for (uint32_t bit_shift = 32U; bit_shift > 0U; bit_shift -= 8U)
+            {
+                crc = (crc << 8) ^ p_table[0][(crc >> 24) ^ ((word >> (bit_shift - 8U)) & 0xFFU)];
+            }
+#endif
+            p_data += 4U;
+            length -= 4U;
+        }
+
+        while (0U != length)
+        {
+            crc = (crc << 8) ^ p_table[0][(crc >> 24) ^ *p_data];
+            p_data++;
+            length--;
+        }
+    }
+
+    return crc;
+}
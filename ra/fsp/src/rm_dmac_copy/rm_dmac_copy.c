@@ -0,0 +1,657 @@
+/***********************************************************************************************************************
+ * Copyright [2020-2024] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include <string.h>
+#include "rm_dmac_copy.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define RM_DMAC_COPY_OPEN                   (0x444D4350U) // "DMCP" in ASCII
+
+/* Maximum number of transfers in one DMAC normal mode transfer (DMCRA is 16 bits) */
+#define RM_DMAC_COPY_MAX_TRANSFER_COUNT     (0xFFFFU)
+
+#define RM_DMAC_COPY_ALIGN_2_BYTES_MASK     (0x1U)
+#define RM_DMAC_COPY_ALIGN_4_BYTES_MASK     (0x3U)
+
+/* Replicates a byte to all bytes of a word */
+#define RM_DMAC_COPY_FILL_REPLICATE         (0x01010101U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static void rm_dmac_copy_chunk_start(rm_dmac_copy_channel_t * const p_channel);
+static void rm_dmac_copy_job_start(rm_dmac_copy_channel_t * const p_channel, rm_dmac_copy_job_t * const p_job);
+static void rm_dmac_copy_job_notify(rm_dmac_copy_instance_ctrl_t * const p_ctrl,
+                                    rm_dmac_copy_job_t * const           p_job,
+                                    rm_dmac_copy_event_t                 event);
+static void rm_dmac_copy_cpu_copy(rm_dmac_copy_job_t * const p_job);
+static void rm_dmac_copy_job_enqueue(rm_dmac_copy_instance_ctrl_t * const p_ctrl, rm_dmac_copy_job_t * const p_job);
+
+#if BSP_FEATURE_DWT_CYCCNT
+static void rm_dmac_copy_benchmark_callback(rm_dmac_copy_callback_args_t * p_args);
+
+#endif
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Global variables
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_DMAC_COPY
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Opens the DMAC channels owned by the copy engine and routes their transfer end interrupts to the engine.
+ *
+ * @retval FSP_SUCCESS                 Copy engine successfully opened.
+ * @retval FSP_ERR_ASSERTION           A required pointer is NULL or the channel count is invalid.
+ * @retval FSP_ERR_ALREADY_OPEN        Module is already open.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ **********************************************************************************************************************/
+fsp_err_t RM_DMAC_COPY_Open (rm_dmac_copy_instance_ctrl_t * const p_ctrl, rm_dmac_copy_cfg_t const * const p_cfg)
+{
+    fsp_err_t err = FSP_SUCCESS;
+
+#if RM_DMAC_COPY_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_transfer_instances);
+    FSP_ASSERT((0U != p_cfg->num_channels) && (BSP_FEATURE_DMAC_MAX_CHANNEL >= p_cfg->num_channels));
+    FSP_ERROR_RETURN(RM_DMAC_COPY_OPEN != p_ctrl->open, FSP_ERR_ALREADY_OPEN);
+#endif
+
+    p_ctrl->p_cfg  = p_cfg;
+    p_ctrl->p_head = NULL;
+    p_ctrl->p_tail = NULL;
+
+    for (uint8_t i = 0U; i < p_cfg->num_channels; i++)
+    {
+        rm_dmac_copy_channel_t    * p_channel  = &p_ctrl->channels[i];
+        transfer_instance_t const * p_transfer = p_cfg->p_transfer_instances[i];
+
+        p_channel->p_ctrl     = p_ctrl;
+        p_channel->p_transfer = p_transfer;
+        p_channel->p_job      = NULL;
+        p_channel->chunk      = 0U;
+
+        err = p_transfer->p_api->open(p_transfer->p_ctrl, p_transfer->p_cfg);
+        if (FSP_SUCCESS == err)
+        {
+            /* Route the transfer end interrupt of this channel to the copy engine */
+            err = p_transfer->p_api->callbackSet(p_transfer->p_ctrl, rm_dmac_copy_transfer_callback, p_channel, NULL);
+        }
+
+        if (FSP_SUCCESS != err)
+        {
+            /* Close the channels that were already opened */
+            for (uint8_t j = 0U; j <= i; j++)
+            {
+                transfer_instance_t const * p_opened = p_cfg->p_transfer_instances[j];
+                (void) p_opened->p_api->close(p_opened->p_ctrl);
+            }
+
+            return err;
+        }
+    }
+
+    p_ctrl->open = RM_DMAC_COPY_OPEN;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Submits a copy job. The job starts immediately if a DMAC channel is idle, otherwise it is queued and started from the
+ * DMAC transfer end interrupt when a channel becomes free. Jobs are split into transfers that fit the DMAC transfer
+ * count limit and use the widest transfer size allowed by the alignment of the source and destination.
+ *
+ * Jobs smaller than rm_dmac_copy_cfg_t::cpu_copy_threshold are completed by the CPU before this function returns.
+ *
+ * @retval FSP_SUCCESS                 Job started, queued or completed.
+ * @retval FSP_ERR_ASSERTION           A required pointer is NULL or the job is invalid.
+ * @retval FSP_ERR_NOT_OPEN            Module is not open.
+ * @retval FSP_ERR_IN_USE              The job is already queued or active.
+ **********************************************************************************************************************/
+fsp_err_t RM_DMAC_COPY_Submit (rm_dmac_copy_instance_ctrl_t * const p_ctrl, rm_dmac_copy_job_t * const p_job)
+{
+#if RM_DMAC_COPY_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_job);
+    FSP_ERROR_RETURN(RM_DMAC_COPY_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT(NULL != p_job->p_dest);
+    FSP_ASSERT(0U != p_job->length);
+    FSP_ASSERT((RM_DMAC_COPY_JOB_TYPE_FILL == p_job->type) || (NULL != p_job->p_src));
+    FSP_ASSERT((RM_DMAC_COPY_JOB_TYPE_COPY_2D != p_job->type) || (0U != p_job->rows));
+#endif
+
+    FSP_ERROR_RETURN((RM_DMAC_COPY_JOB_STATE_QUEUED != p_job->state) &&
+                     (RM_DMAC_COPY_JOB_STATE_ACTIVE != p_job->state),
+                     FSP_ERR_IN_USE);
+
+    uint32_t rows = (RM_DMAC_COPY_JOB_TYPE_COPY_2D == p_job->type) ? p_job->rows : 1U;
+
+    p_job->p_next       = NULL;
+    p_job->row          = 0U;
+    p_job->offset       = 0U;
+    p_job->fill_pattern = (uint32_t) p_job->value * RM_DMAC_COPY_FILL_REPLICATE;
+
+    /* Small copies are faster on the CPU than the DMAC setup and interrupt latency */
+    if ((uint64_t) p_job->length * rows < p_ctrl->p_cfg->cpu_copy_threshold)
+    {
+        rm_dmac_copy_cpu_copy(p_job);
+        rm_dmac_copy_job_notify(p_ctrl, p_job, RM_DMAC_COPY_EVENT_JOB_COMPLETE);
+
+        return FSP_SUCCESS;
+    }
+
+    rm_dmac_copy_job_enqueue(p_ctrl, p_job);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Measures the time taken to copy a buffer with the CPU (memcpy) and with the DMAC. Use it to choose
+ * rm_dmac_copy_cfg_t::cpu_copy_threshold for the sizes and alignments used by the application, for example by
+ * calling it for lengths from 16 bytes to 64 KiB with source and destination pointers offset by 0 to 3 bytes.
+ *
+ * The DMAC time is measured from submission until the job is marked complete in the transfer end interrupt, so it
+ * includes the setup, all transfers and the interrupts between them. cpu_copy_threshold is ignored so the DMAC is
+ * always used. Call from a thread while no other jobs are queued; the DMAC interrupts must be able to preempt the
+ * caller. Both copies write p_dest.
+ *
+ * @retval FSP_SUCCESS                 p_result holds the measurement.
+ * @retval FSP_ERR_ASSERTION           A required pointer is NULL or length is 0.
+ * @retval FSP_ERR_NOT_OPEN            Module is not open.
+ * @retval FSP_ERR_UNSUPPORTED         The MCU has no DWT cycle counter.
+ **********************************************************************************************************************/
+fsp_err_t RM_DMAC_COPY_Benchmark (rm_dmac_copy_instance_ctrl_t * const p_ctrl,
+                                  void * const                         p_dest,
+                                  void const * const                   p_src,
+                                  uint32_t const                       length,
+                                  rm_dmac_copy_benchmark_t * const     p_result)
+{
+#if RM_DMAC_COPY_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_dest);
+    FSP_ASSERT(NULL != p_src);
+    FSP_ASSERT(0U != length);
+    FSP_ASSERT(NULL != p_result);
+    FSP_ERROR_RETURN(RM_DMAC_COPY_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+#if BSP_FEATURE_DWT_CYCCNT
+    R_BSP_CycleCounterEnable();
+
+    /* Cycles taken to read the counter twice, subtracted from both results. */
+    uint32_t start    = DWT->CYCCNT;
+    uint32_t overhead = DWT->CYCCNT - start;
+
+    start = DWT->CYCCNT;
+    memcpy(p_dest, p_src, length);
+    p_result->cpu_cycles = (DWT->CYCCNT - start) - overhead;
+
+    rm_dmac_copy_job_t job;
+    memset(&job, 0, sizeof(job));
+    job.type       = RM_DMAC_COPY_JOB_TYPE_COPY;
+    job.p_src      = p_src;
+    job.p_dest     = p_dest;
+    job.length     = length;
+    job.p_callback = rm_dmac_copy_benchmark_callback;
+
+    start = DWT->CYCCNT;
+    rm_dmac_copy_job_enqueue(p_ctrl, &job);
+    while (RM_DMAC_COPY_JOB_STATE_COMPLETE != job.state)
+    {
+        /* Wait for the transfer end interrupt to complete the job. */
+    }
+
+    p_result->dmac_cycles = (DWT->CYCCNT - start) - overhead;
+    p_result->length      = length;
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+    FSP_PARAMETER_NOT_USED(p_dest);
+    FSP_PARAMETER_NOT_USED(p_src);
+    FSP_PARAMETER_NOT_USED(length);
+    FSP_PARAMETER_NOT_USED(p_result);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
+#if BSP_CFG_RTOS
+
+/*******************************************************************************************************************//**
+ * Blocks until a job completes by taking rm_dmac_copy_job_t::p_semaphore. Call at most once per submission.
+ *
+ * @retval FSP_SUCCESS                 The job completed.
+ * @retval FSP_ERR_ASSERTION           A required pointer is NULL or the job has no semaphore.
+ * @retval FSP_ERR_NOT_OPEN            Module is not open.
+ * @retval FSP_ERR_TIMEOUT             The job did not complete within the timeout.
+ **********************************************************************************************************************/
+fsp_err_t RM_DMAC_COPY_JobWait (rm_dmac_copy_instance_ctrl_t * const p_ctrl,
+                                rm_dmac_copy_job_t * const           p_job,
+                                uint32_t const                       timeout)
+{
+ #if RM_DMAC_COPY_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_job);
+    FSP_ASSERT(NULL != p_job->p_semaphore);
+    FSP_ERROR_RETURN(RM_DMAC_COPY_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+ #else
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+ #endif
+
+ #if BSP_CFG_RTOS == 1                 // ThreadX
+    UINT status = tx_semaphore_get(p_job->p_semaphore->p_semaphore_handle, (ULONG) timeout);
+    FSP_ERROR_RETURN(TX_SUCCESS == status, FSP_ERR_TIMEOUT);
+ #elif BSP_CFG_RTOS == 2               // FreeRTOS
+    BaseType_t sem_err = xSemaphoreTake(*(p_job->p_semaphore->p_semaphore_handle), (TickType_t) timeout);
+    FSP_ERROR_RETURN(pdTRUE == sem_err, FSP_ERR_TIMEOUT);
+ #endif
+
+    return FSP_SUCCESS;
+}
+
+#endif
+
+/*******************************************************************************************************************//**
+ * Stops all transfers, aborts active and queued jobs and closes the DMAC channels.
+ *
+ * @retval FSP_SUCCESS                 Copy engine closed.
+ * @retval FSP_ERR_ASSERTION           p_ctrl is NULL.
+ * @retval FSP_ERR_NOT_OPEN            Module is not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_DMAC_COPY_Close (rm_dmac_copy_instance_ctrl_t * const p_ctrl)
+{
+#if RM_DMAC_COPY_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_DMAC_COPY_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    p_ctrl->open = 0U;
+
+    /* Detach the queue first so that a channel which completes before it is closed cannot start a queued job. The DMAC
+     * end interrupts of the other channels pop the head of the queue, so this must be done in a critical section. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    rm_dmac_copy_job_t * p_queued = p_ctrl->p_head;
+    p_ctrl->p_head = NULL;
+    p_ctrl->p_tail = NULL;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    for (uint8_t i = 0U; i < p_ctrl->p_cfg->num_channels; i++)
+    {
+        rm_dmac_copy_channel_t    * p_channel  = &p_ctrl->channels[i];
+        transfer_instance_t const * p_transfer = p_channel->p_transfer;
+
+        (void) p_transfer->p_api->close(p_transfer->p_ctrl);
+
+        if (NULL != p_channel->p_job)
+        {
+            rm_dmac_copy_job_t * p_job = p_channel->p_job;
+            p_channel->p_job = NULL;
+            rm_dmac_copy_job_notify(p_ctrl, p_job, RM_DMAC_COPY_EVENT_JOB_ABORTED);
+        }
+    }
+
+    while (NULL != p_queued)
+    {
+        rm_dmac_copy_job_t * p_job = p_queued;
+        p_queued = p_job->p_next;
+        rm_dmac_copy_job_notify(p_ctrl, p_job, RM_DMAC_COPY_EVENT_JOB_ABORTED);
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * DMAC transfer end callback. Starts the next transfer of the active job, or completes the job and starts the next
+ * queued job on the same channel.
+ *
+ * @param[in]  p_args    Callback arguments. p_context is the channel state.
+ **********************************************************************************************************************/
+void rm_dmac_copy_transfer_callback (transfer_callback_args_t * p_args)
+{
+    rm_dmac_copy_channel_t       * p_channel = (rm_dmac_copy_channel_t *) p_args->p_context;
+    rm_dmac_copy_instance_ctrl_t * p_ctrl    = p_channel->p_ctrl;
+    rm_dmac_copy_job_t           * p_job     = p_channel->p_job;
+
+    if (NULL == p_job)
+    {
+        return;
+    }
+
+    uint32_t rows = (RM_DMAC_COPY_JOB_TYPE_COPY_2D == p_job->type) ? p_job->rows : 1U;
+
+    p_job->offset += p_channel->chunk;
+    if (p_job->offset >= p_job->length)
+    {
+        p_job->offset = 0U;
+        p_job->row++;
+    }
+
+    if (p_job->row < rows)
+    {
+        rm_dmac_copy_chunk_start(p_channel);
+
+        return;
+    }
+
+    /* Take the next queued job before notifying so the channel is kept busy while the callback runs */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    rm_dmac_copy_job_t * p_next = p_ctrl->p_head;
+    if (NULL != p_next)
+    {
+        p_ctrl->p_head = p_next->p_next;
+        if (NULL == p_ctrl->p_head)
+        {
+            p_ctrl->p_tail = NULL;
+        }
+    }
+
+    p_channel->p_job = p_next;
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    if (NULL != p_next)
+    {
+        rm_dmac_copy_job_start(p_channel, p_next);
+    }
+
+    rm_dmac_copy_job_notify(p_ctrl, p_job, RM_DMAC_COPY_EVENT_JOB_COMPLETE);
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_DMAC_COPY)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Starts a job on a channel that has already been claimed for it.
+ *
+ * @param[in]  p_channel    Channel state.
+ * @param[in]  p_job        Job to start.
+ **********************************************************************************************************************/
+static void rm_dmac_copy_job_start (rm_dmac_copy_channel_t * const p_channel, rm_dmac_copy_job_t * const p_job)
+{
+    p_job->state = RM_DMAC_COPY_JOB_STATE_ACTIVE;
+    p_job->row   = 0U;
+
+    rm_dmac_copy_chunk_start(p_channel);
+}
+
+/*******************************************************************************************************************//**
+ * Configures and starts the next DMAC transfer of the active job.
+ *
+ * The transfer size is the widest of 4, 2 or 1 bytes allowed by the alignment of the current source and destination
+ * addresses. If the source and destination are misaligned by the same amount, a short head transfer is issued first so
+ * the rest of the row can use a wider transfer size.
+ *
+ * @param[in]  p_channel    Channel state.
+ **********************************************************************************************************************/
+static void rm_dmac_copy_chunk_start (rm_dmac_copy_channel_t * const p_channel)
+{
+    rm_dmac_copy_job_t * p_job     = p_channel->p_job;
+    uint32_t             remaining = p_job->length - p_job->offset;
+    uint32_t             dest      = (uint32_t) p_job->p_dest + (p_job->row * p_job->dest_stride) + p_job->offset;
+    uint32_t             src;
+    transfer_addr_mode_t src_addr_mode;
+
+    if (RM_DMAC_COPY_JOB_TYPE_FILL == p_job->type)
+    {
+        /* The DMAC reads the fill pattern from a fixed word; only the destination alignment matters */
+        src           = (uint32_t) &p_job->fill_pattern;
+        src_addr_mode = TRANSFER_ADDR_MODE_FIXED;
+    }
+    else
+    {
+        src           = (uint32_t) p_job->p_src + (p_job->row * p_job->src_stride) + p_job->offset;
+        src_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED;
+    }
+
+    uint32_t misalignment = (RM_DMAC_COPY_JOB_TYPE_FILL == p_job->type) ? dest : (src | dest);
+    uint32_t difference   = (RM_DMAC_COPY_JOB_TYPE_FILL == p_job->type) ? 0U : (src ^ dest);
+
+    transfer_size_t size;
+    uint32_t        count;
+
+    if ((0U == (misalignment & RM_DMAC_COPY_ALIGN_4_BYTES_MASK)) && (4U <= remaining))
+    {
+        size  = TRANSFER_SIZE_4_BYTE;
+        count = remaining >> 2U;
+    }
+    else if ((0U == (misalignment & RM_DMAC_COPY_ALIGN_2_BYTES_MASK)) && (2U <= remaining))
+    {
+        size = TRANSFER_SIZE_2_BYTE;
+
+        /* A single 2 byte transfer reaches 4 byte alignment if both addresses are misaligned by 2 */
+        count = ((0U == (difference & RM_DMAC_COPY_ALIGN_4_BYTES_MASK)) && (4U <= remaining)) ? 1U : (remaining >> 1U);
+    }
+    else
+    {
+        size  = TRANSFER_SIZE_1_BYTE;
+        count = remaining;
+
+        if ((0U == (difference & RM_DMAC_COPY_ALIGN_4_BYTES_MASK)) && (4U <= remaining))
+        {
+            /* Copy bytes up to the next 4 byte boundary */
+            count = 4U - (dest & RM_DMAC_COPY_ALIGN_4_BYTES_MASK);
+        }
+        else if ((0U == (difference & RM_DMAC_COPY_ALIGN_2_BYTES_MASK)) && (2U <= remaining))
+        {
+            /* Copy one byte to reach the next 2 byte boundary */
+            count = 1U;
+        }
+        else
+        {
+            /* Do nothing. */
+        }
+    }
+
+    if (RM_DMAC_COPY_MAX_TRANSFER_COUNT < count)
+    {
+        count = RM_DMAC_COPY_MAX_TRANSFER_COUNT;
+    }
+
+    p_channel->chunk = count << size;
+
+    transfer_info_t * p_info = &p_channel->info;
+    p_info->transfer_settings_word                  = 0U;
+    p_info->transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_info->transfer_settings_word_b.repeat_area    = TRANSFER_REPEAT_AREA_SOURCE;
+    p_info->transfer_settings_word_b.irq            = TRANSFER_IRQ_END;
+    p_info->transfer_settings_word_b.chain_mode     = TRANSFER_CHAIN_MODE_DISABLED;
+    p_info->transfer_settings_word_b.src_addr_mode  = src_addr_mode;
+    p_info->transfer_settings_word_b.size           = size;
+    p_info->transfer_settings_word_b.mode           = TRANSFER_MODE_NORMAL;
+    p_info->p_src      = (void const *) src;
+    p_info->p_dest     = (void *) dest;
+    p_info->num_blocks = 0U;
+    p_info->length     = (uint16_t) count;
+
+    transfer_instance_t const * p_transfer = p_channel->p_transfer;
+    (void) p_transfer->p_api->reconfigure(p_transfer->p_ctrl, p_info);
+    (void) p_transfer->p_api->softwareStart(p_transfer->p_ctrl, TRANSFER_START_MODE_REPEAT);
+}
+
+/*******************************************************************************************************************//**
+ * Marks a job as finished and notifies the application.
+ *
+ * @param[in]  p_ctrl       Instance control block.
+ * @param[in]  p_job        Finished job.
+ * @param[in]  event        RM_DMAC_COPY_EVENT_JOB_COMPLETE or RM_DMAC_COPY_EVENT_JOB_ABORTED.
+ **********************************************************************************************************************/
+static void rm_dmac_copy_job_notify (rm_dmac_copy_instance_ctrl_t * const p_ctrl,
+                                     rm_dmac_copy_job_t * const           p_job,
+                                     rm_dmac_copy_event_t                 event)
+{
+    p_job->state = (RM_DMAC_COPY_EVENT_JOB_COMPLETE == event) ?
+                   RM_DMAC_COPY_JOB_STATE_COMPLETE : RM_DMAC_COPY_JOB_STATE_IDLE;
+
+    void (* p_callback)(rm_dmac_copy_callback_args_t *) = p_job->p_callback;
+    void const * p_context = p_job->p_context;
+    if (NULL == p_callback)
+    {
+        p_callback = p_ctrl->p_cfg->p_callback;
+        p_context  = p_ctrl->p_cfg->p_context;
+    }
+
+    if (NULL != p_callback)
+    {
+        rm_dmac_copy_callback_args_t args;
+        args.event     = event;
+        args.p_job     = p_job;
+        args.p_context = p_context;
+        p_callback(&args);
+    }
+
+#if BSP_CFG_RTOS
+    if (NULL != p_job->p_semaphore)
+    {
+ #if BSP_CFG_RTOS == 1                 // ThreadX
+        (void) tx_semaphore_put(p_job->p_semaphore->p_semaphore_handle);
+ #elif BSP_CFG_RTOS == 2               // FreeRTOS
+
+        /* Jobs below the CPU copy threshold complete in the task that submitted them. */
+        if (0U == __get_IPSR())
+        {
+            (void) xSemaphoreGive(*(p_job->p_semaphore->p_semaphore_handle));
+        }
+        else
+        {
+            BaseType_t higher_priority_task_woken = pdFALSE;
+            (void) xSemaphoreGiveFromISR(*(p_job->p_semaphore->p_semaphore_handle), &higher_priority_task_woken);
+            portYIELD_FROM_ISR(higher_priority_task_woken);
+        }
+ #endif
+    }
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Starts a job on an idle DMAC channel or appends it to the queue.
+ *
+ * @param[in]  p_ctrl       Instance control block.
+ * @param[in]  p_job        Job to start.
+ **********************************************************************************************************************/
+static void rm_dmac_copy_job_enqueue (rm_dmac_copy_instance_ctrl_t * const p_ctrl, rm_dmac_copy_job_t * const p_job)
+{
+    rm_dmac_copy_channel_t * p_idle = NULL;
+
+    /* Claim an idle channel or queue the job. The queue is also modified from the DMAC interrupts. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    for (uint8_t i = 0U; i < p_ctrl->p_cfg->num_channels; i++)
+    {
+        if (NULL == p_ctrl->channels[i].p_job)
+        {
+            p_idle        = &p_ctrl->channels[i];
+            p_idle->p_job = p_job;
+            break;
+        }
+    }
+
+    if (NULL == p_idle)
+    {
+        p_job->state = RM_DMAC_COPY_JOB_STATE_QUEUED;
+
+        if (NULL == p_ctrl->p_tail)
+        {
+            p_ctrl->p_head = p_job;
+        }
+        else
+        {
+            p_ctrl->p_tail->p_next = p_job;
+        }
+
+        p_ctrl->p_tail = p_job;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    if (NULL != p_idle)
+    {
+        rm_dmac_copy_job_start(p_idle, p_job);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Performs a job with the CPU.
+ *
+ * @param[in]  p_job        Job to perform.
+ **********************************************************************************************************************/
+static void rm_dmac_copy_cpu_copy (rm_dmac_copy_job_t * const p_job)
+{
+    uint32_t rows = (RM_DMAC_COPY_JOB_TYPE_COPY_2D == p_job->type) ? p_job->rows : 1U;
+
+    for (uint32_t row = 0U; row < rows; row++)
+    {
+        uint8_t * p_dest = (uint8_t *) p_job->p_dest + (row * p_job->dest_stride);
+
+        if (RM_DMAC_COPY_JOB_TYPE_FILL == p_job->type)
+        {
+            memset(p_dest, p_job->value, p_job->length);
+        }
+        else
+        {
+            memcpy(p_dest, (uint8_t const *) p_job->p_src + (row * p_job->src_stride), p_job->length);
+        }
+    }
+}
+
+#if BSP_FEATURE_DWT_CYCCNT
+
+/*******************************************************************************************************************//**
+ * Completion callback of the job submitted by RM_DMAC_COPY_Benchmark. RM_DMAC_COPY_Benchmark polls the job state, so
+ * the default callback must not be called for it.
+ *
+ * @param[in]  p_args    Callback arguments.
+ **********************************************************************************************************************/
+static void rm_dmac_copy_benchmark_callback (rm_dmac_copy_callback_args_t * p_args)
+{
+    FSP_PARAMETER_NOT_USED(p_args);
+}
+
+#endif
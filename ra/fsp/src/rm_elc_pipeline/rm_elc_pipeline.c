@@ -0,0 +1,512 @@
+/***********************************************************************************************************************
+ * Copyright [2020-2024] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "rm_elc_pipeline.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define RM_ELC_PIPELINE_OPEN    (0x454C4350U) // "ELCP" in ASCII
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static elc_event_t rm_elc_pipeline_event_get(rm_elc_pipeline_stage_t const * const p_stage);
+static elc_event_t rm_elc_pipeline_trigger_get(rm_elc_pipeline_cfg_t const * const p_cfg, uint32_t index);
+static bool        rm_elc_pipeline_input_get(rm_elc_pipeline_stage_t const * const p_stage,
+                                             elc_peripheral_t * const              p_input);
+static fsp_err_t rm_elc_pipeline_stage_start(rm_elc_pipeline_stage_t const * const p_stage);
+static fsp_err_t rm_elc_pipeline_stage_stop(rm_elc_pipeline_stage_t const * const p_stage);
+static void      rm_elc_pipeline_links_release(rm_elc_pipeline_instance_ctrl_t * const p_ctrl);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/* ELC inputs linked by all open pipelines. An input can only belong to one pipeline. */
+static uint32_t g_rm_elc_pipeline_elc_inputs = 0U;
+
+/***********************************************************************************************************************
+ * Global variables
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_ELC_PIPELINE
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Validates the pipeline, resolves the events that connect the stages and creates the ELC links. All instances in
+ * the pipeline and the ELC instance must already be open. Nothing is started until RM_ELC_PIPELINE_Start is called.
+ *
+ * An event can trigger only one stage of a pipeline, and an ELC input can only be linked by one open pipeline.
+ *
+ * @retval FSP_SUCCESS                 Pipeline validated and linked.
+ * @retval FSP_ERR_ASSERTION           A required pointer is NULL or a stage is invalid.
+ * @retval FSP_ERR_ALREADY_OPEN        Module is already open.
+ * @retval FSP_ERR_IN_USE              An event triggers more than one stage or an ELC input is already linked.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ **********************************************************************************************************************/
+fsp_err_t RM_ELC_PIPELINE_Open (rm_elc_pipeline_instance_ctrl_t * const p_ctrl, rm_elc_pipeline_cfg_t const * const p_cfg)
+{
+#if RM_ELC_PIPELINE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_elc);
+    FSP_ASSERT(NULL != p_cfg->p_stages);
+    FSP_ASSERT(p_cfg->num_stages > 0U);
+    FSP_ERROR_RETURN(RM_ELC_PIPELINE_OPEN != p_ctrl->open, FSP_ERR_ALREADY_OPEN);
+
+    for (uint32_t i = 0U; i < p_cfg->num_stages; i++)
+    {
+        rm_elc_pipeline_stage_t const * p_stage = &p_cfg->p_stages[i];
+        FSP_ASSERT(NULL != p_stage->p_instance);
+        if ((RM_ELC_PIPELINE_STAGE_TYPE_TIMER == p_stage->type) || (RM_ELC_PIPELINE_STAGE_TYPE_DAC == p_stage->type))
+        {
+            FSP_ASSERT(0U != (BSP_ELC_PERIPHERAL_MASK & (1U << (uint32_t) p_stage->elc_input)));
+        }
+    }
+#endif
+
+    uint32_t         elc_inputs = 0U;
+    elc_peripheral_t input;
+
+    for (uint32_t i = 0U; i < p_cfg->num_stages; i++)
+    {
+        rm_elc_pipeline_stage_t const * p_stage = &p_cfg->p_stages[i];
+        elc_event_t                     trigger = rm_elc_pipeline_trigger_get(p_cfg, i);
+
+        /* Stages without a trigger are started by software. */
+        if (ELC_EVENT_NONE == trigger)
+        {
+            continue;
+        }
+
+        /* An event consumed by two stages would make the pipeline depend on the order of hardware requests. */
+        for (uint32_t j = 0U; j < i; j++)
+        {
+            FSP_ERROR_RETURN(trigger != rm_elc_pipeline_trigger_get(p_cfg, j), FSP_ERR_IN_USE);
+        }
+
+        if (rm_elc_pipeline_input_get(p_stage, &input))
+        {
+            uint32_t input_mask = 1U << (uint32_t) input;
+            FSP_ERROR_RETURN(0U == (elc_inputs & input_mask), FSP_ERR_IN_USE);
+            elc_inputs |= input_mask;
+        }
+
+        /* Fill in the ADC data register window for a transfer that reads the scan results of the previous stage. */
+        if ((RM_ELC_PIPELINE_STAGE_TYPE_TRANSFER == p_stage->type) && (NULL != p_stage->p_info) &&
+            (NULL == p_stage->p_info->p_src) && (i > 0U) &&
+            (RM_ELC_PIPELINE_STAGE_TYPE_ADC == p_cfg->p_stages[i - 1U].type))
+        {
+            adc_instance_t const * p_adc = (adc_instance_t const *) p_cfg->p_stages[i - 1U].p_instance;
+            adc_info_t             info;
+            fsp_err_t              err = p_adc->p_api->infoGet(p_adc->p_ctrl, &info);
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+            p_stage->p_info->p_src = (void const *) info.p_address;
+            p_stage->p_info->transfer_settings_word_b.size = info.transfer_size;
+            if (0U == p_stage->p_info->length)
+            {
+                p_stage->p_info->length = (uint16_t) info.length;
+            }
+        }
+    }
+
+    /* Claim the ELC inputs against other open pipelines. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    bool available = (0U == (g_rm_elc_pipeline_elc_inputs & elc_inputs));
+    if (available)
+    {
+        g_rm_elc_pipeline_elc_inputs |= elc_inputs;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+    FSP_ERROR_RETURN(available, FSP_ERR_IN_USE);
+
+    p_ctrl->p_cfg      = p_cfg;
+    p_ctrl->elc_inputs = elc_inputs;
+    p_ctrl->running    = false;
+
+    /* Create the links. The consumers are not enabled yet, so events passed on before the pipeline starts are ignored
+     * by the hardware. */
+    elc_instance_t const * p_elc = p_cfg->p_elc;
+    for (uint32_t i = 0U; i < p_cfg->num_stages; i++)
+    {
+        elc_event_t trigger = rm_elc_pipeline_trigger_get(p_cfg, i);
+        if ((ELC_EVENT_NONE != trigger) && rm_elc_pipeline_input_get(&p_cfg->p_stages[i], &input))
+        {
+            fsp_err_t err = p_elc->p_api->linkSet(p_elc->p_ctrl, input, trigger);
+            if (FSP_SUCCESS != err)
+            {
+                rm_elc_pipeline_links_release(p_ctrl);
+
+                return err;
+            }
+        }
+    }
+
+    p_ctrl->open = RM_ELC_PIPELINE_OPEN;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Enables the ELC and starts every stage. Consumers are started before their producers so that no event is produced
+ * before the stage it triggers is ready. All stages are started with interrupts disabled, so the chain starts as one
+ * step with respect to application code and interrupts. If a stage fails to start, the stages already started are
+ * stopped again.
+ *
+ * @retval FSP_SUCCESS                 Pipeline started.
+ * @retval FSP_ERR_ASSERTION           p_ctrl is NULL.
+ * @retval FSP_ERR_NOT_OPEN            Module is not open.
+ * @retval FSP_ERR_IN_USE              Pipeline is already running.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ **********************************************************************************************************************/
+fsp_err_t RM_ELC_PIPELINE_Start (rm_elc_pipeline_instance_ctrl_t * const p_ctrl)
+{
+#if RM_ELC_PIPELINE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_ELC_PIPELINE_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(!p_ctrl->running, FSP_ERR_IN_USE);
+
+    rm_elc_pipeline_cfg_t const * p_cfg = p_ctrl->p_cfg;
+    elc_instance_t const        * p_elc = p_cfg->p_elc;
+
+    fsp_err_t err = p_elc->p_api->enable(p_elc->p_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    uint32_t i = p_cfg->num_stages;
+    while ((FSP_SUCCESS == err) && (i > 0U))
+    {
+        i--;
+        err = rm_elc_pipeline_stage_start(&p_cfg->p_stages[i]);
+    }
+
+    if (FSP_SUCCESS != err)
+    {
+        /* Undo the stages downstream of the one that failed, producers first. */
+        for (uint32_t j = i + 1U; j < p_cfg->num_stages; j++)
+        {
+            (void) rm_elc_pipeline_stage_stop(&p_cfg->p_stages[j]);
+        }
+    }
+    else
+    {
+        p_ctrl->running = true;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Stops every stage, producers first, so that no stage is left waiting for data from a stage that was stopped. All
+ * stages are stopped even if one of them reports an error; the first error is returned.
+ *
+ * @retval FSP_SUCCESS                 Pipeline stopped.
+ * @retval FSP_ERR_ASSERTION           p_ctrl is NULL.
+ * @retval FSP_ERR_NOT_OPEN            Module is not open.
+ * @retval FSP_ERR_NOT_ENABLED         Pipeline is not running.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ **********************************************************************************************************************/
+fsp_err_t RM_ELC_PIPELINE_Stop (rm_elc_pipeline_instance_ctrl_t * const p_ctrl)
+{
+#if RM_ELC_PIPELINE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_ELC_PIPELINE_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(p_ctrl->running, FSP_ERR_NOT_ENABLED);
+
+    rm_elc_pipeline_cfg_t const * p_cfg = p_ctrl->p_cfg;
+    fsp_err_t                     err   = FSP_SUCCESS;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    for (uint32_t i = 0U; i < p_cfg->num_stages; i++)
+    {
+        fsp_err_t stage_err = rm_elc_pipeline_stage_stop(&p_cfg->p_stages[i]);
+        if (FSP_SUCCESS == err)
+        {
+            err = stage_err;
+        }
+    }
+
+    p_ctrl->running = false;
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Stops the pipeline if it is running and breaks the ELC links it created. The stage instances stay open.
+ *
+ * @retval FSP_SUCCESS                 Pipeline closed.
+ * @retval FSP_ERR_ASSERTION           p_ctrl is NULL.
+ * @retval FSP_ERR_NOT_OPEN            Module is not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_ELC_PIPELINE_Close (rm_elc_pipeline_instance_ctrl_t * const p_ctrl)
+{
+#if RM_ELC_PIPELINE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_ELC_PIPELINE_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    if (p_ctrl->running)
+    {
+        (void) RM_ELC_PIPELINE_Stop(p_ctrl);
+    }
+
+    rm_elc_pipeline_links_release(p_ctrl);
+
+    p_ctrl->open = 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_ELC_PIPELINE)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Returns the event produced by a stage.
+ *
+ * @param[in]  p_stage                 Stage
+ **********************************************************************************************************************/
+static elc_event_t rm_elc_pipeline_event_get (rm_elc_pipeline_stage_t const * const p_stage)
+{
+    if ((ELC_EVENT_NONE == p_stage->event) && (RM_ELC_PIPELINE_STAGE_TYPE_ADC == p_stage->type))
+    {
+        adc_instance_t const * p_adc = (adc_instance_t const *) p_stage->p_instance;
+        adc_info_t             info;
+        if (FSP_SUCCESS == p_adc->p_api->infoGet(p_adc->p_ctrl, &info))
+        {
+            return info.elc_event;
+        }
+    }
+
+    return p_stage->event;
+}
+
+/*******************************************************************************************************************//**
+ * Returns the event that triggers a stage, falling back to the event produced by the previous stage.
+ *
+ * @param[in]  p_cfg                   Pipeline configuration
+ * @param[in]  index                   Stage index
+ **********************************************************************************************************************/
+static elc_event_t rm_elc_pipeline_trigger_get (rm_elc_pipeline_cfg_t const * const p_cfg, uint32_t index)
+{
+    elc_event_t trigger = p_cfg->p_stages[index].trigger;
+
+    if ((ELC_EVENT_NONE == trigger) && (index > 0U))
+    {
+        trigger = rm_elc_pipeline_event_get(&p_cfg->p_stages[index - 1U]);
+    }
+
+    return trigger;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the ELC input of a stage.
+ *
+ * @param[in]  p_stage                 Stage
+ * @param[out] p_input                 ELC input of the stage
+ *
+ * @retval true                        The stage is triggered through the ELC.
+ * @retval false                       The stage has no ELC input.
+ **********************************************************************************************************************/
+static bool rm_elc_pipeline_input_get (rm_elc_pipeline_stage_t const * const p_stage, elc_peripheral_t * const p_input)
+{
+    switch (p_stage->type)
+    {
+        case RM_ELC_PIPELINE_STAGE_TYPE_TIMER:
+        case RM_ELC_PIPELINE_STAGE_TYPE_DAC:
+        {
+            *p_input = p_stage->elc_input;
+
+            return true;
+        }
+
+        case RM_ELC_PIPELINE_STAGE_TYPE_ADC:
+        {
+            adc_instance_t const * p_adc = (adc_instance_t const *) p_stage->p_instance;
+            adc_info_t             info;
+            if (FSP_SUCCESS != p_adc->p_api->infoGet(p_adc->p_ctrl, &info))
+            {
+                return false;
+            }
+
+            *p_input = info.elc_peripheral;
+
+            return true;
+        }
+
+        default:
+        {
+            /* Transfers are activated through the ICU and SPI has no ELC input. */
+            return false;
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Starts one stage.
+ *
+ * @param[in]  p_stage                 Stage
+ **********************************************************************************************************************/
+static fsp_err_t rm_elc_pipeline_stage_start (rm_elc_pipeline_stage_t const * const p_stage)
+{
+    switch (p_stage->type)
+    {
+        case RM_ELC_PIPELINE_STAGE_TYPE_TIMER:
+        {
+            timer_instance_t const * p_timer = (timer_instance_t const *) p_stage->p_instance;
+
+            return p_timer->p_api->start(p_timer->p_ctrl);
+        }
+
+        case RM_ELC_PIPELINE_STAGE_TYPE_ADC:
+        {
+            adc_instance_t const * p_adc = (adc_instance_t const *) p_stage->p_instance;
+
+            return p_adc->p_api->scanStart(p_adc->p_ctrl);
+        }
+
+        case RM_ELC_PIPELINE_STAGE_TYPE_TRANSFER:
+        {
+            transfer_instance_t const * p_transfer = (transfer_instance_t const *) p_stage->p_instance;
+            if (NULL != p_stage->p_info)
+            {
+                /* Reloading the descriptor also enables the transfer. */
+                return p_transfer->p_api->reconfigure(p_transfer->p_ctrl, p_stage->p_info);
+            }
+
+            return p_transfer->p_api->enable(p_transfer->p_ctrl);
+        }
+
+        case RM_ELC_PIPELINE_STAGE_TYPE_DAC:
+        {
+            dac_instance_t const * p_dac = (dac_instance_t const *) p_stage->p_instance;
+
+            return p_dac->p_api->start(p_dac->p_ctrl);
+        }
+
+        default:
+        {
+            /* SPI transfers are driven by the transfer stages that service its events. */
+            return FSP_SUCCESS;
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Stops one stage.
+ *
+ * @param[in]  p_stage                 Stage
+ **********************************************************************************************************************/
+static fsp_err_t rm_elc_pipeline_stage_stop (rm_elc_pipeline_stage_t const * const p_stage)
+{
+    switch (p_stage->type)
+    {
+        case RM_ELC_PIPELINE_STAGE_TYPE_TIMER:
+        {
+            timer_instance_t const * p_timer = (timer_instance_t const *) p_stage->p_instance;
+
+            return p_timer->p_api->stop(p_timer->p_ctrl);
+        }
+
+        case RM_ELC_PIPELINE_STAGE_TYPE_ADC:
+        {
+            adc_instance_t const * p_adc = (adc_instance_t const *) p_stage->p_instance;
+
+            return p_adc->p_api->scanStop(p_adc->p_ctrl);
+        }
+
+        case RM_ELC_PIPELINE_STAGE_TYPE_TRANSFER:
+        {
+            transfer_instance_t const * p_transfer = (transfer_instance_t const *) p_stage->p_instance;
+
+            return p_transfer->p_api->disable(p_transfer->p_ctrl);
+        }
+
+        case RM_ELC_PIPELINE_STAGE_TYPE_DAC:
+        {
+            dac_instance_t const * p_dac = (dac_instance_t const *) p_stage->p_instance;
+
+            return p_dac->p_api->stop(p_dac->p_ctrl);
+        }
+
+        default:
+        {
+            return FSP_SUCCESS;
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Breaks the ELC links created by a pipeline and releases its ELC inputs.
+ *
+ * @param[in]  p_ctrl                  Pointer to instance control block
+ **********************************************************************************************************************/
+static void rm_elc_pipeline_links_release (rm_elc_pipeline_instance_ctrl_t * const p_ctrl)
+{
+    elc_instance_t const * p_elc      = p_ctrl->p_cfg->p_elc;
+    uint32_t               elc_inputs = p_ctrl->elc_inputs;
+
+    for (uint32_t input = 0U; elc_inputs != 0U; input++)
+    {
+        if (elc_inputs & (1U << input))
+        {
+            (void) p_elc->p_api->linkBreak(p_elc->p_ctrl, (elc_peripheral_t) input);
+            elc_inputs &= ~(1U << input);
+        }
+    }
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    g_rm_elc_pipeline_elc_inputs &= ~p_ctrl->elc_inputs;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    p_ctrl->elc_inputs = 0U;
+}
@@ -48,6 +48,20 @@ static fsp_err_t rm_filex_block_media_read(rm_filex_block_media_instance_ctrl_t
                                            uint8_t                              * p_dest_address,
                                            uint32_t                               block_address,
                                            uint32_t                               num_blocks);
+static fsp_err_t rm_filex_block_media_transfer(rm_filex_block_media_instance_ctrl_t * p_instance_ctrl,
+                                               uint8_t                              * p_data,
+                                               uint32_t                               block_address,
+                                               uint32_t                               num_blocks,
+                                               bool                                   write);
+static fsp_err_t rm_filex_block_media_transfer_wait(rm_filex_block_media_instance_ctrl_t * p_instance_ctrl,
+                                                    uint8_t                              * p_data,
+                                                    uint32_t                               block_address,
+                                                    uint32_t                               num_blocks,
+                                                    bool                                   write);
+static fsp_err_t rm_filex_block_media_complete(rm_filex_block_media_instance_ctrl_t * p_instance_ctrl);
+static fsp_err_t rm_filex_block_media_write_start(rm_filex_block_media_instance_ctrl_t * p_instance_ctrl);
+static fsp_err_t rm_filex_block_media_write_flush(rm_filex_block_media_instance_ctrl_t * p_instance_ctrl);
+static void      rm_filex_block_media_stats_add(uint32_t * p_histogram, uint32_t num_blocks);
 
 /* FileX utility functions */
 extern UINT _fx_partition_offset_calculate(void  * partition_sector,
@@ -62,8 +76,9 @@ extern UINT _fx_partition_offset_calculate(void  * partition_sector,
 /** File X HAL API mapping for File X Block Media interface */
 const rm_filex_block_media_api_t g_filex_on_block_media =
 {
-    .open  = RM_FILEX_BLOCK_MEDIA_Open,
-    .close = RM_FILEX_BLOCK_MEDIA_Close
+    .open     = RM_FILEX_BLOCK_MEDIA_Open,
+    .close    = RM_FILEX_BLOCK_MEDIA_Close,
+    .statsGet = RM_FILEX_BLOCK_MEDIA_StatsGet,
 };
 
 /*******************************************************************************************************************//**
@@ -107,6 +122,13 @@ fsp_err_t RM_FILEX_BLOCK_MEDIA_Open (rm_filex_block_media_ctrl_t * const      p_
     FSP_ASSERT(NULL != p_cfg);
     FSP_ASSERT(NULL != p_cfg->p_lower_lvl_block_media);
     FSP_ERROR_RETURN(RM_FILEX_BLOCK_MEDIA_OPEN != p_instance_ctrl->open, FSP_ERR_ALREADY_OPEN);
+
+    rm_filex_block_media_extended_cfg_t const * p_extend = (rm_filex_block_media_extended_cfg_t const *) p_cfg->p_extend;
+    if (NULL != p_extend)
+    {
+        FSP_ASSERT((0U == p_extend->read_buffer_sectors) || (NULL != p_extend->p_read_buffer));
+        FSP_ASSERT((0U == p_extend->write_buffer_sectors) || (NULL != p_extend->p_write_buffer));
+    }
 #endif
 
     /* Open the lower level block media. */
@@ -115,14 +137,21 @@ fsp_err_t RM_FILEX_BLOCK_MEDIA_Open (rm_filex_block_media_ctrl_t * const      p_
     FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
 
     /* Initialize control structure. */
-    p_instance_ctrl->p_cfg = p_cfg;
-    p_instance_ctrl->open  = RM_FILEX_BLOCK_MEDIA_OPEN;
+    p_instance_ctrl->p_cfg             = p_cfg;
+    p_instance_ctrl->sector_size_bytes = 0U;
+    p_instance_ctrl->sector_count      = 0U;
+    p_instance_ctrl->transfer_pending  = false;
+    p_instance_ctrl->read_count        = 0U;
+    p_instance_ctrl->write_count       = 0U;
+    p_instance_ctrl->write_half        = 0U;
+    memset(&p_instance_ctrl->stats, 0, sizeof(p_instance_ctrl->stats));
+    p_instance_ctrl->open = RM_FILEX_BLOCK_MEDIA_OPEN;
 
     return FSP_SUCCESS;
 }
 
 /*******************************************************************************************************************//**
- * Closes media device.
+ * Closes media device. Writes still held in the write buffer are written to the media first.
  *
  * Implements @ref rm_filex_block_media_api_t::close().
  *
@@ -131,6 +160,7 @@ fsp_err_t RM_FILEX_BLOCK_MEDIA_Open (rm_filex_block_media_ctrl_t * const      p_
  * @retval FSP_ERR_NOT_OPEN      Module not open.
  *
  * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         The media device is closed even if writing the write buffer failed.
  **********************************************************************************************************************/
 fsp_err_t RM_FILEX_BLOCK_MEDIA_Close (rm_filex_block_media_ctrl_t * const p_ctrl)
 {
@@ -140,12 +170,45 @@ fsp_err_t RM_FILEX_BLOCK_MEDIA_Close (rm_filex_block_media_ctrl_t * const p_ctrl
     FSP_ERROR_RETURN(RM_FILEX_BLOCK_MEDIA_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
 
+    /* Write back buffered writes. */
+    fsp_err_t err = rm_filex_block_media_write_flush(p_instance_ctrl);
+
     /* Close lower level block media*/
     rm_block_media_instance_t * p_lower_lvl_block_media = p_instance_ctrl->p_cfg->p_lower_lvl_block_media;
     p_lower_lvl_block_media->p_api->close(p_lower_lvl_block_media->p_ctrl);
 
     p_instance_ctrl->open = 0;
 
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Gets request statistics. The statistics show how FileX requests were merged into block media requests.
+ *
+ * Implements @ref rm_filex_block_media_api_t::statsGet().
+ *
+ * @retval FSP_SUCCESS           Statistics stored in p_stats.
+ * @retval FSP_ERR_ASSERTION     An input parameter was invalid.
+ * @retval FSP_ERR_NOT_OPEN      Module not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_FILEX_BLOCK_MEDIA_StatsGet (rm_filex_block_media_ctrl_t * const  p_ctrl,
+                                         rm_filex_block_media_stats_t * const p_stats,
+                                         bool                                 reset)
+{
+    rm_filex_block_media_instance_ctrl_t * p_instance_ctrl = (rm_filex_block_media_instance_ctrl_t *) p_ctrl;
+#if RM_FILEX_BLOCK_MEDIA_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_stats);
+    FSP_ERROR_RETURN(RM_FILEX_BLOCK_MEDIA_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    *p_stats = p_instance_ctrl->stats;
+
+    if (reset)
+    {
+        memset(&p_instance_ctrl->stats, 0, sizeof(p_instance_ctrl->stats));
+    }
+
     return FSP_SUCCESS;
 }
 
@@ -253,9 +316,12 @@ static fsp_err_t rm_filex_block_media_driver_request_handler (FX_MEDIA * p_fx_me
 
         /* FX_DRIVER_FLUSH
          *  FileX flushes all sectors currently in the driver's sector cache to the physical media by issuing a flush request to the I/O driver.
-         *  Command not supported in available FSP modules. Return driver success. */
+         *  Writes buffered for merging are written to the media. */
         case (UINT) FX_DRIVER_FLUSH:
         {
+            err = rm_filex_block_media_write_flush(p_filex_block_media_instance_ctrl);
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
             break;
         }
 
@@ -275,6 +341,11 @@ static fsp_err_t rm_filex_block_media_driver_request_handler (FX_MEDIA * p_fx_me
          *  This is typically called on fx_media_abort */
         case (UINT) FX_DRIVER_ABORT:
         {
+            /* Let a transfer in progress finish, then drop buffered data. */
+            (void) rm_filex_block_media_complete(p_filex_block_media_instance_ctrl);
+            p_filex_block_media_instance_ctrl->read_count  = 0U;
+            p_filex_block_media_instance_ctrl->write_count = 0U;
+
             break;
         }
 
@@ -304,6 +375,12 @@ static fsp_err_t rm_filex_block_media_driver_request_handler (FX_MEDIA * p_fx_me
             /* Sector release isn't supported by any block media drivers. */
             p_fx_media->fx_media_driver_free_sector_update = FX_FALSE;
 
+            /* Geometry used by request merging. */
+            p_filex_block_media_instance_ctrl->sector_size_bytes = block_media_info.sector_size_bytes;
+            p_filex_block_media_instance_ctrl->sector_count      = block_media_info.num_sectors;
+            p_filex_block_media_instance_ctrl->read_count        = 0U;
+            p_filex_block_media_instance_ctrl->write_count       = 0U;
+
             break;
         }
 
@@ -311,6 +388,9 @@ static fsp_err_t rm_filex_block_media_driver_request_handler (FX_MEDIA * p_fx_me
          *  FileX uses the uninit command to close the media. This is typically called on fx_media_close. */
         case (UINT) FX_DRIVER_UNINIT:
         {
+            err = rm_filex_block_media_write_flush(p_filex_block_media_instance_ctrl);
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
             break;
         }
 
@@ -364,6 +444,10 @@ static fsp_err_t rm_filex_block_media_driver_request_handler (FX_MEDIA * p_fx_me
                                              p_fx_media->fx_media_hidden_sectors,
                                              1);
             FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+            /* Do not hold the boot record in the write buffer. */
+            err = rm_filex_block_media_write_flush(p_filex_block_media_instance_ctrl);
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
             break;
         }
 
@@ -445,15 +529,17 @@ void rm_filex_block_media_memory_callback (rm_block_media_callback_args_t * p_ar
 }
 
 /*******************************************************************************************************************//**
- * Writes blocks of data to the specified device memory address.
+ * Writes blocks of data to the specified device memory address. If the write buffer is configured, writes that fit in
+ * the write buffer are copied to it and written to the media together with writes to the following sectors. A full
+ * write buffer half is written while FileX continues with the other half.
  *
  * @param[in]   p_instance_ctrl    Control block for the FileX Block Media instance.
  * @param[in]   p_src_address      Address to read the data to be written.
  * @param[in]   block_address      Block address to write the data to.
  * @param[in]   num_blocks         Number of blocks of data to write.
  *
- * @retval     FSP_SUCCESS         Write finished successfully.
- * @retval     FSP_ERR_INTERNAL    Error reported by lower layer driver callback.
+ * @retval     FSP_SUCCESS         Write finished successfully or data stored in the write buffer.
+ * @retval     FSP_ERR_INTERNAL    Error reported by lower layer driver callback for this or a previous write.
  *
  * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
  *         This function calls:
@@ -464,22 +550,67 @@ static fsp_err_t rm_filex_block_media_write (rm_filex_block_media_instance_ctrl_
                                              uint32_t                               block_address,
                                              uint32_t                               num_blocks)
 {
-    fsp_err_t err;
-    rm_block_media_instance_t * p_block_media = p_instance_ctrl->p_cfg->p_lower_lvl_block_media;
+    fsp_err_t err = FSP_SUCCESS;
+    rm_filex_block_media_extended_cfg_t const * p_extend =
+        (rm_filex_block_media_extended_cfg_t const *) p_instance_ctrl->p_cfg->p_extend;
 
-    p_instance_ctrl->event_ready = false;
+    p_instance_ctrl->stats.write_requests++;
+    rm_filex_block_media_stats_add(p_instance_ctrl->stats.request_sectors, num_blocks);
 
-    err = p_block_media->p_api->write(p_block_media->p_ctrl, p_src_address, block_address, num_blocks);
-    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    /* Drop the read buffer if it holds any of the written sectors. */
+    if ((p_instance_ctrl->read_count > 0U) &&
+        (block_address < (p_instance_ctrl->read_sector + p_instance_ctrl->read_count)) &&
+        (p_instance_ctrl->read_sector < (block_address + num_blocks)))
+    {
+        err = rm_filex_block_media_complete(p_instance_ctrl);
+        p_instance_ctrl->read_count = 0U;
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    }
 
-    err = rm_filex_block_media_wait_event(p_instance_ctrl);
-    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    if ((NULL == p_extend) || (0U == p_instance_ctrl->sector_size_bytes) ||
+        (num_blocks > p_extend->write_buffer_sectors))
+    {
+        err = rm_filex_block_media_write_flush(p_instance_ctrl);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
 
-    return FSP_SUCCESS;
+        return rm_filex_block_media_transfer_wait(p_instance_ctrl, p_src_address, block_address, num_blocks, true);
+    }
+
+    uint32_t sector_size = p_instance_ctrl->sector_size_bytes;
+
+    if ((p_instance_ctrl->write_count > 0U) &&
+        (block_address == (p_instance_ctrl->write_sector + p_instance_ctrl->write_count)) &&
+        ((p_instance_ctrl->write_count + num_blocks) <= p_extend->write_buffer_sectors))
+    {
+        /* Continues the buffered write. */
+        p_instance_ctrl->stats.merged_writes++;
+    }
+    else
+    {
+        /* Start writing the buffered data and collect this write in the other half. */
+        err = rm_filex_block_media_write_start(p_instance_ctrl);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        p_instance_ctrl->write_sector = block_address;
+    }
+
+    uint8_t * p_half = p_extend->p_write_buffer +
+                       (p_instance_ctrl->write_half * p_extend->write_buffer_sectors * sector_size);
+    memcpy(p_half + (p_instance_ctrl->write_count * sector_size), p_src_address, num_blocks * sector_size);
+    p_instance_ctrl->write_count += num_blocks;
+
+    if (p_instance_ctrl->write_count == p_extend->write_buffer_sectors)
+    {
+        err = rm_filex_block_media_write_start(p_instance_ctrl);
+    }
+
+    return err;
 }
 
 /*******************************************************************************************************************//**
- * Reads blocks of data from the specified memory device address to the location specified by the caller.
+ * Reads blocks of data from the specified memory device address to the location specified by the caller. If the read
+ * buffer is configured, small reads fill the read buffer and reads of sectors already in the read buffer are copied
+ * from it. When a read reaches the end of the read buffer, reading the following sectors is started before returning.
  *
  * @param[in]   p_instance_ctrl     Control block for the FileX Block Media instance.
  * @param[out]  p_dest_address      Destination to read the data into.
@@ -487,7 +618,7 @@ static fsp_err_t rm_filex_block_media_write (rm_filex_block_media_instance_ctrl_
  * @param[in]   num_blocks          Number of blocks of data to read.
  *
  * @retval     FSP_SUCCESS          Data read successfully.
- * @retval     FSP_ERR_INTERNAL     Error reported by lower layer driver callback.
+ * @retval     FSP_ERR_INTERNAL     Error reported by lower layer driver callback for this read or a previous write.
  *
  * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
  *         This function calls:
@@ -499,19 +630,265 @@ static fsp_err_t rm_filex_block_media_read (rm_filex_block_media_instance_ctrl_t
                                             uint32_t                               num_blocks)
 {
     fsp_err_t err;
+    rm_filex_block_media_extended_cfg_t const * p_extend =
+        (rm_filex_block_media_extended_cfg_t const *) p_instance_ctrl->p_cfg->p_extend;
+
+    p_instance_ctrl->stats.read_requests++;
+    rm_filex_block_media_stats_add(p_instance_ctrl->stats.request_sectors, num_blocks);
+
+    /* Buffered writes must reach the media before it is read. */
+    err = rm_filex_block_media_write_flush(p_instance_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    if ((NULL == p_extend) || (0U == p_instance_ctrl->sector_size_bytes) ||
+        (num_blocks > p_extend->read_buffer_sectors))
+    {
+        return rm_filex_block_media_transfer_wait(p_instance_ctrl, p_dest_address, block_address, num_blocks, false);
+    }
+
+    uint32_t sector_size = p_instance_ctrl->sector_size_bytes;
+
+    if ((p_instance_ctrl->read_count > 0U) && (block_address >= p_instance_ctrl->read_sector) &&
+        ((block_address + num_blocks) <= (p_instance_ctrl->read_sector + p_instance_ctrl->read_count)))
+    {
+        p_instance_ctrl->stats.read_hits++;
+    }
+    else
+    {
+        /* Fill the read buffer starting with the requested sectors. */
+        uint32_t count = p_extend->read_buffer_sectors;
+        if ((p_instance_ctrl->sector_count > block_address) && ((p_instance_ctrl->sector_count - block_address) < count))
+        {
+            count = p_instance_ctrl->sector_count - block_address;
+        }
+
+        if (count < num_blocks)
+        {
+            count = num_blocks;
+        }
+
+        p_instance_ctrl->read_count = 0U;
+        err = rm_filex_block_media_transfer_wait(p_instance_ctrl, p_extend->p_read_buffer, block_address, count, false);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        p_instance_ctrl->read_sector = block_address;
+        p_instance_ctrl->read_count  = count;
+    }
+
+    memcpy(p_dest_address,
+           p_extend->p_read_buffer + ((block_address - p_instance_ctrl->read_sector) * sector_size),
+           num_blocks * sector_size);
+
+    /* Sequential read reached the end of the read buffer, read the next sectors while FileX uses this data. */
+    uint32_t next = block_address + num_blocks;
+    if ((next == (p_instance_ctrl->read_sector + p_instance_ctrl->read_count)) &&
+        (p_instance_ctrl->read_count == p_extend->read_buffer_sectors) && (next < p_instance_ctrl->sector_count))
+    {
+        uint32_t count = p_instance_ctrl->sector_count - next;
+        if (count > p_extend->read_buffer_sectors)
+        {
+            count = p_extend->read_buffer_sectors;
+        }
+
+        p_instance_ctrl->read_sector = next;
+        p_instance_ctrl->read_count  = count;
+
+        if (FSP_SUCCESS == rm_filex_block_media_transfer(p_instance_ctrl, p_extend->p_read_buffer, next, count, false))
+        {
+            p_instance_ctrl->transfer_pending  = true;
+            p_instance_ctrl->transfer_is_write = false;
+        }
+        else
+        {
+            p_instance_ctrl->read_count = 0U;
+        }
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Starts a block media transfer without waiting for it to complete.
+ *
+ * @param[in]   p_instance_ctrl     Control block for the FileX Block Media instance.
+ * @param[in]   p_data              Data to write or destination to read the data into.
+ * @param[in]   block_address       First block address of the transfer.
+ * @param[in]   num_blocks          Number of blocks to transfer.
+ * @param[in]   write               true to write to the media, false to read from the media.
+ *
+ * @retval     FSP_SUCCESS          Transfer started.
+ *
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref rm_block_media_api_t::read
+ *             * @ref rm_block_media_api_t::write
+ **********************************************************************************************************************/
+static fsp_err_t rm_filex_block_media_transfer (rm_filex_block_media_instance_ctrl_t * p_instance_ctrl,
+                                                uint8_t                              * p_data,
+                                                uint32_t                               block_address,
+                                                uint32_t                               num_blocks,
+                                                bool                                   write)
+{
     rm_block_media_instance_t * p_block_media = p_instance_ctrl->p_cfg->p_lower_lvl_block_media;
 
     p_instance_ctrl->event_ready = false;
+    p_instance_ctrl->last_event  = (rm_block_media_event_t) 0;
+
+    rm_filex_block_media_stats_add(p_instance_ctrl->stats.media_sectors, num_blocks);
+
+    if (write)
+    {
+        p_instance_ctrl->stats.media_writes++;
 
-    err = p_block_media->p_api->read(p_block_media->p_ctrl, p_dest_address, block_address, num_blocks);
+        return p_block_media->p_api->write(p_block_media->p_ctrl, p_data, block_address, num_blocks);
+    }
+
+    p_instance_ctrl->stats.media_reads++;
+
+    return p_block_media->p_api->read(p_block_media->p_ctrl, p_data, block_address, num_blocks);
+}
+
+/*******************************************************************************************************************//**
+ * Completes any transfer in progress, then performs a block media transfer and waits for it to complete.
+ *
+ * @param[in]   p_instance_ctrl     Control block for the FileX Block Media instance.
+ * @param[in]   p_data              Data to write or destination to read the data into.
+ * @param[in]   block_address       First block address of the transfer.
+ * @param[in]   num_blocks          Number of blocks to transfer.
+ * @param[in]   write               true to write to the media, false to read from the media.
+ *
+ * @retval     FSP_SUCCESS          Transfer finished successfully.
+ * @retval     FSP_ERR_INTERNAL     Error reported by lower layer driver callback.
+ *
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ **********************************************************************************************************************/
+static fsp_err_t rm_filex_block_media_transfer_wait (rm_filex_block_media_instance_ctrl_t * p_instance_ctrl,
+                                                     uint8_t                              * p_data,
+                                                     uint32_t                               block_address,
+                                                     uint32_t                               num_blocks,
+                                                     bool                                   write)
+{
+    fsp_err_t err = rm_filex_block_media_complete(p_instance_ctrl);
     FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
 
-    err = rm_filex_block_media_wait_event(p_instance_ctrl);
+    err = rm_filex_block_media_transfer(p_instance_ctrl, p_data, block_address, num_blocks, write);
     FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
 
+    return rm_filex_block_media_wait_event(p_instance_ctrl);
+}
+
+/*******************************************************************************************************************//**
+ * Waits for a transfer started without waiting. A failed read of the next sectors only empties the read buffer, a
+ * failed write is reported to the caller.
+ *
+ * @param[in]   p_instance_ctrl     Control block for the FileX Block Media instance.
+ *
+ * @retval     FSP_SUCCESS          No transfer in progress or transfer completed.
+ * @retval     FSP_ERR_INTERNAL     Error reported by lower layer driver callback for a write.
+ *
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ **********************************************************************************************************************/
+static fsp_err_t rm_filex_block_media_complete (rm_filex_block_media_instance_ctrl_t * p_instance_ctrl)
+{
+    if (!p_instance_ctrl->transfer_pending)
+    {
+        return FSP_SUCCESS;
+    }
+
+    p_instance_ctrl->transfer_pending = false;
+
+    fsp_err_t err = rm_filex_block_media_wait_event(p_instance_ctrl);
+
+    if (!p_instance_ctrl->transfer_is_write)
+    {
+        if (FSP_SUCCESS != err)
+        {
+            p_instance_ctrl->read_count = 0U;
+        }
+
+        err = FSP_SUCCESS;
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Starts writing the write buffer half collecting writes and switches to the other half. The previous transfer is
+ * completed first so the other half is free.
+ *
+ * @param[in]   p_instance_ctrl     Control block for the FileX Block Media instance.
+ *
+ * @retval     FSP_SUCCESS          Write started or nothing to write.
+ *
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ **********************************************************************************************************************/
+static fsp_err_t rm_filex_block_media_write_start (rm_filex_block_media_instance_ctrl_t * p_instance_ctrl)
+{
+    rm_filex_block_media_extended_cfg_t const * p_extend =
+        (rm_filex_block_media_extended_cfg_t const *) p_instance_ctrl->p_cfg->p_extend;
+
+    if (0U == p_instance_ctrl->write_count)
+    {
+        return FSP_SUCCESS;
+    }
+
+    fsp_err_t err = rm_filex_block_media_complete(p_instance_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    uint8_t * p_half = p_extend->p_write_buffer +
+                       (p_instance_ctrl->write_half * p_extend->write_buffer_sectors *
+                        p_instance_ctrl->sector_size_bytes);
+    uint32_t count = p_instance_ctrl->write_count;
+
+    p_instance_ctrl->write_count = 0U;
+    p_instance_ctrl->write_half ^= 1U;
+
+    err = rm_filex_block_media_transfer(p_instance_ctrl, p_half, p_instance_ctrl->write_sector, count, true);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    p_instance_ctrl->transfer_pending  = true;
+    p_instance_ctrl->transfer_is_write = true;
+
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Writes the write buffer to the media and waits until the media is idle.
+ *
+ * @param[in]   p_instance_ctrl     Control block for the FileX Block Media instance.
+ *
+ * @retval     FSP_SUCCESS          All buffered writes completed.
+ * @retval     FSP_ERR_INTERNAL     Error reported by lower layer driver callback.
+ *
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ **********************************************************************************************************************/
+static fsp_err_t rm_filex_block_media_write_flush (rm_filex_block_media_instance_ctrl_t * p_instance_ctrl)
+{
+    fsp_err_t err = rm_filex_block_media_write_start(p_instance_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    return rm_filex_block_media_complete(p_instance_ctrl);
+}
+
+/*******************************************************************************************************************//**
+ * Adds a request to a request size histogram.
+ *
+ * @param[in]   p_histogram         Histogram with RM_FILEX_BLOCK_MEDIA_STATS_BUCKETS buckets.
+ * @param[in]   num_blocks          Number of blocks in the request.
+ **********************************************************************************************************************/
+static void rm_filex_block_media_stats_add (uint32_t * p_histogram, uint32_t num_blocks)
+{
+    uint32_t bucket = 0U;
+
+    while ((num_blocks > 1U) && (bucket < (RM_FILEX_BLOCK_MEDIA_STATS_BUCKETS - 1U)))
+    {
+        num_blocks >>= 1;
+        bucket++;
+    }
+
+    p_histogram[bucket]++;
+}
+
 /*******************************************************************************************************************//**
  * Waits for block media transfer complete event.
  *
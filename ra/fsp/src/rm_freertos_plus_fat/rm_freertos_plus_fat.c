@@ -62,6 +62,17 @@
 /** "FFAT" in ASCII, used to determine if channel is open. */
 #define RM_FREERTOS_PLUS_FAT_OPEN                     (0x70706584ULL)
 
+/* Sector cache entry states. */
+#define RM_FREERTOS_PLUS_FAT_CACHE_VALID              (1U << 0)
+#define RM_FREERTOS_PLUS_FAT_CACHE_DIRTY              (1U << 1)
+
+/* Returned when a sector is not held in the cache. */
+#define RM_FREERTOS_PLUS_FAT_CACHE_NONE               (UINT32_MAX)
+
+#define RM_FREERTOS_PLUS_FAT_EVENT_DONE_MASK          (RM_BLOCK_MEDIA_EVENT_OPERATION_COMPLETE | \
+                                                       RM_BLOCK_MEDIA_EVENT_POLL_STATUS |        \
+                                                       RM_BLOCK_MEDIA_EVENT_ERROR)
+
 int32_t rm_freertos_plus_fat_read(uint8_t * p_data, uint32_t sector, uint32_t num_sectors, FF_Disk_t * p_disk);
 int32_t rm_freertos_plus_fat_write(uint8_t * p_data, uint32_t sector, uint32_t num_sectors,
                                    FF_Disk_t * p_disk);
@@ -69,6 +80,22 @@ void             rm_freertos_plus_fat_memory_callback(rm_block_media_callback_ar
 static fsp_err_t rm_freertos_plus_fat_wait_event(rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl,
                                                  uint32_t                               timeout);
 static fsp_err_t rm_freertos_plus_fat_wait_for_device(rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl);
+static fsp_err_t rm_freertos_plus_fat_event_check(rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl);
+static fsp_err_t rm_freertos_plus_fat_media_transfer(rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl,
+                                                     uint8_t                              * p_data,
+                                                     uint32_t                               sector,
+                                                     uint32_t                               num_sectors,
+                                                     bool                                   write);
+static void      rm_freertos_plus_fat_read_ahead_start(rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl);
+static fsp_err_t rm_freertos_plus_fat_read_ahead_wait(rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl);
+static void      rm_freertos_plus_fat_read_ahead_invalidate(rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl,
+                                                            uint32_t                               sector,
+                                                            uint32_t                               num_sectors);
+static uint32_t rm_freertos_plus_fat_cache_find(rm_freertos_plus_fat_extended_cfg_t const * p_extend, uint32_t sector);
+static uint32_t rm_freertos_plus_fat_cache_alloc(rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl,
+                                                 uint32_t                               sector,
+                                                 fsp_err_t                            * p_err);
+static fsp_err_t rm_freertos_plus_fat_cache_flush(rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl);
 
 /** FAT HAL API mapping for FreeRTOS_plus_FAT Controller interface */
 const rm_freertos_plus_fat_api_t g_fat_on_freertos =
@@ -79,6 +106,7 @@ const rm_freertos_plus_fat_api_t g_fat_on_freertos =
     .diskDeinit = RM_FREERTOS_PLUS_FAT_DiskDeinit,
     .infoGet    = RM_FREERTOS_PLUS_FAT_InfoGet,
     .close      = RM_FREERTOS_PLUS_FAT_Close,
+    .cacheFlush = RM_FREERTOS_PLUS_FAT_CacheFlush,
 };
 
 /*******************************************************************************************************************//**
@@ -109,6 +137,14 @@ fsp_err_t RM_FREERTOS_PLUS_FAT_Open (rm_freertos_plus_fat_ctrl_t * const      p_
     FSP_ASSERT(NULL != p_ctrl);
     FSP_ASSERT(NULL != p_cfg);
     FSP_ERROR_RETURN(RM_FREERTOS_PLUS_FAT_OPEN != p_instance_ctrl->open, FSP_ERR_ALREADY_OPEN);
+
+    rm_freertos_plus_fat_extended_cfg_t const * p_extend = (rm_freertos_plus_fat_extended_cfg_t const *) p_cfg->p_extend;
+    if (NULL != p_extend)
+    {
+        FSP_ASSERT((0U == p_extend->num_cache_sectors) ||
+                   ((NULL != p_extend->p_cache) && (NULL != p_extend->p_cache_entries)));
+        FSP_ASSERT((0U == p_extend->read_ahead_sectors) || (NULL != p_extend->p_read_ahead_buffer));
+    }
 #endif
 
 #if 2 == BSP_CFG_RTOS
@@ -134,8 +170,25 @@ fsp_err_t RM_FREERTOS_PLUS_FAT_Open (rm_freertos_plus_fat_ctrl_t * const      p_
     FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
 
     /* Initialize control structure. */
-    p_instance_ctrl->p_cfg = p_cfg;
-    p_instance_ctrl->open  = RM_FREERTOS_PLUS_FAT_OPEN;
+    p_instance_ctrl->p_cfg              = p_cfg;
+    p_instance_ctrl->sector_size_bytes  = 0U;
+    p_instance_ctrl->sector_count       = 0U;
+    p_instance_ctrl->cache_tick         = 0U;
+    p_instance_ctrl->next_read_sector   = RM_FREERTOS_PLUS_FAT_CACHE_NONE;
+    p_instance_ctrl->read_ahead_count   = 0U;
+    p_instance_ctrl->read_ahead_pending = false;
+
+    /* Start with an empty sector cache. */
+    rm_freertos_plus_fat_extended_cfg_t const * p_cache_cfg = (rm_freertos_plus_fat_extended_cfg_t const *) p_cfg->p_extend;
+    if (NULL != p_cache_cfg)
+    {
+        for (uint32_t i = 0U; i < p_cache_cfg->num_cache_sectors; i++)
+        {
+            p_cache_cfg->p_cache_entries[i].state = 0U;
+        }
+    }
+
+    p_instance_ctrl->open = RM_FREERTOS_PLUS_FAT_OPEN;
 
     return FSP_SUCCESS;
 }
@@ -172,7 +225,9 @@ fsp_err_t RM_FREERTOS_PLUS_FAT_MediaInit (rm_freertos_plus_fat_ctrl_t * const
     fsp_err =
         p_instance_ctrl->p_cfg->p_block_media->p_api->infoGet(p_instance_ctrl->p_cfg->p_block_media->p_ctrl, &info);
     FSP_ERROR_RETURN(FSP_SUCCESS == fsp_err, fsp_err);
-    p_instance_ctrl->reentrant = info.reentrant;
+    p_instance_ctrl->reentrant         = info.reentrant;
+    p_instance_ctrl->sector_size_bytes = info.sector_size_bytes;
+    p_instance_ctrl->sector_count      = info.num_sectors;
 
     if (NULL != p_device)
     {
@@ -213,6 +268,10 @@ fsp_err_t RM_FREERTOS_PLUS_FAT_DiskInit (rm_freertos_plus_fat_ctrl_t * const
     FSP_ASSERT(p_disk_cfg->cache_size_bytes >= 2 * p_disk_cfg->device.sector_size_bytes);
 #endif
 
+    /* The port layer sector cache uses the sector size of the disk. */
+    p_instance_ctrl->sector_size_bytes = p_disk_cfg->device.sector_size_bytes;
+    p_instance_ctrl->sector_count      = p_disk_cfg->device.sector_count;
+
     /* Initialise the disk structure. memset used to clear unused bitfields. */
     memset(p_disk, '\0', sizeof(FF_Disk_t));
     p_disk->ulNumberOfSectors        = p_disk_cfg->device.sector_count;
@@ -251,6 +310,10 @@ fsp_err_t RM_FREERTOS_PLUS_FAT_DiskInit (rm_freertos_plus_fat_ctrl_t * const
  * @retval     FSP_SUCCESS               Module is initialized and ready to access the memory device.
  * @retval     FSP_ERR_ASSERTION         An input parameter is invalid.
  * @retval     FSP_ERR_NOT_OPEN          Module has not been initialized.
+ *
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref rm_freertos_plus_fat_api_t::cacheFlush
  **********************************************************************************************************************/
 fsp_err_t RM_FREERTOS_PLUS_FAT_DiskDeinit (rm_freertos_plus_fat_ctrl_t * const p_ctrl, FF_Disk_t * const p_disk)
 {
@@ -260,10 +323,12 @@ fsp_err_t RM_FREERTOS_PLUS_FAT_DiskDeinit (rm_freertos_plus_fat_ctrl_t * const p
     FSP_ASSERT(NULL != p_instance_ctrl);
     FSP_ASSERT(NULL != p_disk);
     FSP_ERROR_RETURN(RM_FREERTOS_PLUS_FAT_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
-#else
-    FSP_PARAMETER_NOT_USED(p_instance_ctrl);
 #endif
 
+    /* Write back sectors still held in the port layer cache. */
+    fsp_err_t err = RM_FREERTOS_PLUS_FAT_CacheFlush(p_instance_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
     FF_DeleteIOManager(p_disk->pxIOManager);
     p_disk->pxIOManager            = NULL;
     p_disk->xStatus.bIsInitialised = 0U;
@@ -331,6 +396,7 @@ fsp_err_t RM_FREERTOS_PLUS_FAT_InfoGet (rm_freertos_plus_fat_ctrl_t * const p_ct
  * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
  *         This function calls:
  *             * @ref rm_block_media_api_t::close
+ *             * @ref rm_freertos_plus_fat_api_t::cacheFlush
  **********************************************************************************************************************/
 fsp_err_t RM_FREERTOS_PLUS_FAT_Close (rm_freertos_plus_fat_ctrl_t * const p_ctrl)
 {
@@ -340,7 +406,11 @@ fsp_err_t RM_FREERTOS_PLUS_FAT_Close (rm_freertos_plus_fat_ctrl_t * const p_ctrl
     FSP_ERROR_RETURN(RM_FREERTOS_PLUS_FAT_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
 
-    fsp_err_t err = p_instance_ctrl->p_cfg->p_block_media->p_api->close(p_instance_ctrl->p_cfg->p_block_media->p_ctrl);
+    /* Write back sectors still held in the port layer cache. */
+    fsp_err_t err = RM_FREERTOS_PLUS_FAT_CacheFlush(p_instance_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    err = p_instance_ctrl->p_cfg->p_block_media->p_api->close(p_instance_ctrl->p_cfg->p_block_media->p_ctrl);
     if (FSP_SUCCESS == err)
     {
 #if 2 == BSP_CFG_RTOS
@@ -352,12 +422,51 @@ fsp_err_t RM_FREERTOS_PLUS_FAT_Close (rm_freertos_plus_fat_ctrl_t * const p_ctrl
     return err;
 }
 
+/*******************************************************************************************************************//**
+ * Writes all sectors held in the port layer write-back cache to the media device. Adjacent dirty sectors are written
+ * with a single multi-sector write. Does nothing if the sector cache is not configured.
+ *
+ * Implements @ref rm_freertos_plus_fat_api_t::cacheFlush().
+ *
+ * @retval FSP_SUCCESS           Cache written to the media device.
+ * @retval FSP_ERR_ASSERTION     An input parameter was invalid.
+ * @retval FSP_ERR_NOT_OPEN      Module not open.
+ *
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref rm_block_media_api_t::write
+ **********************************************************************************************************************/
+fsp_err_t RM_FREERTOS_PLUS_FAT_CacheFlush (rm_freertos_plus_fat_ctrl_t * const p_ctrl)
+{
+    rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl = (rm_freertos_plus_fat_instance_ctrl_t *) p_ctrl;
+#if RM_FREERTOS_PLUS_FAT_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(RM_FREERTOS_PLUS_FAT_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+#if 2 == BSP_CFG_RTOS
+    xSemaphoreTakeRecursive(p_instance_ctrl->p_mutex, portMAX_DELAY);
+#endif
+
+    fsp_err_t err = rm_freertos_plus_fat_cache_flush(p_instance_ctrl);
+
+    /* Make sure the media is idle when returning. */
+    (void) rm_freertos_plus_fat_read_ahead_wait(p_instance_ctrl);
+
+#if 2 == BSP_CFG_RTOS
+    xSemaphoreGiveRecursive(p_instance_ctrl->p_mutex);
+#endif
+
+    return err;
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup FREERTOS_PLUS_FAT)
  **********************************************************************************************************************/
 
 /*******************************************************************************************************************//**
- * Writes sectors to block media device.
+ * Reads sectors from block media device. Sectors held in the write-back cache or the read-ahead buffer are copied from
+ * there, the remaining sectors are read from the media in runs of adjacent sectors.
  *
  * @param[in] p_data                   Buffer to store read data.
  * @param[in] sector                   Sector to read from.
@@ -368,28 +477,89 @@ fsp_err_t RM_FREERTOS_PLUS_FAT_Close (rm_freertos_plus_fat_ctrl_t * const p_ctrl
  * @retval     FF_ERR_IOMAN_DRIVER_FATAL_ERROR    Error reported by block media driver during read.
  **********************************************************************************************************************/
 int32_t rm_freertos_plus_fat_read (uint8_t * p_data, uint32_t sector, uint32_t num_sectors, FF_Disk_t * p_disk) {
-    fsp_err_t err;
-    int32_t   lReturnCode = (int32_t) (FF_ERR_IOMAN_OUT_OF_BOUNDS_READ | FF_ERRFLAG);
+    fsp_err_t err = FSP_SUCCESS;
 
     rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl = (rm_freertos_plus_fat_instance_ctrl_t *) p_disk->pvTag;
+    rm_freertos_plus_fat_extended_cfg_t const * p_extend  =
+        (rm_freertos_plus_fat_extended_cfg_t const *) p_instance_ctrl->p_cfg->p_extend;
 
+    if (NULL == p_extend)
+    {
+        err = rm_freertos_plus_fat_media_transfer(p_instance_ctrl, p_data, sector, num_sectors, false);
+    }
+    else
+    {
 #if 2 == BSP_CFG_RTOS
 
-    /* Store the handle of the calling task. */
-    p_instance_ctrl->current_task = xTaskGetCurrentTaskHandle();
-#else
-    p_instance_ctrl->event_ready = false;
+        /* The cache is shared by all disks on this media, also when the block media driver is reentrant. */
+        xSemaphoreTakeRecursive(p_instance_ctrl->p_mutex, portMAX_DELAY);
 #endif
 
-    p_instance_ctrl->last_event = (rm_block_media_event_t) 0;
+        uint32_t sector_size = p_instance_ctrl->sector_size_bytes;
+        uint32_t i           = 0U;
 
-    err = p_instance_ctrl->p_cfg->p_block_media->p_api->read(p_instance_ctrl->p_cfg->p_block_media->p_ctrl,
-                                                             p_data,
-                                                             sector,
-                                                             num_sectors);
-    if (FSP_SUCCESS == err)
-    {
-        err = rm_freertos_plus_fat_wait_event(p_instance_ctrl, RM_FREERTOS_PLUS_FAT_READ_TIMEOUT_TICKS);
+        while ((i < num_sectors) && (FSP_SUCCESS == err))
+        {
+            uint32_t  current = sector + i;
+            uint8_t * p_dest  = p_data + (i * sector_size);
+            uint32_t  entry   = rm_freertos_plus_fat_cache_find(p_extend, current);
+
+            if (RM_FREERTOS_PLUS_FAT_CACHE_NONE != entry)
+            {
+                /* The cache holds the most recent data for this sector. */
+                memcpy(p_dest, p_extend->p_cache + (entry * sector_size), sector_size);
+                p_extend->p_cache_entries[entry].last_use = ++p_instance_ctrl->cache_tick;
+                i++;
+                continue;
+            }
+
+            if ((p_instance_ctrl->read_ahead_count > 0U) && (current >= p_instance_ctrl->read_ahead_sector) &&
+                ((current - p_instance_ctrl->read_ahead_sector) < p_instance_ctrl->read_ahead_count))
+            {
+                /* The read-ahead window is dropped if the read-ahead failed, the sector is read below instead. */
+                (void) rm_freertos_plus_fat_read_ahead_wait(p_instance_ctrl);
+
+                if (p_instance_ctrl->read_ahead_count > 0U)
+                {
+                    memcpy(p_dest,
+                           p_extend->p_read_ahead_buffer +
+                           ((current - p_instance_ctrl->read_ahead_sector) * sector_size),
+                           sector_size);
+                    i++;
+                    continue;
+                }
+            }
+
+            /* Read the run of sectors that are neither cached nor read ahead with one media request. */
+            uint32_t run = 1U;
+            while (((i + run) < num_sectors) &&
+                   (RM_FREERTOS_PLUS_FAT_CACHE_NONE == rm_freertos_plus_fat_cache_find(p_extend, current + run)) &&
+                   ((0U == p_instance_ctrl->read_ahead_count) ||
+                    ((current + run) < p_instance_ctrl->read_ahead_sector) ||
+                    ((current + run - p_instance_ctrl->read_ahead_sector) >= p_instance_ctrl->read_ahead_count)))
+            {
+                run++;
+            }
+
+            err = rm_freertos_plus_fat_media_transfer(p_instance_ctrl, p_dest, current, run, false);
+            i  += run;
+        }
+
+        if (FSP_SUCCESS == err)
+        {
+            /* Read ahead when this read continues the previous one. */
+            bool sequential = (sector == p_instance_ctrl->next_read_sector);
+            p_instance_ctrl->next_read_sector = sector + num_sectors;
+
+            if (sequential)
+            {
+                rm_freertos_plus_fat_read_ahead_start(p_instance_ctrl);
+            }
+        }
+
+#if 2 == BSP_CFG_RTOS
+        xSemaphoreGiveRecursive(p_instance_ctrl->p_mutex);
+#endif
     }
 
     if (FSP_SUCCESS != err)
@@ -397,13 +567,13 @@ int32_t rm_freertos_plus_fat_read (uint8_t * p_data, uint32_t sector, uint32_t n
         return (int32_t) (FF_ERR_IOMAN_DRIVER_FATAL_ERROR | FF_ERRFLAG);
     }
 
-    lReturnCode = FF_ERR_NONE;
-
-    return lReturnCode;
+    return FF_ERR_NONE;
 }
 
 /*******************************************************************************************************************//**
- * Writes sectors to block media device.
+ * Writes sectors to block media device. When the write-back cache is configured, sectors are stored in the cache and
+ * written to the media when they are evicted or the cache is flushed. Writes that do not fit in the cache are written
+ * to the media directly.
  *
  * @param[in] p_data                   Data to write.
  * @param[in] sector                   Sector to write to.
@@ -414,28 +584,66 @@ int32_t rm_freertos_plus_fat_read (uint8_t * p_data, uint32_t sector, uint32_t n
  * @retval     FF_ERR_IOMAN_DRIVER_FATAL_ERROR    Error reported by block media driver during write.
  **********************************************************************************************************************/
 int32_t rm_freertos_plus_fat_write (uint8_t * p_data, uint32_t sector, uint32_t num_sectors, FF_Disk_t * p_disk) {
-    fsp_err_t err;
-    int32_t   lReturnCode = (int32_t) (FF_ERR_IOMAN_OUT_OF_BOUNDS_READ | FF_ERRFLAG);
+    fsp_err_t err = FSP_SUCCESS;
 
     rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl = (rm_freertos_plus_fat_instance_ctrl_t *) p_disk->pvTag;
+    rm_freertos_plus_fat_extended_cfg_t const * p_extend  =
+        (rm_freertos_plus_fat_extended_cfg_t const *) p_instance_ctrl->p_cfg->p_extend;
 
+    if (NULL == p_extend)
+    {
+        err = rm_freertos_plus_fat_media_transfer(p_instance_ctrl, p_data, sector, num_sectors, true);
+    }
+    else
+    {
 #if 2 == BSP_CFG_RTOS
-
-    /* Store the handle of the calling task. */
-    p_instance_ctrl->current_task = xTaskGetCurrentTaskHandle();
-#else
-    p_instance_ctrl->event_ready = false;
+        xSemaphoreTakeRecursive(p_instance_ctrl->p_mutex, portMAX_DELAY);
 #endif
 
-    p_instance_ctrl->last_event = (rm_block_media_event_t) 0;
+        uint32_t sector_size = p_instance_ctrl->sector_size_bytes;
 
-    err = p_instance_ctrl->p_cfg->p_block_media->p_api->write(p_instance_ctrl->p_cfg->p_block_media->p_ctrl,
-                                                              p_data,
-                                                              sector,
-                                                              num_sectors);
-    if (FSP_SUCCESS == err)
-    {
-        err = rm_freertos_plus_fat_wait_event(p_instance_ctrl, RM_FREERTOS_PLUS_FAT_WRITE_TIMEOUT_TICKS);
+        if (num_sectors >= p_extend->num_cache_sectors)
+        {
+            /* The write replaces any cached copy of these sectors. */
+            for (uint32_t i = 0U; i < p_extend->num_cache_sectors; i++)
+            {
+                rm_freertos_plus_fat_cache_entry_t * p_entry = &p_extend->p_cache_entries[i];
+                if ((RM_FREERTOS_PLUS_FAT_CACHE_VALID & p_entry->state) && (p_entry->sector >= sector) &&
+                    ((p_entry->sector - sector) < num_sectors))
+                {
+                    p_entry->state = 0U;
+                }
+            }
+
+            err = rm_freertos_plus_fat_media_transfer(p_instance_ctrl, p_data, sector, num_sectors, true);
+        }
+        else
+        {
+            for (uint32_t i = 0U; (i < num_sectors) && (FSP_SUCCESS == err); i++)
+            {
+                uint32_t entry = rm_freertos_plus_fat_cache_find(p_extend, sector + i);
+
+                if (RM_FREERTOS_PLUS_FAT_CACHE_NONE == entry)
+                {
+                    entry = rm_freertos_plus_fat_cache_alloc(p_instance_ctrl, sector + i, &err);
+                }
+
+                if (FSP_SUCCESS == err)
+                {
+                    memcpy(p_extend->p_cache + (entry * sector_size), p_data + (i * sector_size), sector_size);
+                    p_extend->p_cache_entries[entry].state    = RM_FREERTOS_PLUS_FAT_CACHE_VALID |
+                                                                RM_FREERTOS_PLUS_FAT_CACHE_DIRTY;
+                    p_extend->p_cache_entries[entry].last_use = ++p_instance_ctrl->cache_tick;
+                }
+            }
+        }
+
+        /* Sectors read ahead before this write are stale. */
+        rm_freertos_plus_fat_read_ahead_invalidate(p_instance_ctrl, sector, num_sectors);
+
+#if 2 == BSP_CFG_RTOS
+        xSemaphoreGiveRecursive(p_instance_ctrl->p_mutex);
+#endif
     }
 
     if (FSP_SUCCESS != err)
@@ -443,9 +651,7 @@ int32_t rm_freertos_plus_fat_write (uint8_t * p_data, uint32_t sector, uint32_t
         return (int32_t) (FF_ERR_IOMAN_DRIVER_FATAL_ERROR | FF_ERRFLAG);
     }
 
-    lReturnCode = FF_ERR_NONE;
-
-    return lReturnCode;
+    return FF_ERR_NONE;
 }
 
 /*******************************************************************************************************************//**
@@ -530,6 +736,19 @@ static fsp_err_t rm_freertos_plus_fat_wait_event (rm_freertos_plus_fat_instance_
     FSP_PARAMETER_NOT_USED(timeout);
 #endif
 
+    return rm_freertos_plus_fat_event_check(p_instance_ctrl);
+}
+
+/*******************************************************************************************************************//**
+ * Checks the events reported for a completed block media transfer.
+ *
+ * @param[in] p_instance_ctrl          Pointer to instance control structure.
+ *
+ * @retval     FSP_SUCCESS             Transfer completed successfully.
+ * @retval     FSP_ERR_INTERNAL        Error reported by lower layer driver callback.
+ **********************************************************************************************************************/
+static fsp_err_t rm_freertos_plus_fat_event_check (rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl)
+{
     FSP_ERROR_RETURN(0U == (RM_BLOCK_MEDIA_EVENT_ERROR & p_instance_ctrl->last_event), FSP_ERR_INTERNAL);
 
     if (RM_BLOCK_MEDIA_EVENT_POLL_STATUS & p_instance_ctrl->last_event)
@@ -569,3 +788,338 @@ static fsp_err_t rm_freertos_plus_fat_wait_for_device (rm_freertos_plus_fat_inst
 
     return FSP_SUCCESS;
 }
+
+/*******************************************************************************************************************//**
+ * Reads or writes sectors on the block media device and waits for the transfer to complete. A pending read-ahead is
+ * completed first since the block media driver handles one request at a time.
+ *
+ * @param[in] p_instance_ctrl          Pointer to instance control structure.
+ * @param[in] p_data                   Data to write or buffer to store read data.
+ * @param[in] sector                   First sector to transfer.
+ * @param[in] num_sectors              Number of sectors to transfer.
+ * @param[in] write                    true to write to the media, false to read from the media.
+ *
+ * @retval     FSP_SUCCESS             Transfer complete.
+ * @retval     FSP_ERR_TIMEOUT         Timeout occurred waiting for device.
+ * @retval     FSP_ERR_INTERNAL        Error reported by lower layer driver callback.
+ *
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref rm_block_media_api_t::read
+ *             * @ref rm_block_media_api_t::write
+ **********************************************************************************************************************/
+static fsp_err_t rm_freertos_plus_fat_media_transfer (rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl,
+                                                      uint8_t                              * p_data,
+                                                      uint32_t                               sector,
+                                                      uint32_t                               num_sectors,
+                                                      bool                                   write)
+{
+    rm_block_media_instance_t const * const p_block_media = p_instance_ctrl->p_cfg->p_block_media;
+    fsp_err_t err;
+
+    /* A failed read-ahead only drops the read-ahead window. */
+    (void) rm_freertos_plus_fat_read_ahead_wait(p_instance_ctrl);
+
+#if 2 == BSP_CFG_RTOS
+
+    /* Store the handle of the calling task. */
+    p_instance_ctrl->current_task = xTaskGetCurrentTaskHandle();
+#else
+    p_instance_ctrl->event_ready = false;
+#endif
+
+    p_instance_ctrl->last_event = (rm_block_media_event_t) 0;
+
+    if (write)
+    {
+        err = p_block_media->p_api->write(p_block_media->p_ctrl, p_data, sector, num_sectors);
+    }
+    else
+    {
+        err = p_block_media->p_api->read(p_block_media->p_ctrl, p_data, sector, num_sectors);
+    }
+
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    return rm_freertos_plus_fat_wait_event(p_instance_ctrl,
+                                           write ? RM_FREERTOS_PLUS_FAT_WRITE_TIMEOUT_TICKS :
+                                           RM_FREERTOS_PLUS_FAT_READ_TIMEOUT_TICKS);
+}
+
+/*******************************************************************************************************************//**
+ * Starts reading the sectors following the last read into the read-ahead buffer. The function returns without waiting
+ * for the transfer, which is completed when the data is used or before the next media request. Does nothing if
+ * read-ahead is not configured or the next sector is already in the read-ahead window.
+ *
+ * @param[in] p_instance_ctrl          Pointer to instance control structure.
+ **********************************************************************************************************************/
+static void rm_freertos_plus_fat_read_ahead_start (rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl)
+{
+    rm_freertos_plus_fat_extended_cfg_t const * p_extend =
+        (rm_freertos_plus_fat_extended_cfg_t const *) p_instance_ctrl->p_cfg->p_extend;
+    rm_block_media_instance_t const * const p_block_media = p_instance_ctrl->p_cfg->p_block_media;
+    uint32_t start = p_instance_ctrl->next_read_sector;
+
+    if ((0U == p_extend->read_ahead_sectors) || (start >= p_instance_ctrl->sector_count))
+    {
+        return;
+    }
+
+    if ((p_instance_ctrl->read_ahead_count > 0U) && (start >= p_instance_ctrl->read_ahead_sector) &&
+        ((start - p_instance_ctrl->read_ahead_sector) < p_instance_ctrl->read_ahead_count))
+    {
+        return;
+    }
+
+    (void) rm_freertos_plus_fat_read_ahead_wait(p_instance_ctrl);
+
+    uint32_t count = p_instance_ctrl->sector_count - start;
+    if (count > p_extend->read_ahead_sectors)
+    {
+        count = p_extend->read_ahead_sectors;
+    }
+
+    /* Nobody waits for the read-ahead until its data is needed. */
+#if 2 == BSP_CFG_RTOS
+    p_instance_ctrl->current_task = NULL;
+#else
+    p_instance_ctrl->event_ready = false;
+#endif
+    p_instance_ctrl->last_event         = (rm_block_media_event_t) 0;
+    p_instance_ctrl->read_ahead_sector  = start;
+    p_instance_ctrl->read_ahead_count   = count;
+    p_instance_ctrl->read_ahead_pending = true;
+
+    if (FSP_SUCCESS !=
+        p_block_media->p_api->read(p_block_media->p_ctrl, p_extend->p_read_ahead_buffer, start, count))
+    {
+        p_instance_ctrl->read_ahead_pending = false;
+        p_instance_ctrl->read_ahead_count   = 0U;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Waits for a pending read-ahead to complete. The read-ahead window is dropped if the read-ahead failed.
+ *
+ * @param[in] p_instance_ctrl          Pointer to instance control structure.
+ *
+ * @retval     FSP_SUCCESS             No read-ahead pending or read-ahead completed.
+ * @retval     FSP_ERR_TIMEOUT         Timeout occurred waiting for device.
+ * @retval     FSP_ERR_INTERNAL        Error reported by lower layer driver callback.
+ **********************************************************************************************************************/
+static fsp_err_t rm_freertos_plus_fat_read_ahead_wait (rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl)
+{
+    fsp_err_t err = FSP_SUCCESS;
+
+    if (!p_instance_ctrl->read_ahead_pending)
+    {
+        return FSP_SUCCESS;
+    }
+
+#if 2 == BSP_CFG_RTOS
+
+    /* Register for the notification unless the read-ahead already completed. */
+    bool done;
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    done = (0U != (RM_FREERTOS_PLUS_FAT_EVENT_DONE_MASK & p_instance_ctrl->last_event));
+    if (!done)
+    {
+        p_instance_ctrl->current_task = xTaskGetCurrentTaskHandle();
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    if (!done && (1U != ulTaskNotifyTake(pdTRUE, RM_FREERTOS_PLUS_FAT_READ_TIMEOUT_TICKS)))
+    {
+        err = FSP_ERR_TIMEOUT;
+    }
+#else
+    while (!p_instance_ctrl->event_ready)
+    {
+        ;
+    }
+#endif
+
+    p_instance_ctrl->read_ahead_pending = false;
+
+    if (FSP_SUCCESS == err)
+    {
+        err = rm_freertos_plus_fat_event_check(p_instance_ctrl);
+    }
+
+    if (FSP_SUCCESS != err)
+    {
+        p_instance_ctrl->read_ahead_count = 0U;
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Drops the read-ahead window if it overlaps sectors that were written.
+ *
+ * @param[in] p_instance_ctrl          Pointer to instance control structure.
+ * @param[in] sector                   First sector written.
+ * @param[in] num_sectors              Number of sectors written.
+ **********************************************************************************************************************/
+static void rm_freertos_plus_fat_read_ahead_invalidate (rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl,
+                                                        uint32_t                               sector,
+                                                        uint32_t                               num_sectors)
+{
+    if ((p_instance_ctrl->read_ahead_count > 0U) &&
+        (sector < (p_instance_ctrl->read_ahead_sector + p_instance_ctrl->read_ahead_count)) &&
+        (p_instance_ctrl->read_ahead_sector < (sector + num_sectors)))
+    {
+        /* The pending transfer still targets the read-ahead buffer, so it must finish before the buffer is reused. */
+        (void) rm_freertos_plus_fat_read_ahead_wait(p_instance_ctrl);
+        p_instance_ctrl->read_ahead_count = 0U;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Finds the cache entry holding a sector.
+ *
+ * @param[in] p_extend                 Pointer to sector cache configuration.
+ * @param[in] sector                   Sector to find.
+ *
+ * @return Index of the cache entry or RM_FREERTOS_PLUS_FAT_CACHE_NONE if the sector is not cached.
+ **********************************************************************************************************************/
+static uint32_t rm_freertos_plus_fat_cache_find (rm_freertos_plus_fat_extended_cfg_t const * p_extend, uint32_t sector)
+{
+    for (uint32_t i = 0U; i < p_extend->num_cache_sectors; i++)
+    {
+        if ((RM_FREERTOS_PLUS_FAT_CACHE_VALID & p_extend->p_cache_entries[i].state) &&
+            (sector == p_extend->p_cache_entries[i].sector))
+        {
+            return i;
+        }
+    }
+
+    return RM_FREERTOS_PLUS_FAT_CACHE_NONE;
+}
+
+/*******************************************************************************************************************//**
+ * Allocates a cache entry for a sector. The entry following the one holding the previous sector is preferred so
+ * sequentially written sectors are adjacent in cache memory and can be written back with one request. Otherwise the
+ * least recently used entry is replaced. If the selected entry is dirty the whole cache is written back first.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to instance control structure.
+ * @param[in]  sector                  Sector to allocate an entry for.
+ * @param[out] p_err                   Set to the write back error, if any.
+ *
+ * @return Index of the allocated cache entry, or RM_FREERTOS_PLUS_FAT_CACHE_NONE if the write back failed. The cache
+ *         is left unchanged in that case.
+ **********************************************************************************************************************/
+static uint32_t rm_freertos_plus_fat_cache_alloc (rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl,
+                                                  uint32_t                               sector,
+                                                  fsp_err_t                            * p_err)
+{
+    rm_freertos_plus_fat_extended_cfg_t const * p_extend =
+        (rm_freertos_plus_fat_extended_cfg_t const *) p_instance_ctrl->p_cfg->p_extend;
+    rm_freertos_plus_fat_cache_entry_t * p_entries = p_extend->p_cache_entries;
+    uint32_t entry = RM_FREERTOS_PLUS_FAT_CACHE_NONE;
+
+    if (sector > 0U)
+    {
+        uint32_t previous = rm_freertos_plus_fat_cache_find(p_extend, sector - 1U);
+        if ((RM_FREERTOS_PLUS_FAT_CACHE_NONE != previous) && ((previous + 1U) < p_extend->num_cache_sectors) &&
+            (0U == (RM_FREERTOS_PLUS_FAT_CACHE_DIRTY & p_entries[previous + 1U].state)))
+        {
+            entry = previous + 1U;
+        }
+    }
+
+    if (RM_FREERTOS_PLUS_FAT_CACHE_NONE == entry)
+    {
+        /* Use a free entry, or the least recently used one. */
+        entry = 0U;
+        for (uint32_t i = 0U; i < p_extend->num_cache_sectors; i++)
+        {
+            if (0U == (RM_FREERTOS_PLUS_FAT_CACHE_VALID & p_entries[i].state))
+            {
+                entry = i;
+                break;
+            }
+
+            if ((p_entries[i].last_use - p_entries[entry].last_use) > (UINT32_MAX / 2U))
+            {
+                entry = i;
+            }
+        }
+    }
+
+    if (RM_FREERTOS_PLUS_FAT_CACHE_DIRTY & p_entries[entry].state)
+    {
+        /* Write back all dirty sectors at once so adjacent sectors are combined. */
+        *p_err = rm_freertos_plus_fat_cache_flush(p_instance_ctrl);
+
+        /* Keep the dirty sector in the cache if it could not be written back. */
+        FSP_ERROR_RETURN(FSP_SUCCESS == *p_err, RM_FREERTOS_PLUS_FAT_CACHE_NONE);
+    }
+
+    p_entries[entry].sector = sector;
+    p_entries[entry].state  = 0U;
+
+    return entry;
+}
+
+/*******************************************************************************************************************//**
+ * Writes all dirty cache entries to the media. Entries holding consecutive sectors in adjacent cache memory are
+ * written with a single multi-sector write.
+ *
+ * @param[in] p_instance_ctrl          Pointer to instance control structure.
+ *
+ * @retval     FSP_SUCCESS             All dirty sectors written.
+ *
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ **********************************************************************************************************************/
+static fsp_err_t rm_freertos_plus_fat_cache_flush (rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl)
+{
+    rm_freertos_plus_fat_extended_cfg_t const * p_extend =
+        (rm_freertos_plus_fat_extended_cfg_t const *) p_instance_ctrl->p_cfg->p_extend;
+
+    if (NULL == p_extend)
+    {
+        return FSP_SUCCESS;
+    }
+
+    rm_freertos_plus_fat_cache_entry_t * p_entries = p_extend->p_cache_entries;
+    uint32_t i = 0U;
+
+    while (i < p_extend->num_cache_sectors)
+    {
+        if (0U == (RM_FREERTOS_PLUS_FAT_CACHE_DIRTY & p_entries[i].state))
+        {
+            i++;
+            continue;
+        }
+
+        uint32_t run = 1U;
+        while (((i + run) < p_extend->num_cache_sectors) &&
+               (RM_FREERTOS_PLUS_FAT_CACHE_DIRTY & p_entries[i + run].state) &&
+               ((p_entries[i].sector + run) == p_entries[i + run].sector))
+        {
+            run++;
+        }
+
+        fsp_err_t err = rm_freertos_plus_fat_media_transfer(p_instance_ctrl,
+                                                            p_extend->p_cache + (i * p_instance_ctrl->sector_size_bytes),
+                                                            p_entries[i].sector,
+                                                            run,
+                                                            true);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        for (uint32_t j = 0U; j < run; j++)
+        {
+            p_entries[i + j].state &= ~RM_FREERTOS_PLUS_FAT_CACHE_DIRTY;
+        }
+
+        /* A read-ahead started while these sectors were dirty holds old data. */
+        rm_freertos_plus_fat_read_ahead_invalidate(p_instance_ctrl, p_entries[i].sector, run);
+
+        i += run;
+    }
+
+    return FSP_SUCCESS;
+}
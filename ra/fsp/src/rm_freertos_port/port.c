@@ -234,6 +234,11 @@ void rm_freertos_port_restore_task_stackless(void) RM_FREERTOS_PORT_NAKED_FUNCTI
 void rm_freertos_port_stack_monitor_cfg(uint32_t psp);
 void rm_freertos_port_sleep_preserving_lpm(uint32_t xExpectedIdleTime);
 
+#if BSP_CFG_RTOS_TRACE_ENABLE
+void rm_freertos_port_trace_switch_context(void);
+
+#endif
+
 /*-----------------------------------------------------------*/
 
 /* Each task maintains its own interrupt status in the critical nesting
@@ -598,7 +603,11 @@ void PendSV_Handler (void)
 #endif
 
         /* Call vTaskSwitchContext(). In this function, pxCurrentTCB is updated to the next task to run. */
+#if BSP_CFG_RTOS_TRACE_ENABLE
+        "BL      rm_freertos_port_trace_switch_context \n"
+#else
         "BL      vTaskSwitchContext              \n"
+#endif
 
         /* Restore interrupts. This is done by unmasking all interrupts in BASEPRI if the MCU has BASEPRI,
          * or by reenabling interrupts globally if the MCU does not have BASEPRI. */
@@ -614,6 +623,22 @@ void PendSV_Handler (void)
         );
 }
 
+#if BSP_CFG_RTOS_TRACE_ENABLE
+
+/***********************************************************************************************************************
+ * Selects the next task and reports the switch to rm_rtos_trace. Called from PendSV_Handler in place of
+ * vTaskSwitchContext() with interrupts masked.
+ **********************************************************************************************************************/
+void rm_freertos_port_trace_switch_context (void)
+{
+    vTaskSwitchContext();
+
+    TaskHandle_t xTask = (TaskHandle_t) pxCurrentTCB;
+    rm_rtos_trace_task_switch(xTask, pcTaskGetName(xTask));
+}
+
+#endif
+
 #if RM_FREERTOS_PORT_PRV_USE_HW_STACK_MONITOR
 
 /***********************************************************************************************************************
@@ -869,6 +894,10 @@ static void rm_freertos_port_reset_systick (uint32_t tick_fraction_remaining, ui
  **********************************************************************************************************************/
 void SysTick_Handler (void)
 {
+#if BSP_CFG_RTOS_TRACE_ENABLE
+    rm_rtos_trace_isr_enter((uint32_t) SysTick_IRQn);
+#endif
+
 #if configUSE_TICKLESS_IDLE
 
     /* Reset the SysTick reload value if it was reconfigured for a long sleep in tickless idle. */
@@ -893,6 +922,10 @@ void SysTick_Handler (void)
     }
 
     portCLEAR_INTERRUPT_MASK_FROM_ISR(ulPreviousMask);
+
+#if BSP_CFG_RTOS_TRACE_ENABLE
+    rm_rtos_trace_isr_exit((uint32_t) SysTick_IRQn);
+#endif
 }
 
 /*-----------------------------------------------------------*/
@@ -33,6 +33,7 @@
 #endif
 #if (GX_USE_RENESAS_JPEG == 1)
  #include    "r_jpeg.h"
+ #include    "rm_guix_port.h"
 #else
  #include    "bsp_api.h"
 #endif
@@ -133,6 +134,28 @@ typedef struct st_jpeg_output_streaming_param
     GX_VALUE          image_height;
     UINT              bytes_per_pixel;
 } jpeg_output_streaming_param_t;
+
+/** MJPEG playback state. The JPEG work buffer is split into two frame buffers when it is large enough, so the codec
+ *  can decode frame N+1 into one while frame N is being composited from the other. */
+typedef struct st_gx_renesas_mjpeg
+{
+    rm_guix_port_mjpeg_source_t p_source;
+    void                      * p_source_context;
+    jpeg_instance_t           * p_jpeg;
+    UCHAR                     * p_buffer[2];
+    UINT                        buffer_size;
+    UINT                        frame_size;
+    UINT                        bytes_per_pixel;
+    GX_VALUE                    width;
+    GX_VALUE                    height;
+    UINT                        ready;
+    UINT                        target;
+    GX_BOOL                     frame_ready;
+    GX_BOOL                     decode_pending;
+    GX_BOOL                     pipelined;
+    ULONG                       last_frame_time;
+    rm_guix_port_mjpeg_stats_t  stats;
+} gx_renesas_mjpeg_t;
 #endif
 
 /** Data structure to save pixel color data for four adjacent pixels */
@@ -212,6 +235,7 @@ static d2_s32 dave_error_list[DAVE_ERROR_LIST_SIZE] = {0};
 #if (GX_USE_RENESAS_JPEG == 1)
 extern TX_SEMAPHORE  gx_renesas_jpeg_semaphore;
 static jpeg_status_t g_jpeg_status;
+static gx_renesas_mjpeg_t g_mjpeg;
 #endif
 
 /***********************************************************************************************************************
@@ -307,6 +331,11 @@ static UINT gx_renesas_jpeg_draw_minimum_height_get(jpeg_color_space_t format, G
 
 static INT gx_renesas_jpeg_draw_output_streaming_wait(void);
 
+static INT  gx_renesas_mjpeg_decode_start(GX_DRAW_CONTEXT * p_context, UINT index);
+static INT  gx_renesas_mjpeg_decode_finish(void);
+static INT  gx_renesas_mjpeg_geometry_set(void);
+static VOID gx_renesas_mjpeg_frame_draw(GX_DRAW_CONTEXT * p_context, INT x, INT y);
+
 #endif
 
 /** functions shared in GUIX display driver files */
@@ -2769,6 +2798,12 @@ VOID _gx_renesas_jpeg_draw (GX_DRAW_CONTEXT * p_context, INT x, INT y, GX_PIXELM
     UINT                          minimum_height  = 0;
     UINT                          memory_required = 0;
 
+    /** Lets an MJPEG frame decode in flight finish so the JPEG Codec is free. */
+    if (g_mjpeg.decode_pending)
+    {
+        gx_renesas_mjpeg_decode_finish();
+    }
+
     /** Gets JPEG Framework driver instance.  */
     p_jpeg = (jpeg_instance_t *) rm_guix_port_jpeg_instance_get(p_context->gx_draw_context_display->gx_display_handle);
 
@@ -2863,6 +2898,170 @@ VOID _gx_renesas_jpeg_draw (GX_DRAW_CONTEXT * p_context, INT x, INT y, GX_PIXELM
     p_jpeg->p_api->close(p_jpeg->p_ctrl);
 }                                      /* End of function _gx_driver_jpeg_draw() */
 
+/*******************************************************************************************************************//**
+ * @brief  Starts Motion-JPEG playback from a streaming source. Frames are pulled from p_source each time
+ *  rm_guix_port_mjpeg_draw() is called, typically from the draw function of a widget that is marked dirty on every
+ *  GUIX timer tick.
+ *  If the JPEG work buffer can hold two decoded frames, the JPEG Codec decodes the next frame into one half while the
+ *  current frame is composited from the other; otherwise each frame is decoded before it is drawn.
+ * @param   p_source[in]        Source callback supplying compressed frames
+ * @param   p_context[in]       Context passed to p_source
+ * @retval  GX_SUCCESS          Playback started.
+ * @retval  GX_PTR_ERROR        p_source is NULL.
+ **********************************************************************************************************************/
+UINT rm_guix_port_mjpeg_start (rm_guix_port_mjpeg_source_t p_source, void * p_context)
+{
+    if (NULL == p_source)
+    {
+        return (UINT) GX_PTR_ERROR;
+    }
+
+    rm_guix_port_mjpeg_stop();
+
+    memset(&g_mjpeg, 0, sizeof(g_mjpeg));
+    g_mjpeg.p_source         = p_source;
+    g_mjpeg.p_source_context = p_context;
+    g_mjpeg.last_frame_time  = tx_time_get();
+
+    return (UINT) GX_SUCCESS;
+}                                      /* End of function rm_guix_port_mjpeg_start() */
+
+/*******************************************************************************************************************//**
+ * @brief  Stops Motion-JPEG playback. Waits for a frame decode in flight to finish. Must be called from the GUIX
+ *  thread.
+ * @retval  GX_SUCCESS          Playback stopped.
+ **********************************************************************************************************************/
+UINT rm_guix_port_mjpeg_stop (void)
+{
+    if (g_mjpeg.decode_pending)
+    {
+        gx_renesas_mjpeg_decode_finish();
+    }
+
+    g_mjpeg.p_source    = NULL;
+    g_mjpeg.frame_ready = GX_FALSE;
+
+    return (UINT) GX_SUCCESS;
+}                                      /* End of function rm_guix_port_mjpeg_stop() */
+
+/*******************************************************************************************************************//**
+ * @brief  Draws the current Motion-JPEG frame at (x, y) and starts decoding the next one.
+ * @param   p_context[in]       Pointer to a GUIX draw context
+ * @param   x[in]               x axis pixel offset
+ * @param   y[in]               y axis pixel offset
+ **********************************************************************************************************************/
+VOID rm_guix_port_mjpeg_draw (GX_DRAW_CONTEXT * p_context, INT x, INT y)
+{
+    INT   buffer_size = 0;
+    ULONG wait_start;
+    ULONG now;
+    UINT  drawn = g_mjpeg.stats.frames_drawn;
+
+    if (NULL == g_mjpeg.p_source)
+    {
+        return;
+    }
+
+    g_mjpeg.p_jpeg =
+        (jpeg_instance_t *) rm_guix_port_jpeg_instance_get(p_context->gx_draw_context_display->gx_display_handle);
+    g_mjpeg.p_buffer[0] = rm_guix_port_jpeg_buffer_get(p_context->gx_draw_context_display->gx_display_handle,
+                                                       &buffer_size);
+    g_mjpeg.buffer_size = (UINT) buffer_size;
+
+    /** Rejects the work buffer if it is missing or not 8-byte aligned. */
+    if ((GX_NULL == g_mjpeg.p_buffer[0]) || ((ULONG) g_mjpeg.p_buffer[0] & 0x7))
+    {
+        return;
+    }
+
+    wait_start = tx_time_get();
+
+    /** Collects the frame the JPEG Codec decoded while the previous frame was being composited. */
+    if (g_mjpeg.decode_pending)
+    {
+        gx_renesas_mjpeg_decode_finish();
+    }
+
+    /** Without a decoded frame (first frame, after an error) or without a second buffer, decodes synchronously. */
+    if (!g_mjpeg.frame_ready || !g_mjpeg.pipelined)
+    {
+ #if (GX_RENESAS_DAVE2D_DRAW == 1)
+
+        /* Make sure D/AVE 2D has finished reading the buffer before it is overwritten. */
+        CHECK_DAVE_STATUS(d2_endframe(p_context->gx_draw_context_display->gx_display_accelerator))
+        CHECK_DAVE_STATUS(d2_startframe(p_context->gx_draw_context_display->gx_display_accelerator))
+ #endif
+
+        if (FSP_SUCCESS == gx_renesas_mjpeg_decode_start(p_context, 0U))
+        {
+            gx_renesas_mjpeg_decode_finish();
+        }
+    }
+
+    now = tx_time_get();
+    g_mjpeg.stats.decode_wait_last = (uint32_t) (now - wait_start);
+    if (g_mjpeg.stats.decode_wait_last > g_mjpeg.stats.decode_wait_max)
+    {
+        g_mjpeg.stats.decode_wait_max = g_mjpeg.stats.decode_wait_last;
+    }
+
+    if (!g_mjpeg.frame_ready)
+    {
+        return;
+    }
+
+    if (g_mjpeg.stats.frames_drawn != drawn)
+    {
+        g_mjpeg.stats.frame_time_last = (uint32_t) (now - g_mjpeg.last_frame_time);
+        if (g_mjpeg.stats.frame_time_last > g_mjpeg.stats.frame_time_max)
+        {
+            g_mjpeg.stats.frame_time_max = g_mjpeg.stats.frame_time_last;
+        }
+
+        g_mjpeg.last_frame_time = now;
+    }
+
+    if (g_mjpeg.pipelined)
+    {
+ #if (GX_RENESAS_DAVE2D_DRAW == 1)
+
+        /* The other buffer was composited during the previous draw; make sure D/AVE 2D is done with it. */
+        CHECK_DAVE_STATUS(d2_endframe(p_context->gx_draw_context_display->gx_display_accelerator))
+        CHECK_DAVE_STATUS(d2_startframe(p_context->gx_draw_context_display->gx_display_accelerator))
+ #endif
+
+        /** Starts decoding the next frame into the other buffer. It is collected by the next draw. */
+        gx_renesas_mjpeg_decode_start(p_context, g_mjpeg.ready ^ 1U);
+    }
+
+    gx_renesas_mjpeg_frame_draw(p_context, x, y);
+
+ #if (GX_RENESAS_DAVE2D_DRAW == 1)
+
+    /* trigger execution of previous display list, switch to new display list */
+    CHECK_DAVE_STATUS(d2_endframe(p_context->gx_draw_context_display->gx_display_accelerator))
+    CHECK_DAVE_STATUS(d2_startframe(p_context->gx_draw_context_display->gx_display_accelerator))
+ #endif
+}                                      /* End of function rm_guix_port_mjpeg_draw() */
+
+/*******************************************************************************************************************//**
+ * @brief  Gets Motion-JPEG playback statistics.
+ * @param   p_stats[out]        Pointer to the memory area to store the statistics
+ * @retval  GX_SUCCESS          Statistics copied.
+ * @retval  GX_PTR_ERROR        p_stats is NULL.
+ **********************************************************************************************************************/
+UINT rm_guix_port_mjpeg_stats_get (rm_guix_port_mjpeg_stats_t * p_stats)
+{
+    if (NULL == p_stats)
+    {
+        return (UINT) GX_PTR_ERROR;
+    }
+
+    *p_stats = g_mjpeg.stats;
+
+    return (UINT) GX_SUCCESS;
+}                                      /* End of function rm_guix_port_mjpeg_stats_get() */
+
 #endif /* (GX_USE_RENESAS_JPEG)  */
 
 /*******************************************************************************************************************//**
@@ -4030,6 +4229,215 @@ static VOID gx_renesas_jpeg_draw_output_streaming (jpeg_output_streaming_param_t
     }
 }
 
+/*******************************************************************************************************************//**
+ * @brief  Subroutine for Motion-JPEG playback to start decoding the next frame from the source.
+ *  This function is called by rm_guix_port_mjpeg_draw().
+ * @param   p_context[in]       Pointer to a GUIX draw context
+ * @param   index[in]           Index of the frame buffer to decode into
+ * @retval  FSP_SUCCESS         Decoding started.
+ * @retval  Others              The source had no new frame or the JPEG driver returned an error.
+ **********************************************************************************************************************/
+static INT gx_renesas_mjpeg_decode_start (GX_DRAW_CONTEXT * p_context, UINT index)
+{
+    INT                        ret;
+    jpeg_instance_t          * p_jpeg = g_mjpeg.p_jpeg;
+    rm_guix_port_mjpeg_frame_t frame  = {0};
+
+    if (!g_mjpeg.p_source(&frame, g_mjpeg.p_source_context) || (NULL == frame.p_data))
+    {
+        g_mjpeg.stats.source_underruns++;
+
+        return FSP_ERR_JPEG_ERR;
+    }
+
+    ret = gx_renesas_jpeg_draw_open(p_context, p_jpeg, &g_mjpeg.bytes_per_pixel);
+    if (ret)
+    {
+        g_mjpeg.stats.frames_dropped++;
+
+        return ret;
+    }
+
+    g_mjpeg.target = index;
+
+    /* With the geometry known the driver starts decoding as soon as the header is parsed. Otherwise the output buffer
+     * is assigned by gx_renesas_mjpeg_geometry_set() once the image size is available. */
+    if (0 != g_mjpeg.width)
+    {
+        ret += (INT) p_jpeg->p_api->horizontalStrideSet(p_jpeg->p_ctrl, (uint32_t) g_mjpeg.width);
+        ret += (INT) p_jpeg->p_api->outputBufferSet(p_jpeg->p_ctrl, g_mjpeg.p_buffer[index], g_mjpeg.frame_size);
+    }
+
+    ret += (INT) p_jpeg->p_api->inputBufferSet(p_jpeg->p_ctrl, (void *) frame.p_data, frame.size);
+    if (ret)
+    {
+        p_jpeg->p_api->close(p_jpeg->p_ctrl);
+        g_mjpeg.stats.frames_dropped++;
+
+        return ret;
+    }
+
+    g_mjpeg.decode_pending = GX_TRUE;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Subroutine for Motion-JPEG playback to wait for the frame being decoded and close the JPEG driver.
+ * @retval  FSP_SUCCESS         The frame was decoded and is ready to be drawn.
+ * @retval  Others              The frame was dropped.
+ **********************************************************************************************************************/
+static INT gx_renesas_mjpeg_decode_finish (void)
+{
+    INT               ret;
+    jpeg_instance_t * p_jpeg      = g_mjpeg.p_jpeg;
+    jpeg_status_t     jpeg_status = JPEG_STATUS_NONE;
+    uint16_t          width       = 0;
+    uint16_t          height      = 0;
+
+    g_mjpeg.decode_pending = GX_FALSE;
+
+    do
+    {
+        ret = gx_renesas_jpeg_wait(&jpeg_status, 1000);
+
+        /* The first frame sets the geometry used for the rest of the stream. */
+        if ((FSP_SUCCESS == ret) && ((UINT) JPEG_STATUS_IMAGE_SIZE_READY & (UINT) jpeg_status) && (0 == g_mjpeg.width))
+        {
+            ret = gx_renesas_mjpeg_geometry_set();
+        }
+    } while ((FSP_SUCCESS == ret) &&
+             !((UINT) (JPEG_STATUS_OPERATION_COMPLETE | JPEG_STATUS_ERROR | JPEG_STATUS_OUTPUT_PAUSE) &
+               (UINT) jpeg_status));
+
+    if ((FSP_SUCCESS == ret) && ((UINT) JPEG_STATUS_OPERATION_COMPLETE & (UINT) jpeg_status))
+    {
+        /* A frame of a different size was decoded with the stride of the stream; it cannot be drawn. */
+        ret = (INT) p_jpeg->p_api->imageSizeGet(p_jpeg->p_ctrl, &width, &height);
+        if ((width != (uint16_t) g_mjpeg.width) || (height != (uint16_t) g_mjpeg.height))
+        {
+            ret = FSP_ERR_JPEG_UNSUPPORTED_IMAGE_SIZE;
+        }
+    }
+    else if (FSP_SUCCESS == ret)
+    {
+        /* Decode error, or the frame did not fit into the frame buffer */
+        ret = FSP_ERR_JPEG_ERR;
+    }
+    else
+    {
+        /* Timeout */
+    }
+
+    p_jpeg->p_api->close(p_jpeg->p_ctrl);
+
+    if (FSP_SUCCESS == ret)
+    {
+        g_mjpeg.ready       = g_mjpeg.target;
+        g_mjpeg.frame_ready = GX_TRUE;
+        g_mjpeg.stats.frames_drawn++;
+    }
+    else
+    {
+        /* Restart from a synchronous decode and re-read the geometry from the next frame. */
+        g_mjpeg.frame_ready = GX_FALSE;
+        g_mjpeg.width       = 0;
+        g_mjpeg.stats.frames_dropped++;
+    }
+
+    return ret;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Subroutine for Motion-JPEG playback to set the stream geometry from the first frame and assign the output
+ *  buffer. The JPEG work buffer is split into two frame buffers if it is large enough.
+ * @retval  FSP_SUCCESS         Output buffer assigned and decoding started.
+ * @retval  Others              The image size or format is not supported or the work buffer is too small.
+ **********************************************************************************************************************/
+static INT gx_renesas_mjpeg_geometry_set (void)
+{
+    INT                ret;
+    jpeg_instance_t  * p_jpeg       = g_mjpeg.p_jpeg;
+    jpeg_color_space_t pixel_format = JPEG_COLOR_SPACE_YCBCR422;
+    uint16_t           width        = 0;
+    uint16_t           height       = 0;
+    UINT               frame_stride;
+
+    ret  = (INT) p_jpeg->p_api->imageSizeGet(p_jpeg->p_ctrl, &width, &height);
+    ret += (INT) p_jpeg->p_api->pixelFormatGet(p_jpeg->p_ctrl, &pixel_format);
+    if (ret)
+    {
+        return ret;
+    }
+
+    if (0U == gx_renesas_jpeg_draw_minimum_height_get(pixel_format, (GX_VALUE) width, (GX_VALUE) height))
+    {
+        return FSP_ERR_JPEG_UNSUPPORTED_IMAGE_SIZE;
+    }
+
+    g_mjpeg.frame_size = (UINT) width * (UINT) height * g_mjpeg.bytes_per_pixel;
+    if (g_mjpeg.frame_size > g_mjpeg.buffer_size)
+    {
+        return FSP_ERR_JPEG_BUFFERSIZE_NOT_ENOUGH;
+    }
+
+    /* Keep the second frame buffer 8-byte aligned */
+    frame_stride        = (g_mjpeg.frame_size + JPEG_ALIGNMENT_8) & ~JPEG_ALIGNMENT_8;
+    g_mjpeg.pipelined   = (GX_BOOL) ((frame_stride + g_mjpeg.frame_size) <= g_mjpeg.buffer_size);
+    g_mjpeg.p_buffer[1] = g_mjpeg.pipelined ? (g_mjpeg.p_buffer[0] + frame_stride) : g_mjpeg.p_buffer[0];
+    g_mjpeg.width       = (GX_VALUE) width;
+    g_mjpeg.height      = (GX_VALUE) height;
+
+    ret  = (INT) p_jpeg->p_api->horizontalStrideSet(p_jpeg->p_ctrl, (uint32_t) width);
+    ret += (INT) p_jpeg->p_api->outputBufferSet(p_jpeg->p_ctrl, g_mjpeg.p_buffer[g_mjpeg.target], g_mjpeg.frame_size);
+
+    return ret;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Subroutine for Motion-JPEG playback to composite the ready frame into all views it overlaps.
+ * @param   p_context[in]       Pointer to a GUIX draw context
+ * @param   x[in]               x axis pixel offset
+ * @param   y[in]               y axis pixel offset
+ **********************************************************************************************************************/
+static VOID gx_renesas_mjpeg_frame_draw (GX_DRAW_CONTEXT * p_context, INT x, INT y)
+{
+    GX_VIEW    * view;
+    GX_RECTANGLE clip_rect;
+    GX_RECTANGLE bound;
+    GX_PIXELMAP  out_pixelmap = {0};
+
+    out_pixelmap.gx_pixelmap_data      = (GX_UBYTE *) g_mjpeg.p_buffer[g_mjpeg.ready];
+    out_pixelmap.gx_pixelmap_data_size = (ULONG) g_mjpeg.frame_size;
+    out_pixelmap.gx_pixelmap_format    = (GX_UBYTE) p_context->gx_draw_context_display->gx_display_color_format;
+    out_pixelmap.gx_pixelmap_height    = g_mjpeg.height;
+    out_pixelmap.gx_pixelmap_width     = g_mjpeg.width;
+
+    /** Calculate rectangle that bounds the frame and clip it to the dirty rectangle */
+    gx_utility_rectangle_define(&bound, (GX_VALUE) x, (GX_VALUE) y,
+                                (GX_VALUE) ((x + g_mjpeg.width) - 1),
+                                (GX_VALUE) ((y + g_mjpeg.height) - 1));
+
+    if (!gx_utility_rectangle_overlap_detect(&bound, &p_context->gx_draw_context_dirty, &bound))
+    {
+        return;
+    }
+
+    view = p_context->gx_draw_context_view_head;
+
+    while (view)
+    {
+        if (gx_utility_rectangle_overlap_detect(&view->gx_view_rectangle, &bound, &clip_rect))
+        {
+            p_context->gx_draw_context_clip = &clip_rect;
+
+            p_context->gx_draw_context_display->gx_display_driver_pixelmap_draw(p_context, x, y, &out_pixelmap);
+        }
+
+        view = view->gx_view_next;
+    }
+}
+
 #endif                                 /* GX_USE_RENESAS_JPEG */
 
 #if (GX_RENESAS_DAVE2D_DRAW == 0)
@@ -0,0 +1,483 @@
+/***********************************************************************************************************************
+ * Copyright [2020-2024] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "rm_jpeg_capture.h"
+#include "rm_jpeg_capture_cfg.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define RM_JPEG_CAPTURE_OPEN               (0x4A504743U) // "JPGC" in ASCII
+
+/* The JPEG codec encodes in units of 8 lines */
+#define RM_JPEG_CAPTURE_LINE_ALIGNMENT     (8U)
+
+/* Number of strip buffers the CEU alternates between in bundle write mode */
+#define RM_JPEG_CAPTURE_STRIP_COUNT        (2U)
+
+#define RM_JPEG_CAPTURE_CEU_BUNDLE_EVENTS  (CEU_EVENT_BUNDLE_A_END | CEU_EVENT_BUNDLE_B_END)
+#define RM_JPEG_CAPTURE_CEU_ERROR_EVENTS   (CEU_EVENT_CRAM_OVERFLOW | CEU_EVENT_HD_MISMATCH | CEU_EVENT_VD_MISMATCH | \
+                                            CEU_EVENT_VD_ERROR | CEU_EVENT_FIREWALL | CEU_EVENT_HD_MISSING |       \
+                                            CEU_EVENT_VD_MISSING)
+
+#if !JPEG_CFG_ENCODE_ENABLE
+ #error "RM_JPEG_CAPTURE requires JPEG encode support to be enabled"
+#endif
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static fsp_err_t rm_jpeg_capture_frame_start(rm_jpeg_capture_instance_ctrl_t * const p_ctrl);
+static void      rm_jpeg_capture_frame_abort(rm_jpeg_capture_instance_ctrl_t * const p_ctrl, uint32_t event);
+static void      rm_jpeg_capture_strip_submit(rm_jpeg_capture_instance_ctrl_t * const p_ctrl);
+static void      rm_jpeg_capture_notify(rm_jpeg_capture_instance_ctrl_t * const p_ctrl,
+                                        uint32_t                                event,
+                                        uint8_t const * const                   p_data,
+                                        uint32_t                                length);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Global variables
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_JPEG_CAPTURE
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Opens the CEU and JPEG instances and prepares the capture pipeline.
+ *
+ * The CEU writes each frame as a sequence of strips (bundles) alternating between the two halves of p_strip_buffer.
+ * Each completed strip is handed to the JPEG encoder while the CEU fills the other half, so only two strips of raw
+ * image data are held in memory at any time.
+ *
+ * @retval FSP_SUCCESS                 Pipeline successfully opened.
+ * @retval FSP_ERR_ASSERTION           A required pointer is NULL or the JPEG encode callback is not this module's.
+ * @retval FSP_ERR_ALREADY_OPEN        Module is already open.
+ * @retval FSP_ERR_INVALID_ARGUMENT    CEU bundle size is not a non-zero multiple of 8 lines.
+ * @retval FSP_ERR_INVALID_ALIGNMENT   The strip buffer is not 8-byte aligned.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ **********************************************************************************************************************/
+fsp_err_t RM_JPEG_CAPTURE_Open (rm_jpeg_capture_instance_ctrl_t * const p_ctrl,
+                                rm_jpeg_capture_cfg_t const * const     p_cfg)
+{
+    fsp_err_t err = FSP_SUCCESS;
+
+#if RM_JPEG_CAPTURE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_capture);
+    FSP_ASSERT(NULL != p_cfg->p_jpeg);
+    FSP_ASSERT(NULL != p_cfg->p_strip_buffer);
+    FSP_ASSERT(NULL != p_cfg->pp_frame_buffers);
+    FSP_ASSERT(0U != p_cfg->frame_buffer_count);
+    FSP_ASSERT(NULL != p_cfg->p_callback);
+    FSP_ERROR_RETURN(RM_JPEG_CAPTURE_OPEN != p_ctrl->open, FSP_ERR_ALREADY_OPEN);
+
+    /* The JPEG driver has no callbackSet, so the encode callback must be routed to this module in its configuration */
+    FSP_ASSERT(rm_jpeg_capture_jpeg_callback == p_cfg->p_jpeg->p_cfg->p_encode_callback);
+    FSP_ASSERT(p_ctrl == p_cfg->p_jpeg->p_cfg->p_encode_context);
+
+    FSP_ERROR_RETURN(0U == ((uint32_t) p_cfg->p_strip_buffer & 0x07U), FSP_ERR_INVALID_ALIGNMENT);
+#endif
+
+    capture_cfg_t const      * p_capture_cfg = p_cfg->p_capture->p_cfg;
+    ceu_extended_cfg_t const * p_extend      = (ceu_extended_cfg_t const *) p_capture_cfg->p_extend;
+
+    /* Each strip must be a whole number of JPEG line blocks */
+    FSP_ERROR_RETURN((0U != p_extend->bundle_lines) && (0U == (p_extend->bundle_lines % RM_JPEG_CAPTURE_LINE_ALIGNMENT)),
+                     FSP_ERR_INVALID_ARGUMENT);
+
+    p_ctrl->p_cfg            = p_cfg;
+    p_ctrl->strip_size       = (uint32_t) p_capture_cfg->x_capture_pixels * p_capture_cfg->bytes_per_pixel *
+                               p_extend->bundle_lines;
+    p_ctrl->strips_per_frame = (uint16_t) (p_capture_cfg->y_capture_pixels / p_extend->bundle_lines);
+    p_ctrl->strips_captured  = 0U;
+    p_ctrl->strips_submitted = 0U;
+    p_ctrl->encoding         = false;
+    p_ctrl->streaming        = false;
+    p_ctrl->frame_active     = false;
+    p_ctrl->stale_frame_end  = false;
+    p_ctrl->frame_index      = 0U;
+    p_ctrl->frame_events     = 0U;
+    p_ctrl->frame_count      = 0U;
+    p_ctrl->bytes_reported   = 0U;
+
+    err = p_cfg->p_capture->p_api->open(p_cfg->p_capture->p_ctrl, p_capture_cfg);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    err = p_cfg->p_capture->p_api->callbackSet(p_cfg->p_capture->p_ctrl, rm_jpeg_capture_ceu_callback, p_ctrl, NULL);
+    if (FSP_SUCCESS == err)
+    {
+        err = p_cfg->p_jpeg->p_api->open(p_cfg->p_jpeg->p_ctrl, p_cfg->p_jpeg->p_cfg);
+    }
+
+    if (FSP_SUCCESS != err)
+    {
+        p_cfg->p_capture->p_api->close(p_cfg->p_capture->p_ctrl);
+
+        return err;
+    }
+
+    p_ctrl->open = RM_JPEG_CAPTURE_OPEN;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Starts streaming. Frames are captured and encoded back to back into the frame buffer ring until
+ * RM_JPEG_CAPTURE_Stop is called. Encoded data is reported through the callback as each strip is encoded
+ * (RM_JPEG_CAPTURE_EVENT_CHUNK_READY) and once per frame (RM_JPEG_CAPTURE_EVENT_FRAME_END).
+ *
+ * @note The application must finish with a frame buffer before the ring wraps back around to it.
+ *
+ * @retval FSP_SUCCESS                 Streaming started.
+ * @retval FSP_ERR_ASSERTION           p_ctrl is NULL.
+ * @retval FSP_ERR_NOT_OPEN            Module is not open.
+ * @retval FSP_ERR_IN_USE              A frame is already in progress.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ **********************************************************************************************************************/
+fsp_err_t RM_JPEG_CAPTURE_Start (rm_jpeg_capture_instance_ctrl_t * const p_ctrl)
+{
+#if RM_JPEG_CAPTURE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_JPEG_CAPTURE_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(!p_ctrl->frame_active, FSP_ERR_IN_USE);
+
+    p_ctrl->frame_count = 0U;
+    p_ctrl->streaming   = true;
+
+    fsp_err_t err = rm_jpeg_capture_frame_start(p_ctrl);
+    if (FSP_SUCCESS != err)
+    {
+        p_ctrl->streaming = false;
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Stops streaming after the frame in progress (if any) has been encoded.
+ *
+ * @retval FSP_SUCCESS                 Streaming will stop at the end of the current frame.
+ * @retval FSP_ERR_ASSERTION           p_ctrl is NULL.
+ * @retval FSP_ERR_NOT_OPEN            Module is not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_JPEG_CAPTURE_Stop (rm_jpeg_capture_instance_ctrl_t * const p_ctrl)
+{
+#if RM_JPEG_CAPTURE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_JPEG_CAPTURE_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    p_ctrl->streaming = false;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Stops the pipeline immediately and closes the CEU and JPEG instances. A frame in progress is discarded.
+ *
+ * @retval FSP_SUCCESS                 Pipeline closed.
+ * @retval FSP_ERR_ASSERTION           p_ctrl is NULL.
+ * @retval FSP_ERR_NOT_OPEN            Module is not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_JPEG_CAPTURE_Close (rm_jpeg_capture_instance_ctrl_t * const p_ctrl)
+{
+#if RM_JPEG_CAPTURE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_JPEG_CAPTURE_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    p_ctrl->streaming    = false;
+    p_ctrl->frame_active = false;
+
+    /* Stop the camera first so no further strips are handed to the encoder */
+    p_ctrl->p_cfg->p_capture->p_api->close(p_ctrl->p_cfg->p_capture->p_ctrl);
+    p_ctrl->p_cfg->p_jpeg->p_api->close(p_ctrl->p_cfg->p_jpeg->p_ctrl);
+
+    p_ctrl->open = 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_JPEG_CAPTURE)
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * JPEG encode callback. Set this as the encode callback of the JPEG instance, with the pipeline control block as the
+ * encode context.
+ *
+ * @param[in]  p_args    JPEG callback arguments.
+ **********************************************************************************************************************/
+void rm_jpeg_capture_jpeg_callback (jpeg_callback_args_t * p_args)
+{
+    rm_jpeg_capture_instance_ctrl_t * p_ctrl = (rm_jpeg_capture_instance_ctrl_t *) p_args->p_context;
+
+    if (!p_ctrl->frame_active)
+    {
+        return;
+    }
+
+    uint8_t const * p_frame = p_ctrl->p_cfg->pp_frame_buffers[p_ctrl->frame_index];
+
+    /* Report the data the encoder has produced since the last strip so it can be forwarded while encoding continues */
+    if (p_args->image_size > p_ctrl->bytes_reported)
+    {
+        uint32_t offset = p_ctrl->bytes_reported;
+        p_ctrl->bytes_reported = p_args->image_size;
+
+        rm_jpeg_capture_notify(p_ctrl, RM_JPEG_CAPTURE_EVENT_CHUNK_READY, p_frame + offset,
+                               p_args->image_size - offset);
+    }
+
+    if ((uint32_t) JPEG_STATUS_OPERATION_COMPLETE & (uint32_t) p_args->status)
+    {
+        p_ctrl->frame_active = false;
+        p_ctrl->encoding     = false;
+
+        rm_jpeg_capture_notify(p_ctrl, RM_JPEG_CAPTURE_EVENT_FRAME_END | p_ctrl->frame_events, p_frame,
+                               p_args->image_size);
+
+        p_ctrl->frame_index = (uint8_t) ((p_ctrl->frame_index + 1U) % p_ctrl->p_cfg->frame_buffer_count);
+
+        if (p_ctrl->streaming && (FSP_SUCCESS != rm_jpeg_capture_frame_start(p_ctrl)))
+        {
+            p_ctrl->streaming = false;
+            rm_jpeg_capture_notify(p_ctrl, RM_JPEG_CAPTURE_EVENT_CAPTURE_ERROR, NULL, 0U);
+        }
+    }
+    else if ((uint32_t) JPEG_STATUS_INPUT_PAUSE & (uint32_t) p_args->status)
+    {
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+
+        /* The encoder has consumed the previous strip; hand it the next one if the CEU has already written it */
+        p_ctrl->encoding = false;
+        rm_jpeg_capture_strip_submit(p_ctrl);
+
+        FSP_CRITICAL_SECTION_EXIT;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+
+/*******************************************************************************************************************//**
+ * CEU callback. Registered automatically by RM_JPEG_CAPTURE_Open.
+ *
+ * @param[in]  p_args    CEU callback arguments.
+ **********************************************************************************************************************/
+void rm_jpeg_capture_ceu_callback (capture_callback_args_t * p_args)
+{
+    rm_jpeg_capture_instance_ctrl_t * p_ctrl = (rm_jpeg_capture_instance_ctrl_t *) p_args->p_context;
+    uint32_t event = p_args->event;
+
+    if (!p_ctrl->frame_active)
+    {
+        return;
+    }
+
+    if (event & RM_JPEG_CAPTURE_CEU_ERROR_EVENTS)
+    {
+        p_ctrl->frame_events |= RM_JPEG_CAPTURE_EVENT_CAPTURE_ERROR;
+    }
+
+    if (event & RM_JPEG_CAPTURE_CEU_BUNDLE_EVENTS)
+    {
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+
+        /* A strip of the restarted frame has arrived, so any later FRAME_END belongs to this frame */
+        p_ctrl->stale_frame_end = false;
+
+        uint16_t strips = (uint16_t) (((event & CEU_EVENT_BUNDLE_A_END) ? 1U : 0U) +
+                                      ((event & CEU_EVENT_BUNDLE_B_END) ? 1U : 0U));
+        p_ctrl->strips_captured = (uint16_t) (p_ctrl->strips_captured + strips);
+
+        /* Once a strip is complete the CEU starts overwriting the other half of the strip buffer. That half must
+         * already have been fully consumed by the encoder, unless this was the last strip of the frame. */
+        uint16_t strips_consumed = (uint16_t) (p_ctrl->strips_submitted - (p_ctrl->encoding ? 1U : 0U));
+        if ((p_ctrl->strips_captured < p_ctrl->strips_per_frame) &&
+            ((strips_consumed + RM_JPEG_CAPTURE_STRIP_COUNT - 1U) < p_ctrl->strips_captured))
+        {
+            p_ctrl->frame_events |= RM_JPEG_CAPTURE_EVENT_STRIP_OVERRUN;
+        }
+
+        rm_jpeg_capture_strip_submit(p_ctrl);
+
+        FSP_CRITICAL_SECTION_EXIT;
+    }
+
+    if ((event & CEU_EVENT_FRAME_END) && p_ctrl->stale_frame_end && (0U == p_ctrl->strips_captured))
+    {
+        /* A FRAME_END from the aborted frame arrived after the restart. It must not end the new frame. Only one can
+         * be outstanding, so a second FRAME_END before the first strip is handled normally. */
+        p_ctrl->stale_frame_end = false;
+    }
+    else if (event & CEU_EVENT_FRAME_END)
+    {
+        /* If the CEU ended the frame early the encoder is still waiting for lines that will never arrive */
+        if ((p_ctrl->strips_captured < p_ctrl->strips_per_frame) ||
+            (p_ctrl->frame_events & RM_JPEG_CAPTURE_EVENT_ENCODE_ERROR))
+        {
+            rm_jpeg_capture_frame_abort(p_ctrl, RM_JPEG_CAPTURE_EVENT_CAPTURE_ERROR);
+        }
+    }
+}
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Points the encoder at the next frame buffer and arms the CEU for the next frame.
+ *
+ * @param[in]  p_ctrl    Pointer to instance control block.
+ **********************************************************************************************************************/
+static fsp_err_t rm_jpeg_capture_frame_start (rm_jpeg_capture_instance_ctrl_t * const p_ctrl)
+{
+    rm_jpeg_capture_cfg_t const * p_cfg = p_ctrl->p_cfg;
+
+    p_ctrl->strips_captured  = 0U;
+    p_ctrl->strips_submitted = 0U;
+    p_ctrl->encoding         = false;
+    p_ctrl->stale_frame_end  = false;
+    p_ctrl->frame_events     = 0U;
+    p_ctrl->bytes_reported   = 0U;
+
+    fsp_err_t err = p_cfg->p_jpeg->p_api->outputBufferSet(p_cfg->p_jpeg->p_ctrl,
+                                                          p_cfg->pp_frame_buffers[p_ctrl->frame_index],
+                                                          p_cfg->frame_buffer_size);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    p_ctrl->frame_active = true;
+    p_ctrl->frame_count++;
+
+    err = p_cfg->p_capture->p_api->captureStart(p_cfg->p_capture->p_ctrl, p_cfg->p_strip_buffer);
+    if (FSP_SUCCESS != err)
+    {
+        p_ctrl->frame_active = false;
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Discards the frame in progress. The JPEG codec cannot be stopped part way through an image, so it is reopened.
+ *
+ * @param[in]  p_ctrl    Pointer to instance control block.
+ * @param[in]  event     Event to report for the discarded frame.
+ **********************************************************************************************************************/
+static void rm_jpeg_capture_frame_abort (rm_jpeg_capture_instance_ctrl_t * const p_ctrl, uint32_t event)
+{
+    jpeg_instance_t const * p_jpeg = p_ctrl->p_cfg->p_jpeg;
+
+    p_ctrl->frame_active = false;
+
+    p_jpeg->p_api->close(p_jpeg->p_ctrl);
+    if (FSP_SUCCESS != p_jpeg->p_api->open(p_jpeg->p_ctrl, p_jpeg->p_cfg))
+    {
+        p_ctrl->streaming = false;
+        event            |= RM_JPEG_CAPTURE_EVENT_ENCODE_ERROR;
+    }
+
+    rm_jpeg_capture_notify(p_ctrl, event | p_ctrl->frame_events, NULL, 0U);
+
+    if (p_ctrl->streaming && (FSP_SUCCESS != rm_jpeg_capture_frame_start(p_ctrl)))
+    {
+        p_ctrl->streaming = false;
+    }
+
+    /* The CEU can still report the end of the aborted frame after capture has been restarted. Set after
+     * rm_jpeg_capture_frame_start, which clears it for normal frame starts. */
+    p_ctrl->stale_frame_end = p_ctrl->frame_active;
+}
+
+/*******************************************************************************************************************//**
+ * Hands the next captured strip to the encoder if the encoder is free. Must be called with interrupts disabled.
+ *
+ * @param[in]  p_ctrl    Pointer to instance control block.
+ **********************************************************************************************************************/
+static void rm_jpeg_capture_strip_submit (rm_jpeg_capture_instance_ctrl_t * const p_ctrl)
+{
+    if (p_ctrl->encoding || (p_ctrl->strips_submitted >= p_ctrl->strips_captured))
+    {
+        return;
+    }
+
+    uint8_t * p_strip = p_ctrl->p_cfg->p_strip_buffer +
+                        ((p_ctrl->strips_submitted % RM_JPEG_CAPTURE_STRIP_COUNT) * p_ctrl->strip_size);
+
+    p_ctrl->encoding = true;
+    p_ctrl->strips_submitted++;
+
+    fsp_err_t err = p_ctrl->p_cfg->p_jpeg->p_api->inputBufferSet(p_ctrl->p_cfg->p_jpeg->p_ctrl,
+                                                                 p_strip,
+                                                                 p_ctrl->strip_size);
+    if (FSP_SUCCESS != err)
+    {
+        /* The frame is discarded when the CEU reports the end of the frame */
+        p_ctrl->encoding      = false;
+        p_ctrl->frame_events |= RM_JPEG_CAPTURE_EVENT_ENCODE_ERROR;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Calls the user callback.
+ *
+ * @param[in]  p_ctrl    Pointer to instance control block.
+ * @param[in]  event     Event mask to report.
+ * @param[in]  p_data    Encoded data associated with the event.
+ * @param[in]  length    Length of p_data in bytes.
+ **********************************************************************************************************************/
+static void rm_jpeg_capture_notify (rm_jpeg_capture_instance_ctrl_t * const p_ctrl,
+                                    uint32_t                                event,
+                                    uint8_t const * const                   p_data,
+                                    uint32_t                                length)
+{
+    rm_jpeg_capture_callback_args_t args;
+
+    args.event       = event;
+    args.p_data      = p_data;
+    args.length      = length;
+    args.frame_count = p_ctrl->frame_count;
+    args.p_context   = p_ctrl->p_cfg->p_context;
+
+    p_ctrl->p_cfg->p_callback(&args);
+}
@@ -28,10 +28,13 @@
  **********************************************************************************************************************/
 
 /* "LXNO" in ASCII, used to identify LevelX NOR SPI handle */
-#define RM_LEVELX_NOR_SPI_OPEN              (0x4C584E4FU)
+#define RM_LEVELX_NOR_SPI_OPEN                  (0x4C584E4FU)
 
-#define RM_LEVELX_NOR_SPI_BYTES_PER_WORD    (4U)
-#define RM_LEVELX_NOR_SPI_FLASH_CLEARED     (0xFF)
+#define RM_LEVELX_NOR_SPI_BYTES_PER_WORD        (4U)
+#define RM_LEVELX_NOR_SPI_FLASH_CLEARED         (0xFF)
+#define RM_LEVELX_NOR_SPI_FLASH_CLEARED_WORD    (0xFFFFFFFFU)
+#define RM_LEVELX_NOR_SPI_VERIFY_UNROLL         (8U)
+#define RM_LEVELX_NOR_SPI_BLOCKS_PER_MAP_WORD   (32U)
 
 /***********************************************************************************************************************
  * Typedef definitions
@@ -46,6 +49,10 @@
  **********************************************************************************************************************/
 
 static fsp_err_t rm_levelx_nor_spi_wait_write_erase_complete(rm_levelx_nor_spi_instance_ctrl_t * const p_ctrl);
+static bool      rm_levelx_nor_spi_erased_check(uint32_t address, uint32_t size);
+static void      rm_levelx_nor_spi_erased_map_clear(rm_levelx_nor_spi_instance_ctrl_t * const p_ctrl,
+                                                    uint32_t                                  address,
+                                                    uint32_t                                  size);
 
 /***********************************************************************************************************************
  * Global Variables
@@ -118,6 +125,14 @@ fsp_err_t RM_LEVELX_NOR_SPI_Open (rm_levelx_nor_spi_instance_ctrl_t * const p_ct
     p_cfg->p_lx_nor_flash->lx_nor_flash_words_per_block = p_ctrl->minimum_erase_size /
                                                           RM_LEVELX_NOR_SPI_BYTES_PER_WORD;
 
+    /** No block is known to be erased yet. */
+    if (NULL != p_cfg->p_erased_block_map)
+    {
+        memset(p_cfg->p_erased_block_map,
+               0,
+               RM_LEVELX_NOR_SPI_ERASED_BLOCK_MAP_WORDS(p_cfg->size, p_ctrl->minimum_erase_size) * sizeof(uint32_t));
+    }
+
     /** Mark control block open so subsequent calls know the device is open. */
     p_ctrl->open = RM_LEVELX_NOR_SPI_OPEN;
 
@@ -221,6 +236,9 @@ fsp_err_t RM_LEVELX_NOR_SPI_Write (rm_levelx_nor_spi_instance_ctrl_t * const p_c
         read_from_spi = true;
     }
 
+    /* The written blocks are no longer known to be erased. */
+    rm_levelx_nor_spi_erased_map_clear(p_ctrl, (uint32_t) p_flash_addr, byte_count);
+
     for (uint32_t offset = 0U; offset < byte_count; offset += current_write_size)
     {
         /* Calculate current write size */
@@ -300,6 +318,9 @@ fsp_err_t RM_LEVELX_NOR_SPI_BlockErase (rm_levelx_nor_spi_instance_ctrl_t * cons
     /* Calculate the block address */
     block_address = p_ctrl->start_address + ((uint32_t) block * p_ctrl->minimum_erase_size);
 
+    /* The block is known to be erased again only after it passes erased verification. */
+    rm_levelx_nor_spi_erased_map_clear(p_ctrl, block_address, p_ctrl->minimum_erase_size);
+
     /* Erase using underlying API */
     err = p_spi_flash_instance->p_api->erase(p_spi_flash_instance->p_ctrl,
                                              (uint8_t *) block_address,
@@ -315,7 +336,9 @@ fsp_err_t RM_LEVELX_NOR_SPI_BlockErase (rm_levelx_nor_spi_instance_ctrl_t * cons
 /*******************************************************************************************************************//**
  * @brief  LevelX NOR driver "block erased verify" service.
  *
- * This is responsible for verifying the specified block of the NOR flash is erased.
+ * This is responsible for verifying the specified block of the NOR flash is erased. The block is read a word at a
+ * time. If rm_levelx_nor_spi_cfg_t::p_erased_block_map is set, blocks that passed verification and were not written or
+ * erased since then are reported as erased without reading the flash.
  *
  * @param[in]      p_ctrl               Control block for the LevelX NOR SPI instance.
  * @param[in]      block                Specifies which block to verify that it is erased.
@@ -329,22 +352,30 @@ fsp_err_t RM_LEVELX_NOR_SPI_BlockErase (rm_levelx_nor_spi_instance_ctrl_t * cons
  **********************************************************************************************************************/
 fsp_err_t RM_LEVELX_NOR_SPI_BlockErasedVerify (rm_levelx_nor_spi_instance_ctrl_t * const p_ctrl, ULONG block)
 {
-    uint8_t * read_address;
+    uint32_t * p_map;
 
 #if RM_LEVELX_NOR_SPI_CFG_PARAM_CHECKING_ENABLE
     FSP_ASSERT(p_ctrl);
     FSP_ERROR_RETURN(RM_LEVELX_NOR_SPI_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
 
-    read_address = (uint8_t *) (p_ctrl->start_address + (block * p_ctrl->minimum_erase_size));
+    p_map = p_ctrl->p_cfg->p_erased_block_map;
+
+    uint32_t map_bit  = 1U << (block % RM_LEVELX_NOR_SPI_BLOCKS_PER_MAP_WORD);
+    uint32_t map_word = block / RM_LEVELX_NOR_SPI_BLOCKS_PER_MAP_WORD;
 
-    /* Loop to check if the block is erased.  */
-    for (uint32_t offset = 0U; offset < p_ctrl->minimum_erase_size; offset++)
+    if ((NULL != p_map) && (p_map[map_word] & map_bit))
     {
-        if (RM_LEVELX_NOR_SPI_FLASH_CLEARED != read_address[offset])
-        {
-            return FSP_ERR_NOT_ERASED;
-        }
+        return FSP_SUCCESS;
+    }
+
+    FSP_ERROR_RETURN(rm_levelx_nor_spi_erased_check(p_ctrl->start_address + (block * p_ctrl->minimum_erase_size),
+                                                    p_ctrl->minimum_erase_size),
+                     FSP_ERR_NOT_ERASED);
+
+    if (NULL != p_map)
+    {
+        p_map[map_word] |= map_bit;
     }
 
     return FSP_SUCCESS;
@@ -437,3 +468,84 @@ static fsp_err_t rm_levelx_nor_spi_wait_write_erase_complete (rm_levelx_nor_spi_
 
     return FSP_SUCCESS;
 }
+
+/*******************************************************************************************************************//**
+ * @brief      Check that a region of the memory mapped flash is erased. Eight words are combined per iteration, so the
+ *             loop is limited by the read bandwidth of the memory mapped interface rather than compare and branch.
+ * @param      address                  Start address of the region
+ * @param      size                     Size of the region in bytes
+ * @retval     true                     All bytes in the region are erased.
+ * @retval     false                    At least one byte in the region is not erased.
+ **********************************************************************************************************************/
+static bool rm_levelx_nor_spi_erased_check (uint32_t address, uint32_t size)
+{
+    uint32_t offset = 0U;
+
+    if (0U == (address % RM_LEVELX_NOR_SPI_BYTES_PER_WORD))
+    {
+        uint32_t const * p_word = (uint32_t const *) address;
+        uint32_t words = size / RM_LEVELX_NOR_SPI_BYTES_PER_WORD;
+        uint32_t i     = 0U;
+
+        for ( ; (i + RM_LEVELX_NOR_SPI_VERIFY_UNROLL) <= words; i += RM_LEVELX_NOR_SPI_VERIFY_UNROLL)
+        {
+            uint32_t cleared = p_word[i] & p_word[i + 1U] & p_word[i + 2U] & p_word[i + 3U] &
+                               p_word[i + 4U] & p_word[i + 5U] & p_word[i + 6U] & p_word[i + 7U];
+
+            if (RM_LEVELX_NOR_SPI_FLASH_CLEARED_WORD != cleared)
+            {
+                return false;
+            }
+        }
+
+        for ( ; i < words; i++)
+        {
+            if (RM_LEVELX_NOR_SPI_FLASH_CLEARED_WORD != p_word[i])
+            {
+                return false;
+            }
+        }
+
+        offset = words * RM_LEVELX_NOR_SPI_BYTES_PER_WORD;
+    }
+
+    /* Unaligned regions and trailing bytes are checked a byte at a time. */
+    uint8_t const * p_byte = (uint8_t const *) address;
+    for ( ; offset < size; offset++)
+    {
+        if (RM_LEVELX_NOR_SPI_FLASH_CLEARED != p_byte[offset])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*******************************************************************************************************************//**
+ * @brief      Clear the erased block map bits of all blocks overlapping a region.
+ * @param      p_ctrl                   The instance control block
+ * @param      address                  Start address of the region
+ * @param      size                     Size of the region in bytes
+ **********************************************************************************************************************/
+static void rm_levelx_nor_spi_erased_map_clear (rm_levelx_nor_spi_instance_ctrl_t * const p_ctrl,
+                                                uint32_t                                  address,
+                                                uint32_t                                  size)
+{
+    uint32_t * p_map = p_ctrl->p_cfg->p_erased_block_map;
+
+    if ((NULL == p_map) || (0U == size) || (address < p_ctrl->start_address))
+    {
+        return;
+    }
+
+    uint32_t total_blocks = p_ctrl->p_cfg->size / p_ctrl->minimum_erase_size;
+    uint32_t first_block  = (address - p_ctrl->start_address) / p_ctrl->minimum_erase_size;
+    uint32_t last_block   = (address - p_ctrl->start_address + size - 1U) / p_ctrl->minimum_erase_size;
+
+    for (uint32_t block = first_block; (block <= last_block) && (block < total_blocks); block++)
+    {
+        p_map[block / RM_LEVELX_NOR_SPI_BLOCKS_PER_MAP_WORD] &=
+            ~(1U << (block % RM_LEVELX_NOR_SPI_BLOCKS_PER_MAP_WORD));
+    }
+}
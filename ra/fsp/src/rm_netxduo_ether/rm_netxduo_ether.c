@@ -55,6 +55,11 @@
  #define NX_ETHERNET_POLLING_TIMEOUT      (100U)
 #endif
 
+/* Maximum number of NX_PACKETs in a chained transmit packet. Each one uses a transmit descriptor. */
+#ifndef RM_NETXDUO_ETHER_TX_FRAGMENTS_MAX
+ #define RM_NETXDUO_ETHER_TX_FRAGMENTS_MAX    (8U)
+#endif
+
 /* Transmit Complete. */
 #define ETHER_ISR_EE_TC_MASK              (1U << 21U)
 
@@ -66,6 +71,10 @@
  **********************************************************************************************************************/
 
 static void rm_netxduo_ether_cleanup(rm_netxduo_ether_instance_t * p_netxduo_ether_instance);
+static bool rm_netxduo_ether_tx_pad(NX_PACKET * p_packet, ULONG pad);
+static UINT rm_netxduo_ether_tx_fragments_get(NX_PACKET           * p_packet,
+                                              ether_tx_fragment_t * p_fragments,
+                                              UCHAR              ** pp_last_buffer);
 void        rm_netxduo_ether_receive_packet(rm_netxduo_ether_instance_t * p_netxduo_ether_instance);
 void        rm_event_timer_callback(ULONG data);
 
@@ -239,6 +248,36 @@ void rm_netxduo_ether (NX_IP_DRIVER * driver_req_ptr, rm_netxduo_ether_instance_
             NX_CHANGE_ULONG_ENDIAN(*(ethernet_frame_ptr + 2));
             NX_CHANGE_ULONG_ENDIAN(*(ethernet_frame_ptr + 3));
 
+            /* A chained packet is sent without copying, one transmit descriptor per NX_PACKET in the chain. */
+            UINT num_fragments = rm_netxduo_ether_tx_fragments_get(packet_ptr, NULL, NULL);
+            if ((num_fragments > 1U) && (packet_length < NX_ETHERNET_MIN_TRANSMIT_SIZE))
+            {
+                /* Zero-pad a short chained packet at the end of its last buffer so the descriptor count does not
+                 * change. */
+                if (rm_netxduo_ether_tx_pad(packet_ptr, NX_ETHERNET_MIN_TRANSMIT_SIZE - packet_length))
+                {
+                    packet_length = NX_ETHERNET_MIN_TRANSMIT_SIZE;
+                }
+            }
+
+            if ((num_fragments > RM_NETXDUO_ETHER_TX_FRAGMENTS_MAX) ||
+                (num_fragments > p_ether_instance->p_cfg->num_tx_descriptors) ||
+                ((num_fragments > 1U) && (packet_length < NX_ETHERNET_MIN_TRANSMIT_SIZE)))
+            {
+                /* Set driver status to indicate that the packet was not transmitted. */
+                driver_req_ptr->nx_ip_driver_status = NX_INVALID_PACKET;
+
+                FSP_LOG_PRINT("Chained packet cannot be transmitted.");
+
+                /* Release the NetX packet because it cannot be sent. */
+                if (NX_SUCCESS != nx_packet_transmit_release(packet_ptr))
+                {
+                    FSP_LOG_PRINT("Failed to release transmit packet.");
+                }
+
+                return;
+            }
+
             /* Zero-pad if the packet is smaller than the minimum packet size. */
             if (packet_length < NX_ETHERNET_MIN_TRANSMIT_SIZE)
             {
@@ -246,9 +285,26 @@ void rm_netxduo_ether (NX_IP_DRIVER * driver_req_ptr, rm_netxduo_ether_instance_
                 packet_length = NX_ETHERNET_MIN_TRANSMIT_SIZE;
             }
 
-            if (TX_SUCCESS !=
-                tx_semaphore_get(&p_netxduo_ether_instance->p_ctrl->ether_tx_semaphore, NX_IP_PERIODIC_RATE))
+            /* Reserve a transmit descriptor for each NX_PACKET. */
+            UINT reserved;
+            for (reserved = 0U; reserved < num_fragments; reserved++)
             {
+                if (TX_SUCCESS !=
+                    tx_semaphore_get(&p_netxduo_ether_instance->p_ctrl->ether_tx_semaphore, NX_IP_PERIODIC_RATE))
+                {
+                    break;
+                }
+            }
+
+            if (reserved < num_fragments)
+            {
+                /* Return the descriptors that were reserved. */
+                while (reserved-- > 0U)
+                {
+                    tx_semaphore_ceiling_put(&p_netxduo_ether_instance->p_ctrl->ether_tx_semaphore,
+                                             p_ether_instance->p_cfg->num_tx_descriptors);
+                }
+
                 /* Set driver status to indicate that the packet was not transmitted. */
                 driver_req_ptr->nx_ip_driver_status = NX_TX_QUEUE_DEPTH;
 
@@ -262,10 +318,28 @@ void rm_netxduo_ether (NX_IP_DRIVER * driver_req_ptr, rm_netxduo_ether_instance_
             p_netxduo_ether_instance->p_cfg->p_tx_packets[index] = packet_ptr;
 
             /* Transmit the Ethernet packet. */
-            fsp_err_t err = p_ether_instance->p_api->write(p_ether_instance->p_ctrl, p_packet_prepend, packet_length);
+            fsp_err_t err;
+            if (1U == num_fragments)
+            {
+                err = p_ether_instance->p_api->write(p_ether_instance->p_ctrl, p_packet_prepend, packet_length);
+            }
+            else
+            {
+                ether_tx_fragment_t fragments[RM_NETXDUO_ETHER_TX_FRAGMENTS_MAX];
+                (void) rm_netxduo_ether_tx_fragments_get(packet_ptr, fragments, NULL);
+                err = p_ether_instance->p_api->writeFragments(p_ether_instance->p_ctrl, fragments, num_fragments);
+            }
 
             if (FSP_SUCCESS != err)
             {
+                /* The descriptors were not used, so free the slot and return the reserved descriptors. */
+                p_netxduo_ether_instance->p_cfg->p_tx_packets[index] = NULL;
+                for (UINT i = 0U; i < num_fragments; i++)
+                {
+                    tx_semaphore_ceiling_put(&p_netxduo_ether_instance->p_ctrl->ether_tx_semaphore,
+                                             p_ether_instance->p_cfg->num_tx_descriptors);
+                }
+
                 /* Set driver status to indicate that the packet was not transmitted. */
                 driver_req_ptr->nx_ip_driver_status = NX_TX_QUEUE_DEPTH;
 
@@ -274,8 +348,8 @@ void rm_netxduo_ether (NX_IP_DRIVER * driver_req_ptr, rm_netxduo_ether_instance_
                 return;
             }
 
-            /* Increment the index used to store the NetX packet. */
-            p_netxduo_ether_instance->p_ctrl->tx_packet_index = (index + 1U) %
+            /* Advance the index used to store the NetX packet past the descriptors used by this packet. */
+            p_netxduo_ether_instance->p_ctrl->tx_packet_index = (index + num_fragments) %
                                                                 p_ether_instance->p_cfg->num_tx_descriptors;
 
             break;
@@ -384,6 +458,83 @@ void rm_netxduo_ether (NX_IP_DRIVER * driver_req_ptr, rm_netxduo_ether_instance_
     }
 }
 
+/*******************************************************************************************************************//**
+ * Get the transmit buffers of a packet. The first buffer starts with the Ethernet header in front of the prepend
+ * pointer. Each following NX_PACKET in the chain that holds data adds one buffer.
+ *
+ * @param[in]  p_packet          Packet to transmit.
+ * @param[out] p_fragments       Optional array that receives the buffers (RM_NETXDUO_ETHER_TX_FRAGMENTS_MAX entries).
+ * @param[out] pp_last_buffer    Optional pointer that receives the start of the last buffer.
+ *
+ * @return Number of buffers (transmit descriptors) used by the packet.
+ **********************************************************************************************************************/
+static UINT rm_netxduo_ether_tx_fragments_get (NX_PACKET           * p_packet,
+                                               ether_tx_fragment_t * p_fragments,
+                                               UCHAR              ** pp_last_buffer)
+{
+    UCHAR * p_buffer      = p_packet->nx_packet_prepend_ptr - NX_ETHERNET_SIZE;
+    UINT    num_fragments = 0U;
+
+    for (NX_PACKET * p_current = p_packet; NULL != p_current; p_current = p_current->nx_packet_next)
+    {
+        UCHAR * p_start = (p_current == p_packet) ? p_buffer : p_current->nx_packet_prepend_ptr;
+        ULONG   length  = (ULONG) (p_current->nx_packet_append_ptr - p_start);
+
+        if (0U == length)
+        {
+            continue;
+        }
+
+        if ((NULL != p_fragments) && (num_fragments < RM_NETXDUO_ETHER_TX_FRAGMENTS_MAX))
+        {
+            p_fragments[num_fragments].p_buffer = p_start;
+            p_fragments[num_fragments].length   = length;
+        }
+
+        p_buffer = p_start;
+        num_fragments++;
+    }
+
+    if (NULL != pp_last_buffer)
+    {
+        *pp_last_buffer = p_buffer;
+    }
+
+    return num_fragments;
+}
+
+/*******************************************************************************************************************//**
+ * Append zeros to the last NX_PACKET of a chain that holds data.
+ *
+ * @param[in]  p_packet          Packet to pad.
+ * @param[in]  pad               Number of zero bytes to append.
+ *
+ * @retval true                  The packet was padded.
+ * @retval false                 The last buffer does not have room for the padding.
+ **********************************************************************************************************************/
+static bool rm_netxduo_ether_tx_pad (NX_PACKET * p_packet, ULONG pad)
+{
+    NX_PACKET * p_last = p_packet;
+
+    for (NX_PACKET * p_current = p_packet->nx_packet_next; NULL != p_current; p_current = p_current->nx_packet_next)
+    {
+        if (p_current->nx_packet_append_ptr != p_current->nx_packet_prepend_ptr)
+        {
+            p_last = p_current;
+        }
+    }
+
+    if ((ULONG) (p_last->nx_packet_data_end - p_last->nx_packet_append_ptr) < pad)
+    {
+        return false;
+    }
+
+    memset(p_last->nx_packet_append_ptr, 0, pad);
+    p_last->nx_packet_append_ptr += pad;
+
+    return true;
+}
+
 /*******************************************************************************************************************//**
  * Delete all unused rtos objects.
  **********************************************************************************************************************/
@@ -714,13 +865,15 @@ void rm_netxduo_ether_callback (ether_callback_args_t * p_args)
                     /* Get the pointer to the next NX_PACKET to release. */
                     NX_PACKET * p_nx_packet_current =
                         p_netxduo_ether_instance->p_cfg->p_tx_packets[tx_packet_transmitted_index];
+                    UINT descriptors = 1U;
 
                     if (NULL != p_nx_packet_current)
                     {
-                        /* Calculate the pointer to the start of the Ethernet packet that was transmitted. */
-                        p_buffer_current = p_nx_packet_current->nx_packet_prepend_ptr - NX_ETHERNET_SIZE;
+                        /* Get the number of descriptors used by the packet and the pointer to the last buffer that
+                         * was transmitted for it. */
+                        descriptors = rm_netxduo_ether_tx_fragments_get(p_nx_packet_current, NULL, &p_buffer_current);
 
-                        /* Release the NX_PACKET. */
+                        /* Release the NX_PACKET and the rest of its chain. */
                         if (TX_SUCCESS != nx_packet_transmit_release(p_nx_packet_current))
                         {
                             FSP_LOG_PRINT("Failed to release NetX transmit Packet.");
@@ -730,11 +883,14 @@ void rm_netxduo_ether_callback (ether_callback_args_t * p_args)
                         p_netxduo_ether_instance->p_cfg->p_tx_packets[tx_packet_transmitted_index] = NULL;
 
                         /* Synchronize the IP task with the transmit complete ISR. */
-                        if (TX_SUCCESS !=
-                            tx_semaphore_ceiling_put(&p_netxduo_ether_instance->p_ctrl->ether_tx_semaphore,
-                                                     p_ether_instance->p_cfg->num_tx_descriptors))
+                        for (UINT i = 0U; i < descriptors; i++)
                         {
-                            FSP_LOG_PRINT("Failed to increment tx semaphore.");
+                            if (TX_SUCCESS !=
+                                tx_semaphore_ceiling_put(&p_netxduo_ether_instance->p_ctrl->ether_tx_semaphore,
+                                                         p_ether_instance->p_cfg->num_tx_descriptors))
+                            {
+                                FSP_LOG_PRINT("Failed to increment tx semaphore.");
+                            }
                         }
                     }
                     else
@@ -743,11 +899,8 @@ void rm_netxduo_ether_callback (ether_callback_args_t * p_args)
                     }
 
                     /* Calculate the index of the next NX_PACKET. */
-                    tx_packet_transmitted_index = tx_packet_transmitted_index + 1;
-                    if (tx_packet_transmitted_index == p_ether_instance->p_cfg->num_tx_descriptors)
-                    {
-                        tx_packet_transmitted_index = 0;
-                    }
+                    tx_packet_transmitted_index = (tx_packet_transmitted_index + descriptors) %
+                                                  p_ether_instance->p_cfg->num_tx_descriptors;
                 } while (p_buffer_current != p_buffer_last);
 
                 p_netxduo_ether_instance->p_ctrl->tx_packet_transmitted_index = tx_packet_transmitted_index;
@@ -24,6 +24,194 @@
 
 #if (defined(MBEDTLS_ECDSA_SIGN_ALT) || defined(MBEDTLS_ECDSA_VERIFY_ALT) || defined(MBEDTLS_ECP_ALT))
 
+ #include "mbedtls/platform_util.h"
+
+/* The SCE accepts a 64-byte plaintext P-521 private key */
+ #define RM_PSA_CRYPTO_ECC_521_PRIVATE_KEY_BYTES      (64U)
+
+/* Number of installed plaintext ECC keys kept in the wrapped key cache. Set to 0 to install the key on every call. */
+ #ifndef RM_PSA_CRYPTO_CFG_ECC_KEY_CACHE_ENTRIES
+  #define RM_PSA_CRYPTO_CFG_ECC_KEY_CACHE_ENTRIES    (0)
+ #endif
+
+ #if RM_PSA_CRYPTO_CFG_ECC_KEY_CACHE_ENTRIES > 0
+  #if !defined(MBEDTLS_SHA256_C)
+   #error "RM_PSA_CRYPTO_CFG_ECC_KEY_CACHE_ENTRIES requires MBEDTLS_SHA256_C"
+  #endif
+
+  #include "mbedtls/sha256.h"
+
+  #define RM_PSA_CRYPTO_ECC_KEY_CACHE_DIGEST_BYTES    (32U)
+  #if BSP_FEATURE_CRYPTO_HAS_RSIP7
+   #define RM_PSA_CRYPTO_ECC_KEY_CACHE_MAX_WORDS      (ECC_521_FORMATTED_PUBLIC_KEY_LENGTH_WORDS)
+  #else
+   #define RM_PSA_CRYPTO_ECC_KEY_CACHE_MAX_WORDS      (ECC_384_FORMATTED_PUBLIC_KEY_LENGTH_WORDS)
+  #endif
+
+/* One installed key. An entry with last_used == 0 is empty. */
+typedef struct st_rm_psa_crypto_ecc_key_cache_entry
+{
+    uint32_t key_command;                                         // OEM key command (curve and key type)
+    uint32_t last_used;                                           // LRU stamp
+    uint32_t wrapped_words;                                       // Size of wrapped_key in words
+    uint8_t  digest[RM_PSA_CRYPTO_ECC_KEY_CACHE_DIGEST_BYTES];    // SHA-256 of the plaintext key
+    uint32_t wrapped_key[RM_PSA_CRYPTO_ECC_KEY_CACHE_MAX_WORDS];  // Wrapped private key or formatted public key
+} rm_psa_crypto_ecc_key_cache_entry_t;
+
+static rm_psa_crypto_ecc_key_cache_entry_t g_ecc_key_cache[RM_PSA_CRYPTO_CFG_ECC_KEY_CACHE_ENTRIES];
+static uint32_t g_ecc_key_cache_stamp = 0U;
+
+/*******************************************************************************************************************//**
+ * Compares two digests in constant time.
+ *
+ * @retval true     Digests match.
+ * @retval false    Digests differ.
+ **********************************************************************************************************************/
+static bool rm_psa_crypto_ecc_key_cache_digest_equal (const uint8_t * p_a, const uint8_t * p_b)
+{
+    uint8_t diff = 0U;
+    for (uint32_t i = 0U; i < RM_PSA_CRYPTO_ECC_KEY_CACHE_DIGEST_BYTES; i++)
+    {
+        diff |= (uint8_t) (p_a[i] ^ p_b[i]);
+    }
+
+    return 0U == diff;
+}
+
+/*******************************************************************************************************************//**
+ * Returns the next LRU stamp. Must be called inside a critical section. When the stamp wraps every entry is dropped so
+ * that the ordering stays valid.
+ **********************************************************************************************************************/
+static uint32_t rm_psa_crypto_ecc_key_cache_stamp_next (void)
+{
+    g_ecc_key_cache_stamp++;
+    if (0U == g_ecc_key_cache_stamp)
+    {
+        mbedtls_platform_zeroize(g_ecc_key_cache, sizeof(g_ecc_key_cache));
+        g_ecc_key_cache_stamp = 1U;
+    }
+
+    return g_ecc_key_cache_stamp;
+}
+
+ #endif
+
+/*******************************************************************************************************************//**
+ * Installs a plaintext ECC key and returns the wrapped private key or formatted public key for it.
+ *
+ * When RM_PSA_CRYPTO_CFG_ECC_KEY_CACHE_ENTRIES is non-zero the result is cached, keyed by the OEM key command and a
+ * SHA-256 digest of the plaintext key, so that repeated operations with the same key skip the key install step. The
+ * least recently used entry is zeroized and replaced when the cache is full. The plaintext key is never stored.
+ *
+ * Only the long-lived ECDSA signing and verification keys go through this function. The scalar of
+ * mbedtls_ecp_mul_restartable is usually an ephemeral ECDH key and is installed directly so that it is neither kept
+ * nor evicts the ECDSA keys.
+ *
+ * @param[in]  key_command     OEM key command identifying the curve and key type.
+ * @param[in]  p_plain_key     Plaintext key.
+ * @param[in]  key_bytes       Size of the plaintext key in bytes.
+ * @param[out] p_wrapped_key   Wrapped private key or formatted public key.
+ * @param[in]  wrapped_words   Size of p_wrapped_key in words.
+ *
+ * @return See HW_SCE_GenerateOemKeyIndexPrivate.
+ **********************************************************************************************************************/
+fsp_err_t HW_SCE_ECC_PlainKeyInstall (uint32_t        key_command,
+                                      const uint8_t * p_plain_key,
+                                      uint32_t        key_bytes,
+                                      uint32_t      * p_wrapped_key,
+                                      uint32_t        wrapped_words)
+{
+ #if RM_PSA_CRYPTO_CFG_ECC_KEY_CACHE_ENTRIES > 0
+    uint8_t digest[RM_PSA_CRYPTO_ECC_KEY_CACHE_DIGEST_BYTES];
+    bool    hit = false;
+
+    if ((wrapped_words <= RM_PSA_CRYPTO_ECC_KEY_CACHE_MAX_WORDS) &&
+        (0 == mbedtls_sha256(p_plain_key, key_bytes, digest, 0)))
+    {
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+        for (uint32_t i = 0U; i < RM_PSA_CRYPTO_CFG_ECC_KEY_CACHE_ENTRIES; i++)
+        {
+            rm_psa_crypto_ecc_key_cache_entry_t * p_entry = &g_ecc_key_cache[i];
+            if ((0U != p_entry->last_used) && (key_command == p_entry->key_command) &&
+                (wrapped_words == p_entry->wrapped_words) &&
+                rm_psa_crypto_ecc_key_cache_digest_equal(digest, p_entry->digest))
+            {
+                memcpy(p_wrapped_key, p_entry->wrapped_key, wrapped_words * 4U);
+                p_entry->last_used = rm_psa_crypto_ecc_key_cache_stamp_next();
+                hit                = true;
+                break;
+            }
+        }
+
+        FSP_CRITICAL_SECTION_EXIT;
+
+        if (!hit)
+        {
+            fsp_err_t err = HW_SCE_GenerateOemKeyIndexPrivate(SCE_OEM_KEY_TYPE_PLAIN,
+                                                              (sce_oem_cmd_t) key_command,
+                                                              NULL,
+                                                              NULL,
+                                                              p_plain_key,
+                                                              p_wrapped_key);
+            if (FSP_SUCCESS != err)
+            {
+                mbedtls_platform_zeroize(digest, sizeof(digest));
+
+                return err;
+            }
+
+            /* Replace an empty entry or the least recently used one */
+            FSP_CRITICAL_SECTION_ENTER;
+            rm_psa_crypto_ecc_key_cache_entry_t * p_victim = &g_ecc_key_cache[0];
+            for (uint32_t i = 1U; (i < RM_PSA_CRYPTO_CFG_ECC_KEY_CACHE_ENTRIES) && (0U != p_victim->last_used); i++)
+            {
+                if (g_ecc_key_cache[i].last_used < p_victim->last_used)
+                {
+                    p_victim = &g_ecc_key_cache[i];
+                }
+            }
+
+            mbedtls_platform_zeroize(p_victim, sizeof(*p_victim));
+            p_victim->key_command   = key_command;
+            p_victim->wrapped_words = wrapped_words;
+            memcpy(p_victim->digest, digest, sizeof(digest));
+            memcpy(p_victim->wrapped_key, p_wrapped_key, wrapped_words * 4U);
+            p_victim->last_used = rm_psa_crypto_ecc_key_cache_stamp_next();
+            FSP_CRITICAL_SECTION_EXIT;
+        }
+
+        mbedtls_platform_zeroize(digest, sizeof(digest));
+
+        return FSP_SUCCESS;
+    }
+ #else
+    FSP_PARAMETER_NOT_USED(key_bytes);
+    FSP_PARAMETER_NOT_USED(wrapped_words);
+ #endif
+
+    return HW_SCE_GenerateOemKeyIndexPrivate(SCE_OEM_KEY_TYPE_PLAIN,
+                                             (sce_oem_cmd_t) key_command,
+                                             NULL,
+                                             NULL,
+                                             p_plain_key,
+                                             p_wrapped_key);
+}
+
+/*******************************************************************************************************************//**
+ * Zeroizes every entry of the plaintext ECC key cache. Called by RM_PSA_CRYPTO_DestroyKey so that the wrapped form of a
+ * key does not outlive it.
+ **********************************************************************************************************************/
+void HW_SCE_ECC_PlainKeyCacheFlush (void)
+{
+ #if RM_PSA_CRYPTO_CFG_ECC_KEY_CACHE_ENTRIES > 0
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    mbedtls_platform_zeroize(g_ecc_key_cache, sizeof(g_ecc_key_cache));
+    FSP_CRITICAL_SECTION_EXIT;
+ #endif
+}
+
 fsp_err_t HW_SCE_ECC_256GenerateSign (const uint32_t * InData_CurveType,
                                       const uint32_t * InData_G,
                                       const uint32_t * InData_PrivKey,
@@ -56,12 +244,11 @@ fsp_err_t HW_SCE_ECC_256GenerateSign (const uint32_t * InData_CurveType,
     }
 
     /* Install the plaintext private key to get the wrapped key */
-    fsp_err_t err = HW_SCE_GenerateOemKeyIndexPrivate(SCE_OEM_KEY_TYPE_PLAIN,
-                                                      key_command,
-                                                      NULL,
-                                                      NULL,
-                                                      (const uint8_t *) InData_PrivKey,
-                                                      wrapped_private_key);
+    fsp_err_t err = HW_SCE_ECC_PlainKeyInstall(key_command,
+                                               (const uint8_t *) InData_PrivKey,
+                                               ECC_256_PRIVATE_KEY_LENGTH_WORDS * 4U,
+                                               wrapped_private_key,
+                                               sizeof(wrapped_private_key) / 4U);
     if (FSP_SUCCESS == err)
     {
         err = HW_SCE_EcdsaSignatureGenerateSubAdaptor(InData_CurveType,
@@ -153,12 +340,11 @@ fsp_err_t HW_SCE_ECC_384GenerateSign (const uint32_t * InData_CurveType,
     }
 
     /* Install the plaintext private key to get the wrapped key */
-    fsp_err_t err = HW_SCE_GenerateOemKeyIndexPrivate(SCE_OEM_KEY_TYPE_PLAIN,
-                                                      key_command,
-                                                      NULL,
-                                                      NULL,
-                                                      (const uint8_t *) InData_PrivKey,
-                                                      wrapped_private_key);
+    fsp_err_t err = HW_SCE_ECC_PlainKeyInstall(key_command,
+                                               (const uint8_t *) InData_PrivKey,
+                                               ECC_384_PRIVATE_KEY_LENGTH_WORDS * 4U,
+                                               wrapped_private_key,
+                                               sizeof(wrapped_private_key) / 4U);
     if (FSP_SUCCESS == err)
     {
         err =
@@ -241,12 +427,11 @@ fsp_err_t HW_SCE_ECC_521GenerateSign (const uint32_t * InData_CurveType,
     }
 
     /* Install the plaintext private key to get the wrapped key */
-    fsp_err_t err = HW_SCE_GenerateOemKeyIndexPrivate(SCE_OEM_KEY_TYPE_PLAIN,
-                                                      key_command,
-                                                      NULL,
-                                                      NULL,
-                                                      (const uint8_t *) InData_PrivKey,
-                                                      wrapped_private_key);
+    fsp_err_t err = HW_SCE_ECC_PlainKeyInstall(key_command,
+                                               (const uint8_t *) InData_PrivKey,
+                                               RM_PSA_CRYPTO_ECC_521_PRIVATE_KEY_BYTES,
+                                               wrapped_private_key,
+                                               sizeof(wrapped_private_key) / 4U);
     if (FSP_SUCCESS == err)
     {
         err =
@@ -333,12 +518,11 @@ fsp_err_t HW_SCE_ECC_256VerifySign (const uint32_t * InData_CurveType,
     }
 
     /* Install the plaintext public key to get the formatted public key */
-    fsp_err_t err = HW_SCE_GenerateOemKeyIndexPrivate(SCE_OEM_KEY_TYPE_PLAIN,
-                                                      key_command,
-                                                      NULL,
-                                                      NULL,
-                                                      (const uint8_t *) InData_PubKey,
-                                                      formatted_public_key);
+    fsp_err_t err = HW_SCE_ECC_PlainKeyInstall(key_command,
+                                               (const uint8_t *) InData_PubKey,
+                                               ECC_256_PUBLIC_KEY_LENGTH_WORDS * 4U,
+                                               formatted_public_key,
+                                               sizeof(formatted_public_key) / 4U);
     if (FSP_SUCCESS == err)
     {
         /* InData_CurveType = curve type; InData_G = command */
@@ -388,12 +572,11 @@ fsp_err_t HW_SCE_ECC_384VerifySign (const uint32_t * InData_CurveType,
     }
 
     /* Install the plaintext public key to get the formatted public key */
-    fsp_err_t err = HW_SCE_GenerateOemKeyIndexPrivate(SCE_OEM_KEY_TYPE_PLAIN,
-                                                      key_command,
-                                                      NULL,
-                                                      NULL,
-                                                      (const uint8_t *) InData_PubKey,
-                                                      formatted_public_key);
+    fsp_err_t err = HW_SCE_ECC_PlainKeyInstall(key_command,
+                                               (const uint8_t *) InData_PubKey,
+                                               ECC_384_PUBLIC_KEY_LENGTH_WORDS * 4U,
+                                               formatted_public_key,
+                                               sizeof(formatted_public_key) / 4U);
     if (FSP_SUCCESS == err)
     {
         err = HW_SCE_EcdsaP384SignatureVerificationSubAdaptor((uint32_t *)InData_CurveType,
@@ -444,12 +627,11 @@ fsp_err_t HW_SCE_ECC_521VerifySign (const uint32_t * InData_CurveType,
     }
 
     /* Install the plaintext public key to get the formatted public key */
-    fsp_err_t err = HW_SCE_GenerateOemKeyIndexPrivate(SCE_OEM_KEY_TYPE_PLAIN,
-                                                      key_command,
-                                                      NULL,
-                                                      NULL,
-                                                      (const uint8_t *) Pubkey,
-                                                      formatted_public_key);
+    fsp_err_t err = HW_SCE_ECC_PlainKeyInstall(key_command,
+                                               (const uint8_t *) Pubkey,
+                                               sizeof(Pubkey),
+                                               formatted_public_key,
+                                               sizeof(formatted_public_key) / 4U);
     if (FSP_SUCCESS == err)
     {
         err = HW_SCE_EcdsaP521SignatureVerificationSubAdaptor((uint32_t *)InData_CurveType,
@@ -50,6 +50,9 @@ psa_status_t psa_export_key_buffer_internal( const uint8_t *key_buffer,
 /* Functions to support vendor defined format */
 psa_status_t vendor_bitlength_to_raw_bitlength(psa_key_type_t type, size_t vendor_bits, size_t * raw_bits);
 
+/* Destroys a key and the wrapped ECC keys cached for plaintext keys */
+psa_status_t RM_PSA_CRYPTO_DestroyKey(mbedtls_svc_key_id_t key);
+
  #ifdef __cplusplus
 }
  #endif
@@ -25,6 +25,10 @@
 #include "aes_vendor.h"
 #include "mbedtls/error.h"
 
+#if (defined(MBEDTLS_ECDSA_SIGN_ALT) || defined(MBEDTLS_ECDSA_VERIFY_ALT) || defined(MBEDTLS_ECP_ALT))
+ #include "hw_sce_ecc_private.h"
+#endif
+
 uint32_t ecp_load_key_size(bool wrapped_mode_ctx, const mbedtls_ecp_group * grp);
 
 psa_status_t vendor_bitlength_to_raw_bitlength (psa_key_type_t type, size_t vendor_bits, size_t * raw_bits)
@@ -466,3 +470,19 @@ psa_status_t psa_finish_key_creation_vendor (psa_key_slot_t * slot)
 #endif                                 // defined (MBEDTLS_PSA_CRYPTO_STORAGE_C)
     return status;
 }
+
+/*
+ * Destroys a key with psa_destroy_key(). The plaintext ECC key cache in ecdsa_alt_process.c is keyed by a digest of
+ * the key material, which is not available here once the key is gone, so the whole cache is flushed. Use this function
+ * instead of psa_destroy_key() when RM_PSA_CRYPTO_CFG_ECC_KEY_CACHE_ENTRIES is non-zero.
+ */
+psa_status_t RM_PSA_CRYPTO_DestroyKey (mbedtls_svc_key_id_t key)
+{
+    psa_status_t status = psa_destroy_key(key);
+
+#if (defined(MBEDTLS_ECDSA_SIGN_ALT) || defined(MBEDTLS_ECDSA_VERIFY_ALT) || defined(MBEDTLS_ECP_ALT))
+    HW_SCE_ECC_PlainKeyCacheFlush();
+#endif
+
+    return status;
+}
@@ -36,6 +36,10 @@
 #define RAI_DATA_SHIPPER_PRV_HEADER_BUFFER_BASE_SIZE    (17U) ///< Size of rai_data_shipper_header_buffer_t excluding data_type array
 #define RM_RAI_DATA_SHIPPER_HEADER_BUFFER_VERSION       (0)
 
+#define RAI_DATA_SHIPPER_PRV_ENCODING_RAW               (0xFFU) ///< Delta encoded channel block stored as raw samples
+#define RAI_DATA_SHIPPER_PRV_DATA_TYPE_FLOAT            (6U)    ///< 4-bit data type code of float
+#define RAI_DATA_SHIPPER_PRV_BITS_PER_BYTE              (8U)
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -48,7 +52,25 @@ static void rai_data_shipper_write_callback(rm_comms_callback_args_t * p_args);
 static void rai_data_shipper_notify_application(rai_data_shipper_instance_ctrl_t * p_ctrl,
                                                 uint8_t                            instance_id,
                                                 rm_comms_event_t                   event);
-static void rai_data_shipper_start_next_transmission(rai_data_shipper_instance_ctrl_t * p_ctrl);
+static void     rai_data_shipper_start_next_transmission(rai_data_shipper_instance_ctrl_t * p_ctrl);
+static void     rai_data_shipper_transmit_start(rai_data_shipper_instance_ctrl_t * p_ctrl);
+static void     rai_data_shipper_send_next(rai_data_shipper_instance_ctrl_t * p_ctrl);
+static void     rai_data_shipper_crc_calculate(rai_data_shipper_instance_ctrl_t * p_ctrl,
+                                               rai_data_shipper_tx_info_t       * p_tx_info);
+static uint32_t rai_data_shipper_crc_update(rai_data_shipper_instance_ctrl_t * p_ctrl,
+                                            uint32_t                           crc,
+                                            void const                       * p_buf,
+                                            uint32_t                           len);
+static uint32_t rai_data_shipper_header_buffer_len(rai_data_shipper_tx_info_t const * p_tx_info);
+static uint32_t rai_data_shipper_pack(rai_data_shipper_instance_ctrl_t * p_ctrl, rai_data_shipper_tx_info_t * p_tx_info);
+static uint32_t rai_data_shipper_channel_encode(uint8_t       * p_dest,
+                                                uint32_t        capacity,
+                                                uint8_t const * p_src,
+                                                uint32_t        len,
+                                                uint32_t        samples,
+                                                uint32_t        sample_size);
+static uint32_t rai_data_shipper_sample_get(uint8_t const * p_src, uint32_t index, uint32_t sample_size);
+static uint32_t rai_data_shipper_zigzag_delta(uint32_t sample, uint32_t previous, uint32_t bits);
 
 /***********************************************************************************************************************
  * Private global variables
@@ -88,6 +110,7 @@ fsp_err_t RM_RAI_DATA_SHIPPER_Open (rai_data_shipper_ctrl_t * const      p_api_c
     FSP_ASSERT(NULL != p_ctrl);
     FSP_ASSERT(NULL != p_cfg);
     FSP_ASSERT(NULL != p_cfg->p_comms);
+    FSP_ASSERT((RAI_DATA_SHIPPER_COMPRESSION_NONE == p_cfg->compression) || (NULL != p_cfg->p_tx_buffer));
     FSP_ERROR_RETURN(RAI_DATA_SHIPPER_PRV_OPEN != p_ctrl->opened, FSP_ERR_ALREADY_OPEN);
 #endif
 
@@ -113,10 +136,15 @@ fsp_err_t RM_RAI_DATA_SHIPPER_Open (rai_data_shipper_ctrl_t * const      p_api_c
         p_ctrl->tx_info[i].header.rssn[3]    = 'N';
         p_ctrl->tx_info[i].header.crc_enable = (p_cfg->p_crc != NULL) ? 1 : 0;
         p_ctrl->tx_info[i].header.version    = RM_RAI_DATA_SHIPPER_HEADER_BUFFER_VERSION;
+        p_ctrl->tx_info[i].header.encoding   = RAI_DATA_SHIPPER_COMPRESSION_NONE;
+        p_ctrl->tx_info[i].packed_len        = 0;
+        p_ctrl->tx_info[i].crc_ready         = false;
+        p_ctrl->tx_info[i].send_deferred     = false;
     }
 
     p_ctrl->index           = 0;
     p_ctrl->data_ready_mask = 0;
+    p_ctrl->tx_buffer_busy  = false;
     p_ctrl->opened          = RAI_DATA_SHIPPER_PRV_OPEN;
 
     return FSP_SUCCESS;
@@ -146,6 +174,19 @@ fsp_err_t RM_RAI_DATA_SHIPPER_Read (rai_data_shipper_ctrl_t * const p_api_ctrl,
  *
  * Implements @ref rai_data_shipper_api_t::write().
  *
+ * The gathering and delta encoding of the frame are done here, so the write complete interrupt only starts the next
+ * write. The CRC is calculated here after the transmission has been started, one segment at a time while the frame is
+ * on the wire. Only the CRC byte waits for the calculation to finish.
+ *
+ * If a transmit buffer is configured and not holding another frame, the frame is gathered into it and sent with a
+ * single write, optionally with delta encoded channels. A delta encoded channel block is:
+ * - 1 byte bit width b, or 0xFF if the block holds the raw samples;
+ * - the first sample as is;
+ * - the remaining samples as zigzag encoded differences to the previous sample, b bits each, packed LSB first and
+ *   padded to a whole byte.
+ *
+ * Float and double channels are always stored raw.
+ *
  * @retval FSP_SUCCESS                  Tx buf list created and transmission starts, or write request skipped.
  * @retval FSP_ERR_ASSERTION            An input parameter was invalid.
  * @retval FSP_ERR_NOT_OPEN             Module not open.
@@ -214,9 +255,6 @@ fsp_err_t RM_RAI_DATA_SHIPPER_Write (rai_data_shipper_ctrl_t * const         p_a
         p_tx_info->channels++;
     }
 
-    uint32_t header_buffer_len = RAI_DATA_SHIPPER_PRV_HEADER_BUFFER_BASE_SIZE +
-                                 (uint32_t) ((p_tx_info->header.channels + 1) >> 1);
-
     p_tx_info->header.events              = p_write_params->events;
     p_tx_info->header.diagnostic_data_len = p_write_params->diagnostic_data_len;
 
@@ -227,41 +265,63 @@ fsp_err_t RM_RAI_DATA_SHIPPER_Write (rai_data_shipper_ctrl_t * const         p_a
         p_tx_info->channels++;
     }
 
-    if (p_ctrl->p_cfg->p_crc)
-    {
-        crc_input_t            input;
-        uint32_t               crc   = 0;
-        crc_instance_t const * p_crc = p_ctrl->p_cfg->p_crc;
-
-        input.p_input_buffer = (void *) &p_tx_info->header;
-        input.num_bytes      = header_buffer_len;
-        input.crc_seed       = crc;
+    FSP_CRITICAL_SECTION_DEFINE;
 
-        p_crc->p_api->calculate(p_crc->p_ctrl, &input, &crc);
+    /* Claim the transmit buffer. It is released when the frame in it has been sent. */
+    bool packed = false;
+    if (NULL != p_ctrl->p_cfg->p_tx_buffer)
+    {
+        FSP_CRITICAL_SECTION_ENTER;
+        packed = !p_ctrl->tx_buffer_busy;
+        p_ctrl->tx_buffer_busy = true;
+        FSP_CRITICAL_SECTION_EXIT;
+    }
 
-        for (uint8_t i = 0; i < p_tx_info->channels; i++)
+    p_tx_info->packed_len = 0;
+    if (packed)
+    {
+        p_tx_info->packed_len = rai_data_shipper_pack(p_ctrl, p_tx_info);
+        if (0 == p_tx_info->packed_len)
         {
-            input.p_input_buffer = p_tx_info->data[i].p_buf;
-            input.num_bytes      = p_tx_info->data[i].len;
-            input.crc_seed       = crc;
-            p_crc->p_api->calculate(p_crc->p_ctrl, &input, &crc);
+            p_ctrl->tx_buffer_busy = false;
         }
+    }
 
-        p_tx_info->crc = (uint8_t) crc;
+    if (0 == p_tx_info->packed_len)
+    {
+        p_tx_info->header.encoding = RAI_DATA_SHIPPER_COMPRESSION_NONE;
+    }
+
+    bool crc = (NULL != p_ctrl->p_cfg->p_crc);
+    if (crc)
+    {
+        /* The CRC value is filled in while the frame is transmitted */
+        p_tx_info->crc_ready     = false;
+        p_tx_info->send_deferred = false;
         p_tx_info->data[p_tx_info->channels].p_buf = &p_tx_info->crc;
         p_tx_info->data[p_tx_info->channels].len   = 1;
         p_tx_info->channels++;
     }
 
-    if (0 == p_ctrl->data_ready_mask)
+    FSP_CRITICAL_SECTION_ENTER;
+    bool idle = (0 == p_ctrl->data_ready_mask);
+    p_ctrl->data_ready_mask |= (uint8_t) (1 << p_sensor_data->instance_id);
+    if (idle)
     {
         p_ctrl->index = p_sensor_data->instance_id;
-        p_ctrl->p_cfg->p_comms->p_api->write(p_ctrl->p_cfg->p_comms->p_ctrl,
-                                             (uint8_t *) &p_tx_info->header,
-                                             header_buffer_len);
     }
 
-    p_ctrl->data_ready_mask |= (uint8_t) (1 << p_sensor_data->instance_id);
+    FSP_CRITICAL_SECTION_EXIT;
+
+    if (idle)
+    {
+        rai_data_shipper_transmit_start(p_ctrl);
+    }
+
+    if (crc)
+    {
+        rai_data_shipper_crc_calculate(p_ctrl, p_tx_info);
+    }
 
     return FSP_SUCCESS;
 }
@@ -329,6 +389,11 @@ static void rai_data_shipper_start_next_transmission (rai_data_shipper_instance_
 {
     /* Clear the one that just finished */
     p_ctrl->data_ready_mask &= (uint8_t) ~(1 << p_ctrl->index);
+    if (0 != p_ctrl->tx_info[p_ctrl->index].packed_len)
+    {
+        p_ctrl->tx_buffer_busy = false;
+    }
+
     if (p_ctrl->data_ready_mask > 0)
     {
         /* Find the next instance to send */
@@ -340,12 +405,7 @@ static void rai_data_shipper_start_next_transmission (rai_data_shipper_instance_
             {
                 p_ctrl->index = next;
 
-                rai_data_shipper_tx_info_t * p_tx_info = &(p_ctrl->tx_info[next]);
-                uint32_t header_buffer_len             = RAI_DATA_SHIPPER_PRV_HEADER_BUFFER_BASE_SIZE +
-                                                         (uint32_t) ((p_tx_info->header.channels + 1) >> 1);
-                p_ctrl->p_cfg->p_comms->p_api->write(p_ctrl->p_cfg->p_comms->p_ctrl,
-                                                     (uint8_t *) &p_tx_info->header,
-                                                     header_buffer_len);
+                rai_data_shipper_transmit_start(p_ctrl);
                 break;
             }
 
@@ -355,42 +415,368 @@ static void rai_data_shipper_start_next_transmission (rai_data_shipper_instance_
 }
 
 /**********************************************************************************************************************
- * Write callback. Invoked when data is sent, or there is an error during transmission.
- * Data instances will be sent one by one, and for each data collector instance, data will be sent channel by channel.
+ * Start transmission of the data collector instance selected by p_ctrl->index. A frame gathered into the transmit
+ * buffer is sent with one write, otherwise its header is sent and the segments follow from the write callback.
  *
- * @param[in]     p_args     Pointer to RM_COPMMS module callback structure.
+ * @param[in]  p_ctrl          pointer to control structure.
  **********************************************************************************************************************/
-static void rai_data_shipper_write_callback (rm_comms_callback_args_t * p_args)
+static void rai_data_shipper_transmit_start (rai_data_shipper_instance_ctrl_t * p_ctrl)
 {
-    rai_data_shipper_instance_ctrl_t * p_ctrl = (rai_data_shipper_instance_ctrl_t *) p_args->p_context;
+    uint8_t instance = p_ctrl->index;
+    rai_data_shipper_tx_info_t * p_tx_info = &(p_ctrl->tx_info[instance]);
+    void     * p_buf = &p_tx_info->header;
+    uint32_t   len   = rai_data_shipper_header_buffer_len(p_tx_info);
+
+    p_tx_info->current = 0;
+
+    if (0 != p_tx_info->packed_len)
+    {
+        /* Everything but the CRC is in the transmit buffer */
+        p_buf              = p_ctrl->p_cfg->p_tx_buffer;
+        len                = p_tx_info->packed_len;
+        p_tx_info->current = (uint8_t) (p_tx_info->channels - ((NULL != p_ctrl->p_cfg->p_crc) ? 1 : 0));
+    }
+
+    fsp_err_t err = p_ctrl->p_cfg->p_comms->p_api->write(p_ctrl->p_cfg->p_comms->p_ctrl, p_buf, len);
+    if (FSP_SUCCESS != err)
+    {
+        rai_data_shipper_start_next_transmission(p_ctrl);
+
+        /* Notify application that there was an error during transmission. */
+        rai_data_shipper_notify_application(p_ctrl, instance, RM_COMMS_EVENT_ERROR);
+    }
+}
 
+/**********************************************************************************************************************
+ * Send the next segment of the current instance, or finish the instance if all segments were sent. If the CRC of the
+ * frame is still being calculated, the CRC segment is sent when the calculation finishes.
+ *
+ * @param[in]  p_ctrl          pointer to control structure.
+ **********************************************************************************************************************/
+static void rai_data_shipper_send_next (rai_data_shipper_instance_ctrl_t * p_ctrl)
+{
     uint8_t instance = p_ctrl->index;
     rai_data_shipper_tx_info_t * p_tx_info = &(p_ctrl->tx_info[instance]);
 
-    /* Error or data instance was transmitted successfully. */
-    if ((RM_COMMS_EVENT_ERROR == p_args->event) || (p_tx_info->current == p_tx_info->channels))
+    if ((NULL != p_ctrl->p_cfg->p_crc) && (p_tx_info->current == (p_tx_info->channels - 1)))
+    {
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+        if (!p_tx_info->crc_ready)
+        {
+            p_tx_info->send_deferred = true;
+            FSP_CRITICAL_SECTION_EXIT;
+
+            return;
+        }
+
+        FSP_CRITICAL_SECTION_EXIT;
+    }
+
+    /* Data instance was transmitted successfully. */
+    if (p_tx_info->current == p_tx_info->channels)
     {
         rai_data_shipper_start_next_transmission(p_ctrl);
 
-        /* Notify application instance data was sent or there was an error during transmission. */
-        rai_data_shipper_notify_application(p_ctrl, instance, p_args->event);
+        /* Notify application instance data was sent. */
+        rai_data_shipper_notify_application(p_ctrl, instance, RM_COMMS_EVENT_TX_OPERATION_COMPLETE);
 
         return;
     }
 
-    fsp_err_t err =
-        p_ctrl->p_cfg->p_comms->p_api->write(p_ctrl->p_cfg->p_comms->p_ctrl,
-                                             p_tx_info->data[p_tx_info->current].p_buf,
-                                             p_tx_info->data[p_tx_info->current].len);
+    rai_data_shipper_data_buffer_t * p_segment = &p_tx_info->data[p_tx_info->current];
+    p_tx_info->current++;
+
+    fsp_err_t err = p_ctrl->p_cfg->p_comms->p_api->write(p_ctrl->p_cfg->p_comms->p_ctrl,
+                                                         p_segment->p_buf,
+                                                         p_segment->len);
     if (FSP_SUCCESS != err)
     {
         rai_data_shipper_start_next_transmission(p_ctrl);
 
         /* Notify application that there was an error during transmission. */
         rai_data_shipper_notify_application(p_ctrl, instance, RM_COMMS_EVENT_ERROR);
+    }
+}
+
+/**********************************************************************************************************************
+ * Calculate the CRC of a frame that is queued or being transmitted. The CRC covers the same bytes as go on the wire,
+ * and each segment is added while the earlier ones are sent. If the transmission is already waiting for the CRC
+ * segment, it is sent from here.
+ *
+ * @param[in]  p_ctrl          pointer to control structure.
+ * @param[in]  p_tx_info       Instance to calculate the CRC of.
+ **********************************************************************************************************************/
+static void rai_data_shipper_crc_calculate (rai_data_shipper_instance_ctrl_t * p_ctrl,
+                                            rai_data_shipper_tx_info_t       * p_tx_info)
+{
+    uint32_t crc = 0;
+
+    if (0 != p_tx_info->packed_len)
+    {
+        crc = rai_data_shipper_crc_update(p_ctrl, crc, p_ctrl->p_cfg->p_tx_buffer, p_tx_info->packed_len);
+    }
+    else
+    {
+        crc = rai_data_shipper_crc_update(p_ctrl, crc, &p_tx_info->header, rai_data_shipper_header_buffer_len(p_tx_info));
+
+        /* The last segment is the CRC itself */
+        for (uint8_t i = 0; i < (p_tx_info->channels - 1); i++)
+        {
+            crc = rai_data_shipper_crc_update(p_ctrl, crc, p_tx_info->data[i].p_buf, p_tx_info->data[i].len);
+        }
+    }
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    p_tx_info->crc       = (uint8_t) crc;
+    p_tx_info->crc_ready = true;
+    bool deferred = p_tx_info->send_deferred;
+    p_tx_info->send_deferred = false;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    if (deferred)
+    {
+        rai_data_shipper_send_next(p_ctrl);
+    }
+}
+
+/**********************************************************************************************************************
+ * Add a buffer to a running CRC.
+ *
+ * @param[in]  p_ctrl          pointer to control structure.
+ * @param[in]  crc             CRC of the data before p_buf.
+ * @param[in]  p_buf           Data.
+ * @param[in]  len             Data length in bytes.
+ *
+ * @return CRC including p_buf.
+ **********************************************************************************************************************/
+static uint32_t rai_data_shipper_crc_update (rai_data_shipper_instance_ctrl_t * p_ctrl,
+                                             uint32_t                           crc,
+                                             void const                       * p_buf,
+                                             uint32_t                           len)
+{
+    crc_instance_t const * p_crc = p_ctrl->p_cfg->p_crc;
+    crc_input_t            input;
+
+    input.p_input_buffer = (void *) p_buf;
+    input.num_bytes      = len;
+    input.crc_seed       = crc;
+    p_crc->p_api->calculate(p_crc->p_ctrl, &input, &crc);
+
+    return crc;
+}
+
+/**********************************************************************************************************************
+ * Length of the header buffer on the wire.
+ *
+ * @param[in]  p_tx_info       Instance being transmitted.
+ **********************************************************************************************************************/
+static uint32_t rai_data_shipper_header_buffer_len (rai_data_shipper_tx_info_t const * p_tx_info)
+{
+    return RAI_DATA_SHIPPER_PRV_HEADER_BUFFER_BASE_SIZE + (uint32_t) ((p_tx_info->header.channels + 1) >> 1);
+}
+
+/**********************************************************************************************************************
+ * Gather the header, channels and diagnostic data of an instance into the transmit buffer.
+ *
+ * @param[in]  p_ctrl          pointer to control structure.
+ * @param[in]  p_tx_info       Instance to pack.
+ *
+ * @return Number of bytes in the transmit buffer, or 0 if the frame does not fit.
+ **********************************************************************************************************************/
+static uint32_t rai_data_shipper_pack (rai_data_shipper_instance_ctrl_t * p_ctrl, rai_data_shipper_tx_info_t * p_tx_info)
+{
+    uint8_t * p_dest     = p_ctrl->p_cfg->p_tx_buffer;
+    uint32_t  capacity   = p_ctrl->p_cfg->tx_buffer_size;
+    uint32_t  header_len = rai_data_shipper_header_buffer_len(p_tx_info);
+    uint8_t   segments   = p_tx_info->channels;
+    uint32_t  used;
+
+    FSP_ERROR_RETURN(header_len <= capacity, 0);
+
+    p_tx_info->header.encoding = (uint8_t) p_ctrl->p_cfg->compression;
+    memcpy(p_dest, &p_tx_info->header, header_len);
+    used = header_len;
+
+    for (uint8_t i = 0; i < segments; i++)
+    {
+        rai_data_shipper_data_buffer_t * p_segment = &p_tx_info->data[i];
+        uint32_t written = 0;
+
+        if ((RAI_DATA_SHIPPER_COMPRESSION_DELTA == p_ctrl->p_cfg->compression) && (i < p_tx_info->header.channels))
+        {
+            uint32_t data_type   = (uint32_t) (p_tx_info->header.data_type[i >> 1] >> ((i & 1) * 4)) & 0x0FU;
+            uint32_t sample_size = 0;
+
+            /* Floating point samples do not delta encode well and are sent raw */
+            if ((data_type < RAI_DATA_SHIPPER_PRV_DATA_TYPE_FLOAT) && (0 != p_tx_info->header.frame_buf_len))
+            {
+                sample_size = p_segment->len / p_tx_info->header.frame_buf_len;
+            }
+
+            written = rai_data_shipper_channel_encode(p_dest + used,
+                                                      capacity - used,
+                                                      p_segment->p_buf,
+                                                      p_segment->len,
+                                                      p_tx_info->header.frame_buf_len,
+                                                      sample_size);
+            FSP_ERROR_RETURN(0 != written, 0);
+        }
+        else
+        {
+            FSP_ERROR_RETURN(p_segment->len <= (capacity - used), 0);
+            memcpy(p_dest + used, p_segment->p_buf, p_segment->len);
+            written = p_segment->len;
+        }
+
+        used += written;
+    }
+
+    return used;
+}
+
+/**********************************************************************************************************************
+ * Read one integer sample.
+ *
+ * @param[in]  p_src           Channel samples.
+ * @param[in]  index           Sample index.
+ * @param[in]  sample_size     Sample size in bytes (1, 2 or 4).
+ **********************************************************************************************************************/
+static uint32_t rai_data_shipper_sample_get (uint8_t const * p_src, uint32_t index, uint32_t sample_size)
+{
+    if (1U == sample_size)
+    {
+        return p_src[index];
+    }
+
+    if (2U == sample_size)
+    {
+        return ((uint16_t const *) p_src)[index];
+    }
+
+    return ((uint32_t const *) p_src)[index];
+}
+
+/**********************************************************************************************************************
+ * Zigzag encoded difference of two samples, computed in the sample width.
+ *
+ * @param[in]  sample          Current sample.
+ * @param[in]  previous        Previous sample.
+ * @param[in]  bits            Sample width in bits.
+ **********************************************************************************************************************/
+static uint32_t rai_data_shipper_zigzag_delta (uint32_t sample, uint32_t previous, uint32_t bits)
+{
+    /* Left align the difference so the sign bit of the sample width is bit 31 */
+    uint32_t delta = (sample - previous) << (32U - bits);
+
+    return ((delta << 1) ^ (uint32_t) ((int32_t) delta >> 31)) >> (32U - bits);
+}
+
+/**********************************************************************************************************************
+ * Delta encode and bit-pack one channel. Falls back to raw samples if packing does not reduce the size.
+ *
+ * @param[out] p_dest          Output buffer.
+ * @param[in]  capacity        Space left in the output buffer.
+ * @param[in]  p_src           Channel samples.
+ * @param[in]  len             Channel length in bytes.
+ * @param[in]  samples         Number of samples.
+ * @param[in]  sample_size     Sample size in bytes (1, 2 or 4), or 0 to store the samples raw.
+ *
+ * @return Number of bytes written, or 0 if the block does not fit.
+ **********************************************************************************************************************/
+static uint32_t rai_data_shipper_channel_encode (uint8_t       * p_dest,
+                                                 uint32_t        capacity,
+                                                 uint8_t const * p_src,
+                                                 uint32_t        len,
+                                                 uint32_t        samples,
+                                                 uint32_t        sample_size)
+{
+    if (((1U == sample_size) || (2U == sample_size) || (4U == sample_size)) && (samples > 1U))
+    {
+        uint32_t bits = sample_size * RAI_DATA_SHIPPER_PRV_BITS_PER_BYTE;
+        uint32_t any  = 0;
+
+        /* Find the widest difference */
+        for (uint32_t i = 1; i < samples; i++)
+        {
+            any |= rai_data_shipper_zigzag_delta(rai_data_shipper_sample_get(p_src, i, sample_size),
+                                                 rai_data_shipper_sample_get(p_src, i - 1U, sample_size),
+                                                 bits);
+        }
+
+        uint32_t width      = (0U == any) ? 0U : (32U - (uint32_t) __CLZ(any));
+        uint32_t packed_len = 1U + sample_size +
+                              ((((samples - 1U) * width) + RAI_DATA_SHIPPER_PRV_BITS_PER_BYTE - 1U) /
+                               RAI_DATA_SHIPPER_PRV_BITS_PER_BYTE);
+
+        if (packed_len < (1U + len))
+        {
+            FSP_ERROR_RETURN(packed_len <= capacity, 0);
+
+            uint8_t * p_out = p_dest;
+            uint64_t  acc   = 0;
+            uint32_t  fill  = 0;
+
+            *p_out++ = (uint8_t) width;
+            memcpy(p_out, p_src, sample_size);
+            p_out += sample_size;
+
+            for (uint32_t i = 1; i < samples; i++)
+            {
+                uint32_t zigzag = rai_data_shipper_zigzag_delta(rai_data_shipper_sample_get(p_src, i, sample_size),
+                                                                rai_data_shipper_sample_get(p_src, i - 1U, sample_size),
+                                                                bits);
+
+                acc  |= (uint64_t) zigzag << fill;
+                fill += width;
+                while (fill >= RAI_DATA_SHIPPER_PRV_BITS_PER_BYTE)
+                {
+                    *p_out++ = (uint8_t) acc;
+                    acc    >>= RAI_DATA_SHIPPER_PRV_BITS_PER_BYTE;
+                    fill    -= RAI_DATA_SHIPPER_PRV_BITS_PER_BYTE;
+                }
+            }
+
+            if (0U != fill)
+            {
+                *p_out++ = (uint8_t) acc;
+            }
+
+            return packed_len;
+        }
+    }
+
+    /* Store the samples raw */
+    FSP_ERROR_RETURN((1U + len) <= capacity, 0);
+    p_dest[0] = RAI_DATA_SHIPPER_PRV_ENCODING_RAW;
+    memcpy(p_dest + 1, p_src, len);
+
+    return 1U + len;
+}
+
+/**********************************************************************************************************************
+ * Write callback. Invoked when data is sent, or there is an error during transmission.
+ * Data instances will be sent one by one, and for each data collector instance, data will be sent channel by channel.
+ *
+ * @param[in]     p_args     Pointer to RM_COPMMS module callback structure.
+ **********************************************************************************************************************/
+static void rai_data_shipper_write_callback (rm_comms_callback_args_t * p_args)
+{
+    rai_data_shipper_instance_ctrl_t * p_ctrl = (rai_data_shipper_instance_ctrl_t *) p_args->p_context;
+
+    /* Error during transmission. */
+    if (RM_COMMS_EVENT_ERROR == p_args->event)
+    {
+        uint8_t instance = p_ctrl->index;
+
+        rai_data_shipper_start_next_transmission(p_ctrl);
+
+        /* Notify application that there was an error during transmission. */
+        rai_data_shipper_notify_application(p_ctrl, instance, p_args->event);
 
         return;
     }
 
-    p_tx_info->current++;
+    rai_data_shipper_send_next(p_ctrl);
 }
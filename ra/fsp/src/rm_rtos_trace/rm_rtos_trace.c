@@ -0,0 +1,602 @@
+/***********************************************************************************************************************
+ * Copyright [2020-2024] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "rm_rtos_trace.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* "RTRC" in ASCII, used to determine if the module is open. */
+#define RM_RTOS_TRACE_OPEN                  (0x52545243U)
+
+/* Number of events in the ring. Must be a power of 2. Each event takes 8 bytes. */
+#ifndef RM_RTOS_TRACE_CFG_EVENTS
+ #define RM_RTOS_TRACE_CFG_EVENTS           (512U)
+#endif
+
+/* Number of task slots, including slot 0 which collects time with no task running. Must be a power of 2. */
+#ifndef RM_RTOS_TRACE_CFG_TASKS
+ #define RM_RTOS_TRACE_CFG_TASKS            (16U)
+#endif
+
+#if (0U != (RM_RTOS_TRACE_CFG_EVENTS & (RM_RTOS_TRACE_CFG_EVENTS - 1U)))
+ #error "RM_RTOS_TRACE_CFG_EVENTS must be a power of 2."
+#endif
+
+#if (RM_RTOS_TRACE_CFG_TASKS < 2U) || (0U != (RM_RTOS_TRACE_CFG_TASKS & (RM_RTOS_TRACE_CFG_TASKS - 1U)))
+ #error "RM_RTOS_TRACE_CFG_TASKS must be a power of 2 and at least 2."
+#endif
+
+/* The timestamp source defaults to the DWT cycle counter. MCUs without CYCCNT must supply a free running 32-bit
+ * counter, for example a GPT counter register. */
+#ifndef RM_RTOS_TRACE_CFG_TIMESTAMP_GET
+ #if BSP_FEATURE_DWT_CYCCNT
+  #define RM_RTOS_TRACE_CFG_TIMESTAMP_GET()    (DWT->CYCCNT)
+  #define RM_RTOS_TRACE_PRV_USE_CYCCNT         (1)
+ #else
+  #error "This MCU has no DWT CYCCNT. Define RM_RTOS_TRACE_CFG_TIMESTAMP_GET() and RM_RTOS_TRACE_CFG_TIMESTAMP_HZ."
+ #endif
+#endif
+
+#ifndef RM_RTOS_TRACE_PRV_USE_CYCCNT
+ #define RM_RTOS_TRACE_PRV_USE_CYCCNT       (0)
+#endif
+
+#ifndef RM_RTOS_TRACE_CFG_TIMESTAMP_HZ
+ #define RM_RTOS_TRACE_CFG_TIMESTAMP_HZ     (SystemCoreClock)
+#endif
+
+#define RM_RTOS_TRACE_EVENT_MASK            (RM_RTOS_TRACE_CFG_EVENTS - 1U)
+#define RM_RTOS_TRACE_TASK_MASK             (RM_RTOS_TRACE_CFG_TASKS - 1U)
+
+/* Events sent per frame. Keeps each write to the sink at 512 bytes of payload or less. */
+#define RM_RTOS_TRACE_EVENTS_PER_FRAME      (64U)
+
+/* The hooks use FSP critical sections, which mask interrupts with BASEPRI when BSP_CFG_IRQ_MASK_LEVEL_FOR_CRITICAL_SECTION
+ * is set. Interrupts of a higher priority are never delayed by the trace and are therefore not traced. */
+#if BSP_CFG_IRQ_MASK_LEVEL_FOR_CRITICAL_SECTION
+ #define RM_RTOS_TRACE_PRV_IRQ_TRACED(irq)    (NVIC_GetPriority((IRQn_Type) (irq)) >= \
+                                               BSP_CFG_IRQ_MASK_LEVEL_FOR_CRITICAL_SECTION)
+#else
+ #define RM_RTOS_TRACE_PRV_IRQ_TRACED(irq)    (true)
+#endif
+
+/* Task handles are at least 8-byte aligned, so the low bits carry no information for the slot hash. */
+#define RM_RTOS_TRACE_HANDLE_HASH_SHIFT     (3U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/* Per task accounting. */
+typedef struct st_rm_rtos_trace_task
+{
+    void const * p_handle;             // RTOS task handle, NULL if the slot is unused
+    char const * p_name;               // Task name owned by the RTOS
+    uint64_t     cycles;               // Time the task ran, excluding interrupts
+} rm_rtos_trace_task_t;
+
+/* Trace state. There is only one instance because the hooks are called from the RTOS port and every ISR. */
+typedef struct st_rm_rtos_trace_ctrl
+{
+    uint32_t                     open;
+    volatile bool                running;      // Hooks record only while true
+    bsp_sink_t const           * p_sink;       // Destination used by RM_RTOS_TRACE_Flush
+    volatile uint32_t            head;         // Free running index of the next event to write
+    uint32_t                     tail;         // Free running index of the next event to flush
+    uint32_t                     lost;         // Events overwritten before they were flushed
+    uint32_t                     current;      // Slot of the running task
+    uint32_t                     slice_start;  // Timestamp when the current task last started accumulating time
+    uint32_t                     nesting;      // Interrupt nesting level
+    uint32_t                     isr_start;    // Timestamp of the outermost interrupt entry
+    uint64_t                     isr_cycles;   // Total time spent in interrupts
+    rm_rtos_trace_task_t         tasks[RM_RTOS_TRACE_CFG_TASKS];
+    rm_rtos_trace_event_t        events[RM_RTOS_TRACE_CFG_EVENTS];
+    rm_rtos_trace_event_t        frame[RM_RTOS_TRACE_EVENTS_PER_FRAME]; // Events being flushed
+} rm_rtos_trace_ctrl_t;
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static void      rm_rtos_trace_record(uint32_t timestamp, rm_rtos_trace_event_type_t type, uint32_t id);
+static uint32_t  rm_rtos_trace_slot_get(void const * p_handle, char const * p_name);
+static fsp_err_t rm_rtos_trace_frame_write(rm_rtos_trace_frame_type_t type, void const * p_payload, uint32_t length);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/* Kept in RAM where a debugger or crash handler can dump it directly. */
+static rm_rtos_trace_ctrl_t g_rm_rtos_trace;
+
+static const char g_rm_rtos_trace_no_task_name[] = "(no task)";
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_RTOS_TRACE
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Clears the trace buffer and task statistics, enables the timestamp counter and stores the sink used by
+ * RM_RTOS_TRACE_Flush. Recording begins when RM_RTOS_TRACE_Start is called.
+ *
+ * Enable the hooks in the RTOS port and FSP_CONTEXT_SAVE/FSP_CONTEXT_RESTORE by setting BSP_CFG_RTOS_TRACE_ENABLE to 1.
+ * To capture frames in RAM, use RM_RTOS_TRACE_MemorySinkWrite with a rm_rtos_trace_memory_sink_t context.
+ *
+ * @retval FSP_SUCCESS                 Trace opened.
+ * @retval FSP_ERR_ASSERTION           p_sink or p_sink->p_write is NULL.
+ * @retval FSP_ERR_ALREADY_OPEN        Trace is already open.
+ **********************************************************************************************************************/
+fsp_err_t RM_RTOS_TRACE_Open (bsp_sink_t const * const p_sink)
+{
+#if RM_RTOS_TRACE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_sink);
+    FSP_ASSERT(NULL != p_sink->p_write);
+    FSP_ERROR_RETURN(RM_RTOS_TRACE_OPEN != g_rm_rtos_trace.open, FSP_ERR_ALREADY_OPEN);
+#endif
+
+    memset(&g_rm_rtos_trace, 0, sizeof(g_rm_rtos_trace));
+    g_rm_rtos_trace.p_sink          = p_sink;
+    g_rm_rtos_trace.tasks[0].p_name = g_rm_rtos_trace_no_task_name;
+
+#if RM_RTOS_TRACE_PRV_USE_CYCCNT
+    R_BSP_CycleCounterEnable();
+#endif
+
+    g_rm_rtos_trace.open = RM_RTOS_TRACE_OPEN;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Starts recording events and accumulating per task time.
+ *
+ * @retval FSP_SUCCESS                 Recording started.
+ * @retval FSP_ERR_NOT_OPEN            Trace is not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_RTOS_TRACE_Start (void)
+{
+#if RM_RTOS_TRACE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ERROR_RETURN(RM_RTOS_TRACE_OPEN == g_rm_rtos_trace.open, FSP_ERR_NOT_OPEN);
+#endif
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    g_rm_rtos_trace.slice_start = RM_RTOS_TRACE_CFG_TIMESTAMP_GET();
+    g_rm_rtos_trace.nesting     = 0U;
+    g_rm_rtos_trace.running     = true;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Stops recording. The time of the running task is accounted up to this point. Stop before RM_RTOS_TRACE_Flush to get
+ * a dump that cannot be overwritten while it is written to the sink.
+ *
+ * @retval FSP_SUCCESS                 Recording stopped.
+ * @retval FSP_ERR_NOT_OPEN            Trace is not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_RTOS_TRACE_Stop (void)
+{
+#if RM_RTOS_TRACE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ERROR_RETURN(RM_RTOS_TRACE_OPEN == g_rm_rtos_trace.open, FSP_ERR_NOT_OPEN);
+#endif
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    if (g_rm_rtos_trace.running)
+    {
+        uint32_t now = RM_RTOS_TRACE_CFG_TIMESTAMP_GET();
+        g_rm_rtos_trace.tasks[g_rm_rtos_trace.current].cycles += now - g_rm_rtos_trace.slice_start;
+        g_rm_rtos_trace.running = false;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Writes an info frame, one task frame per used slot and all events recorded since the previous flush to the sink.
+ *
+ * Flushing while recording is supported. Events that were overwritten before they could be copied out of the ring are
+ * counted in the lost field of the info frame. Events overwritten during this flush are reported by the next one. Call
+ * from thread context only.
+ *
+ * @retval FSP_SUCCESS                 Data written to the sink.
+ * @retval FSP_ERR_NOT_OPEN            Trace is not open.
+ * @return See @ref RENESAS_ERROR_CODES or the sink write function for other possible return codes.
+ **********************************************************************************************************************/
+fsp_err_t RM_RTOS_TRACE_Flush (void)
+{
+#if RM_RTOS_TRACE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ERROR_RETURN(RM_RTOS_TRACE_OPEN == g_rm_rtos_trace.open, FSP_ERR_NOT_OPEN);
+#endif
+
+    rm_rtos_trace_frame_info_t info;
+    rm_rtos_trace_frame_task_t task;
+
+    /* Snapshot the write index and statistics so the frames are consistent with each other. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    uint32_t head    = g_rm_rtos_trace.head;
+    uint32_t pending = head - g_rm_rtos_trace.tail;
+    if (pending > RM_RTOS_TRACE_CFG_EVENTS)
+    {
+        g_rm_rtos_trace.lost += pending - RM_RTOS_TRACE_CFG_EVENTS;
+        g_rm_rtos_trace.tail  = head - RM_RTOS_TRACE_CFG_EVENTS;
+    }
+
+    info.timestamp_hz    = RM_RTOS_TRACE_CFG_TIMESTAMP_HZ;
+    info.timestamp       = RM_RTOS_TRACE_CFG_TIMESTAMP_GET();
+    info.lost            = g_rm_rtos_trace.lost;
+    info.reserved        = 0U;
+    info.isr_cycles      = g_rm_rtos_trace.isr_cycles;
+    g_rm_rtos_trace.lost = 0U;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    fsp_err_t err = rm_rtos_trace_frame_write(RM_RTOS_TRACE_FRAME_TYPE_INFO, &info, sizeof(info));
+
+    for (uint32_t slot = 0U; (FSP_SUCCESS == err) && (slot < RM_RTOS_TRACE_CFG_TASKS); slot++)
+    {
+        FSP_CRITICAL_SECTION_ENTER;
+        rm_rtos_trace_task_t entry = g_rm_rtos_trace.tasks[slot];
+        FSP_CRITICAL_SECTION_EXIT;
+
+        if ((0U == slot) || (NULL != entry.p_handle))
+        {
+            memset(&task, 0, sizeof(task));
+            task.slot   = (uint16_t) slot;
+            task.handle = (uint32_t) entry.p_handle;
+            task.cycles = entry.cycles;
+            if (NULL != entry.p_name)
+            {
+                strncpy(task.name, entry.p_name, RM_RTOS_TRACE_TASK_NAME_LENGTH - 1U);
+            }
+
+            err = rm_rtos_trace_frame_write(RM_RTOS_TRACE_FRAME_TYPE_TASK, &task, sizeof(task));
+        }
+    }
+
+    /* Copy the events out of the ring in chunks that do not wrap. The hooks keep writing while a chunk is copied, so a
+     * chunk is only sent if none of its events were overwritten during the copy. Overwritten events are counted as
+     * lost and the rest of the chunk is copied again. */
+    while ((FSP_SUCCESS == err) && (g_rm_rtos_trace.tail != head))
+    {
+        uint32_t tail  = g_rm_rtos_trace.tail;
+        uint32_t index = tail & RM_RTOS_TRACE_EVENT_MASK;
+        uint32_t count = head - tail;
+        count = (count > RM_RTOS_TRACE_EVENTS_PER_FRAME) ? RM_RTOS_TRACE_EVENTS_PER_FRAME : count;
+        count = (count > (RM_RTOS_TRACE_CFG_EVENTS - index)) ? (RM_RTOS_TRACE_CFG_EVENTS - index) : count;
+
+        memcpy(g_rm_rtos_trace.frame, &g_rm_rtos_trace.events[index], count * sizeof(rm_rtos_trace_event_t));
+        __DMB();
+
+        uint32_t oldest = g_rm_rtos_trace.head - RM_RTOS_TRACE_CFG_EVENTS;
+        if ((int32_t) (oldest - tail) > 0)
+        {
+            g_rm_rtos_trace.lost += oldest - tail;
+            g_rm_rtos_trace.tail  = oldest;
+            if ((int32_t) (oldest - head) > 0)
+            {
+                head = oldest;
+            }
+
+            continue;
+        }
+
+        err = rm_rtos_trace_frame_write(RM_RTOS_TRACE_FRAME_TYPE_EVENTS,
+                                        g_rm_rtos_trace.frame,
+                                        count * sizeof(rm_rtos_trace_event_t));
+        g_rm_rtos_trace.tail = tail + count;
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the accumulated statistics of a task slot. Slot 0 collects time with no task running (or tasks that did not fit
+ * in the slot table).
+ *
+ * @retval FSP_SUCCESS                 Statistics copied to p_stats.
+ * @retval FSP_ERR_ASSERTION           p_stats is NULL.
+ * @retval FSP_ERR_NOT_OPEN            Trace is not open.
+ * @retval FSP_ERR_INVALID_ARGUMENT    Slot is out of range.
+ * @retval FSP_ERR_NOT_FOUND           Slot is not used.
+ **********************************************************************************************************************/
+fsp_err_t RM_RTOS_TRACE_TaskStatsGet (uint32_t slot, rm_rtos_trace_task_stats_t * const p_stats)
+{
+#if RM_RTOS_TRACE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_stats);
+    FSP_ERROR_RETURN(RM_RTOS_TRACE_OPEN == g_rm_rtos_trace.open, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(slot < RM_RTOS_TRACE_CFG_TASKS, FSP_ERR_INVALID_ARGUMENT);
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    rm_rtos_trace_task_t entry = g_rm_rtos_trace.tasks[slot];
+
+    /* Include the time of the running task up to now. */
+    if (g_rm_rtos_trace.running && (slot == g_rm_rtos_trace.current) && (0U == g_rm_rtos_trace.nesting))
+    {
+        entry.cycles += RM_RTOS_TRACE_CFG_TIMESTAMP_GET() - g_rm_rtos_trace.slice_start;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    FSP_ERROR_RETURN((0U == slot) || (NULL != entry.p_handle), FSP_ERR_NOT_FOUND);
+
+    p_stats->p_handle = entry.p_handle;
+    p_stats->p_name   = entry.p_name;
+    p_stats->cycles   = entry.cycles;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Records a user marker event. Can be called from tasks and ISRs, for example around a section whose latency is being
+ * investigated. Must not be called from interrupts with a priority above BSP_CFG_IRQ_MASK_LEVEL_FOR_CRITICAL_SECTION.
+ *
+ * @param[in] id    Marker ID shown by the decoder.
+ **********************************************************************************************************************/
+void RM_RTOS_TRACE_Mark (uint16_t id)
+{
+    if (g_rm_rtos_trace.running)
+    {
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+        rm_rtos_trace_record(RM_RTOS_TRACE_CFG_TIMESTAMP_GET(), RM_RTOS_TRACE_EVENT_TYPE_MARK, id);
+        FSP_CRITICAL_SECTION_EXIT;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Stops recording and closes the trace.
+ *
+ * @retval FSP_SUCCESS                 Trace closed.
+ * @retval FSP_ERR_NOT_OPEN            Trace is not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_RTOS_TRACE_Close (void)
+{
+#if RM_RTOS_TRACE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ERROR_RETURN(RM_RTOS_TRACE_OPEN == g_rm_rtos_trace.open, FSP_ERR_NOT_OPEN);
+#endif
+
+    g_rm_rtos_trace.running = false;
+    g_rm_rtos_trace.open    = 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Sink write function that appends trace data to a RAM buffer described by rm_rtos_trace_memory_sink_t. The buffer can
+ * be read by a debugger or saved by the application and decoded on the host.
+ *
+ * @retval FSP_SUCCESS                 Data appended.
+ * @retval FSP_ERR_ASSERTION           p_context is NULL.
+ * @retval FSP_ERR_OVERFLOW            The buffer is full. Nothing was written.
+ **********************************************************************************************************************/
+fsp_err_t RM_RTOS_TRACE_MemorySinkWrite (void * p_context, uint8_t const * p_data, uint32_t bytes)
+{
+    rm_rtos_trace_memory_sink_t * p_sink = (rm_rtos_trace_memory_sink_t *) p_context;
+
+#if RM_RTOS_TRACE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_sink);
+#endif
+    FSP_ERROR_RETURN(bytes <= (p_sink->size - p_sink->used), FSP_ERR_OVERFLOW);
+
+    memcpy(&p_sink->p_buffer[p_sink->used], p_data, bytes);
+    p_sink->used += bytes;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_RTOS_TRACE)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Hooks called from the RTOS ports and ISRs
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Called by the RTOS port after the scheduler selected the next task. Charges the elapsed time to the previous task and
+ * records a switch event if the task changed.
+ *
+ * @param[in] p_handle  Handle of the task that is about to run, NULL if no task is ready.
+ * @param[in] p_name    Name of the task. Only read when the task is seen for the first time.
+ **********************************************************************************************************************/
+void rm_rtos_trace_task_switch (void const * p_handle, char const * p_name)
+{
+    if (g_rm_rtos_trace.running)
+    {
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+        uint32_t slot = rm_rtos_trace_slot_get(p_handle, p_name);
+        if (slot != g_rm_rtos_trace.current)
+        {
+            uint32_t now = RM_RTOS_TRACE_CFG_TIMESTAMP_GET();
+            g_rm_rtos_trace.tasks[g_rm_rtos_trace.current].cycles += now - g_rm_rtos_trace.slice_start;
+            g_rm_rtos_trace.current     = slot;
+            g_rm_rtos_trace.slice_start = now;
+            rm_rtos_trace_record(now, RM_RTOS_TRACE_EVENT_TYPE_TASK_SWITCH, slot);
+        }
+
+        FSP_CRITICAL_SECTION_EXIT;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Called on interrupt entry. The outermost interrupt stops charging time to the running task.
+ *
+ * @param[in] irq  IRQ number, or (uint32_t) SysTick_IRQn.
+ **********************************************************************************************************************/
+void rm_rtos_trace_isr_enter (uint32_t irq)
+{
+    if (g_rm_rtos_trace.running && RM_RTOS_TRACE_PRV_IRQ_TRACED(irq))
+    {
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+        uint32_t now = RM_RTOS_TRACE_CFG_TIMESTAMP_GET();
+        if (0U == g_rm_rtos_trace.nesting)
+        {
+            g_rm_rtos_trace.tasks[g_rm_rtos_trace.current].cycles += now - g_rm_rtos_trace.slice_start;
+            g_rm_rtos_trace.isr_start = now;
+        }
+
+        g_rm_rtos_trace.nesting++;
+        rm_rtos_trace_record(now, RM_RTOS_TRACE_EVENT_TYPE_ISR_ENTER, irq);
+        FSP_CRITICAL_SECTION_EXIT;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Called on interrupt exit. When the outermost interrupt returns, time is charged to the running task again.
+ *
+ * @param[in] irq  IRQ number, or (uint32_t) SysTick_IRQn.
+ **********************************************************************************************************************/
+void rm_rtos_trace_isr_exit (uint32_t irq)
+{
+    if (g_rm_rtos_trace.running && RM_RTOS_TRACE_PRV_IRQ_TRACED(irq))
+    {
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+        uint32_t now = RM_RTOS_TRACE_CFG_TIMESTAMP_GET();
+
+        /* Ignore the exit of an interrupt that was already running when recording started. */
+        if (g_rm_rtos_trace.nesting > 0U)
+        {
+            g_rm_rtos_trace.nesting--;
+            if (0U == g_rm_rtos_trace.nesting)
+            {
+                g_rm_rtos_trace.isr_cycles += now - g_rm_rtos_trace.isr_start;
+                g_rm_rtos_trace.slice_start = now;
+            }
+
+            rm_rtos_trace_record(now, RM_RTOS_TRACE_EVENT_TYPE_ISR_EXIT, irq);
+        }
+
+        FSP_CRITICAL_SECTION_EXIT;
+    }
+}
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Writes one event to the ring, overwriting the oldest event when the ring is full. The reader never blocks a writer.
+ * Must be called inside a critical section.
+ *
+ * @param[in] timestamp  Event timestamp.
+ * @param[in] type       Event type.
+ * @param[in] id         Task slot, IRQ number or marker ID.
+ **********************************************************************************************************************/
+static void rm_rtos_trace_record (uint32_t timestamp, rm_rtos_trace_event_type_t type, uint32_t id)
+{
+    rm_rtos_trace_event_t * p_event = &g_rm_rtos_trace.events[g_rm_rtos_trace.head & RM_RTOS_TRACE_EVENT_MASK];
+
+    p_event->timestamp = timestamp;
+    p_event->type      = (uint8_t) type;
+    p_event->nesting   = (uint8_t) g_rm_rtos_trace.nesting;
+    p_event->id        = (uint16_t) id;
+
+    g_rm_rtos_trace.head++;
+}
+
+/*******************************************************************************************************************//**
+ * Finds the slot of a task, assigning a free one on first use. Slots are found by hashing the handle with linear
+ * probing so the lookup is usually a single compare. Must be called inside a critical section.
+ *
+ * @param[in] p_handle  Task handle.
+ * @param[in] p_name    Task name stored when a slot is assigned.
+ *
+ * @return Slot of the task. Slot 0 is returned for NULL handles and when the table is full.
+ **********************************************************************************************************************/
+static uint32_t rm_rtos_trace_slot_get (void const * p_handle, char const * p_name)
+{
+    if (NULL == p_handle)
+    {
+        return 0U;
+    }
+
+    uint32_t slot = ((uint32_t) p_handle >> RM_RTOS_TRACE_HANDLE_HASH_SHIFT) & RM_RTOS_TRACE_TASK_MASK;
+    for (uint32_t i = 0U; i < RM_RTOS_TRACE_CFG_TASKS; i++)
+    {
+        rm_rtos_trace_task_t * p_task = &g_rm_rtos_trace.tasks[slot];
+        if (0U != slot)
+        {
+            if (p_handle == p_task->p_handle)
+            {
+                return slot;
+            }
+
+            if (NULL == p_task->p_handle)
+            {
+                p_task->p_handle = p_handle;
+                p_task->p_name   = p_name;
+
+                return slot;
+            }
+        }
+
+        slot = (slot + 1U) & RM_RTOS_TRACE_TASK_MASK;
+    }
+
+    return 0U;
+}
+
+/*******************************************************************************************************************//**
+ * Writes one frame header and its payload to the sink.
+ *
+ * @param[in] type       Frame type.
+ * @param[in] p_payload  Frame payload.
+ * @param[in] length     Payload length in bytes.
+ *
+ * @return See the sink write function.
+ **********************************************************************************************************************/
+static fsp_err_t rm_rtos_trace_frame_write (rm_rtos_trace_frame_type_t type, void const * p_payload, uint32_t length)
+{
+    bsp_sink_t const * p_sink = g_rm_rtos_trace.p_sink;
+    rm_rtos_trace_frame_header_t header =
+    {
+        .magic   = RM_RTOS_TRACE_FRAME_MAGIC,
+        .type    = (uint8_t) type,
+        .version = RM_RTOS_TRACE_FRAME_VERSION,
+        .length  = (uint16_t) length,
+    };
+
+    fsp_err_t err = p_sink->p_write(p_sink->p_context, (uint8_t const *) &header, sizeof(header));
+    if (FSP_SUCCESS == err)
+    {
+        err = p_sink->p_write(p_sink->p_context, (uint8_t const *) p_payload, length);
+    }
+
+    return err;
+}
@@ -0,0 +1,216 @@
+#!/usr/bin/env python3
+#
+# Decodes the frames written by rm_rtos_trace (RM_RTOS_TRACE_Flush) and reports per task CPU utilization, interrupt
+# durations and the longest task slices and interrupts. Optionally writes the reconstructed timeline as CSV.
+#
+# Usage:
+#   python rm_rtos_trace_decode.py trace.bin [--timeline timeline.csv] [--top 10]
+#
+# The input is the raw byte stream sent to the sink: an RTT capture, a UART capture or a memory dump of the buffer
+# used with RM_RTOS_TRACE_MemorySinkWrite. Several flushes can be concatenated.
+
+import argparse
+import collections
+import struct
+import sys
+
+FRAME_MAGIC = 0x52545452
+FRAME_VERSION = 1
+
+FRAME_TYPE_INFO = 1
+FRAME_TYPE_TASK = 2
+FRAME_TYPE_EVENTS = 3
+
+EVENT_TYPE_TASK_SWITCH = 1
+EVENT_TYPE_ISR_ENTER = 2
+EVENT_TYPE_ISR_EXIT = 3
+EVENT_TYPE_MARK = 4
+
+ID_SYSTICK = 0xFFFF
+
+HEADER = struct.Struct('<IBBH')
+INFO = struct.Struct('<IIIIQ')
+TASK = struct.Struct('<HHIQ16s')
+EVENT = struct.Struct('<IBBH')
+
+
+def read_frames(data):
+    """Yields (type, payload) for every frame, skipping bytes that do not start a valid frame."""
+    magic = struct.pack('<I', FRAME_MAGIC)
+    offset = 0
+    while True:
+        offset = data.find(magic, offset)
+        if offset < 0 or offset + HEADER.size > len(data):
+            return
+        _, frame_type, version, length = HEADER.unpack_from(data, offset)
+        end = offset + HEADER.size + length
+        if version != FRAME_VERSION or end > len(data):
+            offset += 1
+            continue
+        yield frame_type, data[offset + HEADER.size:end]
+        offset = end
+
+
+class Decoder:
+    def __init__(self):
+        self.hz = 0
+        self.lost = 0
+        self.isr_cycles_reported = 0
+        self.task_names = {0: '(no task)'}
+        self.task_cycles_reported = {}
+
+        # Timeline reconstruction state.
+        self.last_raw = None
+        self.now = 0
+        self.first = None
+        self.current = None
+        self.slice_start = None
+        self.slice_isr = 0
+        self.isr_stack = []
+        self.isr_outer_start = None
+
+        # Results.
+        self.task_cycles = collections.Counter()
+        self.isr_stats = collections.defaultdict(lambda: [0, 0, 0])
+        self.slices = []
+        self.isrs = []
+        self.timeline = []
+
+    def irq_name(self, irq):
+        return 'SysTick' if irq == ID_SYSTICK else 'IRQ%d' % irq
+
+    def task_name(self, slot):
+        return self.task_names.get(slot, 'slot%d' % slot)
+
+    def unwrap(self, timestamp):
+        # Timestamps are free running 32-bit counters. Consecutive events must be less than one wrap apart.
+        if self.last_raw is not None:
+            self.now += (timestamp - self.last_raw) & 0xFFFFFFFF
+        self.last_raw = timestamp
+        if self.first is None:
+            self.first = self.now
+        return self.now
+
+    def end_slice(self, now):
+        if self.current is not None and self.slice_start is not None:
+            run = now - self.slice_start - self.slice_isr
+            self.task_cycles[self.current] += run
+            self.slices.append((run, self.slice_start, self.current))
+            self.timeline.append((self.slice_start, now, 'task', self.task_name(self.current)))
+        self.slice_start = now
+        self.slice_isr = 0
+
+    def event(self, timestamp, event_type, nesting, event_id):
+        now = self.unwrap(timestamp)
+        if event_type == EVENT_TYPE_TASK_SWITCH:
+            self.end_slice(now)
+            self.current = event_id
+            self.slice_start = now
+        elif event_type == EVENT_TYPE_ISR_ENTER:
+            if not self.isr_stack:
+                self.isr_outer_start = now
+            self.isr_stack.append((event_id, now))
+        elif event_type == EVENT_TYPE_ISR_EXIT:
+            if self.isr_stack and self.isr_stack[-1][0] == event_id:
+                _, start = self.isr_stack.pop()
+                duration = now - start
+                stats = self.isr_stats[event_id]
+                stats[0] += 1
+                stats[1] += duration
+                stats[2] = max(stats[2], duration)
+                self.isrs.append((duration, start, event_id))
+                self.timeline.append((start, now, 'isr', self.irq_name(event_id)))
+                if not self.isr_stack:
+                    self.slice_isr += now - self.isr_outer_start
+            else:
+                # Unmatched exit, for example when the ring overwrote the matching entry.
+                self.isr_stack = []
+        elif event_type == EVENT_TYPE_MARK:
+            self.timeline.append((now, now, 'mark', str(event_id)))
+
+    def frame(self, frame_type, payload):
+        if frame_type == FRAME_TYPE_INFO and len(payload) >= INFO.size:
+            self.hz, _, lost, _, isr_cycles = INFO.unpack_from(payload)
+            self.lost += lost
+            self.isr_cycles_reported = isr_cycles
+            if lost:
+                # Events are missing before the events that follow, so the open slice and interrupts cannot be
+                # closed. Restart at the next task switch.
+                self.current = None
+                self.slice_start = None
+                self.isr_stack = []
+        elif frame_type == FRAME_TYPE_TASK and len(payload) >= TASK.size:
+            slot, _, handle, cycles, name = TASK.unpack_from(payload)
+            name = name.split(b'\0', 1)[0].decode('ascii', 'replace')
+            self.task_names[slot] = name if name else '0x%08x' % handle
+            self.task_cycles_reported[slot] = cycles
+        elif frame_type == FRAME_TYPE_EVENTS:
+            for offset in range(0, len(payload) - EVENT.size + 1, EVENT.size):
+                self.event(*EVENT.unpack_from(payload, offset))
+
+    def us(self, cycles):
+        return cycles * 1e6 / self.hz if self.hz else float(cycles)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode rm_rtos_trace data.')
+    parser.add_argument('input', help='binary trace data written by the sink')
+    parser.add_argument('--timeline', help='write the reconstructed timeline to this CSV file')
+    parser.add_argument('--top', type=int, default=10, help='number of outliers to list (default 10)')
+    args = parser.parse_args()
+
+    with open(args.input, 'rb') as f:
+        data = f.read()
+
+    decoder = Decoder()
+    for frame_type, payload in read_frames(data):
+        decoder.frame(frame_type, payload)
+    decoder.end_slice(decoder.now)
+
+    unit = 'us' if decoder.hz else 'cycles'
+    window = decoder.now - (decoder.first or 0)
+    isr_total = sum(stats[1] for stats in decoder.isr_stats.values())
+
+    print('Timestamp clock: %s Hz, traced window: %.1f %s, lost events: %d'
+          % (decoder.hz or 'unknown', decoder.us(window), unit, decoder.lost))
+
+    print('\nTask CPU utilization (excluding interrupts)')
+    print('%-18s %14s %8s %16s' % ('task', 'traced ' + unit, 'percent', 'total cycles'))
+    slots = sorted(set(decoder.task_cycles) | set(decoder.task_cycles_reported))
+    for slot in slots:
+        cycles = decoder.task_cycles.get(slot, 0)
+        percent = 100.0 * cycles / window if window else 0.0
+        print('%-18s %14.1f %7.2f%% %16d'
+              % (decoder.task_name(slot), decoder.us(cycles), percent, decoder.task_cycles_reported.get(slot, 0)))
+    percent = 100.0 * isr_total / window if window else 0.0
+    print('%-18s %14.1f %7.2f%% %16d'
+          % ('(interrupts)', decoder.us(isr_total), percent, decoder.isr_cycles_reported))
+
+    print('\nInterrupts')
+    print('%-10s %8s %12s %12s' % ('irq', 'count', 'avg ' + unit, 'max ' + unit))
+    for irq, (count, total, longest) in sorted(decoder.isr_stats.items()):
+        print('%-10s %8d %12.2f %12.2f'
+              % (decoder.irq_name(irq), count, decoder.us(total / count), decoder.us(longest)))
+
+    print('\nLongest task slices (time a task ran without a switch, excluding interrupts)')
+    for run, start, slot in sorted(decoder.slices, reverse=True)[:args.top]:
+        print('  %12.2f %s at %.1f %s  %s'
+              % (decoder.us(run), unit, decoder.us(start - decoder.first), unit, decoder.task_name(slot)))
+
+    print('\nLongest interrupts')
+    for duration, start, irq in sorted(decoder.isrs, reverse=True)[:args.top]:
+        print('  %12.2f %s at %.1f %s  %s'
+              % (decoder.us(duration), unit, decoder.us(start - decoder.first), unit, decoder.irq_name(irq)))
+
+    if args.timeline:
+        with open(args.timeline, 'w') as f:
+            f.write('start_%s,end_%s,kind,name\n' % (unit, unit))
+            for start, end, kind, name in sorted(decoder.timeline):
+                f.write('%.3f,%.3f,%s,%s\n'
+                        % (decoder.us(start - decoder.first), decoder.us(end - decoder.first), kind, name))
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
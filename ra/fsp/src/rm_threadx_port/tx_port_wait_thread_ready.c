@@ -113,6 +113,12 @@ void * _tx_port_wait_thread_ready (void)
 
     TX_THREAD * new_thread_ptr;
 
+#if BSP_CFG_RTOS_TRACE_ENABLE
+
+    /* Charge the idle time to trace slot 0. */
+    rm_rtos_trace_task_switch(NULL, NULL);
+#endif
+
 #if defined(BSP_CFG_RTOS_IDLE_SLEEP) && (0 == BSP_CFG_RTOS_IDLE_SLEEP)
     while (1)
     {
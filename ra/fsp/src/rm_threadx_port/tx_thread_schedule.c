@@ -101,6 +101,11 @@ VOID _tx_thread_schedule(VOID);
 
 VOID _tx_port_svc_handler(UINT * caller_stack_ptr);
 
+#if BSP_CFG_RTOS_TRACE_ENABLE
+VOID rm_threadx_port_trace_thread_enter(VOID);
+
+#endif
+
 extern TX_THREAD * volatile _tx_thread_current_ptr;
 extern TX_THREAD * volatile _tx_thread_execute_ptr;
 extern volatile UINT        _tx_thread_preempt_disable;
@@ -524,6 +529,16 @@ TX_PORT_NAKED_FUNCTION VOID PendSV_Handler (VOID)
         /* r0-r3 are undefined after branches. */
 #endif
 
+#if BSP_CFG_RTOS_TRACE_ENABLE
+
+        /* Record the switch to the new thread.  */
+
+        // rm_threadx_port_trace_thread_enter();
+        "BL      rm_threadx_port_trace_thread_enter \n"
+
+        /* r0-r3 are undefined after branches. */
+#endif
+
 #ifdef TX_PORT_TRUSTZONE_NSC_ENABLE
 
         /* Load the offset of tx_thread_secure_stack_context in r12. */
@@ -646,7 +661,27 @@ extern VOID _tx_timer_interrupt(VOID);
 /* System tick timer. */
 VOID SysTick_Handler (VOID)
 {
+ #if BSP_CFG_RTOS_TRACE_ENABLE
+    rm_rtos_trace_isr_enter((uint32_t) SysTick_IRQn);
+ #endif
+
     _tx_timer_interrupt();
+
+ #if BSP_CFG_RTOS_TRACE_ENABLE
+    rm_rtos_trace_isr_exit((uint32_t) SysTick_IRQn);
+ #endif
+}
+
+#endif
+
+#if BSP_CFG_RTOS_TRACE_ENABLE
+
+/* Called from PendSV_Handler after _tx_thread_current_ptr is updated to the thread about to run. */
+VOID rm_threadx_port_trace_thread_enter (VOID)
+{
+    TX_THREAD * p_thread = _tx_thread_current_ptr;
+
+    rm_rtos_trace_task_switch(p_thread, p_thread->tx_thread_name);
 }
 
 #endif
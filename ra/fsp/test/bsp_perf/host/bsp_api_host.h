@@ -0,0 +1,76 @@
+/***********************************************************************************************************************
+ * Copyright [2020-2024] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/* Replaces bsp_api.h when building bsp_perf.c for the host. Only the definitions used by the performance counters are
+ * provided. Included on the command line with -include so the include guard of bsp_api.h is already set. */
+
+#ifndef BSP_API_HOST_H
+#define BSP_API_HOST_H
+
+#define BSP_API_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "fsp_common_api.h"
+
+#define BSP_CFG_PERF_COUNTERS_ENABLE     (1)
+#define BSP_CFG_PARAM_CHECKING_ENABLE    (1)
+#define BSP_FEATURE_DWT_CYCCNT           (0U)
+
+#define FSP_ERROR_LOG(err)
+#define FSP_ASSERT(a)    FSP_ERROR_RETURN((a), FSP_ERR_ASSERTION)
+#define FSP_ERROR_RETURN(a, err) \
+    {                            \
+        if ((a))                 \
+        {                        \
+            (void) 0;            \
+        }                        \
+        else                     \
+        {                        \
+            return err;          \
+        }                        \
+    }
+
+#define __STATIC_INLINE    static inline
+
+#define FSP_CRITICAL_SECTION_DEFINE
+#define FSP_CRITICAL_SECTION_ENTER
+#define FSP_CRITICAL_SECTION_EXIT
+
+typedef fsp_err_t (* bsp_sink_write_t)(void * p_context, uint8_t const * p_data, uint32_t bytes);
+
+typedef struct st_bsp_sink
+{
+    bsp_sink_write_t p_write;
+    void           * p_context;
+} bsp_sink_t;
+
+extern uint32_t SystemCoreClock;
+
+static inline void R_BSP_CycleCounterEnable (void)
+{
+}
+
+#include "bsp_perf.h"
+
+#endif
@@ -0,0 +1,330 @@
+/***********************************************************************************************************************
+ * Copyright [2020-2024] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/* Host test for the driver performance counter list and its text dump in bsp_perf.c. The sink collects the dumped
+ * lines so the tests can check the list order and the formatting without a UART. */
+
+/***********************************************************************************************************************
+ * Includes   <System Includes> , "Project Includes"
+ **********************************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define TEST_MAX_LINES        (8U)
+#define TEST_LINE_SIZE        (400U)
+
+/* Line size and name length limits of bsp_perf.c. */
+#define TEST_PERF_LINE_SIZE   (320U)
+#define TEST_PERF_NAME_MAX    (32U)
+
+#define TEST_CHECK(a)                                                    \
+    {                                                                    \
+        if (!(a))                                                        \
+        {                                                                \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #a); \
+            g_test_failures++;                                           \
+        }                                                                \
+    }
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/* Lines written to the sink by R_BSP_PerfDump. */
+typedef struct st_test_sink_capture
+{
+    char      lines[TEST_MAX_LINES][TEST_LINE_SIZE];
+    uint32_t  lengths[TEST_MAX_LINES];
+    uint32_t  count;                   // Lines written
+    uint32_t  fail_at;                 // Write that fails, or TEST_MAX_LINES to never fail
+    fsp_err_t fail_err;                // Error returned by the failing write
+} test_sink_capture_t;
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static fsp_err_t test_sink_write(void * p_context, uint8_t const * p_data, uint32_t bytes);
+static void      test_sink_reset(void);
+static uint32_t  test_list_length(void);
+static void      test_list_clear(void);
+static void      test_register_next(void);
+static void      test_register_again(void);
+static void      test_unregister_unknown(void);
+static void      test_reset(void);
+static void      test_dump_format(void);
+static void      test_dump_truncation(void);
+static void      test_dump_sink_error(void);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+static uint32_t g_test_failures;
+
+static test_sink_capture_t g_capture;
+
+static const bsp_sink_t g_sink =
+{
+    .p_write   = test_sink_write,
+    .p_context = &g_capture,
+};
+
+static bsp_perf_entry_t g_entry_a;
+static bsp_perf_entry_t g_entry_b;
+static bsp_perf_entry_t g_entry_c;
+
+/***********************************************************************************************************************
+ * BSP stand-ins
+ **********************************************************************************************************************/
+uint32_t SystemCoreClock = 200000000U;
+
+/***********************************************************************************************************************
+ * Sink
+ **********************************************************************************************************************/
+static fsp_err_t test_sink_write (void * p_context, uint8_t const * p_data, uint32_t bytes)
+{
+    test_sink_capture_t * p_capture = (test_sink_capture_t *) p_context;
+
+    FSP_ERROR_RETURN(p_capture->count != p_capture->fail_at, p_capture->fail_err);
+    FSP_ERROR_RETURN(p_capture->count < TEST_MAX_LINES, FSP_ERR_OVERFLOW);
+    FSP_ERROR_RETURN(bytes < TEST_LINE_SIZE, FSP_ERR_OVERFLOW);
+
+    memcpy(p_capture->lines[p_capture->count], p_data, bytes);
+    p_capture->lines[p_capture->count][bytes] = '\0';
+    p_capture->lengths[p_capture->count]      = bytes;
+    p_capture->count++;
+
+    return FSP_SUCCESS;
+}
+
+static void test_sink_reset (void)
+{
+    memset(&g_capture, 0, sizeof(g_capture));
+    g_capture.fail_at = TEST_MAX_LINES;
+}
+
+/***********************************************************************************************************************
+ * Helpers
+ **********************************************************************************************************************/
+
+/* Number of registered instances. Stops counting at 16 so a list with a cycle does not hang the test. */
+static uint32_t test_list_length (void)
+{
+    uint32_t           length  = 0U;
+    bsp_perf_entry_t * p_entry = R_BSP_PerfNext(NULL);
+
+    while ((NULL != p_entry) && (length < 16U))
+    {
+        length++;
+        p_entry = R_BSP_PerfNext(p_entry);
+    }
+
+    return length;
+}
+
+static void test_list_clear (void)
+{
+    R_BSP_PerfUnregister(&g_entry_a);
+    R_BSP_PerfUnregister(&g_entry_b);
+    R_BSP_PerfUnregister(&g_entry_c);
+    TEST_CHECK(NULL == R_BSP_PerfNext(NULL));
+}
+
+/***********************************************************************************************************************
+ * Tests
+ **********************************************************************************************************************/
+
+/* Instances are enumerated from the most recently registered one. */
+static void test_register_next (void)
+{
+    R_BSP_PerfRegister(&g_entry_a, "r_a", 1U);
+    R_BSP_PerfRegister(&g_entry_b, "r_b", 2U);
+
+    TEST_CHECK(&g_entry_b == R_BSP_PerfNext(NULL));
+    TEST_CHECK(&g_entry_a == R_BSP_PerfNext(&g_entry_b));
+    TEST_CHECK(NULL == R_BSP_PerfNext(&g_entry_a));
+    TEST_CHECK(0 == strcmp("r_a", g_entry_a.p_name));
+    TEST_CHECK(1U == g_entry_a.channel);
+
+    test_list_clear();
+}
+
+/* Registering an instance again, as a driver does when it is reopened, moves it to the front of the list without
+ * duplicating it and restarts its counters. */
+static void test_register_again (void)
+{
+    R_BSP_PerfRegister(&g_entry_a, "r_a", 1U);
+    R_BSP_PerfRegister(&g_entry_b, "r_b", 2U);
+    R_BSP_PerfRegister(&g_entry_c, "r_c", 3U);
+
+    g_entry_b.counters.tx_bytes   = 100U;
+    g_entry_b.counters.isr_cycles = 5000U;
+
+    R_BSP_PerfRegister(&g_entry_b, "r_b", 4U);
+
+    TEST_CHECK(3U == test_list_length());
+    TEST_CHECK(&g_entry_b == R_BSP_PerfNext(NULL));
+    TEST_CHECK(&g_entry_c == R_BSP_PerfNext(&g_entry_b));
+    TEST_CHECK(&g_entry_a == R_BSP_PerfNext(&g_entry_c));
+    TEST_CHECK(NULL == R_BSP_PerfNext(&g_entry_a));
+    TEST_CHECK(0U == g_entry_b.counters.tx_bytes);
+    TEST_CHECK(0U == g_entry_b.counters.isr_cycles);
+    TEST_CHECK(4U == g_entry_b.channel);
+
+    test_list_clear();
+}
+
+/* Unregistering an instance that is not in the list leaves the list unchanged, including an instance whose p_next
+ * still points into the list. */
+static void test_unregister_unknown (void)
+{
+    R_BSP_PerfRegister(&g_entry_a, "r_a", 1U);
+    R_BSP_PerfRegister(&g_entry_b, "r_b", 2U);
+
+    g_entry_c.p_next = &g_entry_a;
+    R_BSP_PerfUnregister(&g_entry_c);
+
+    TEST_CHECK(2U == test_list_length());
+    TEST_CHECK(&g_entry_b == R_BSP_PerfNext(NULL));
+    TEST_CHECK(&g_entry_a == R_BSP_PerfNext(&g_entry_b));
+
+    /* Unregistering twice is harmless. */
+    R_BSP_PerfUnregister(&g_entry_b);
+    R_BSP_PerfUnregister(&g_entry_b);
+
+    TEST_CHECK(1U == test_list_length());
+    TEST_CHECK(&g_entry_a == R_BSP_PerfNext(NULL));
+    TEST_CHECK(NULL == g_entry_b.p_next);
+
+    test_list_clear();
+}
+
+/* R_BSP_PerfReset clears the counters of every instance but keeps them registered. */
+static void test_reset (void)
+{
+    R_BSP_PerfRegister(&g_entry_a, "r_a", 1U);
+    R_BSP_PerfRegister(&g_entry_b, "r_b", 2U);
+
+    g_entry_a.counters.rx_frames = 7U;
+    g_entry_b.counters.errors    = 3U;
+
+    R_BSP_PerfReset();
+
+    TEST_CHECK(0U == g_entry_a.counters.rx_frames);
+    TEST_CHECK(0U == g_entry_b.counters.errors);
+    TEST_CHECK(2U == test_list_length());
+    TEST_CHECK(0 == strcmp("r_b", g_entry_b.p_name));
+
+    test_list_clear();
+}
+
+/* Values are written in decimal, including zero and the largest counter values. */
+static void test_dump_format (void)
+{
+    test_sink_reset();
+    TEST_CHECK(FSP_SUCCESS == R_BSP_PerfDump(&g_sink));
+    TEST_CHECK(1U == g_capture.count);
+    TEST_CHECK(0 == strcmp("perf hz=200000000\r\n", g_capture.lines[0]));
+
+    R_BSP_PerfRegister(&g_entry_a, "r_sci_uart", 9U);
+    g_entry_a.counters.tx_bytes       = 1024U;
+    g_entry_a.counters.rx_bytes       = 12U;
+    g_entry_a.counters.interrupts     = 1037U;
+    g_entry_a.counters.retries        = UINT32_MAX;
+    g_entry_a.counters.isr_cycles     = UINT64_MAX;
+    g_entry_a.counters.isr_cycles_max = 612U;
+
+    test_sink_reset();
+    TEST_CHECK(FSP_SUCCESS == R_BSP_PerfDump(&g_sink));
+    TEST_CHECK(2U == g_capture.count);
+    TEST_CHECK(0 ==
+               strcmp("r_sci_uart ch=9 tx_bytes=1024 rx_bytes=12 tx_frames=0 rx_frames=0 interrupts=1037 overruns=0 "
+                      "errors=0 retries=4294967295 isr_cycles=18446744073709551615 isr_cycles_max=612\r\n",
+                      g_capture.lines[1]));
+
+    test_list_clear();
+
+    TEST_CHECK(FSP_ERR_ASSERTION == R_BSP_PerfDump(NULL));
+}
+
+/* Names longer than 32 characters are truncated. A line with such a name and every counter at its maximum value
+ * still fits with its line ending. */
+static void test_dump_truncation (void)
+{
+    static const char long_name[] = "r_driver_with_a_very_long_name_that_does_not_fit";
+
+    R_BSP_PerfRegister(&g_entry_a, long_name, UINT32_MAX);
+    memset(&g_entry_a.counters, 0xFF, sizeof(g_entry_a.counters));
+
+    test_sink_reset();
+    TEST_CHECK(FSP_SUCCESS == R_BSP_PerfDump(&g_sink));
+    TEST_CHECK(2U == g_capture.count);
+
+    char const * p_line = g_capture.lines[1];
+    uint32_t     length = g_capture.lengths[1];
+
+    TEST_CHECK(length <= TEST_PERF_LINE_SIZE);
+    TEST_CHECK(0 == strncmp(long_name, p_line, TEST_PERF_NAME_MAX));
+    TEST_CHECK(0 == strncmp(" ch=4294967295 ", &p_line[TEST_PERF_NAME_MAX], 15U));
+    TEST_CHECK((length >= 2U) && (0 == strcmp("\r\n", &p_line[length - 2U])));
+    TEST_CHECK(NULL != strstr(p_line, " isr_cycles=18446744073709551615 isr_cycles_max=4294967295\r\n"));
+
+    test_list_clear();
+}
+
+/* An error from the sink stops the dump and is returned. */
+static void test_dump_sink_error (void)
+{
+    R_BSP_PerfRegister(&g_entry_a, "r_a", 1U);
+    R_BSP_PerfRegister(&g_entry_b, "r_b", 2U);
+
+    test_sink_reset();
+    g_capture.fail_at  = 1U;
+    g_capture.fail_err = FSP_ERR_TIMEOUT;
+    TEST_CHECK(FSP_ERR_TIMEOUT == R_BSP_PerfDump(&g_sink));
+    TEST_CHECK(1U == g_capture.count);
+
+    test_list_clear();
+}
+
+int main (void)
+{
+    test_register_next();
+    test_register_again();
+    test_unregister_unknown();
+    test_reset();
+    test_dump_format();
+    test_dump_truncation();
+    test_dump_sink_error();
+
+    if (0U != g_test_failures)
+    {
+        printf("%u check(s) failed\n", (unsigned) g_test_failures);
+
+        return EXIT_FAILURE;
+    }
+
+    printf("All bsp_perf tests passed\n");
+
+    return EXIT_SUCCESS;
+}
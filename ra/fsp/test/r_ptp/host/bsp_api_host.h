@@ -0,0 +1,114 @@
+/***********************************************************************************************************************
+ * Copyright [2020-2024] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/* Replaces bsp_api.h when building r_ptp for the host. The register definitions come from the RA6M3 device header so
+ * that the driver compiles unchanged; the tests only call functions that do not access the peripheral. Included on the
+ * command line with -include so the include guard of bsp_api.h is already set. */
+
+#ifndef BSP_API_HOST_H
+#define BSP_API_HOST_H
+
+#define BSP_API_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "fsp_common_api.h"
+#include "fsp_features.h"
+
+typedef int32_t IRQn_Type;
+
+#include "R7FA6M3AH.h"
+
+#define BSP_CFG_RTOS    (0)
+
+#define FSP_ERROR_LOG(err)
+#define FSP_ASSERT(a)    FSP_ERROR_RETURN((a), FSP_ERR_ASSERTION)
+#define FSP_ERROR_RETURN(a, err) \
+    {                            \
+        if ((a))                 \
+        {                        \
+            (void) 0;            \
+        }                        \
+        else                     \
+        {                        \
+            return err;          \
+        }                        \
+    }
+
+#define FSP_LOG_PRINT(X)
+#define FSP_CONTEXT_SAVE
+#define FSP_CONTEXT_RESTORE
+#define FSP_HARDWARE_REGISTER_WAIT(reg, required_value)
+#define FSP_CRITICAL_SECTION_DEFINE
+#define FSP_CRITICAL_SECTION_ENTER
+#define FSP_CRITICAL_SECTION_EXIT
+#define R_BSP_MODULE_START(ip, channel)
+
+typedef enum
+{
+    BSP_DELAY_UNITS_SECONDS      = 1000000,
+    BSP_DELAY_UNITS_MILLISECONDS = 1000,
+    BSP_DELAY_UNITS_MICROSECONDS = 1
+} bsp_delay_units_t;
+
+static inline void R_BSP_SoftwareDelay (uint32_t delay, bsp_delay_units_t units)
+{
+    FSP_PARAMETER_NOT_USED(delay);
+    FSP_PARAMETER_NOT_USED(units);
+}
+
+static inline IRQn_Type R_FSP_CurrentIrqGet (void)
+{
+    return 0;
+}
+
+static inline void * R_FSP_IsrContextGet (IRQn_Type const irq)
+{
+    FSP_PARAMETER_NOT_USED(irq);
+
+    return NULL;
+}
+
+static inline void R_BSP_IrqCfgEnable (IRQn_Type const irq, uint32_t priority, void * p_context)
+{
+    FSP_PARAMETER_NOT_USED(irq);
+    FSP_PARAMETER_NOT_USED(priority);
+    FSP_PARAMETER_NOT_USED(p_context);
+}
+
+static inline void R_BSP_IrqEnable (IRQn_Type const irq)
+{
+    FSP_PARAMETER_NOT_USED(irq);
+}
+
+static inline void R_BSP_IrqDisable (IRQn_Type const irq)
+{
+    FSP_PARAMETER_NOT_USED(irq);
+}
+
+static inline void R_BSP_IrqStatusClear (IRQn_Type irq)
+{
+    FSP_PARAMETER_NOT_USED(irq);
+}
+
+#endif
@@ -0,0 +1,367 @@
+/***********************************************************************************************************************
+ * Copyright [2020-2024] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/* Host test for the offset calculation and software clock servo of r_ptp. A simulated master and slave clock exchange
+ * Sync and Delay_req timestamps over a path with a fixed delay and a small deterministic jitter. The slave clock has a
+ * frequency error and applies the servo output the way the driver does on hardware: steps are subtracted from the
+ * clock and the frequency adjustment changes its rate continuously between samples. */
+
+/***********************************************************************************************************************
+ * Includes   <System Includes> , "Project Includes"
+ **********************************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "r_ptp.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define TEST_NANOSECONDS_IN_SECOND    (1000000000LL)
+#define TEST_EPOCH                    (1700000000LL * TEST_NANOSECONDS_IN_SECOND)
+#define TEST_SYNC_INTERVAL            (125000000LL)  // Sync interval of the master (2^-3 seconds) in nanoseconds
+#define TEST_DELAY_REQ_OFFSET         (1000000LL)    // Time from Sync reception to Delay_req transmission in nanoseconds
+#define TEST_PATH_DELAY               (1500LL)       // One way path delay in nanoseconds
+#define TEST_JITTER                   (16)           // Peak timestamp jitter in nanoseconds
+#define TEST_DRIFT                    (40000)        // Frequency error of the slave clock in ppb
+#define TEST_INITIAL_OFFSET           (250000.0)     // Initial offset of the slave clock in nanoseconds
+#define TEST_LOCK_SAMPLES             (400U)
+
+#define TEST_CHECK(a)                                                    \
+    {                                                                    \
+        if (!(a))                                                        \
+        {                                                                \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #a); \
+            g_test_failures++;                                           \
+        }                                                                \
+    }
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/* Simulated slave clock and the path to the master. */
+typedef struct st_test_clock
+{
+    int64_t  master_time;              // Master time of the next Sync transmission in nanoseconds
+    double   offset;                   // Slave clock minus master clock in nanoseconds
+    int32_t  frequency;                // Frequency adjustment applied to the slave clock in ppb
+    int64_t  extra_delay_ms;           // Additional master to slave delay in nanoseconds (Queuing in a switch)
+    int64_t  extra_delay_sm;           // Additional slave to master delay in nanoseconds
+    uint32_t seed;                     // Jitter generator state
+} test_clock_t;
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static void    test_time_set(ptp_time_t * p_time, int64_t nanoseconds);
+static int64_t test_jitter(test_clock_t * p_clock);
+static void    test_clock_init(test_clock_t * p_clock);
+static void    test_clock_advance(test_clock_t * p_clock, int64_t interval);
+static void    test_sample(test_clock_t * p_clock, int64_t * p_offset, int64_t * p_delay);
+static void    test_servo_apply(test_clock_t * p_clock, ptp_servo_output_t const * p_output);
+static void    test_servo_run(ptp_servo_t * p_servo, test_clock_t * p_clock, uint32_t samples);
+static void    test_offset_calculate(void);
+static void    test_servo_not_initialized(void);
+static void    test_servo_lock(void);
+static void    test_servo_delay_outlier(void);
+static void    test_servo_step_threshold(void);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+static uint32_t g_test_failures;
+
+static const ptp_servo_cfg_t g_servo_cfg =
+{
+    .kp                      = 4 * 65536,
+    .ki                      = 65536 / 2,
+    .max_frequency           = 200000,
+    .step_threshold          = 1000000,
+    .lock_threshold          = 100,
+    .lock_count              = 8,
+    .offset_filter_shift     = 1,
+    .delay_filter_shift      = 4,
+    .delay_outlier_threshold = 5000,
+};
+
+/***********************************************************************************************************************
+ * Global variables
+ **********************************************************************************************************************/
+uint32_t SystemCoreClock = 120000000U;
+
+/***********************************************************************************************************************
+ * Private functions
+ **********************************************************************************************************************/
+
+static void test_time_set (ptp_time_t * p_time, int64_t nanoseconds)
+{
+    uint64_t seconds = (uint64_t) (nanoseconds / TEST_NANOSECONDS_IN_SECOND);
+
+    p_time->seconds_upper = (uint16_t) (seconds >> 32U);
+    p_time->seconds_lower = (uint32_t) seconds;
+    p_time->nanoseconds   = (uint32_t) (nanoseconds % TEST_NANOSECONDS_IN_SECOND);
+}
+
+/* Uniformly distributed jitter in [-TEST_JITTER, TEST_JITTER] from a linear congruential generator. */
+static int64_t test_jitter (test_clock_t * p_clock)
+{
+    p_clock->seed = (p_clock->seed * 1664525U) + 1013904223U;
+
+    return (int64_t) ((p_clock->seed >> 16U) % (2U * TEST_JITTER + 1U)) - TEST_JITTER;
+}
+
+static void test_clock_init (test_clock_t * p_clock)
+{
+    memset(p_clock, 0, sizeof(test_clock_t));
+    p_clock->master_time = TEST_EPOCH;
+    p_clock->offset      = TEST_INITIAL_OFFSET;
+    p_clock->seed        = 1U;
+}
+
+/* Advance master time and let the slave clock run at its own rate. */
+static void test_clock_advance (test_clock_t * p_clock, int64_t interval)
+{
+    p_clock->offset      += (double) (TEST_DRIFT + p_clock->frequency) * (double) interval / 1e9;
+    p_clock->master_time += interval;
+}
+
+/* Simulate one Sync / Delay_req exchange and calculate offsetFromMaster and meanPathDelay from the timestamps. */
+static void test_sample (test_clock_t * p_clock, int64_t * p_offset, int64_t * p_delay)
+{
+    ptp_time_t t1;
+    ptp_time_t t2;
+    ptp_time_t t3;
+    ptp_time_t t4;
+
+    int64_t delay_ms = TEST_PATH_DELAY + p_clock->extra_delay_ms;
+    int64_t delay_sm = TEST_PATH_DELAY + p_clock->extra_delay_sm;
+
+    /* Sync: t1 is taken by the master, t2 by the slave clock. */
+    int64_t master = p_clock->master_time;
+    test_time_set(&t1, master);
+    test_clock_advance(p_clock, delay_ms);
+    test_time_set(&t2, p_clock->master_time + (int64_t) p_clock->offset + test_jitter(p_clock));
+
+    /* Delay_req: t3 is taken by the slave clock, t4 by the master. */
+    test_clock_advance(p_clock, TEST_DELAY_REQ_OFFSET);
+    test_time_set(&t3, p_clock->master_time + (int64_t) p_clock->offset + test_jitter(p_clock));
+    test_clock_advance(p_clock, delay_sm);
+    test_time_set(&t4, p_clock->master_time + test_jitter(p_clock));
+
+    TEST_CHECK(FSP_SUCCESS == R_PTP_OffsetCalculate(&t1, &t2, &t3, &t4, p_offset, p_delay));
+
+    /* Continue with the next Sync. */
+    test_clock_advance(p_clock, master + TEST_SYNC_INTERVAL - p_clock->master_time);
+}
+
+static void test_servo_apply (test_clock_t * p_clock, ptp_servo_output_t const * p_output)
+{
+    if (PTP_SERVO_ACTION_STEP == p_output->action)
+    {
+        p_clock->offset -= (double) p_output->step;
+    }
+    else if (PTP_SERVO_ACTION_ADJUST == p_output->action)
+    {
+        p_clock->frequency = p_output->frequency;
+    }
+    else
+    {
+        /* Rejected samples keep the previous frequency adjustment. */
+    }
+}
+
+static void test_servo_run (ptp_servo_t * p_servo, test_clock_t * p_clock, uint32_t samples)
+{
+    for (uint32_t i = 0U; i < samples; i++)
+    {
+        int64_t            offset;
+        int64_t            delay;
+        ptp_servo_output_t output;
+
+        test_sample(p_clock, &offset, &delay);
+        TEST_CHECK(FSP_SUCCESS == R_PTP_ServoUpdate(p_servo, offset, delay, &output));
+        test_servo_apply(p_clock, &output);
+    }
+}
+
+/* The offset and delay are recovered exactly from timestamps that straddle a second boundary. */
+static void test_offset_calculate (void)
+{
+    ptp_time_t t1;
+    ptp_time_t t2;
+    ptp_time_t t3;
+    ptp_time_t t4;
+    int64_t    offset = 0;
+    int64_t    delay  = 0;
+
+    int64_t master = TEST_EPOCH + TEST_NANOSECONDS_IN_SECOND - 1000LL;
+    test_time_set(&t1, master);
+    test_time_set(&t2, master + TEST_PATH_DELAY - 250LL);
+    test_time_set(&t3, master + TEST_PATH_DELAY - 250LL + TEST_DELAY_REQ_OFFSET);
+    test_time_set(&t4, master + TEST_PATH_DELAY + TEST_DELAY_REQ_OFFSET + TEST_PATH_DELAY);
+
+    TEST_CHECK(FSP_SUCCESS == R_PTP_OffsetCalculate(&t1, &t2, &t3, &t4, &offset, &delay));
+    TEST_CHECK(-250 == offset);
+    TEST_CHECK(TEST_PATH_DELAY == delay);
+
+    TEST_CHECK(FSP_ERR_ASSERTION == R_PTP_OffsetCalculate(&t1, &t2, &t3, NULL, &offset, &delay));
+}
+
+static void test_servo_not_initialized (void)
+{
+    ptp_servo_t        servo;
+    ptp_servo_output_t output;
+
+    memset(&servo, 0, sizeof(servo));
+    TEST_CHECK(FSP_ERR_NOT_INITIALIZED == R_PTP_ServoUpdate(&servo, 0, 0, &output));
+}
+
+/* The first sample steps the clock, after which the frequency error is removed and the servo locks. */
+static void test_servo_lock (void)
+{
+    ptp_servo_t        servo;
+    test_clock_t       clock;
+    ptp_servo_output_t output;
+    int64_t            offset;
+    int64_t            delay;
+
+    test_clock_init(&clock);
+    TEST_CHECK(FSP_SUCCESS == R_PTP_ServoInit(&servo, &g_servo_cfg));
+
+    test_sample(&clock, &offset, &delay);
+    TEST_CHECK(FSP_SUCCESS == R_PTP_ServoUpdate(&servo, offset, delay, &output));
+    TEST_CHECK(PTP_SERVO_ACTION_STEP == output.action);
+    TEST_CHECK(PTP_SERVO_STATE_LOCKING == output.p_stats->state);
+    test_servo_apply(&clock, &output);
+
+    /* Only the drift until the next Sync remains after the step. */
+    TEST_CHECK(clock.offset < 100.0 + (double) TEST_DRIFT * TEST_SYNC_INTERVAL / 1e9);
+    TEST_CHECK(clock.offset > -100.0);
+
+    test_servo_run(&servo, &clock, TEST_LOCK_SAMPLES);
+
+    TEST_CHECK(PTP_SERVO_STATE_LOCKED == servo.stats.state);
+    TEST_CHECK(1U == servo.stats.steps);
+    TEST_CHECK(0U == servo.stats.rejected);
+    TEST_CHECK(TEST_LOCK_SAMPLES + 1U == servo.stats.samples);
+    TEST_CHECK(clock.offset < 50.0 && clock.offset > -50.0);
+    TEST_CHECK(clock.frequency < -TEST_DRIFT + 100 && clock.frequency > -TEST_DRIFT - 100);
+    TEST_CHECK(servo.stats.delay_filtered < TEST_PATH_DELAY + TEST_JITTER);
+    TEST_CHECK(servo.stats.delay_filtered > TEST_PATH_DELAY - TEST_JITTER);
+}
+
+/* Isolated meanPathDelay outliers are rejected; a permanent change reseeds the filter instead. */
+static void test_servo_delay_outlier (void)
+{
+    ptp_servo_t        servo;
+    test_clock_t       clock;
+    ptp_servo_output_t output;
+    int64_t            offset;
+    int64_t            delay;
+
+    test_clock_init(&clock);
+    TEST_CHECK(FSP_SUCCESS == R_PTP_ServoInit(&servo, &g_servo_cfg));
+    test_servo_run(&servo, &clock, TEST_LOCK_SAMPLES);
+    TEST_CHECK(PTP_SERVO_STATE_LOCKED == servo.stats.state);
+
+    /* A Sync message queued behind other traffic looks like a large offset and must not disturb the clock. */
+    int32_t frequency = clock.frequency;
+    clock.extra_delay_ms = 20000;
+    test_sample(&clock, &offset, &delay);
+    TEST_CHECK(FSP_SUCCESS == R_PTP_ServoUpdate(&servo, offset, delay, &output));
+    TEST_CHECK(PTP_SERVO_ACTION_NONE == output.action);
+    TEST_CHECK(frequency == output.frequency);
+    TEST_CHECK(1U == servo.stats.rejected);
+    TEST_CHECK(PTP_SERVO_STATE_LOCKED == servo.stats.state);
+    test_servo_apply(&clock, &output);
+
+    clock.extra_delay_ms = 0;
+    test_servo_run(&servo, &clock, 1U);
+    TEST_CHECK(1U == servo.stats.rejected);
+
+    /* A longer path is accepted after three rejected samples. */
+    clock.extra_delay_ms = 10000;
+    clock.extra_delay_sm = 10000;
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+        test_sample(&clock, &offset, &delay);
+        TEST_CHECK(FSP_SUCCESS == R_PTP_ServoUpdate(&servo, offset, delay, &output));
+        TEST_CHECK((i < 3U) == (PTP_SERVO_ACTION_NONE == output.action));
+        test_servo_apply(&clock, &output);
+    }
+
+    TEST_CHECK(4U == servo.stats.rejected);
+    TEST_CHECK(servo.stats.delay_filtered > TEST_PATH_DELAY + 10000 - 2 * TEST_JITTER);
+
+    test_servo_run(&servo, &clock, TEST_LOCK_SAMPLES / 4U);
+    TEST_CHECK(4U == servo.stats.rejected);
+    TEST_CHECK(PTP_SERVO_STATE_LOCKED == servo.stats.state);
+    TEST_CHECK(clock.offset < 50.0 && clock.offset > -50.0);
+}
+
+/* A master clock jump larger than the step threshold steps the clock again. */
+static void test_servo_step_threshold (void)
+{
+    ptp_servo_t        servo;
+    test_clock_t       clock;
+    ptp_servo_output_t output;
+    int64_t            offset;
+    int64_t            delay;
+
+    test_clock_init(&clock);
+    TEST_CHECK(FSP_SUCCESS == R_PTP_ServoInit(&servo, &g_servo_cfg));
+    test_servo_run(&servo, &clock, TEST_LOCK_SAMPLES);
+
+    clock.offset += 2000000.0;
+    test_sample(&clock, &offset, &delay);
+    TEST_CHECK(FSP_SUCCESS == R_PTP_ServoUpdate(&servo, offset, delay, &output));
+    TEST_CHECK(PTP_SERVO_ACTION_STEP == output.action);
+    TEST_CHECK(output.step > 2000000 - 100 && output.step < 2000000 + 100);
+    TEST_CHECK(2U == servo.stats.steps);
+    TEST_CHECK(PTP_SERVO_STATE_LOCKING == servo.stats.state);
+    test_servo_apply(&clock, &output);
+
+    /* The frequency estimate survives the step so the servo relocks quickly. */
+    test_servo_run(&servo, &clock, TEST_LOCK_SAMPLES / 8U);
+    TEST_CHECK(PTP_SERVO_STATE_LOCKED == servo.stats.state);
+    TEST_CHECK(clock.offset < 50.0 && clock.offset > -50.0);
+}
+
+int main (void)
+{
+    test_offset_calculate();
+    test_servo_not_initialized();
+    test_servo_lock();
+    test_servo_delay_outlier();
+    test_servo_step_threshold();
+
+    if (0U != g_test_failures)
+    {
+        printf("%u check(s) failed\n", (unsigned) g_test_failures);
+
+        return EXIT_FAILURE;
+    }
+
+    printf("All r_ptp servo tests passed\n");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,88 @@
+/***********************************************************************************************************************
+ * Copyright [2020-2024] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/* Minimal FreeRTOS+FAT definitions used by the port layer. The test calls the sector read and write hooks directly,
+ * so no FAT file system is built. */
+
+#ifndef FF_HEADERS_H
+#define FF_HEADERS_H
+
+#include <stdint.h>
+
+typedef long    BaseType_t;
+typedef int32_t FF_Error_t;
+
+#define FF_ERR_NONE                        (0)
+#define FF_ERRFLAG                         (0x80000000)
+#define FF_ERR_IOMAN_DRIVER_FATAL_ERROR    (0x0F)
+
+#define FF_T_FAT12                         (0x0A)
+#define FF_T_FAT16                         (0x0B)
+#define FF_T_FAT32                         (0x0C)
+
+typedef struct
+{
+    uint8_t  ucType;
+    uint32_t ulFreeClusterCount;
+    uint32_t ulSectorsPerCluster;
+    uint32_t ulTotalSectors;
+    char     pcVolumeLabel[12];
+} FF_Partition_t;
+
+typedef struct
+{
+    FF_Partition_t xPartition;
+    uint16_t       usSectorSize;
+} FF_IOManager_t;
+
+typedef struct xFFDisk
+{
+    FF_IOManager_t * pxIOManager;
+    void           * pvTag;
+    uint32_t         ulNumberOfSectors;
+    struct
+    {
+        uint32_t bIsInitialised   : 1;
+        uint32_t bPartitionNumber : 8;
+    } xStatus;
+} FF_Disk_t;
+
+typedef int32_t (* FF_WriteBlocks_t)(uint8_t * pucBuffer, uint32_t ulSectorAddress, uint32_t ulCount,
+                                     FF_Disk_t * pxDisk);
+typedef int32_t (* FF_ReadBlocks_t)(uint8_t * pucBuffer, uint32_t ulSectorAddress, uint32_t ulCount,
+                                    FF_Disk_t * pxDisk);
+
+typedef struct
+{
+    uint8_t        * pucCacheMemory;
+    uint32_t         ulMemorySize;
+    BaseType_t       ulSectorSize;
+    FF_WriteBlocks_t fnWriteBlocks;
+    FF_ReadBlocks_t  fnReadBlocks;
+    FF_Disk_t      * pxDisk;
+    BaseType_t       xBlockDeviceIsReentrant;
+    void           * pvSemaphore;
+} FF_CreationParameters_t;
+
+FF_IOManager_t * FF_CreateIOManger(FF_CreationParameters_t * pxParameters, FF_Error_t * pError);
+FF_Error_t       FF_DeleteIOManager(FF_IOManager_t * pxIOManager);
+uint64_t         FF_GetFreeSize(FF_IOManager_t * pxIOManager, FF_Error_t * pxError);
+
+#endif
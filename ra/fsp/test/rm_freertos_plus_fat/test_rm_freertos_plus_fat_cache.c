@@ -0,0 +1,534 @@
+/***********************************************************************************************************************
+ * Copyright [2020-2024] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/* Host test for the port layer sector cache and read-ahead of rm_freertos_plus_fat. The block media driver is replaced
+ * by a RAM disk that completes every request immediately and counts the requests it receives, so the tests can check
+ * both the data seen by FreeRTOS+FAT and the number of media operations needed to produce it. */
+
+/***********************************************************************************************************************
+ * Includes   <System Includes> , "Project Includes"
+ **********************************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "rm_freertos_plus_fat.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define TEST_SECTOR_SIZE          (512U)
+#define TEST_NUM_SECTORS          (128U)
+#define TEST_CACHE_SECTORS        (8U)
+#define TEST_READ_AHEAD_SECTORS   (4U)
+
+#define TEST_CHECK(a)                                                    \
+    {                                                                    \
+        if (!(a))                                                        \
+        {                                                                \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #a); \
+            g_test_failures++;                                           \
+        }                                                                \
+    }
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/* RAM block media stand-in. */
+typedef struct st_test_ram_media
+{
+    uint8_t                      data[TEST_NUM_SECTORS * TEST_SECTOR_SIZE];
+    rm_block_media_cfg_t const * p_cfg;
+    uint32_t reads;                    // Read requests received
+    uint32_t writes;                   // Write requests received
+    uint32_t sectors_read;             // Sectors transferred by read requests
+    uint32_t sectors_written;          // Sectors transferred by write requests
+    bool     write_fail;               // Fail write requests while set
+} test_ram_media_t;
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static fsp_err_t test_ram_media_open(rm_block_media_ctrl_t * const p_ctrl, rm_block_media_cfg_t const * const p_cfg);
+static fsp_err_t test_ram_media_init(rm_block_media_ctrl_t * const p_ctrl);
+static fsp_err_t test_ram_media_read(rm_block_media_ctrl_t * const p_ctrl,
+                                     uint8_t * const               p_dest_address,
+                                     uint32_t const                block_address,
+                                     uint32_t const                num_blocks);
+static fsp_err_t test_ram_media_write(rm_block_media_ctrl_t * const p_ctrl,
+                                      uint8_t const * const         p_src_address,
+                                      uint32_t const                block_address,
+                                      uint32_t const                num_blocks);
+static fsp_err_t test_ram_media_status_get(rm_block_media_ctrl_t * const   p_ctrl,
+                                           rm_block_media_status_t * const p_status);
+static fsp_err_t test_ram_media_info_get(rm_block_media_ctrl_t * const p_ctrl, rm_block_media_info_t * const p_info);
+static fsp_err_t test_ram_media_close(rm_block_media_ctrl_t * const p_ctrl);
+static void      test_ram_media_complete(test_ram_media_t * p_media);
+static void      test_ram_media_reset_counts(void);
+static void      test_open(void const * p_extend);
+static void      test_close(void);
+static void      test_sector_fill(uint8_t * p_buffer, uint32_t sector, uint8_t seed);
+static bool      test_sector_check(uint8_t const * p_buffer, uint32_t sector, uint8_t seed);
+static void      test_uncached(void);
+static void      test_write_back(void);
+static void      test_read_ahead(void);
+static void      test_read_after_write(void);
+static void      test_write_back_error(void);
+
+void rm_freertos_plus_fat_memory_callback(rm_block_media_callback_args_t * p_args);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+static uint32_t g_test_failures;
+
+static test_ram_media_t g_ram_media;
+
+static const rm_block_media_api_t g_ram_media_api =
+{
+    .open      = test_ram_media_open,
+    .mediaInit = test_ram_media_init,
+    .read      = test_ram_media_read,
+    .write     = test_ram_media_write,
+    .statusGet = test_ram_media_status_get,
+    .infoGet   = test_ram_media_info_get,
+    .close     = test_ram_media_close,
+};
+
+static rm_freertos_plus_fat_instance_ctrl_t g_fat_ctrl;
+
+static const rm_block_media_cfg_t g_ram_media_cfg =
+{
+    .p_callback = rm_freertos_plus_fat_memory_callback,
+    .p_context  = &g_fat_ctrl,
+    .p_extend   = NULL,
+};
+
+static const rm_block_media_instance_t g_ram_media_instance =
+{
+    .p_ctrl = &g_ram_media,
+    .p_cfg  = &g_ram_media_cfg,
+    .p_api  = &g_ram_media_api,
+};
+
+static uint8_t                            g_cache[TEST_CACHE_SECTORS * TEST_SECTOR_SIZE];
+static rm_freertos_plus_fat_cache_entry_t g_cache_entries[TEST_CACHE_SECTORS];
+static uint8_t                            g_read_ahead_buffer[TEST_READ_AHEAD_SECTORS * TEST_SECTOR_SIZE];
+
+static const rm_freertos_plus_fat_extended_cfg_t g_fat_extend =
+{
+    .p_cache             = g_cache,
+    .p_cache_entries     = g_cache_entries,
+    .num_cache_sectors   = TEST_CACHE_SECTORS,
+    .p_read_ahead_buffer = g_read_ahead_buffer,
+    .read_ahead_sectors  = TEST_READ_AHEAD_SECTORS,
+};
+
+static rm_freertos_plus_fat_cfg_t g_fat_cfg =
+{
+    .p_block_media   = &g_ram_media_instance,
+    .p_callback      = NULL,
+    .p_context       = NULL,
+    .p_busy_callback = NULL,
+    .p_busy_context  = NULL,
+    .p_extend        = NULL,
+};
+
+static uint8_t        g_fat_cache[2U * TEST_SECTOR_SIZE];
+static FF_IOManager_t g_io_manager;
+static FF_Disk_t      g_disk;
+
+static const rm_freertos_plus_fat_disk_cfg_t g_disk_cfg =
+{
+    .device           =
+    {
+        .sector_count      = TEST_NUM_SECTORS,
+        .sector_size_bytes = TEST_SECTOR_SIZE,
+    },
+    .p_cache          = g_fat_cache,
+    .cache_size_bytes = sizeof(g_fat_cache),
+    .partition_number = 0,
+};
+
+/* Set by FF_CreateIOManger, these are the hooks FreeRTOS+FAT would call. */
+static FF_ReadBlocks_t  g_read_blocks;
+static FF_WriteBlocks_t g_write_blocks;
+
+/***********************************************************************************************************************
+ * FreeRTOS+FAT stand-ins
+ **********************************************************************************************************************/
+FF_IOManager_t * FF_CreateIOManger (FF_CreationParameters_t * pxParameters, FF_Error_t * pError)
+{
+    g_read_blocks  = pxParameters->fnReadBlocks;
+    g_write_blocks = pxParameters->fnWriteBlocks;
+    *pError        = FF_ERR_NONE;
+
+    return &g_io_manager;
+}
+
+FF_Error_t FF_DeleteIOManager (FF_IOManager_t * pxIOManager)
+{
+    FSP_PARAMETER_NOT_USED(pxIOManager);
+
+    return FF_ERR_NONE;
+}
+
+uint64_t FF_GetFreeSize (FF_IOManager_t * pxIOManager, FF_Error_t * pxError)
+{
+    FSP_PARAMETER_NOT_USED(pxIOManager);
+    *pxError = FF_ERR_NONE;
+
+    return 0U;
+}
+
+/***********************************************************************************************************************
+ * RAM block media
+ **********************************************************************************************************************/
+static fsp_err_t test_ram_media_open (rm_block_media_ctrl_t * const p_ctrl, rm_block_media_cfg_t const * const p_cfg)
+{
+    ((test_ram_media_t *) p_ctrl)->p_cfg = p_cfg;
+
+    return FSP_SUCCESS;
+}
+
+static fsp_err_t test_ram_media_init (rm_block_media_ctrl_t * const p_ctrl)
+{
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+
+    return FSP_SUCCESS;
+}
+
+static fsp_err_t test_ram_media_read (rm_block_media_ctrl_t * const p_ctrl,
+                                      uint8_t * const               p_dest_address,
+                                      uint32_t const                block_address,
+                                      uint32_t const                num_blocks)
+{
+    test_ram_media_t * p_media = (test_ram_media_t *) p_ctrl;
+
+    FSP_ERROR_RETURN((block_address + num_blocks) <= TEST_NUM_SECTORS, FSP_ERR_INVALID_ARGUMENT);
+
+    memcpy(p_dest_address, &p_media->data[block_address * TEST_SECTOR_SIZE], num_blocks * TEST_SECTOR_SIZE);
+    p_media->reads++;
+    p_media->sectors_read += num_blocks;
+    test_ram_media_complete(p_media);
+
+    return FSP_SUCCESS;
+}
+
+static fsp_err_t test_ram_media_write (rm_block_media_ctrl_t * const p_ctrl,
+                                       uint8_t const * const         p_src_address,
+                                       uint32_t const                block_address,
+                                       uint32_t const                num_blocks)
+{
+    test_ram_media_t * p_media = (test_ram_media_t *) p_ctrl;
+
+    FSP_ERROR_RETURN((block_address + num_blocks) <= TEST_NUM_SECTORS, FSP_ERR_INVALID_ARGUMENT);
+    FSP_ERROR_RETURN(!p_media->write_fail, FSP_ERR_WRITE_FAILED);
+
+    memcpy(&p_media->data[block_address * TEST_SECTOR_SIZE], p_src_address, num_blocks * TEST_SECTOR_SIZE);
+    p_media->writes++;
+    p_media->sectors_written += num_blocks;
+    test_ram_media_complete(p_media);
+
+    return FSP_SUCCESS;
+}
+
+static fsp_err_t test_ram_media_status_get (rm_block_media_ctrl_t * const   p_ctrl,
+                                            rm_block_media_status_t * const p_status)
+{
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+    p_status->initialized    = true;
+    p_status->busy           = false;
+    p_status->media_inserted = true;
+
+    return FSP_SUCCESS;
+}
+
+static fsp_err_t test_ram_media_info_get (rm_block_media_ctrl_t * const p_ctrl, rm_block_media_info_t * const p_info)
+{
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+    p_info->sector_size_bytes = TEST_SECTOR_SIZE;
+    p_info->num_sectors       = TEST_NUM_SECTORS;
+    p_info->reentrant         = false;
+    p_info->write_protected   = false;
+
+    return FSP_SUCCESS;
+}
+
+static fsp_err_t test_ram_media_close (rm_block_media_ctrl_t * const p_ctrl)
+{
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+
+    return FSP_SUCCESS;
+}
+
+/* Reports completion the way a block media driver does from its transfer complete interrupt. */
+static void test_ram_media_complete (test_ram_media_t * p_media)
+{
+    rm_block_media_callback_args_t args;
+    args.event     = RM_BLOCK_MEDIA_EVENT_OPERATION_COMPLETE;
+    args.p_context = p_media->p_cfg->p_context;
+    p_media->p_cfg->p_callback(&args);
+}
+
+static void test_ram_media_reset_counts (void)
+{
+    g_ram_media.reads           = 0U;
+    g_ram_media.writes          = 0U;
+    g_ram_media.sectors_read    = 0U;
+    g_ram_media.sectors_written = 0U;
+}
+
+/***********************************************************************************************************************
+ * Helpers
+ **********************************************************************************************************************/
+static void test_open (void const * p_extend)
+{
+    memset(&g_fat_ctrl, 0, sizeof(g_fat_ctrl));
+    memset(g_ram_media.data, 0, sizeof(g_ram_media.data));
+    g_fat_cfg.p_extend = p_extend;
+
+    TEST_CHECK(FSP_SUCCESS == RM_FREERTOS_PLUS_FAT_Open(&g_fat_ctrl, &g_fat_cfg));
+    TEST_CHECK(FSP_SUCCESS == RM_FREERTOS_PLUS_FAT_MediaInit(&g_fat_ctrl, NULL));
+    TEST_CHECK(FSP_SUCCESS == RM_FREERTOS_PLUS_FAT_DiskInit(&g_fat_ctrl, &g_disk_cfg, &g_disk));
+
+    test_ram_media_reset_counts();
+}
+
+static void test_close (void)
+{
+    TEST_CHECK(FSP_SUCCESS == RM_FREERTOS_PLUS_FAT_DiskDeinit(&g_fat_ctrl, &g_disk));
+    TEST_CHECK(FSP_SUCCESS == RM_FREERTOS_PLUS_FAT_Close(&g_fat_ctrl));
+}
+
+/* Fills a sector with a pattern that identifies the sector and the write that produced it. */
+static void test_sector_fill (uint8_t * p_buffer, uint32_t sector, uint8_t seed)
+{
+    for (uint32_t i = 0U; i < TEST_SECTOR_SIZE; i++)
+    {
+        p_buffer[i] = (uint8_t) (sector + i + seed);
+    }
+}
+
+static bool test_sector_check (uint8_t const * p_buffer, uint32_t sector, uint8_t seed)
+{
+    uint8_t expected[TEST_SECTOR_SIZE];
+    test_sector_fill(expected, sector, seed);
+
+    return 0 == memcmp(p_buffer, expected, TEST_SECTOR_SIZE);
+}
+
+/***********************************************************************************************************************
+ * Tests
+ **********************************************************************************************************************/
+
+/* Without p_extend every sector request goes straight to the media. This is the baseline for the tests below. */
+static void test_uncached (void)
+{
+    uint8_t buffer[TEST_SECTOR_SIZE];
+
+    test_open(NULL);
+
+    for (uint32_t sector = 0U; sector < 16U; sector++)
+    {
+        test_sector_fill(buffer, sector, 1U);
+        TEST_CHECK(FF_ERR_NONE == g_write_blocks(buffer, sector, 1U, &g_disk));
+    }
+
+    for (uint32_t sector = 0U; sector < 16U; sector++)
+    {
+        TEST_CHECK(FF_ERR_NONE == g_read_blocks(buffer, sector, 1U, &g_disk));
+        TEST_CHECK(test_sector_check(buffer, sector, 1U));
+    }
+
+    TEST_CHECK(16U == g_ram_media.writes);
+    TEST_CHECK(16U == g_ram_media.reads);
+
+    test_close();
+}
+
+/* Sequential single sector writes are collected in the cache and written back with one multi-sector write. */
+static void test_write_back (void)
+{
+    uint8_t buffer[TEST_SECTOR_SIZE];
+
+    test_open(&g_fat_extend);
+
+    for (uint32_t sector = 32U; sector < (32U + TEST_CACHE_SECTORS); sector++)
+    {
+        test_sector_fill(buffer, sector, 2U);
+        TEST_CHECK(FF_ERR_NONE == g_write_blocks(buffer, sector, 1U, &g_disk));
+    }
+
+    /* Nothing reaches the media until the cache is flushed. */
+    TEST_CHECK(0U == g_ram_media.writes);
+
+    TEST_CHECK(FSP_SUCCESS == RM_FREERTOS_PLUS_FAT_CacheFlush(&g_fat_ctrl));
+    TEST_CHECK(1U == g_ram_media.writes);
+    TEST_CHECK(TEST_CACHE_SECTORS == g_ram_media.sectors_written);
+
+    for (uint32_t sector = 32U; sector < (32U + TEST_CACHE_SECTORS); sector++)
+    {
+        TEST_CHECK(test_sector_check(&g_ram_media.data[sector * TEST_SECTOR_SIZE], sector, 2U));
+    }
+
+    /* A flush with nothing dirty does not touch the media. */
+    TEST_CHECK(FSP_SUCCESS == RM_FREERTOS_PLUS_FAT_CacheFlush(&g_fat_ctrl));
+    TEST_CHECK(1U == g_ram_media.writes);
+
+    /* Writing one more sector than the cache holds evicts the dirty entries in one request. */
+    test_ram_media_reset_counts();
+    for (uint32_t sector = 64U; sector <= (64U + TEST_CACHE_SECTORS); sector++)
+    {
+        test_sector_fill(buffer, sector, 3U);
+        TEST_CHECK(FF_ERR_NONE == g_write_blocks(buffer, sector, 1U, &g_disk));
+    }
+
+    TEST_CHECK(1U == g_ram_media.writes);
+
+    /* Close writes back the remaining sector. */
+    test_close();
+    TEST_CHECK(2U == g_ram_media.writes);
+    TEST_CHECK((TEST_CACHE_SECTORS + 1U) == g_ram_media.sectors_written);
+
+    for (uint32_t sector = 64U; sector <= (64U + TEST_CACHE_SECTORS); sector++)
+    {
+        TEST_CHECK(test_sector_check(&g_ram_media.data[sector * TEST_SECTOR_SIZE], sector, 3U));
+    }
+}
+
+/* Sequential single sector reads are served from read-ahead windows of TEST_READ_AHEAD_SECTORS sectors. */
+static void test_read_ahead (void)
+{
+    uint8_t buffer[TEST_SECTOR_SIZE];
+
+    test_open(&g_fat_extend);
+
+    for (uint32_t sector = 0U; sector < TEST_NUM_SECTORS; sector++)
+    {
+        test_sector_fill(&g_ram_media.data[sector * TEST_SECTOR_SIZE], sector, 4U);
+    }
+
+    for (uint32_t sector = 16U; sector < 32U; sector++)
+    {
+        TEST_CHECK(FF_ERR_NONE == g_read_blocks(buffer, sector, 1U, &g_disk));
+        TEST_CHECK(test_sector_check(buffer, sector, 4U));
+    }
+
+    /* Sectors 16 and 17 are read directly, the second read is detected as sequential and starts the read-ahead. The
+     * remaining 14 sectors come from read-ahead windows starting at 18, 22, 26 and 30. */
+    TEST_CHECK(6U == g_ram_media.reads);
+    TEST_CHECK(0U == g_ram_media.writes);
+
+    test_close();
+}
+
+/* Data written to the cache is returned by later reads, including reads of sectors in the read-ahead window. */
+static void test_read_after_write (void)
+{
+    uint8_t buffer[TEST_SECTOR_SIZE];
+
+    test_open(&g_fat_extend);
+
+    for (uint32_t sector = 0U; sector < TEST_NUM_SECTORS; sector++)
+    {
+        test_sector_fill(&g_ram_media.data[sector * TEST_SECTOR_SIZE], sector, 5U);
+    }
+
+    /* Start a read-ahead of sectors 82 to 85. */
+    TEST_CHECK(FF_ERR_NONE == g_read_blocks(buffer, 80U, 1U, &g_disk));
+    TEST_CHECK(FF_ERR_NONE == g_read_blocks(buffer, 81U, 1U, &g_disk));
+
+    /* Overwrite a sector inside the read-ahead window. The write stays in the cache. */
+    test_sector_fill(buffer, 83U, 6U);
+    TEST_CHECK(FF_ERR_NONE == g_write_blocks(buffer, 83U, 1U, &g_disk));
+    TEST_CHECK(0U == g_ram_media.writes);
+
+    for (uint32_t sector = 82U; sector < 86U; sector++)
+    {
+        TEST_CHECK(FF_ERR_NONE == g_read_blocks(buffer, sector, 1U, &g_disk));
+        TEST_CHECK(test_sector_check(buffer, sector, (83U == sector) ? 6U : 5U));
+    }
+
+    /* A cached sector is read without a media request. */
+    uint32_t reads = g_ram_media.reads;
+    TEST_CHECK(FF_ERR_NONE == g_read_blocks(buffer, 83U, 1U, &g_disk));
+    TEST_CHECK(test_sector_check(buffer, 83U, 6U));
+    TEST_CHECK(reads == g_ram_media.reads);
+
+    test_close();
+    TEST_CHECK(test_sector_check(&g_ram_media.data[83U * TEST_SECTOR_SIZE], 83U, 6U));
+}
+
+/* A dirty sector whose write back fails stays in the cache and is written by a later flush. */
+static void test_write_back_error (void)
+{
+    uint8_t buffer[TEST_SECTOR_SIZE];
+
+    test_open(&g_fat_extend);
+
+    for (uint32_t sector = 40U; sector < (40U + TEST_CACHE_SECTORS); sector++)
+    {
+        test_sector_fill(buffer, sector, 7U);
+        TEST_CHECK(FF_ERR_NONE == g_write_blocks(buffer, sector, 1U, &g_disk));
+    }
+
+    /* The cache is full of dirty sectors, so the next write has to evict one. */
+    g_ram_media.write_fail = true;
+    test_sector_fill(buffer, 100U, 7U);
+    TEST_CHECK(FF_ERR_NONE != g_write_blocks(buffer, 100U, 1U, &g_disk));
+    g_ram_media.write_fail = false;
+
+    /* None of the dirty sectors were dropped. The media still holds zeros, so the data can only come from the cache. */
+    for (uint32_t sector = 40U; sector < (40U + TEST_CACHE_SECTORS); sector++)
+    {
+        TEST_CHECK(FF_ERR_NONE == g_read_blocks(buffer, sector, 1U, &g_disk));
+        TEST_CHECK(test_sector_check(buffer, sector, 7U));
+    }
+
+    TEST_CHECK(FSP_SUCCESS == RM_FREERTOS_PLUS_FAT_CacheFlush(&g_fat_ctrl));
+    for (uint32_t sector = 40U; sector < (40U + TEST_CACHE_SECTORS); sector++)
+    {
+        TEST_CHECK(test_sector_check(&g_ram_media.data[sector * TEST_SECTOR_SIZE], sector, 7U));
+    }
+
+    test_close();
+}
+
+int main (void)
+{
+    test_uncached();
+    test_write_back();
+    test_read_ahead();
+    test_read_after_write();
+    test_write_back_error();
+
+    if (0U != g_test_failures)
+    {
+        printf("%u check(s) failed\n", (unsigned) g_test_failures);
+
+        return EXIT_FAILURE;
+    }
+
+    printf("All rm_freertos_plus_fat cache tests passed\n");
+
+    return EXIT_SUCCESS;
+}